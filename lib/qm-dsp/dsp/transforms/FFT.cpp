@@ -7,29 +7,51 @@
 */
 
 #include "FFT.h"
+#include "FFTRadix4.h"
 
 #include "maths/MathUtilities.h"
 
 #include "ext/kissfft/kiss_fft.h"
 #include "ext/kissfft/tools/kiss_fftr.h"
 
+#include <atomic>
 #include <cmath>
 
 #include <iostream>
 
 #include <stdexcept>
+#include <vector>
 
-class FFT::D
+namespace {
+
+std::atomic<int> s_backend(FFTBackendAuto);
+
+FFTBackend chooseBackend(bool radix4SupportsSize)
+{
+    switch (getFFTBackend()) {
+    case FFTBackendRadix4:
+        return radix4SupportsSize ? FFTBackendRadix4 : FFTBackendKissFFT;
+    case FFTBackendKissFFT:
+        return FFTBackendKissFFT;
+    default:
+        // The scalar fallback of the radix-4 backend is not faster
+        // than kissfft
+        return radix4SupportsSize && FFTRadix4::isVectorized() ?
+            FFTBackendRadix4 : FFTBackendKissFFT;
+    }
+}
+
+class KissFFT
 {
 public:
-    D(int n) : m_n(n) {
+    KissFFT(int n) : m_n(n) {
         m_planf = kiss_fft_alloc(m_n, 0, NULL, NULL);
         m_plani = kiss_fft_alloc(m_n, 1, NULL, NULL);
         m_kin = new kiss_fft_cpx[m_n];
         m_kout = new kiss_fft_cpx[m_n];
     }
 
-    ~D() {
+    ~KissFFT() {
         kiss_fft_free(m_planf);
         kiss_fft_free(m_plani);
         delete[] m_kin;
@@ -77,6 +99,84 @@ private:
     kiss_fft_cpx *m_kout;
 };        
 
+} // namespace
+
+void
+setFFTBackend(FFTBackend backend)
+{
+    s_backend = backend;
+}
+
+FFTBackend
+getFFTBackend()
+{
+    return FFTBackend(s_backend.load());
+}
+
+class FFT::D
+{
+public:
+    D(int n) :
+        m_n(n),
+        m_backend(chooseBackend(FFTRadix4::supportsSize(n))),
+        m_kiss(0),
+        m_radix4(0) {
+        if (m_backend == FFTBackendRadix4) {
+            m_radix4 = new FFTRadix4(n);
+            m_ri.resize(n);
+            m_ii.resize(n);
+        } else {
+            m_kiss = new KissFFT(n);
+        }
+    }
+
+    ~D() {
+        delete m_kiss;
+        delete m_radix4;
+    }
+
+    FFTBackend backend() const {
+        return m_backend;
+    }
+
+    void process(bool inverse,
+                 const double *ri,
+                 const double *ii,
+                 double *ro,
+                 double *io) {
+
+        if (m_kiss) {
+            m_kiss->process(inverse, ri, ii, ro, io);
+            return;
+        }
+
+        // FFTRadix4 reads from its input while writing to its
+        // output, unlike kissfft which works on its own copy
+        if (ri == ro || ri == io) {
+            m_ri.assign(ri, ri + m_n);
+            ri = &m_ri[0];
+        }
+        if (ii && (ii == ro || ii == io)) {
+            m_ii.assign(ii, ii + m_n);
+            ii = &m_ii[0];
+        }
+
+        if (!inverse) {
+            m_radix4->forward(ri, ii, ro, io);
+        } else {
+            m_radix4->inverse(ri, ii, ro, io);
+        }
+    }
+
+private:
+    int m_n;
+    FFTBackend m_backend;
+    KissFFT *m_kiss;
+    FFTRadix4 *m_radix4;
+    std::vector<double> m_ri;
+    std::vector<double> m_ii;
+};
+
 FFT::FFT(int n) :
     m_d(new D(n))
 {
@@ -96,33 +196,58 @@ FFT::process(bool inverse,
                  p_lpRealIn, p_lpImagIn,
                  p_lpRealOut, p_lpImagOut);
 }
+
+FFTBackend
+FFT::getBackend() const
+{
+    return m_d->backend();
+}
     
 class FFTReal::D
 {
 public:
-    D(int n) : m_n(n) {
+    D(int n) :
+        m_n(n),
+        m_backend(chooseBackend(FFTRadix4Real::supportsSize(n))),
+        m_radix4(0) {
         if (n % 2) {
             throw std::invalid_argument
                 ("nsamples must be even in FFTReal constructor");
         }
+        if (m_backend == FFTBackendRadix4) {
+            m_radix4 = new FFTRadix4Real(n);
+            m_planf = 0;
+            m_plani = 0;
+            m_c = 0;
+            return;
+        }
         m_planf = kiss_fftr_alloc(m_n, 0, NULL, NULL);
         m_plani = kiss_fftr_alloc(m_n, 1, NULL, NULL);
         m_c = new kiss_fft_cpx[m_n];
     }
 
     ~D() {
+        delete m_radix4;
         kiss_fftr_free(m_planf);
         kiss_fftr_free(m_plani);
         delete[] m_c;
     }
 
+    FFTBackend backend() const {
+        return m_backend;
+    }
+
     void forward(const double *ri, double *ro, double *io) {
 
-        kiss_fftr(m_planf, ri, m_c);
+        if (m_radix4) {
+            m_radix4->forward(ri, ro, io);
+        } else {
+            kiss_fftr(m_planf, ri, m_c);
 
-        for (int i = 0; i <= m_n/2; ++i) {
-            ro[i] = m_c[i].r;
-            io[i] = m_c[i].i;
+            for (int i = 0; i <= m_n/2; ++i) {
+                ro[i] = m_c[i].r;
+                io[i] = m_c[i].i;
+            }
         }
 
         for (int i = 0; i + 1 < m_n/2; ++i) {
@@ -146,6 +271,11 @@ public:
 
     void inverse(const double *ri, const double *ii, double *ro) {
 
+        if (m_radix4) {
+            m_radix4->inverse(ri, ii, ro);
+            return;
+        }
+
         // kiss_fftr.h says
         // "input freqdata has nfft/2+1 complex points"
 
@@ -165,6 +295,8 @@ public:
 
 private:
     int m_n;
+    FFTBackend m_backend;
+    FFTRadix4Real *m_radix4;
     kiss_fftr_cfg m_planf;
     kiss_fftr_cfg m_plani;
     kiss_fft_cpx *m_c;
@@ -198,5 +330,11 @@ FFTReal::inverse(const double *ri, const double *ii, double *ro)
     m_d->inverse(ri, ii, ro);
 }
 
+FFTBackend
+FFTReal::getBackend() const
+{
+    return m_d->backend();
+}
+
 
     
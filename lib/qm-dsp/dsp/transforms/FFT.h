@@ -15,6 +15,24 @@
 #ifndef QM_DSP_FFT_H
 #define QM_DSP_FFT_H
 
+/**
+ * The implementations that FFT and FFTReal can use.
+ */
+enum FFTBackend {
+    FFTBackendAuto,    // the fastest backend that supports the size
+    FFTBackendKissFFT, // the bundled kissfft, which supports every size
+    FFTBackendRadix4   // SIMD radix-4 (FFTRadix4), power-of-two sizes only
+};
+
+/**
+ * Set the backend that is used by FFT and FFTReal objects constructed
+ * afterwards. If the backend does not support the size of a
+ * transform, kissfft is used instead. The default is FFTBackendAuto,
+ * which prefers the radix-4 backend where it is vectorized.
+ */
+void setFFTBackend(FFTBackend backend);
+FFTBackend getFFTBackend();
+
 class FFT  
 {
 public:
@@ -43,6 +61,12 @@ public:
     void process(bool inverse,
                  const double *realIn, const double *imagIn,
                  double *realOut, double *imagOut);
+
+    /**
+     * Return the backend that carries out the transforms, which is
+     * never FFTBackendAuto.
+     */
+    FFTBackend getBackend() const;
     
 private:
     class D;
@@ -103,6 +127,12 @@ public:
     void inverse(const double *realIn, const double *imagIn,
                  double *realOut);
 
+    /**
+     * Return the backend that carries out the transforms, which is
+     * never FFTBackendAuto.
+     */
+    FFTBackend getBackend() const;
+
 private:
     class D;
     D *m_d;
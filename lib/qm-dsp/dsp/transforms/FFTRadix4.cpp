@@ -0,0 +1,481 @@
+/* -*- c-basic-offset: 4 indent-tabs-mode: nil -*-  vi:set ts=8 sts=4 sw=4: */
+
+/*
+    QM DSP Library
+
+    Centre for Digital Music, Queen Mary, University of London.
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of the
+    License, or (at your option) any later version.  See the file
+    COPYING included with this distribution for more information.
+*/
+
+#include "FFTRadix4.h"
+
+#include <cmath>
+
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QM_FFT_RADIX4_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define QM_FFT_RADIX4_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+#if defined(QM_FFT_RADIX4_SSE2)
+
+// Two doubles in an SSE2 register
+struct V2 {
+    __m128d v;
+    V2() { }
+    V2(__m128d value) : v(value) { }
+    explicit V2(double value) : v(_mm_set1_pd(value)) { }
+    static V2 load(const double *p) { return V2(_mm_loadu_pd(p)); }
+    void store(double *p) const { _mm_storeu_pd(p, v); }
+    void storeLow(double *p) const { _mm_storel_pd(p, v); }
+    void storeHigh(double *p) const { _mm_storeh_pd(p, v); }
+    V2 reversed() const { return V2(_mm_shuffle_pd(v, v, 1)); }
+    // Loads p[0..3] and returns p[0], p[2] and p[1], p[3]
+    static void deinterleave(const double *p, V2 &even, V2 &odd) {
+        const __m128d a = _mm_loadu_pd(p), b = _mm_loadu_pd(p + 2);
+        even = V2(_mm_unpacklo_pd(a, b));
+        odd = V2(_mm_unpackhi_pd(a, b));
+    }
+    // Stores even[0], odd[0], even[1], odd[1] to p[0..3]
+    static void interleave(V2 even, V2 odd, double *p) {
+        _mm_storeu_pd(p, _mm_unpacklo_pd(even.v, odd.v));
+        _mm_storeu_pd(p + 2, _mm_unpackhi_pd(even.v, odd.v));
+    }
+};
+
+inline V2 operator+(V2 a, V2 b) { return V2(_mm_add_pd(a.v, b.v)); }
+inline V2 operator-(V2 a, V2 b) { return V2(_mm_sub_pd(a.v, b.v)); }
+inline V2 operator*(V2 a, V2 b) { return V2(_mm_mul_pd(a.v, b.v)); }
+
+#elif defined(QM_FFT_RADIX4_NEON)
+
+// Two doubles in a NEON register
+struct V2 {
+    float64x2_t v;
+    V2() { }
+    V2(float64x2_t value) : v(value) { }
+    explicit V2(double value) : v(vdupq_n_f64(value)) { }
+    static V2 load(const double *p) { return V2(vld1q_f64(p)); }
+    void store(double *p) const { vst1q_f64(p, v); }
+    void storeLow(double *p) const { vst1q_lane_f64(p, v, 0); }
+    void storeHigh(double *p) const { vst1q_lane_f64(p, v, 1); }
+    V2 reversed() const { return V2(vextq_f64(v, v, 1)); }
+    // Loads p[0..3] and returns p[0], p[2] and p[1], p[3]
+    static void deinterleave(const double *p, V2 &even, V2 &odd) {
+        const float64x2_t a = vld1q_f64(p), b = vld1q_f64(p + 2);
+        even = V2(vuzp1q_f64(a, b));
+        odd = V2(vuzp2q_f64(a, b));
+    }
+    // Stores even[0], odd[0], even[1], odd[1] to p[0..3]
+    static void interleave(V2 even, V2 odd, double *p) {
+        vst1q_f64(p, vzip1q_f64(even.v, odd.v));
+        vst1q_f64(p + 2, vzip2q_f64(even.v, odd.v));
+    }
+};
+
+inline V2 operator+(V2 a, V2 b) { return V2(vaddq_f64(a.v, b.v)); }
+inline V2 operator-(V2 a, V2 b) { return V2(vsubq_f64(a.v, b.v)); }
+inline V2 operator*(V2 a, V2 b) { return V2(vmulq_f64(a.v, b.v)); }
+
+#endif
+
+// One radix-4 decimation in frequency butterfly of the Stockham
+// algorithm, for T = double or for two butterflies at once with T = V2.
+// (b - d) is multiplied by -i for the forward transform.
+template <typename T>
+inline void butterfly(T ar, T ai, T br, T bi, T cr, T ci, T dr, T di,
+                      T w1r, T w1i, T w2r, T w2i, T w3r, T w3i,
+                      T &y0r, T &y0i, T &y1r, T &y1i,
+                      T &y2r, T &y2i, T &y3r, T &y3i)
+{
+    const T apcr = ar + cr, apci = ai + ci;
+    const T amcr = ar - cr, amci = ai - ci;
+    const T bpdr = br + dr, bpdi = bi + di;
+    const T bmdr = br - dr, bmdi = bi - di;
+
+    y0r = apcr + bpdr;
+    y0i = apci + bpdi;
+
+    const T t1r = amcr + bmdi, t1i = amci - bmdr;
+    y1r = w1r * t1r - w1i * t1i;
+    y1i = w1r * t1i + w1i * t1r;
+
+    const T t2r = apcr - bpdr, t2i = apci - bpdi;
+    y2r = w2r * t2r - w2i * t2i;
+    y2i = w2r * t2i + w2i * t2r;
+
+    const T t3r = amcr - bmdi, t3i = amci + bmdr;
+    y3r = w3r * t3r - w3i * t3i;
+    y3i = w3r * t3i + w3i * t3r;
+}
+
+// Splits the FFT Z of the even (real part) and odd (imaginary part)
+// samples of a real signal into the spectra E and O of the even and
+// odd samples and returns X[k] = E[k] + W^k O[k]. zm is Z[m - k].
+template <typename T>
+inline void splitSpectrum(T zkr, T zki, T zmr, T zmi, T wr, T wi,
+                          T &xr, T &xi)
+{
+    const T half(0.5);
+    const T er = half * (zkr + zmr);
+    const T ei = half * (zki - zmi);
+    const T orr = half * (zki + zmi);
+    const T oi = half * (zmr - zkr);
+    xr = er + wr * orr - wi * oi;
+    xi = ei + wr * oi + wi * orr;
+}
+
+// The inverse of splitSpectrum(), which returns Z[k] = E[k] + i O[k]
+// from X[k] and xm = X[m - k].
+template <typename T>
+inline void mergeSpectrum(T xkr, T xki, T xmr, T xmi, T wr, T wi,
+                          T &zr, T &zi)
+{
+    const T half(0.5);
+    const T er = half * (xkr + xmr);
+    const T ei = half * (xki - xmi);
+    const T dr = half * (xkr - xmr);
+    const T di = half * (xki + xmi);
+    const T orr = dr * wr + di * wi;
+    const T oi = di * wr - dr * wi;
+    zr = er - oi;
+    zi = ei + orr;
+}
+
+bool isPowerOfTwo(int n)
+{
+    return n > 0 && (n & (n - 1)) == 0;
+}
+
+} // namespace
+
+FFTRadix4::FFTRadix4(int n) :
+    m_n(n),
+    m_radix2Stride(0),
+    m_workRe(n),
+    m_workIm(n),
+    m_zeros(n, 0.0)
+{
+    if (!supportsSize(n)) {
+        throw std::invalid_argument
+            ("nsamples must be a power of two in FFTRadix4 constructor");
+    }
+
+    int length = n;
+    int stride = 1;
+    while (length >= 4) {
+        Stage stage;
+        stage.m = length / 4;
+        stage.s = stride;
+        for (int p = 0; p < stage.m; ++p) {
+            const double theta = -2.0 * M_PI * p / length;
+            stage.w1r.push_back(cos(theta));
+            stage.w1i.push_back(sin(theta));
+            stage.w2r.push_back(cos(2.0 * theta));
+            stage.w2i.push_back(sin(2.0 * theta));
+            stage.w3r.push_back(cos(3.0 * theta));
+            stage.w3i.push_back(sin(3.0 * theta));
+        }
+        m_stages.push_back(stage);
+        length /= 4;
+        stride *= 4;
+    }
+    if (length == 2) {
+        m_radix2Stride = stride;
+    }
+}
+
+bool
+FFTRadix4::supportsSize(int n)
+{
+    return isPowerOfTwo(n);
+}
+
+bool
+FFTRadix4::isVectorized()
+{
+#if defined(QM_FFT_RADIX4_SSE2) || defined(QM_FFT_RADIX4_NEON)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void
+FFTRadix4::forward(const double *ri, const double *ii,
+                   double *ro, double *io)
+{
+    transform(ri, ii ? ii : &m_zeros[0], ro, io);
+}
+
+void
+FFTRadix4::inverse(const double *ri, const double *ii,
+                   double *ro, double *io)
+{
+    // Swapping the real and imaginary parts of the input and the
+    // output turns the forward into an (unscaled) inverse transform
+    transform(ii ? ii : &m_zeros[0], ri, io, ro);
+
+    const double scale = 1.0 / m_n;
+    for (int i = 0; i < m_n; ++i) {
+        ro[i] *= scale;
+        io[i] *= scale;
+    }
+}
+
+void
+FFTRadix4::transform(const double *xr, const double *xi,
+                     double *outRe, double *outIm)
+{
+    const int passes = int(m_stages.size()) + (m_radix2Stride ? 1 : 0);
+    if (passes == 0) {
+        for (int i = 0; i < m_n; ++i) {
+            outRe[i] = xr[i];
+            outIm[i] = xi[i];
+        }
+        return;
+    }
+
+    // Every pass reads the output of the previous one. Alternate
+    // between the work buffer and the output, so that the last pass
+    // writes to the output.
+    for (int pass = 0; pass < int(m_stages.size()); ++pass) {
+        const bool toOutput = (passes - 1 - pass) % 2 == 0;
+        double *yr = toOutput ? outRe : &m_workRe[0];
+        double *yi = toOutput ? outIm : &m_workIm[0];
+
+        const Stage &stage = m_stages[pass];
+        const int m = stage.m;
+        const int s = stage.s;
+
+        if (s == 1) {
+            // First pass: the butterflies of neighbouring p are
+            // contiguous in the input, but not in the output.
+            int p = 0;
+#if defined(QM_FFT_RADIX4_SSE2) || defined(QM_FFT_RADIX4_NEON)
+            for (; p + 2 <= m; p += 2) {
+                V2 y0r, y0i, y1r, y1i, y2r, y2i, y3r, y3i;
+                butterfly(V2::load(xr + p), V2::load(xi + p),
+                          V2::load(xr + p + m), V2::load(xi + p + m),
+                          V2::load(xr + p + 2 * m), V2::load(xi + p + 2 * m),
+                          V2::load(xr + p + 3 * m), V2::load(xi + p + 3 * m),
+                          V2::load(&stage.w1r[p]), V2::load(&stage.w1i[p]),
+                          V2::load(&stage.w2r[p]), V2::load(&stage.w2i[p]),
+                          V2::load(&stage.w3r[p]), V2::load(&stage.w3i[p]),
+                          y0r, y0i, y1r, y1i, y2r, y2i, y3r, y3i);
+                double *y0 = yr + 4 * p;
+                double *y1 = yi + 4 * p;
+                y0r.storeLow(y0);     y0r.storeHigh(y0 + 4);
+                y1r.storeLow(y0 + 1); y1r.storeHigh(y0 + 5);
+                y2r.storeLow(y0 + 2); y2r.storeHigh(y0 + 6);
+                y3r.storeLow(y0 + 3); y3r.storeHigh(y0 + 7);
+                y0i.storeLow(y1);     y0i.storeHigh(y1 + 4);
+                y1i.storeLow(y1 + 1); y1i.storeHigh(y1 + 5);
+                y2i.storeLow(y1 + 2); y2i.storeHigh(y1 + 6);
+                y3i.storeLow(y1 + 3); y3i.storeHigh(y1 + 7);
+            }
+#endif
+            for (; p < m; ++p) {
+                butterfly(xr[p], xi[p], xr[p + m], xi[p + m],
+                          xr[p + 2 * m], xi[p + 2 * m],
+                          xr[p + 3 * m], xi[p + 3 * m],
+                          stage.w1r[p], stage.w1i[p],
+                          stage.w2r[p], stage.w2i[p],
+                          stage.w3r[p], stage.w3i[p],
+                          yr[4 * p], yi[4 * p],
+                          yr[4 * p + 1], yi[4 * p + 1],
+                          yr[4 * p + 2], yi[4 * p + 2],
+                          yr[4 * p + 3], yi[4 * p + 3]);
+            }
+        } else {
+            // The butterflies of neighbouring q are contiguous in both
+            // the input and the output and share their twiddle factors.
+            for (int p = 0; p < m; ++p) {
+                const double *ar = xr + s * p;
+                const double *ai = xi + s * p;
+                double *y0r = yr + s * 4 * p;
+                double *y0i = yi + s * 4 * p;
+                int q = 0;
+#if defined(QM_FFT_RADIX4_SSE2) || defined(QM_FFT_RADIX4_NEON)
+                const V2 w1r(stage.w1r[p]), w1i(stage.w1i[p]);
+                const V2 w2r(stage.w2r[p]), w2i(stage.w2i[p]);
+                const V2 w3r(stage.w3r[p]), w3i(stage.w3i[p]);
+                for (; q + 2 <= s; q += 2) {
+                    V2 b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i;
+                    butterfly(V2::load(ar + q), V2::load(ai + q),
+                              V2::load(ar + q + s * m),
+                              V2::load(ai + q + s * m),
+                              V2::load(ar + q + 2 * s * m),
+                              V2::load(ai + q + 2 * s * m),
+                              V2::load(ar + q + 3 * s * m),
+                              V2::load(ai + q + 3 * s * m),
+                              w1r, w1i, w2r, w2i, w3r, w3i,
+                              b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i);
+                    b0r.store(y0r + q);         b0i.store(y0i + q);
+                    b1r.store(y0r + q + s);     b1i.store(y0i + q + s);
+                    b2r.store(y0r + q + 2 * s); b2i.store(y0i + q + 2 * s);
+                    b3r.store(y0r + q + 3 * s); b3i.store(y0i + q + 3 * s);
+                }
+#endif
+                for (; q < s; ++q) {
+                    butterfly(ar[q], ai[q],
+                              ar[q + s * m], ai[q + s * m],
+                              ar[q + 2 * s * m], ai[q + 2 * s * m],
+                              ar[q + 3 * s * m], ai[q + 3 * s * m],
+                              stage.w1r[p], stage.w1i[p],
+                              stage.w2r[p], stage.w2i[p],
+                              stage.w3r[p], stage.w3i[p],
+                              y0r[q], y0i[q],
+                              y0r[q + s], y0i[q + s],
+                              y0r[q + 2 * s], y0i[q + 2 * s],
+                              y0r[q + 3 * s], y0i[q + 3 * s]);
+                }
+            }
+        }
+
+        xr = yr;
+        xi = yi;
+    }
+
+    if (m_radix2Stride) {
+        // The remaining sub-transforms have a length of 2 and need no
+        // twiddle factors. This pass always writes to the output.
+        const int s = m_radix2Stride;
+        for (int q = 0; q < s; ++q) {
+            const double ar = xr[q], ai = xi[q];
+            const double br = xr[q + s], bi = xi[q + s];
+            outRe[q] = ar + br;
+            outIm[q] = ai + bi;
+            outRe[q + s] = ar - br;
+            outIm[q + s] = ai - bi;
+        }
+    }
+}
+
+FFTRadix4Real::FFTRadix4Real(int n) :
+    m_n(n),
+    m_fft(n / 2),
+    m_wr(n / 2 + 1),
+    m_wi(n / 2 + 1),
+    m_zr(n / 2),
+    m_zi(n / 2),
+    m_outRe(n / 2),
+    m_outIm(n / 2)
+{
+    if (!supportsSize(n)) {
+        throw std::invalid_argument
+            ("nsamples must be a power of two in FFTRadix4Real constructor");
+    }
+    for (int k = 0; k <= n / 2; ++k) {
+        const double theta = -2.0 * M_PI * k / n;
+        m_wr[k] = cos(theta);
+        m_wi[k] = sin(theta);
+    }
+}
+
+bool
+FFTRadix4Real::supportsSize(int n)
+{
+    return n >= 2 && isPowerOfTwo(n);
+}
+
+void
+FFTRadix4Real::forward(const double *ri, double *ro, double *io)
+{
+    // Transform the even samples as the real and the odd samples as
+    // the imaginary part of a complex signal of half the size
+    const int m = m_n / 2;
+    int k = 0;
+#if defined(QM_FFT_RADIX4_SSE2) || defined(QM_FFT_RADIX4_NEON)
+    for (; k + 2 <= m; k += 2) {
+        V2 even, odd;
+        V2::deinterleave(ri + 2 * k, even, odd);
+        even.store(&m_zr[k]);
+        odd.store(&m_zi[k]);
+    }
+#endif
+    for (; k < m; ++k) {
+        m_zr[k] = ri[2 * k];
+        m_zi[k] = ri[2 * k + 1];
+    }
+    m_fft.forward(&m_zr[0], &m_zi[0], &m_outRe[0], &m_outIm[0]);
+
+    const double *zr = &m_outRe[0];
+    const double *zi = &m_outIm[0];
+
+    // DC and Nyquist are real
+    ro[0] = zr[0] + zi[0];
+    io[0] = 0.0;
+    ro[m] = zr[0] - zi[0];
+    io[m] = 0.0;
+
+    k = 1;
+#if defined(QM_FFT_RADIX4_SSE2) || defined(QM_FFT_RADIX4_NEON)
+    for (; k + 2 <= m; k += 2) {
+        V2 xr, xi;
+        splitSpectrum(V2::load(zr + k), V2::load(zi + k),
+                      V2::load(zr + m - k - 1).reversed(),
+                      V2::load(zi + m - k - 1).reversed(),
+                      V2::load(&m_wr[k]), V2::load(&m_wi[k]),
+                      xr, xi);
+        xr.store(ro + k);
+        xi.store(io + k);
+    }
+#endif
+    for (; k < m; ++k) {
+        splitSpectrum(zr[k], zi[k], zr[m - k], zi[m - k],
+                      m_wr[k], m_wi[k], ro[k], io[k]);
+    }
+}
+
+void
+FFTRadix4Real::inverse(const double *ri, const double *ii, double *ro)
+{
+    // Reverse the split of forward(). The imaginary parts at DC and
+    // Nyquist are ignored like kiss_fftri does.
+    const int m = m_n / 2;
+    mergeSpectrum(ri[0], 0.0, ri[m], 0.0, m_wr[0], m_wi[0],
+                  m_zr[0], m_zi[0]);
+    int k = 1;
+#if defined(QM_FFT_RADIX4_SSE2) || defined(QM_FFT_RADIX4_NEON)
+    for (; k + 2 <= m; k += 2) {
+        V2 zr, zi;
+        mergeSpectrum(V2::load(ri + k), V2::load(ii + k),
+                      V2::load(ri + m - k - 1).reversed(),
+                      V2::load(ii + m - k - 1).reversed(),
+                      V2::load(&m_wr[k]), V2::load(&m_wi[k]),
+                      zr, zi);
+        zr.store(&m_zr[k]);
+        zi.store(&m_zi[k]);
+    }
+#endif
+    for (; k < m; ++k) {
+        mergeSpectrum(ri[k], ii[k], ri[m - k], ii[m - k],
+                      m_wr[k], m_wi[k], m_zr[k], m_zi[k]);
+    }
+    m_fft.inverse(&m_zr[0], &m_zi[0], &m_outRe[0], &m_outIm[0]);
+
+    // The real and imaginary parts are the even and odd samples
+    k = 0;
+#if defined(QM_FFT_RADIX4_SSE2) || defined(QM_FFT_RADIX4_NEON)
+    for (; k + 2 <= m; k += 2) {
+        V2::interleave(V2::load(&m_outRe[k]), V2::load(&m_outIm[k]),
+                       ro + 2 * k);
+    }
+#endif
+    for (; k < m; ++k) {
+        ro[2 * k] = m_outRe[k];
+        ro[2 * k + 1] = m_outIm[k];
+    }
+}
@@ -0,0 +1,121 @@
+/* -*- c-basic-offset: 4 indent-tabs-mode: nil -*-  vi:set ts=8 sts=4 sw=4: */
+
+/*
+    QM DSP Library
+
+    Centre for Digital Music, Queen Mary, University of London.
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of the
+    License, or (at your option) any later version.  See the file
+    COPYING included with this distribution for more information.
+*/
+
+#ifndef QM_DSP_FFT_RADIX4_H
+#define QM_DSP_FFT_RADIX4_H
+
+#include <vector>
+
+/**
+ * Complex-to-complex FFT for power-of-two sizes, using a Stockham
+ * autosort radix-4 algorithm (with a final radix-2 pass for odd
+ * powers of two) on split real and imaginary arrays. Two butterflies
+ * are computed at once in the lanes of an SSE2 or NEON register where
+ * available.
+ *
+ * This is the vectorized backend of FFT and FFTReal. Use those
+ * classes rather than this one directly.
+ */
+class FFTRadix4
+{
+public:
+    /**
+     * Construct an FFT object for transforms of size nsamples, which
+     * must be a power of two (see supportsSize).
+     */
+    FFTRadix4(int nsamples);
+
+    /**
+     * Return true if transforms of size nsamples are supported.
+     */
+    static bool supportsSize(int nsamples);
+
+    /**
+     * Return true if the butterflies are computed in SIMD registers
+     * on this platform, false if the scalar fallback is used.
+     */
+    static bool isVectorized();
+
+    /**
+     * Carry out an unscaled forward transform. imagIn may be NULL if
+     * the signal is real. The input and output may not overlap.
+     */
+    void forward(const double *realIn, const double *imagIn,
+                 double *realOut, double *imagOut);
+
+    /**
+     * Carry out an inverse transform, scaled by 1/nsamples. The
+     * input and output may not overlap.
+     */
+    void inverse(const double *realIn, const double *imagIn,
+                 double *realOut, double *imagOut);
+
+private:
+    struct Stage {
+        int m; // quarter of the sub-transform length
+        int s; // stride between the elements of a sub-transform
+        std::vector<double> w1r, w1i, w2r, w2i, w3r, w3i;
+    };
+
+    void transform(const double *re, const double *im,
+                   double *outRe, double *outIm);
+
+    int m_n;
+    std::vector<Stage> m_stages;
+    // Stride of the final radix-2 pass, or 0 if there is none
+    int m_radix2Stride;
+    std::vector<double> m_workRe;
+    std::vector<double> m_workIm;
+    // Imaginary part of a real input signal
+    std::vector<double> m_zeros;
+};
+
+/**
+ * Real-to-complex FFT for power-of-two sizes, which carries out a
+ * complex FFTRadix4 of half the size on the even and odd samples and
+ * splits the result into the spectrum of the real signal.
+ */
+class FFTRadix4Real
+{
+public:
+    FFTRadix4Real(int nsamples);
+
+    static bool supportsSize(int nsamples);
+
+    /**
+     * Carry out an unscaled forward transform and return the
+     * nsamples/2+1 values of the non-redundant half of the spectrum.
+     */
+    void forward(const double *realIn, double *realOut, double *imagOut);
+
+    /**
+     * Carry out an inverse transform of the nsamples/2+1 values of
+     * the non-redundant half of a spectrum, scaled by 1/nsamples.
+     */
+    void inverse(const double *realIn, const double *imagIn,
+                 double *realOut);
+
+private:
+    int m_n;
+    FFTRadix4 m_fft;
+    // Twiddle factors exp(-2 pi i k / nsamples) for k <= nsamples/2
+    std::vector<double> m_wr;
+    std::vector<double> m_wi;
+    std::vector<double> m_zr;
+    std::vector<double> m_zi;
+    std::vector<double> m_outRe;
+    std::vector<double> m_outIm;
+};
+
+#endif
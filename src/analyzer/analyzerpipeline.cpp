@@ -0,0 +1,127 @@
+#include "analyzer/analyzerpipeline.h"
+
+#include "util/assert.h"
+
+class AnalyzerPipeline::Stage : public QThread {
+  public:
+    Stage(AnalyzerPipeline* pPipeline, AnalyzerWithState* pAnalyzer, int index)
+            : m_pPipeline(pPipeline),
+              m_pAnalyzer(pAnalyzer),
+              m_readIndex(0) {
+        setObjectName(QStringLiteral("AnalyzerPipelineStage %1").arg(index));
+    }
+
+  protected:
+    void run() override {
+        m_pPipeline->stageLoop(this);
+    }
+
+  private:
+    friend class AnalyzerPipeline;
+
+    AnalyzerPipeline* const m_pPipeline;
+    AnalyzerWithState* const m_pAnalyzer;
+    // Counts the published blocks that have not been processed yet
+    mixxx::LightweightSemaphore m_publishedBlocks;
+    // Only accessed by the stage thread
+    int m_readIndex;
+};
+
+AnalyzerPipeline::AnalyzerPipeline(
+        std::vector<AnalyzerWithState>* pAnalyzers,
+        int numBlocks,
+        SINT samplesPerBlock,
+        QThread::Priority priority)
+        : m_numBlocks(numBlocks),
+          m_samplesPerBlock(samplesPerBlock),
+          m_buffer(numBlocks * samplesPerBlock),
+          m_blocks(new Block[numBlocks]),
+          m_freeBlocks(numBlocks),
+          m_quit(false),
+          m_writeIndex(0),
+          m_writeBlockAcquired(false) {
+    DEBUG_ASSERT(pAnalyzers);
+    DEBUG_ASSERT(numBlocks > 0);
+    for (int i = 0; i < m_numBlocks; ++i) {
+        m_blocks[i].pBuffer = m_buffer.data(i * m_samplesPerBlock);
+        m_blocks[i].pData = nullptr;
+        m_blocks[i].numSamples = 0;
+        m_blocks[i].pendingStages.store(0, std::memory_order_relaxed);
+    }
+    m_stages.reserve(pAnalyzers->size());
+    for (auto& analyzer : *pAnalyzers) {
+        m_stages.push_back(std::make_unique<Stage>(
+                this, &analyzer, static_cast<int>(m_stages.size())));
+    }
+    for (const auto& pStage : m_stages) {
+        pStage->start(priority);
+    }
+}
+
+AnalyzerPipeline::~AnalyzerPipeline() {
+    drain();
+    m_quit.store(true, std::memory_order_release);
+    for (const auto& pStage : m_stages) {
+        pStage->m_publishedBlocks.release();
+    }
+    for (const auto& pStage : m_stages) {
+        pStage->wait();
+    }
+}
+
+mixxx::SampleBuffer::WritableSlice AnalyzerPipeline::nextWritableBlock() {
+    if (!m_writeBlockAcquired) {
+        m_freeBlocks.acquire();
+        m_writeBlockAcquired = true;
+    }
+    return mixxx::SampleBuffer::WritableSlice(
+            m_blocks[m_writeIndex].pBuffer,
+            m_samplesPerBlock);
+}
+
+void AnalyzerPipeline::publishBlock(const CSAMPLE* pData, SINT numSamples) {
+    DEBUG_ASSERT(m_writeBlockAcquired);
+    Block& block = m_blocks[m_writeIndex];
+    DEBUG_ASSERT(pData >= block.pBuffer);
+    DEBUG_ASSERT(pData + numSamples <= block.pBuffer + m_samplesPerBlock);
+    if (m_stages.empty() || numSamples <= 0) {
+        // Nothing to process, reuse the block
+        return;
+    }
+    block.pData = pData;
+    block.numSamples = numSamples;
+    block.pendingStages.store(numStages(), std::memory_order_relaxed);
+    m_writeBlockAcquired = false;
+    m_writeIndex = (m_writeIndex + 1) % m_numBlocks;
+    // The release of the semaphores publishes the block contents
+    for (const auto& pStage : m_stages) {
+        pStage->m_publishedBlocks.release();
+    }
+}
+
+void AnalyzerPipeline::drain() {
+    if (m_writeBlockAcquired) {
+        m_freeBlocks.release();
+        m_writeBlockAcquired = false;
+    }
+    // All blocks are free after the stages have caught up
+    for (int i = 0; i < m_numBlocks; ++i) {
+        m_freeBlocks.acquire();
+    }
+    m_freeBlocks.release(m_numBlocks);
+}
+
+void AnalyzerPipeline::stageLoop(Stage* pStage) {
+    while (true) {
+        pStage->m_publishedBlocks.acquire();
+        if (m_quit.load(std::memory_order_acquire)) {
+            return;
+        }
+        Block& block = m_blocks[pStage->m_readIndex];
+        pStage->m_pAnalyzer->processSamples(block.pData, block.numSamples);
+        pStage->m_readIndex = (pStage->m_readIndex + 1) % m_numBlocks;
+        if (block.pendingStages.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            m_freeBlocks.release();
+        }
+    }
+}
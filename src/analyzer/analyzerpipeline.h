@@ -0,0 +1,81 @@
+#pragma once
+
+#include <QThread>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "analyzer/analyzer.h"
+#include "util/class.h"
+#include "util/lightweightsemaphore.h"
+#include "util/samplebuffer.h"
+
+// AnalyzerPipeline runs each analyzer of an AnalyzerThread on a separate
+// stage thread. The AnalyzerThread only decodes the audio data into a ring
+// of blocks that are shared by all stages. A block becomes writable again
+// after every stage has processed it. This allows the beat and key
+// detection to run in parallel instead of waiting for each other.
+//
+// The analyzers are initialized, finished and cancelled by the decoding
+// thread as before, but only after drain() returned. Between those calls
+// the stages have exclusive access to their analyzer.
+class AnalyzerPipeline {
+  public:
+    // The stage threads are started immediately. The vector of analyzers
+    // must not be modified during the lifetime of the pipeline.
+    AnalyzerPipeline(
+            std::vector<AnalyzerWithState>* pAnalyzers,
+            int numBlocks,
+            SINT samplesPerBlock,
+            QThread::Priority priority = QThread::InheritPriority);
+    ~AnalyzerPipeline();
+
+    int numStages() const {
+        return static_cast<int>(m_stages.size());
+    }
+
+    // Returns the next block for decoding into. Blocks the calling thread
+    // until the block has been processed by all stages. Subsequent calls
+    // return the same block until it has been published.
+    mixxx::SampleBuffer::WritableSlice nextWritableBlock();
+
+    // Passes the decoded samples to all stages. The samples must be located
+    // within the block returned by nextWritableBlock().
+    void publishBlock(const CSAMPLE* pData, SINT numSamples);
+
+    // Blocks the calling thread until all published blocks have been
+    // processed by all stages. A block that has not been published is
+    // discarded.
+    void drain();
+
+  private:
+    class Stage;
+
+    struct Block {
+        CSAMPLE* pBuffer;
+        const CSAMPLE* pData;
+        SINT numSamples;
+        // The number of stages that have not processed this block yet
+        std::atomic<int> pendingStages;
+    };
+
+    void stageLoop(Stage* pStage);
+
+    const int m_numBlocks;
+    const SINT m_samplesPerBlock;
+
+    mixxx::SampleBuffer m_buffer;
+    std::unique_ptr<Block[]> m_blocks;
+
+    // Counts the blocks that are writable
+    mixxx::LightweightSemaphore m_freeBlocks;
+    std::atomic<bool> m_quit;
+
+    // Only accessed by the decoding thread
+    int m_writeIndex;
+    bool m_writeBlockAcquired;
+
+    std::vector<std::unique_ptr<Stage>> m_stages;
+
+    DISALLOW_COPY_AND_ASSIGN(AnalyzerPipeline);
+};
@@ -14,6 +14,8 @@
 #include "moc_analyzerthread.cpp"
 #include "sources/audiosourcestereoproxy.h"
 #include "sources/soundsourceproxy.h"
+#include "track/beats.h"
+#include "track/keyfactory.h"
 #include "track/track.h"
 #include "util/db/dbconnectionpooled.h"
 #include "util/db/dbconnectionpooler.h"
@@ -36,6 +38,11 @@ mixxx::Logger kLogger("AnalyzerThread");
 // continuous feedback.
 const mixxx::Duration kBusyProgressInhibitDuration = mixxx::Duration::fromMillis(60);
 
+// The number of decoded chunks that are buffered for the analyzers in
+// pipelined mode. Allows the decoder to run ahead of the slowest analyzer
+// and compensates for analyzers that process multiple chunks at once.
+constexpr int kPipelineNumBlocks = 16;
+
 void deleteAnalyzerThread(AnalyzerThread* plainPtr) {
     if (plainPtr) {
         plainPtr->deleteAfterFinished();
@@ -84,18 +91,24 @@ AnalyzerThread::AnalyzerThread(
           m_pConfig(pConfig),
           m_modeFlags(modeFlags),
           m_nextTrack(2), // minimum capacity
-          m_sampleBuffer(mixxx::kAnalysisSamplesPerChunk),
+          m_sampleBuffer((modeFlags & AnalyzerModeFlags::Pipelined)
+                          ? 0 // decoded into the blocks of the pipeline
+                          : mixxx::kAnalysisSamplesPerChunk),
           m_emittedState(AnalyzerThreadState::Void) {
     std::call_once(registerMetaTypesOnceFlag, registerMetaTypesOnce);
 }
 
 void AnalyzerThread::doRun() {
-    std::unique_ptr<AnalysisDao> pAnalysisDao;
     // The thread-local database connection  must not be closed
     // before returning from this function.
     mixxx::DbConnectionPooler dbConnectionPooler;
+    // Declared after the pooler, so that the DAO does not outlive
+    // the database connection.
+    std::unique_ptr<AnalysisDao> pAnalysisDao;
 
-    if (m_modeFlags & AnalyzerModeFlags::WithWaveform) {
+    // The database is also needed for looking up the results of
+    // other tracks with the same audio content
+    if (m_dbConnectionPool || (m_modeFlags & AnalyzerModeFlags::WithWaveform)) {
         dbConnectionPooler = mixxx::DbConnectionPooler(m_dbConnectionPool); // move assignment
         if (!dbConnectionPooler.isPooling()) {
             kLogger.warning()
@@ -103,7 +116,12 @@ void AnalyzerThread::doRun() {
             return;
         }
         QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_dbConnectionPool);
-        m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerWaveform>(m_pConfig, dbConnection)));
+        pAnalysisDao = std::make_unique<AnalysisDao>(m_pConfig);
+        pAnalysisDao->initialize(dbConnection);
+        if (m_modeFlags & AnalyzerModeFlags::WithWaveform) {
+            m_analyzers.push_back(AnalyzerWithState(
+                    std::make_unique<AnalyzerWaveform>(m_pConfig, dbConnection)));
+        }
     }
     if (AnalyzerGain::isEnabled(ReplayGainSettings(m_pConfig))) {
         m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerGain>(m_pConfig)));
@@ -120,6 +138,15 @@ void AnalyzerThread::doRun() {
     DEBUG_ASSERT(!m_analyzers.empty());
     kLogger.debug() << "Activated" << m_analyzers.size() << "analyzers";
 
+    if (m_modeFlags & AnalyzerModeFlags::Pipelined) {
+        m_pPipeline = std::make_unique<AnalyzerPipeline>(
+                &m_analyzers,
+                kPipelineNumBlocks,
+                mixxx::kAnalysisSamplesPerChunk,
+                priority());
+        kLogger.debug() << "Started" << m_pPipeline->numStages() << "pipeline stages";
+    }
+
     m_lastBusyProgressEmittedTimer.start();
 
     mixxx::AudioSource::OpenParams openParams;
@@ -140,20 +167,36 @@ void AnalyzerThread::doRun() {
             continue;
         }
 
-        bool processTrack = false;
-        for (auto&& analyzer : m_analyzers) {
-            // Make sure not to short-circuit initialize(...)
-            if (analyzer.initialize(
-                        *m_currentTrack,
-                        audioSource->getSignalInfo().getSampleRate(),
-                        audioSource->frameLength())) {
-                processTrack = true;
+        bool processTrack = initializeAnalyzers(audioSource);
+
+        // The digest of a track is calculated while decoding it for the
+        // first analysis. Previous analyses of the same audio content are
+        // only looked up if there is any work left for the analyzers.
+        TrackId trackId = m_currentTrack->getTrack()->getId();
+        mixxx::AudioDigest audioDigest;
+        if (pAnalysisDao && trackId.isValid()) {
+            audioDigest = pAnalysisDao->getAudioDigest(trackId);
+            if (processTrack &&
+                    reuseAnalysesOfSameAudio(pAnalysisDao.get(), audioDigest, audioSource)) {
+                // The analyzers decide again with the results taken over
+                for (auto&& analyzer : m_analyzers) {
+                    analyzer.cancel();
+                }
+                processTrack = initializeAnalyzers(audioSource);
             }
         }
 
         if (processTrack) {
-            const auto analysisResult = analyzeAudioSource(audioSource);
+            const bool calculateAudioDigest =
+                    pAnalysisDao && trackId.isValid() && audioDigest.isEmpty();
+            const auto analysisResult = analyzeAudioSource(
+                    audioSource,
+                    calculateAudioDigest ? &audioDigest : nullptr);
             DEBUG_ASSERT(analysisResult != AnalysisResult::Pending);
+            if (m_pPipeline) {
+                // Wait until the analyzers are done with the decoded blocks
+                m_pPipeline->drain();
+            }
             if (analysisResult == AnalysisResult::Finished) {
                 // The analysis has been finished, and is either complete without
                 // any errors or partial if it has been aborted due to a corrupt
@@ -162,6 +205,9 @@ void AnalyzerThread::doRun() {
                 // and again, because it is very unlikely that the error vanishes
                 // suddenly.
                 emitBusyProgress(kAnalyzerProgressFinalizing);
+                if (calculateAudioDigest && !audioDigest.isEmpty()) {
+                    pAnalysisDao->saveAudioDigest(trackId, audioDigest);
+                }
                 // This takes around 3 sec on a Atom Netbook
                 for (auto&& analyzer : m_analyzers) {
                     analyzer.finish(*m_currentTrack);
@@ -181,6 +227,8 @@ void AnalyzerThread::doRun() {
     DEBUG_ASSERT(!m_currentTrack);
     DEBUG_ASSERT(isStopping());
 
+    // The pipeline stages must be stopped before destroying the analyzers
+    m_pPipeline.reset();
     m_analyzers.clear();
 
     kLogger.debug() << "Exiting worker thread";
@@ -218,9 +266,78 @@ WorkerThread::TryFetchWorkItemsResult AnalyzerThread::tryFetchWorkItems() {
     }
 }
 
-AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
+bool AnalyzerThread::initializeAnalyzers(
         const mixxx::AudioSourcePointer& audioSource) {
     DEBUG_ASSERT(m_currentTrack.has_value());
+    bool processTrack = false;
+    for (auto&& analyzer : m_analyzers) {
+        // Make sure not to short-circuit initialize(...)
+        if (analyzer.initialize(
+                    *m_currentTrack,
+                    audioSource->getSignalInfo().getSampleRate(),
+                    audioSource->frameLength())) {
+            processTrack = true;
+        }
+    }
+    return processTrack;
+}
+
+bool AnalyzerThread::reuseAnalysesOfSameAudio(
+        AnalysisDao* pAnalysisDao,
+        const mixxx::AudioDigest& audioDigest,
+        const mixxx::AudioSourcePointer& audioSource) {
+    DEBUG_ASSERT(m_currentTrack.has_value());
+    if (audioDigest.isEmpty()) {
+        // Not known before the track has been analyzed once
+        return false;
+    }
+    const TrackPointer pTrack = m_currentTrack->getTrack();
+    const TrackId trackId = pTrack->getId();
+
+    // The waveforms are reused by AnalyzerWaveform, the other results
+    // are stored in the library table and only taken over if missing.
+    // The analyzers then decide if they need to be updated.
+    const auto libraryAnalysis =
+            pAnalysisDao->getLibraryAnalysisForAudioDigest(audioDigest, trackId);
+    if (!libraryAnalysis) {
+        return false;
+    }
+    bool reused = false;
+    if (!pTrack->getBeats() && !libraryAnalysis->beatsVersion.isEmpty()) {
+        const mixxx::BeatsPointer pBeats = mixxx::Beats::fromByteArray(
+                audioSource->getSignalInfo().getSampleRate(),
+                libraryAnalysis->beatsVersion,
+                libraryAnalysis->beatsSubVersion,
+                libraryAnalysis->beats);
+        if (pBeats) {
+            if (libraryAnalysis->bpmLocked) {
+                reused |= pTrack->trySetAndLockBeats(pBeats);
+            } else {
+                reused |= pTrack->trySetBeats(pBeats);
+            }
+        }
+    }
+    if (pTrack->getKeys().getGlobalKey() == mixxx::track::io::key::INVALID &&
+            !libraryAnalysis->keysVersion.isEmpty()) {
+        QByteArray keysBlob = libraryAnalysis->keys;
+        pTrack->setKeys(KeyFactory::loadKeysFromByteArray(
+                libraryAnalysis->keysVersion,
+                libraryAnalysis->keysSubVersion,
+                &keysBlob));
+        reused = true;
+    }
+    if (!pTrack->getReplayGain().hasRatio() &&
+            libraryAnalysis->replayGain.hasRatio()) {
+        pTrack->setReplayGain(libraryAnalysis->replayGain);
+        reused = true;
+    }
+    return reused;
+}
+
+AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
+        const mixxx::AudioSourcePointer& audioSource,
+        mixxx::AudioDigest* pAudioDigest) {
+    DEBUG_ASSERT(m_currentTrack.has_value());
 
     mixxx::AudioSourceStereoProxy audioSourceProxy(
             audioSource,
@@ -229,6 +346,13 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
             audioSourceProxy.getSignalInfo().getChannelCount() ==
             mixxx::kAnalysisChannels);
 
+    std::optional<mixxx::AudioDigestCalculator> audioDigestCalculator;
+    if (pAudioDigest) {
+        audioDigestCalculator.emplace(
+                audioSourceProxy.getSignalInfo(),
+                audioSource->frameLength());
+    }
+
     // Analysis starts now
     emitBusyProgress(kAnalyzerProgressNone);
 
@@ -247,12 +371,16 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
                         math_min(mixxx::kAnalysisFramesPerChunk, remainingFrameRange.length()));
         DEBUG_ASSERT(!chunkFrameRange.empty());
 
-        // Request the next chunk of audio data
+        // Request the next chunk of audio data. In pipelined mode the data
+        // is decoded directly into the next free block of the pipeline.
         const auto readableSampleFrames =
                 audioSourceProxy.readSampleFrames(
                         mixxx::WritableSampleFrames(
                                 chunkFrameRange,
-                                mixxx::SampleBuffer::WritableSlice(m_sampleBuffer)));
+                                m_pPipeline
+                                        ? m_pPipeline->nextWritableBlock()
+                                        : mixxx::SampleBuffer::WritableSlice(
+                                                  m_sampleBuffer)));
         // The returned range fits into the requested range
         DEBUG_ASSERT(readableSampleFrames.frameIndexRange().isSubrangeOf(chunkFrameRange));
 
@@ -297,11 +425,22 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
 
         // 2nd: step: Analyze chunk of decoded audio data
         if (!readableSampleFrames.frameIndexRange().empty()) {
-            for (auto&& analyzer : m_analyzers) {
-                analyzer.processSamples(
+            if (audioDigestCalculator) {
+                audioDigestCalculator->addSamples(
                         readableSampleFrames.readableData(),
                         readableSampleFrames.readableLength());
             }
+            if (m_pPipeline) {
+                m_pPipeline->publishBlock(
+                        readableSampleFrames.readableData(),
+                        readableSampleFrames.readableLength());
+            } else {
+                for (auto&& analyzer : m_analyzers) {
+                    analyzer.processSamples(
+                            readableSampleFrames.readableData(),
+                            readableSampleFrames.readableLength());
+                }
+            }
         }
 
         // Don't check again for paused/stopped again and simply finish
@@ -326,6 +465,9 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
         }
     }
 
+    if (audioDigestCalculator) {
+        *pAudioDigest = audioDigestCalculator->finish();
+    }
     return AnalysisResult::Finished;
 }
 
@@ -4,10 +4,12 @@
 #include <vector>
 
 #include "analyzer/analyzer.h"
+#include "analyzer/analyzerpipeline.h"
 #include "analyzer/analyzerprogress.h"
 #include "analyzer/analyzertrack.h"
 #include "preferences/usersettings.h"
 #include "rigtorp/SPSCQueue.h"
+#include "sources/audiodigest.h"
 #include "sources/audiosource.h"
 #include "track/track_decl.h"
 #include "track/trackid.h"
@@ -17,11 +19,16 @@
 #include "util/samplebuffer.h"
 #include "util/workerthread.h"
 
+class AnalysisDao;
+
 enum AnalyzerModeFlags {
     None = 0x00,
     WithBeats = 0x01,
     WithWaveform = 0x02,
     LowPriority = 0x04,
+    // Decode on the analyzer thread and run the analyzers in parallel,
+    // see AnalyzerPipeline
+    Pipelined = 0x08,
     All = WithBeats | WithWaveform,
 };
 
@@ -118,6 +125,9 @@ class AnalyzerThread : public WorkerThread {
 
     std::vector<AnalyzerWithState> m_analyzers;
 
+    // Only used in pipelined mode
+    std::unique_ptr<AnalyzerPipeline> m_pPipeline;
+
     mixxx::SampleBuffer m_sampleBuffer;
 
     std::optional<AnalyzerTrack> m_currentTrack;
@@ -131,7 +141,22 @@ class AnalyzerThread : public WorkerThread {
         Finished,
         Cancelled,
     };
+    // Also calculates the digest of the decoded audio if pAudioDigest
+    // is not null. It is only valid if the analysis has been finished.
     AnalysisResult analyzeAudioSource(
+            const mixxx::AudioSourcePointer& audioSource,
+            mixxx::AudioDigest* pAudioDigest);
+
+    // Returns true if any of the analyzers needs to process the track
+    bool initializeAnalyzers(
+            const mixxx::AudioSourcePointer& audioSource);
+
+    // Takes over the results of previous analyses of the same audio
+    // content from other tracks in the library. Returns true if any
+    // results have been taken over.
+    bool reuseAnalysesOfSameAudio(
+            AnalysisDao* pAnalysisDao,
+            const mixxx::AudioDigest& audioDigest,
             const mixxx::AudioSourcePointer& audioSource);
 
     // Blocks the worker thread until a next track becomes available
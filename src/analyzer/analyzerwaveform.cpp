@@ -138,6 +138,21 @@ bool AnalyzerWaveform::shouldAnalyze(TrackPointer tio) const {
         }
     }
 
+    if (trackId.isValid() && (missingWaveform || missingWavesummary)) {
+        // Reuse the waveforms of a copy of the same audio file
+        const QByteArray audioDigest = m_analysisDao.getAudioDigest(trackId);
+        if (missingWaveform) {
+            pLoadedTrackWaveform = loadWaveformOfSameAudio(
+                    trackId, audioDigest, AnalysisDao::TYPE_WAVEFORM);
+            missingWaveform = pLoadedTrackWaveform.isNull();
+        }
+        if (missingWavesummary) {
+            pLoadedTrackWaveformSummary = loadWaveformOfSameAudio(
+                    trackId, audioDigest, AnalysisDao::TYPE_WAVESUMMARY);
+            missingWavesummary = pLoadedTrackWaveformSummary.isNull();
+        }
+    }
+
     // If we don't need to calculate the waveform/wavesummary, skip.
     if (!missingWaveform && !missingWavesummary) {
         kLogger.debug() << "loadStored - Stored waveform loaded";
@@ -152,6 +167,31 @@ bool AnalyzerWaveform::shouldAnalyze(TrackPointer tio) const {
     return true;
 }
 
+ConstWaveformPointer AnalyzerWaveform::loadWaveformOfSameAudio(
+        TrackId trackId,
+        const QByteArray& audioDigest,
+        AnalysisDao::AnalysisType type) const {
+    if (audioDigest.isEmpty()) {
+        return ConstWaveformPointer();
+    }
+    const QList<AnalysisDao::AnalysisInfo> analyses =
+            m_analysisDao.getAnalysesForAudioDigest(audioDigest, type, trackId);
+    for (AnalysisDao::AnalysisInfo analysis : analyses) {
+        const WaveformFactory::VersionClass vc = type == AnalysisDao::TYPE_WAVEFORM
+                ? WaveformFactory::waveformVersionToVersionClass(analysis.version)
+                : WaveformFactory::waveformSummaryVersionToVersionClass(analysis.version);
+        if (vc != WaveformFactory::VC_USE) {
+            continue;
+        }
+        // The copy stays valid when the other track is purged
+        if (!m_analysisDao.adoptAnalysis(&analysis, trackId)) {
+            continue;
+        }
+        return ConstWaveformPointer(WaveformFactory::loadWaveformFromAnalysis(analysis));
+    }
+    return ConstWaveformPointer();
+}
+
 void AnalyzerWaveform::createFilters(mixxx::audio::SampleRate sampleRate) {
     // m_filter[Low] = new EngineFilterButterworth8Low(sampleRate, kLowMidFreqHz);
     // m_filter[Mid] = new EngineFilterButterworth8Band(sampleRate, kLowMidFreqHz, kMidHighFreqHz);
@@ -150,6 +150,10 @@ class AnalyzerWaveform : public Analyzer {
 
   private:
     bool shouldAnalyze(TrackPointer tio) const;
+    ConstWaveformPointer loadWaveformOfSameAudio(
+            TrackId trackId,
+            const QByteArray& audioDigest,
+            AnalysisDao::AnalysisType type) const;
 
     void storeCurrentStridePower();
     void resetCurrentStride();
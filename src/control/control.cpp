@@ -1,5 +1,7 @@
 #include "control/control.h"
 
+#include <array>
+
 #include "control/controlobject.h"
 #include "moc_control.cpp"
 #include "util/stat.h"
@@ -13,17 +15,46 @@ namespace {
 /// configuration object would be arduous.
 UserSettingsPointer s_pUserConfig;
 
-/// Mutex guarding access to s_qCOHash and s_qCOAliasHash.
-MMutex s_qCOHashMutex;
+/// The registry of ControlDoublePrivate instantiations is split into shards
+/// with their own locks. Controls are looked up concurrently by the GUI, skin
+/// loading, controller scripts and QML, which all serialized on a single
+/// mutex before.
+constexpr std::size_t kControlRegistryShardCount = 64;
+
+/// Aligned to a cache line so that the locks of neighbouring shards don't
+/// suffer from false sharing.
+struct alignas(64) ControlRegistryShard {
+    MReadWriteLock lock;
+    QHash<ConfigKey, QWeakPointer<ControlDoublePrivate>> controls GUARDED_BY(lock);
+};
 
-/// Hash of ControlDoublePrivate instantiations.
-QHash<ConfigKey, QWeakPointer<ControlDoublePrivate>> s_qCOHash
-        GUARDED_BY(s_qCOHashMutex);
+std::array<ControlRegistryShard, kControlRegistryShardCount> s_controlRegistry;
+
+ControlRegistryShard& controlRegistryShard(const ConfigKey& key) {
+    return s_controlRegistry[qHash(key) % kControlRegistryShardCount];
+}
+
+/// Removes the entry for key if its control has been deleted
+void removeExpiredControl(const ConfigKey& key) {
+    ControlRegistryShard& shard = controlRegistryShard(key);
+    const MWriteLocker locker(&shard.lock);
+    const auto it = shard.controls.find(key);
+    // The entry might already be replaced by a new control with the same key
+    if (it != shard.controls.end() && it.value().isNull()) {
+        shard.controls.erase(it);
+    }
+}
+
+/// Mutex guarding access to s_qCOAliasHash.
+MMutex s_qCOAliasHashMutex;
 
 /// Hash of aliases between ConfigKeys. Solely used for looking up the first
 /// alias associated with a key.
 QHash<ConfigKey, ConfigKey> s_qCOAliasHash
-        GUARDED_BY(s_qCOHashMutex);
+        GUARDED_BY(s_qCOAliasHashMutex);
+
+/// Mutex guarding the creation of s_pDefaultCO.
+MMutex s_defaultCOMutex;
 
 /// is used instead of a nullptr, helps to omit null checks everywhere
 QWeakPointer<ControlDoublePrivate> s_pDefaultCO;
@@ -87,10 +118,8 @@ void ControlDoublePrivate::initialize(double defaultValue) {
 }
 
 ControlDoublePrivate::~ControlDoublePrivate() {
-    s_qCOHashMutex.lock();
-    //qDebug() << "ControlDoublePrivate::s_qCOHash.remove(" << m_key.group << "," << m_key.item << ")";
-    s_qCOHash.remove(m_key);
-    s_qCOHashMutex.unlock();
+    //qDebug() << "ControlDoublePrivate: removing (" << m_key.group << "," << m_key.item << ")";
+    removeExpiredControl(m_key);
 
     if (m_bPersistInConfiguration) {
         UserSettingsPointer pConfig = s_pUserConfig;
@@ -109,26 +138,34 @@ void ControlDoublePrivate::setUserConfig(const UserSettingsPointer& pConfig) {
 
 // static
 void ControlDoublePrivate::insertAlias(const ConfigKey& alias, const ConfigKey& key) {
-    MMutexLocker locker(&s_qCOHashMutex);
     VERIFY_OR_DEBUG_ASSERT(alias != key) {
         qWarning() << "cannot create alias with identical key" << key;
         return;
     }
 
-    auto it = s_qCOHash.constFind(key);
-    VERIFY_OR_DEBUG_ASSERT(it != s_qCOHash.constEnd()) {
-        qWarning() << "cannot create alias for null control" << key;
-        return;
+    QSharedPointer<ControlDoublePrivate> pControl;
+    {
+        ControlRegistryShard& shard = controlRegistryShard(key);
+        const MReadLocker locker(&shard.lock);
+        const auto it = shard.controls.constFind(key);
+        VERIFY_OR_DEBUG_ASSERT(it != shard.controls.constEnd()) {
+            qWarning() << "cannot create alias for null control" << key;
+            return;
+        }
+        pControl = it.value().lock();
     }
-
-    QSharedPointer<ControlDoublePrivate> pControl = it.value();
     VERIFY_OR_DEBUG_ASSERT(!pControl.isNull()) {
         qWarning() << "cannot create alias for expired control" << key;
         return;
     }
 
-    s_qCOAliasHash.insert(key, alias);
-    s_qCOHash.insert(alias, pControl);
+    {
+        const MMutexLocker locker(&s_qCOAliasHashMutex);
+        s_qCOAliasHash.insert(key, alias);
+    }
+    ControlRegistryShard& aliasShard = controlRegistryShard(alias);
+    const MWriteLocker locker(&aliasShard.lock);
+    aliasShard.controls.insert(alias, pControl);
 }
 
 // static
@@ -149,11 +186,14 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
         return nullptr;
     }
 
-    // Scope for MMutexLocker.
+    ControlRegistryShard& shard = controlRegistryShard(key);
+    bool expired = false;
+    // Scope for MReadLocker. Lookups only block while a control with a key
+    // of the same shard is created or deleted.
     {
-        const MMutexLocker locker(&s_qCOHashMutex);
-        const auto it = s_qCOHash.constFind(key);
-        if (it != s_qCOHash.constEnd()) {
+        const MReadLocker locker(&shard.lock);
+        const auto it = shard.controls.constFind(key);
+        if (it != shard.controls.constEnd()) {
             auto pControl = it.value().lock();
             if (pControl) {
                 auto actualKey = pControl->getKey();
@@ -176,10 +216,8 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
                     return nullptr;
                 }
                 return pControl;
-            } else {
-                // The weak pointer has become invalid and can be cleaned up
-                s_qCOHash.erase(it);
             }
+            expired = true;
         }
     }
 
@@ -191,12 +229,17 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
                         bTrack,
                         bPersist,
                         defaultValue));
-        const MMutexLocker locker(&s_qCOHashMutex);
-        //qDebug() << "ControlDoublePrivate::s_qCOHash.insert(" << key.group << "," << key.item << ")";
-        s_qCOHash.insert(key, pControl);
+        const MWriteLocker locker(&shard.lock);
+        //qDebug() << "ControlDoublePrivate: inserting (" << key.group << "," << key.item << ")";
+        shard.controls.insert(key, pControl);
         return pControl;
     }
 
+    if (expired) {
+        // The weak pointer has become invalid and can be cleaned up
+        removeExpiredControl(key);
+    }
+
     if (!flags.testFlag(ControlFlag::NoWarnIfMissing)) {
         qWarning() << "ControlDoublePrivate::getControl returning NULL for ("
                    << key.group << "," << key.item << ")";
@@ -212,7 +255,7 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getDefaultControl() {
         // Try again with the mutex locked to protect against creating two
         // ControlDoublePrivateConst objects. Access to s_defaultCO itself is
         // thread save.
-        MMutexLocker locker(&s_qCOHashMutex);
+        MMutexLocker locker(&s_defaultCOMutex);
         defaultCO = s_pDefaultCO.lock();
         if (!defaultCO) {
             defaultCO = QSharedPointer<ControlDoublePrivate>(new ControlDoublePrivateConst());
@@ -225,15 +268,13 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getDefaultControl() {
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::getAllInstances() {
     QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.constBegin(); it != s_qCOHash.constEnd(); ++it) {
-        auto pControl = it.value().lock();
-        if (pControl) {
-            result.append(std::move(pControl));
-        } else {
-            // The weak pointer has become invalid and can be cleaned up
-            s_qCOHash.erase(it);
+    for (auto& shard : s_controlRegistry) {
+        const MReadLocker locker(&shard.lock);
+        for (auto it = shard.controls.constBegin(); it != shard.controls.constEnd(); ++it) {
+            auto pControl = it.value().lock();
+            if (pControl) {
+                result.append(std::move(pControl));
+            }
         }
     }
     return result;
@@ -242,21 +283,22 @@ QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::getAllInstance
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::takeAllInstances() {
     QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.begin(); it != s_qCOHash.end(); ++it) {
-        auto pControl = it.value().lock();
-        if (pControl) {
-            result.append(std::move(pControl));
+    for (auto& shard : s_controlRegistry) {
+        const MWriteLocker locker(&shard.lock);
+        for (auto it = shard.controls.constBegin(); it != shard.controls.constEnd(); ++it) {
+            auto pControl = it.value().lock();
+            if (pControl) {
+                result.append(std::move(pControl));
+            }
         }
+        shard.controls.clear();
     }
-    s_qCOHash.clear();
     return result;
 }
 
 //static
 QHash<ConfigKey, ConfigKey> ControlDoublePrivate::getControlAliases() {
-    MMutexLocker locker(&s_qCOHashMutex);
+    MMutexLocker locker(&s_qCOAliasHashMutex);
     // lock thread-unsafe copy constructors of QHash
     return s_qCOAliasHash;
 }
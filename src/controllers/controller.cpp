@@ -8,8 +8,13 @@
 #include "controllers/defs_controllers.h"
 #include "moc_controller.cpp"
 #include "util/screensaver.h"
+#include "util/stat.h"
+#include "util/time.h"
 
 namespace {
+const Stat::ComputeFlags kInputLatencyStatFlags = Stat::COUNT | Stat::AVERAGE |
+        Stat::MIN | Stat::MAX | Stat::SAMPLE_VARIANCE | Stat::SAMPLE_MEDIAN;
+
 QString loggingCategoryPrefix(const QString& deviceName) {
     return QStringLiteral("controller.") +
             RuntimeLoggingCategory::removeInvalidCharsFromCategory(deviceName.toLower());
@@ -25,7 +30,9 @@ Controller::Controller(const QString& deviceName)
           m_bIsOutputDevice(false),
           m_bIsInputDevice(false),
           m_bIsOpen(false),
-          m_bLearning(false) {
+          m_bLearning(false),
+          m_inputLatencyStatTag(
+                  QStringLiteral("Controller %1 input latency").arg(deviceName)) {
     m_userActivityInhibitTimer.start();
 }
 
@@ -114,6 +121,19 @@ void Controller::triggerActivity()
         m_userActivityInhibitTimer.start();
     }
 }
+
+void Controller::trackInputLatency(mixxx::Duration timestamp) {
+    if (timestamp == mixxx::Duration::empty()) {
+        // Not stamped by the device, e.g. synthetic messages
+        return;
+    }
+    const mixxx::Duration latency = mixxx::Time::elapsed() - timestamp;
+    Stat::track(m_inputLatencyStatTag,
+            Stat::DURATION_NANOSEC,
+            kInputLatencyStatFlags,
+            static_cast<double>(latency.toIntegerNanos()));
+}
+
 void Controller::receive(const QByteArray& data, mixxx::Duration timestamp) {
     if (!m_pScriptEngineLegacy) {
         //qWarning() << "Controller::receive called with no active engine!";
@@ -148,4 +168,5 @@ void Controller::receive(const QByteArray& data, mixxx::Duration timestamp) {
     }
 
     m_pScriptEngineLegacy->handleIncomingData(data);
+    trackInputLatency(timestamp);
 }
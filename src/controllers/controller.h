@@ -117,6 +117,11 @@ class Controller : public QObject {
     // To be called when receiving events
     void triggerActivity();
 
+    // To be called after an input message has been processed. Records the
+    // time since the message was received by the device, measured with
+    // mixxx::Time, in the statistics shown by the developer tools.
+    void trackInputLatency(mixxx::Duration timestamp);
+
     inline ControllerScriptEngineLegacy* getScriptEngine() const {
         return m_pScriptEngineLegacy;
     }
@@ -167,6 +172,7 @@ class Controller : public QObject {
     bool m_bIsOpen;
     bool m_bLearning;
     QElapsedTimer m_userActivityInhibitTimer;
+    const QString m_inputLatencyStatTag;
 
     friend class ControllerJSProxy;
     // accesses lots of our stuff, but in the same thread
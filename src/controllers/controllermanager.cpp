@@ -25,14 +25,12 @@
 
 // http://developer.qt.nokia.com/wiki/Threads_Events_QObjects
 
-// Poll every 1ms (where possible) for good controller response
-#ifdef __LINUX__
-// Many Linux distros ship with the system tick set to 250Hz so 1ms timer
-// reportedly causes CPU hosage. See Bug #990992 rryan 6/2012
-const mixxx::Duration ControllerManager::kPollInterval = mixxx::Duration::fromMillis(5);
-#else
+// Poll every 1ms for good controller response. The 5ms interval that was
+// used on Linux to spare kernels with a 250Hz system tick (Bug #990992)
+// added up to 5ms of jitter to jog wheels. Current kernels use high
+// resolution timers and an idle poll takes only a few microseconds, while
+// pollDevices() skips a cycle if polling starts to overload the thread.
 const mixxx::Duration ControllerManager::kPollInterval = mixxx::Duration::fromMillis(1);
-#endif
 
 namespace {
 /// Strip slashes and spaces from device name, so that it can be used as config
@@ -98,6 +96,8 @@ ControllerManager::ControllerManager(UserSettingsPointer pConfig)
         QDir().mkpath(userMappings);
     }
 
+    // Keep millisecond accuracy instead of aligning with other timers
+    m_pollTimer.setTimerType(Qt::PreciseTimer);
     m_pollTimer.setInterval(kPollInterval.toIntegerMillis());
     connect(&m_pollTimer, &QTimer::timeout, this, &ControllerManager::pollDevices);
 
@@ -24,6 +24,12 @@ constexpr size_t kMaxHidErrorMessageSize = 512;
 // the fastest possible rate of HID devices with USB HighSpeed or USB SuperSpeed interface is 8kHz
 constexpr int kSleepTimeWhenIdleMicros = 250;
 
+// Timeout of the blocking read of the run loop, in idle case, when input is active.
+// The thread wakes up as soon as the device sends an InputReport, the timeout only
+// limits the delay of OutputReports that are cached while the thread is waiting.
+// hidapi only supports timeouts in milliseconds.
+constexpr int kReadTimeoutWhenIdleMillis = 1;
+
 QString loggingCategoryPrefix(const QString& deviceName) {
     return QStringLiteral("controller.") +
             RuntimeLoggingCategory::removeInvalidCharsFromCategory(deviceName.toLower());
@@ -49,6 +55,7 @@ HidIoThread::HidIoThread(
     for (int i = 0; i < kNumBuffers; i++) {
         memset(m_pPollData[i], 0, kBufferSize);
     }
+    memset(m_waitData, 0, kBufferSize);
     m_outputReportIterator = m_outputReports.begin();
     m_state.storeRelease(static_cast<int>(HidIoThreadState::Initialized));
 }
@@ -75,10 +82,8 @@ void HidIoThread::run() {
                         HidIoThreadState::Stopped)) {
                 break;
             }
-            // Sleep run loop, if no OutputReport was send
-            // Tests on Windows and Linux showed that the thread schedulers
-            // handle usleep wait times reliable under CPU load
-            usleep(kSleepTimeWhenIdleMicros);
+            // Wait for the next InputReport, if no OutputReport was send
+            waitForInputReport();
         }
     }
 }
@@ -117,6 +122,45 @@ void HidIoThread::pollBufferedInputReports() {
     }
 }
 
+void HidIoThread::waitForInputReport() {
+    if (m_state.loadAcquire() != static_cast<int>(HidIoThreadState::InputOutputActive)) {
+        // Sleep run loop, if no input is expected
+        // Tests on Windows and Linux showed that the thread schedulers
+        // handle usleep wait times reliable under CPU load
+        usleep(kSleepTimeWhenIdleMicros);
+        return;
+    }
+    Trace hidRead("HidIoThread waitForInputReport");
+    // Block until the device sends an InputReport, instead of sleeping for a fixed time,
+    // so that the InputReport is processed and timestamped without delay.
+    // All hidapi backends wait on the OS without busy polling.
+    // The mutex is not locked while waiting, otherwise getInputReport, sendFeatureReport
+    // and getFeatureReport called from the controller thread would be stalled.
+    // hidapi allows to read InputReports concurrently to these operations.
+    // m_waitData is only accessed by this thread.
+    int bytesRead = hid_read_timeout(m_pHidDevice,
+            m_waitData,
+            kBufferSize,
+            kReadTimeoutWhenIdleMillis);
+    auto hidDeviceLock = lockMutex(&m_hidDeviceAndPollMutex);
+    if (bytesRead < 0) {
+        qCWarning(m_logInput) << "Unable to wait for HID InputReports from"
+                              << m_deviceInfo.formatName() << ":"
+                              << mixxx::convertWCStringToQString(
+                                         hid_error(m_pHidDevice),
+                                         kMaxHidErrorMessageSize);
+        DEBUG_ASSERT(bytesRead == -1);
+        hidDeviceLock.unlock();
+        // Don't spin if the device is gone
+        usleep(kSleepTimeWhenIdleMicros);
+        return;
+    }
+    if (bytesRead > 0) {
+        memcpy(m_pPollData[m_pollingBufferIndex], m_waitData, bytesRead);
+        processInputReport(bytesRead);
+    }
+}
+
 void HidIoThread::processInputReport(int bytesRead) {
     Trace process("HidIO processInputReport");
     unsigned char* pPreviousBuffer = m_pPollData[(m_pollingBufferIndex + 1) % kNumBuffers];
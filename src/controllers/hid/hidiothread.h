@@ -58,6 +58,8 @@ class HidIoThread : public QThread {
     bool sendNextCachedOutputReport();
 
     void pollBufferedInputReports();
+    /// Blocks until an InputReport is received or a short timeout expires
+    void waitForInputReport();
     void processInputReport(int bytesRead);
 
     const mixxx::hid::DeviceInfo m_deviceInfo;
@@ -69,6 +71,8 @@ class HidIoThread : public QThread {
     /// If the hid_error functions is called after the hid device operation to get the error message,
     /// this mutex must not be unlocked before hid_error.
     /// This mutex must be locked also, for access to m_pPollData, m_lastPollSize, m_pollingBufferIndex.
+    /// The only exception is the blocking hid_read_timeout in waitForInputReport,
+    /// which would otherwise stall the operations called from the controller thread.
     QMutex m_hidDeviceAndPollMutex;
 
     /// const pointer to the C data structure, which hidapi uses for communication between functions
@@ -80,6 +84,9 @@ class HidIoThread : public QThread {
     unsigned char m_pPollData[kNumBuffers][kBufferSize];
     int m_lastPollSize;
     int m_pollingBufferIndex;
+    /// Buffer of the blocking read in waitForInputReport, which is executed
+    /// without locking m_hidDeviceAndPollMutex. Only accessed by the run loop.
+    unsigned char m_waitData[kBufferSize];
 
     /// Must be locked when a operation changes the size of the m_outputReports map,
     /// or when modify the m_outputReportIterator
@@ -3,6 +3,7 @@
 #include "control/controlobject.h"
 #include "controllers/defs_controllers.h"
 #include "controllers/midi/midiutils.h"
+#include "controllers/scripting/legacy/controllerscriptenginelegacy.h"
 #include "defs_urls.h"
 #include "errordialoghandler.h"
 #include "mixer/playermanager.h"
@@ -14,6 +15,10 @@
 MidiController::MidiController(const QString& deviceName)
         : Controller(deviceName) {
     setDeviceCategory(tr("MIDI Controller"));
+    m_scriptArguments.reserve(MidiInputDispatchTable::kScriptArgumentCount);
+    for (int i = 0; i < MidiInputDispatchTable::kScriptArgumentCount; ++i) {
+        m_scriptArguments.append(QJSValue());
+    }
 }
 
 MidiController::~MidiController() {
@@ -32,6 +37,11 @@ QString MidiController::mappingExtension() {
 
 void MidiController::setMapping(std::shared_ptr<LegacyControllerMapping> pMapping) {
     m_pMapping = downcastAndTakeOwnership<LegacyMidiControllerMapping>(std::move(pMapping));
+    if (m_pMapping) {
+        m_inputDispatchTable.compile(m_pMapping->getInputMappings());
+    } else {
+        m_inputDispatchTable.clear();
+    }
 }
 
 std::shared_ptr<LegacyControllerMapping> MidiController::cloneMapping() {
@@ -56,6 +66,12 @@ bool MidiController::applyMapping() {
     // Handles the engine
     bool result = Controller::applyMapping();
 
+    // Drop the functions of the previous script engine and resolve the
+    // controls that have been created since the mapping has been set
+    if (m_pMapping) {
+        m_inputDispatchTable.compile(m_pMapping->getInputMappings());
+    }
+
     // Only execute this code if this is an output device
     if (isOutputDevice()) {
         if (m_outputs.count() > 0) {
@@ -208,6 +224,7 @@ void MidiController::commitTemporaryInputMappings() {
         m_pMapping->addInputMapping(it.key(), it.value());
     }
     m_temporaryInputMappings.clear();
+    m_inputDispatchTable.compile(m_pMapping->getInputMappings());
 }
 
 void MidiController::receivedShortMessage(unsigned char status,
@@ -251,18 +268,29 @@ void MidiController::receivedShortMessage(unsigned char status,
         }
     }
 
-    auto it = m_pMapping->getInputMappings().constFind(mappingKey.key);
-    for (; it != m_pMapping->getInputMappings().constEnd() && it.key() == mappingKey.key; ++it) {
-        processInputMapping(it.value(), status, control, value, timestamp);
+    for (auto& entry : m_inputDispatchTable.entries(mappingKey)) {
+        processInputMapping(&entry, status, control, value, timestamp);
     }
+    trackInputLatency(timestamp);
 }
 
 void MidiController::processInputMapping(const MidiInputMapping& mapping,
-                                         unsigned char status,
-                                         unsigned char control,
-                                         unsigned char value,
-                                         mixxx::Duration timestamp) {
+        unsigned char status,
+        unsigned char control,
+        unsigned char value,
+        mixxx::Duration timestamp) {
+    // Temporary mappings are not compiled into the dispatch table
+    MidiInputDispatchTable::Entry entry(mapping);
+    processInputMapping(&entry, status, control, value, timestamp);
+}
+
+void MidiController::processInputMapping(MidiInputDispatchTable::Entry* pEntry,
+        unsigned char status,
+        unsigned char control,
+        unsigned char value,
+        mixxx::Duration timestamp) {
     Q_UNUSED(timestamp);
+    const MidiInputMapping& mapping = pEntry->mapping();
     unsigned char channel = MidiUtils::channelFromStatus(status);
     MidiOpCode opCode = MidiUtils::opCodeFromStatus(status);
 
@@ -272,15 +300,12 @@ void MidiController::processInputMapping(const MidiInputMapping& mapping,
             return;
         }
 
-        QJSValue function = pEngine->wrapFunctionCode(mapping.control.item, 5);
-        const auto args = QJSValueList{
-                channel,
-                control,
-                value,
-                status,
-                mapping.control.group,
-        };
-        if (!pEngine->executeFunction(&function, args)) {
+        m_scriptArguments[0] = QJSValue(channel);
+        m_scriptArguments[1] = QJSValue(control);
+        m_scriptArguments[2] = QJSValue(value);
+        m_scriptArguments[3] = QJSValue(status);
+        m_scriptArguments[4] = pEntry->scriptGroup();
+        if (!pEngine->executeFunction(pEntry->scriptFunction(pEngine), m_scriptArguments)) {
             qCWarning(m_logBase) << "MidiController: Invalid script function"
                                  << mapping.control.item;
         }
@@ -288,7 +313,7 @@ void MidiController::processInputMapping(const MidiInputMapping& mapping,
     }
 
     // Only pass values on to valid ControlObjects.
-    ControlObject* pCO = ControlObject::getControl(mapping.control);
+    ControlObject* pCO = pEntry->control();
     if (pCO == nullptr) {
         return;
     }
@@ -515,10 +540,10 @@ void MidiController::receive(const QByteArray& data, mixxx::Duration timestamp)
         }
     }
 
-    auto it = m_pMapping->getInputMappings().constFind(mappingKey.key);
-    for (; it != m_pMapping->getInputMappings().constEnd() && it.key() == mappingKey.key; ++it) {
-        processInputMapping(it.value(), data, timestamp);
+    for (const auto& entry : m_inputDispatchTable.entries(mappingKey)) {
+        processInputMapping(entry.mapping(), data, timestamp);
     }
+    trackInputLatency(timestamp);
 }
 
 void MidiController::processInputMapping(const MidiInputMapping& mapping,
@@ -3,6 +3,7 @@
 #include "controllers/controller.h"
 #include "controllers/midi/legacymidicontrollermapping.h"
 #include "controllers/midi/legacymidicontrollermappingfilehandler.h"
+#include "controllers/midi/midiinputdispatchtable.h"
 #include "controllers/midi/midimessage.h"
 #include "controllers/midi/midioutputhandler.h"
 #include "controllers/softtakeover.h"
@@ -77,6 +78,12 @@ class MidiController : public Controller {
             unsigned char control,
             unsigned char value,
             mixxx::Duration timestamp);
+    void processInputMapping(
+            MidiInputDispatchTable::Entry* pEntry,
+            unsigned char status,
+            unsigned char control,
+            unsigned char value,
+            mixxx::Duration timestamp);
     void processInputMapping(
             const MidiInputMapping& mapping,
             const QByteArray& data,
@@ -90,6 +97,10 @@ class MidiController : public Controller {
     QHash<uint16_t, MidiInputMapping> m_temporaryInputMappings;
     QList<MidiOutputHandler*> m_outputs;
     std::shared_ptr<LegacyMidiControllerMapping> m_pMapping;
+    // The input mappings of m_pMapping, must be recompiled when they change
+    MidiInputDispatchTable m_inputDispatchTable;
+    // Reused for calling script functions
+    QJSValueList m_scriptArguments;
     SoftTakeoverCtrl m_st;
     QList<QPair<MidiInputMapping, unsigned char>> m_fourteen_bit_queued_mappings;
 
@@ -0,0 +1,89 @@
+#include "controllers/midi/midiinputdispatchtable.h"
+
+#include "control/control.h"
+#include "controllers/scripting/legacy/controllerscriptenginelegacy.h"
+
+MidiInputDispatchTable::Entry::Entry(const MidiInputMapping& mapping)
+        : m_mapping(mapping),
+          m_scriptGeneration(0) {
+    if (m_mapping.options.testFlag(MidiOption::Script)) {
+        m_scriptGroup = QJSValue(m_mapping.control.group);
+    } else {
+        m_pControl = ControlDoublePrivate::getControl(m_mapping.control,
+                ControlFlag::AllowMissingOrInvalid | ControlFlag::NoWarnIfMissing);
+    }
+}
+
+ControlObject* MidiInputDispatchTable::Entry::control() {
+    if (const auto pControl = m_pControl.lock()) {
+        ControlObject* pCO = pControl->getCreatorCO();
+        if (pCO) {
+            return pCO;
+        }
+    }
+    // Warn about missing controls like ControlObject::getControl()
+    const auto pControl = ControlDoublePrivate::getControl(m_mapping.control);
+    m_pControl = pControl;
+    return pControl ? pControl->getCreatorCO() : nullptr;
+}
+
+QJSValue* MidiInputDispatchTable::Entry::scriptFunction(
+        ControllerScriptEngineLegacy* pEngine) {
+    DEBUG_ASSERT(pEngine);
+    if (m_scriptGeneration != pEngine->scriptGeneration()) {
+        m_scriptFunction = pEngine->wrapFunctionCode(
+                m_mapping.control.item, kScriptArgumentCount);
+        m_scriptGeneration = pEngine->scriptGeneration();
+    }
+    return &m_scriptFunction;
+}
+
+MidiInputDispatchTable::MidiInputDispatchTable() = default;
+
+void MidiInputDispatchTable::compile(
+        const QMultiHash<uint16_t, MidiInputMapping>& mappings) {
+    clear();
+    if (mappings.isEmpty()) {
+        return;
+    }
+
+    // Counting sort by slot that preserves the order of the hash
+    std::vector<quint32> counts(kSlotCount, 0);
+    for (auto it = mappings.constBegin(); it != mappings.constEnd(); ++it) {
+        MidiKey key;
+        key.key = it.key();
+        if (key.status < 0x80) {
+            // Unreachable
+            continue;
+        }
+        ++counts[slotIndex(key.status, key.control)];
+    }
+    m_offsets.resize(kSlotCount + 1);
+    m_offsets[0] = 0;
+    for (std::size_t i = 0; i < kSlotCount; ++i) {
+        m_offsets[i + 1] = m_offsets[i] + counts[i];
+    }
+
+    std::vector<const MidiInputMapping*> sortedMappings(m_offsets[kSlotCount]);
+    for (std::size_t i = 0; i < kSlotCount; ++i) {
+        counts[i] = m_offsets[i];
+    }
+    for (auto it = mappings.constBegin(); it != mappings.constEnd(); ++it) {
+        MidiKey key;
+        key.key = it.key();
+        if (key.status < 0x80) {
+            continue;
+        }
+        sortedMappings[counts[slotIndex(key.status, key.control)]++] = &it.value();
+    }
+
+    m_entries.reserve(sortedMappings.size());
+    for (const MidiInputMapping* pMapping : sortedMappings) {
+        m_entries.emplace_back(*pMapping);
+    }
+}
+
+void MidiInputDispatchTable::clear() {
+    m_offsets.clear();
+    m_entries.clear();
+}
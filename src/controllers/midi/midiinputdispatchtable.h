@@ -0,0 +1,97 @@
+#pragma once
+
+#include <QJSValue>
+#include <QMultiHash>
+#include <QSharedPointer>
+#include <span>
+#include <vector>
+
+#include "controllers/midi/midimessage.h"
+
+class ControlDoublePrivate;
+class ControlObject;
+class ControllerScriptEngineLegacy;
+
+/// The input mappings of a MidiController, compiled into a flat table that
+/// is indexed by the status and control byte of incoming messages.
+///
+/// Looking up the mappings in the QMultiHash of the mapping and resolving
+/// their ControlObjects in the global control hash for every message is
+/// too expensive for the bursts of messages sent by jog wheels. The entries
+/// of the table cache the resolved control and script function instead.
+class MidiInputDispatchTable {
+  public:
+    /// Script functions are called with the channel, control, value,
+    /// status and group of the message
+    static constexpr int kScriptArgumentCount = 5;
+
+    class Entry {
+      public:
+        explicit Entry(const MidiInputMapping& mapping);
+
+        const MidiInputMapping& mapping() const {
+            return m_mapping;
+        }
+
+        /// Returns the ControlObject of a control mapping. Controls that
+        /// did not exist when the table was compiled, or that have been
+        /// deleted in the meantime, are looked up again.
+        ControlObject* control();
+
+        /// Returns the wrapped function of a script mapping, which is only
+        /// wrapped again after the scripts have been reloaded.
+        QJSValue* scriptFunction(ControllerScriptEngineLegacy* pEngine);
+
+        /// The group of a script mapping that is passed as the last argument
+        const QJSValue& scriptGroup() const {
+            return m_scriptGroup;
+        }
+
+      private:
+        friend class MidiInputDispatchTable;
+
+        MidiInputMapping m_mapping;
+        // Weak, because holding the control would prevent recreating a
+        // deleted ControlObject with the same key.
+        QWeakPointer<ControlDoublePrivate> m_pControl;
+        QJSValue m_scriptFunction;
+        QJSValue m_scriptGroup;
+        int m_scriptGeneration;
+    };
+
+    MidiInputDispatchTable();
+
+    /// Replaces the contents of the table. Controls are resolved now if they
+    /// already exist, script functions when they are executed first.
+    void compile(const QMultiHash<uint16_t, MidiInputMapping>& mappings);
+
+    void clear();
+
+    bool isEmpty() const {
+        return m_entries.empty();
+    }
+
+    /// Returns the entries for a message in the order in which they would
+    /// be found in the QMultiHash of the mapping.
+    std::span<Entry> entries(MidiKey key) {
+        // Only status bytes have the most significant bit set
+        if (key.status < 0x80 || m_offsets.empty()) {
+            return {};
+        }
+        const std::size_t index = slotIndex(key.status, key.control);
+        return std::span<Entry>(m_entries.data() + m_offsets[index],
+                m_offsets[index + 1] - m_offsets[index]);
+    }
+
+  private:
+    static constexpr std::size_t kSlotCount = 0x80 * 0x100;
+
+    static std::size_t slotIndex(unsigned char status, unsigned char control) {
+        return (static_cast<std::size_t>(status & 0x7F) << 8) | control;
+    }
+
+    // The entries of slot i are m_entries[m_offsets[i]] up to, but not
+    // including, m_entries[m_offsets[i + 1]]
+    std::vector<quint32> m_offsets;
+    std::vector<Entry> m_entries;
+};
@@ -2,6 +2,8 @@
 
 #include <portmidi.h>
 
+#include "util/time.h"
+
 class PortMidiDevice {
   public:
     PortMidiDevice(const PmDeviceInfo* deviceInfo,
@@ -30,7 +32,7 @@ class PortMidiDevice {
         return Pm_OpenInput(&m_pStream, m_deviceIndex,
                             NULL, // no drive hacks
                             bufferSize,
-                            NULL,
+                            &elapsedMillis,
                             NULL);
     }
 
@@ -67,6 +69,14 @@ class PortMidiDevice {
     }
 
   private:
+    // Stamps received messages with mixxx::Time instead of PortTime, like
+    // the other controller backends, so that the input latency can be
+    // measured against mixxx::Time::elapsed().
+    static PmTimestamp elapsedMillis(void* pTimeInfo) {
+        Q_UNUSED(pTimeInfo);
+        return static_cast<PmTimestamp>(mixxx::Time::elapsed().toIntegerMillis());
+    }
+
     const PmDeviceInfo* m_pDeviceInfo;
     int m_deviceIndex;
     PortMidiStream* m_pStream;
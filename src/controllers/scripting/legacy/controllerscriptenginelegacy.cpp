@@ -8,9 +8,13 @@
 #include "mixer/playermanager.h"
 #include "moc_controllerscriptenginelegacy.cpp"
 
+// static
+QAtomicInt ControllerScriptEngineLegacy::s_scriptGenerationCounter = 0;
+
 ControllerScriptEngineLegacy::ControllerScriptEngineLegacy(
         Controller* controller, const RuntimeLoggingCategory& logger)
-        : ControllerScriptEngineBase(controller, logger) {
+        : ControllerScriptEngineBase(controller, logger),
+          m_scriptGeneration(s_scriptGenerationCounter.fetchAndAddRelaxed(1) + 1) {
     connect(&m_fileWatcher,
             &QFileSystemWatcher::fileChanged,
             this,
@@ -100,6 +104,7 @@ void ControllerScriptEngineLegacy::setScriptFiles(
 }
 
 bool ControllerScriptEngineLegacy::initialize() {
+    m_scriptGeneration = s_scriptGenerationCounter.fetchAndAddRelaxed(1) + 1;
     if (!ControllerScriptEngineBase::initialize()) {
         return false;
     }
@@ -172,6 +177,7 @@ void ControllerScriptEngineLegacy::shutdown() {
     if (m_pJSEngine) {
         callFunctionOnObjects(m_scriptFunctionPrefixes, "shutdown");
     }
+    m_scriptGeneration = s_scriptGenerationCounter.fetchAndAddRelaxed(1) + 1;
     m_scriptWrappedFunctionCache.clear();
     m_incomingDataFunctions.clear();
     m_scriptFunctionPrefixes.clear();
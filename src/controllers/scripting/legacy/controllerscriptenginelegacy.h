@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QAtomicInt>
 #include <QFileSystemWatcher>
 #include <QJSEngine>
 #include <QJSValue>
@@ -26,6 +27,13 @@ class ControllerScriptEngineLegacy : public ControllerScriptEngineBase {
     /// and ensures the function is executed with the correct 'this' object.
     QJSValue wrapFunctionCode(const QString& codeSnippet, int numberOfArgs);
 
+    /// Changes whenever the scripts are (re)loaded or shut down, which
+    /// invalidates all functions returned by wrapFunctionCode(). Unique
+    /// across all engines.
+    int scriptGeneration() const {
+        return m_scriptGeneration;
+    }
+
   public slots:
     void setScriptFiles(const QList<LegacyControllerMapping::ScriptFileInfo>& scripts);
 
@@ -47,6 +55,9 @@ class ControllerScriptEngineLegacy : public ControllerScriptEngineBase {
 
     QFileSystemWatcher m_fileWatcher;
 
+    static QAtomicInt s_scriptGenerationCounter;
+    int m_scriptGeneration;
+
     // There is lots of tight coupling between ControllerScriptEngineLegacy
     // and ControllerScriptInterface. This is probably not worth improving in legacy code.
     friend class ControllerScriptInterfaceLegacy;
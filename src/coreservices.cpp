@@ -14,6 +14,7 @@
 #include "database/mixxxdb.h"
 #include "effects/effectsmanager.h"
 #include "engine/enginemixer.h"
+#include "engine/engineprofiler.h"
 #include "library/coverartcache.h"
 #include "library/library.h"
 #include "library/library_prefs.h"
@@ -27,6 +28,9 @@
 #include "preferences/dialog/dlgprefmodplug.h"
 #endif
 #include "soundio/soundmanager.h"
+#ifdef __MAD__
+#include "sources/soundsourcemp3.h"
+#endif
 #include "sources/soundsourceproxy.h"
 #include "util/db/dbconnectionpooled.h"
 #include "util/font.h"
@@ -120,6 +124,9 @@ CoreServices::CoreServices(const CmdlineArgs& args, QApplication* pApp)
     if (m_cmdlineArgs.getDeveloper()) {
         StatsManager::createInstance();
     }
+    // The engine profiler is cheap enough to always be enabled, so that
+    // xruns can be attributed even if they are rare.
+    EngineProfiler::createInstance();
     mixxx::Translations::initializeTranslations(
             m_pSettingsManager->settings(), pApp, m_cmdlineArgs.getLocale());
     initializeKeyboard();
@@ -138,6 +145,7 @@ CoreServices::~CoreServices() {
     if (m_cmdlineArgs.getDeveloper()) {
         StatsManager::destroy();
     }
+    EngineProfiler::destroy();
 
     // HACK: Save config again. We saved it once before doing some dangerous
     // stuff. We only really want to save it here, but the first one was just
@@ -234,6 +242,12 @@ void CoreServices::initialize(QApplication* pApp) {
 
     Sandbox::setPermissionsFilePath(QDir(pConfig->getSettingsPath()).filePath("sandbox.cfg"));
 
+#ifdef __MAD__
+    // Avoid decoding all frame headers whenever an MP3 file is opened
+    mixxx::SoundSourceMp3::setSeekFrameCacheDir(
+            QDir(pConfig->getSettingsPath()).filePath("mp3seekframes"));
+#endif
+
     QString resourcePath = pConfig->getResourcePath();
 
     emit initializationProgressUpdate(0, tr("fonts"));
@@ -331,6 +345,9 @@ void CoreServices::initialize(QApplication* pApp) {
             &ScreensaverManager::slotCurrentPlayingDeckChanged);
 
     emit initializationProgressUpdate(50, tr("library"));
+    // Keep the resized covers of the library table across restarts
+    CoverArtCache::setThumbnailCacheDir(
+            QDir(pConfig->getSettingsPath()).filePath("coverthumbnails"));
     CoverArtCache::createInstance();
 
     m_pTrackCollectionManager = std::make_shared<TrackCollectionManager>(
@@ -415,6 +432,8 @@ void CoreServices::initialize(QApplication* pApp) {
 #endif
 
     rescan = rescan || (prev_plugins != curr_plugins);
+    // The watched directories are only known after a full scan
+    rescan = rescan || pConfig->getValue(library::prefs::kWatchDirectoriesConfigKey, false);
     pConfig->set(ConfigKey("[Library]", "SupportedFileExtensions"),
             supportedFileSuffixes.join(","));
 
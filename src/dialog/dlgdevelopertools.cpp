@@ -3,6 +3,7 @@
 #include <QDateTime>
 
 #include "control/control.h"
+#include "engine/engineprofiler.h"
 #include "moc_dlgdevelopertools.cpp"
 #include "util/cmdlineargs.h"
 #include "util/logging.h"
@@ -31,6 +32,26 @@ DlgDeveloperTools::DlgDeveloperTools(QWidget* pParent,
     m_statProxyModel.setSourceModel(&m_statModel);
     statsTable->setModel(&m_statProxyModel);
 
+    engineStagesTable->setColumnCount(7);
+    engineStagesTable->setHorizontalHeaderLabels({tr("Stage"),
+            tr("Count"),
+            tr("p50 (us)"),
+            tr("p90 (us)"),
+            tr("p99 (us)"),
+            tr("Max (us)"),
+            tr("Overruns")});
+    engineOverrunsTable->setColumnCount(6);
+    engineOverrunsTable->setHorizontalHeaderLabels({tr("Callback"),
+            tr("Duration (us)"),
+            tr("Budget (us)"),
+            tr("Xrun"),
+            tr("Stage"),
+            tr("Stage Duration (us)")});
+    connect(engineTraceExport,
+            &QPushButton::clicked,
+            this,
+            &DlgDeveloperTools::slotEngineTraceExport);
+
     QString logFileName = QDir(pConfig->getSettingsPath()).filePath("mixxx.log");
     m_logFile.setFileName(logFileName);
     if (!m_logFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
@@ -98,6 +119,69 @@ void DlgDeveloperTools::timerEvent(QTimerEvent* pEvent) {
         if (pManager) {
             pManager->updateStats();
         }
+    } else if (toolTabWidget->currentWidget() == engineTab) {
+        updateEngineProfile();
+    }
+}
+
+void DlgDeveloperTools::updateEngineProfile() {
+    if (!EngineProfiler::s_bEngineProfilerEnabled) {
+        return;
+    }
+    const EngineProfiler* pProfiler = EngineProfiler::instance();
+    const auto toMicros = [](qint64 nanos) {
+        return QString::number(nanos / 1000.0, 'f', 1);
+    };
+    const auto setItem = [](QTableWidget* pTable, int row, int column, const QString& text) {
+        QTableWidgetItem* pItem = pTable->item(row, column);
+        if (pItem) {
+            pItem->setText(text);
+        } else {
+            pTable->setItem(row, column, new QTableWidgetItem(text));
+        }
+    };
+
+    const QList<EngineProfiler::StageStats> stageStats = pProfiler->stageStats();
+    engineStagesTable->setRowCount(stageStats.size());
+    for (int row = 0; row < stageStats.size(); ++row) {
+        const auto& stats = stageStats[row];
+        setItem(engineStagesTable, row, 0, EngineProfiler::stageName(stats.stage));
+        setItem(engineStagesTable, row, 1, QString::number(stats.count));
+        setItem(engineStagesTable, row, 2, toMicros(stats.p50Nanos));
+        setItem(engineStagesTable, row, 3, toMicros(stats.p90Nanos));
+        setItem(engineStagesTable, row, 4, toMicros(stats.p99Nanos));
+        setItem(engineStagesTable, row, 5, toMicros(stats.maxNanos));
+        setItem(engineStagesTable, row, 6, QString::number(stats.overruns));
+    }
+
+    // Most recent first
+    const QList<EngineProfiler::Overrun> overruns = pProfiler->recentOverruns();
+    engineOverrunsTable->setRowCount(overruns.size());
+    for (int row = 0; row < overruns.size(); ++row) {
+        const auto& overrun = overruns[overruns.size() - 1 - row];
+        QString stage = EngineProfiler::stageName(overrun.stage);
+        if (overrun.channel >= 0) {
+            stage += QStringLiteral(" %1").arg(overrun.channel);
+        }
+        setItem(engineOverrunsTable, row, 0, QString::number(overrun.callback));
+        setItem(engineOverrunsTable, row, 1, toMicros(overrun.callbackNanos));
+        setItem(engineOverrunsTable, row, 2, toMicros(overrun.budgetNanos));
+        setItem(engineOverrunsTable, row, 3, overrun.xrun ? tr("yes") : tr("no"));
+        setItem(engineOverrunsTable, row, 4, stage);
+        setItem(engineOverrunsTable, row, 5, toMicros(overrun.stageNanos));
+    }
+}
+
+void DlgDeveloperTools::slotEngineTraceExport() {
+    if (!EngineProfiler::s_bEngineProfilerEnabled) {
+        return;
+    }
+    QString timestamp = QDateTime::currentDateTime()
+            .toString("yyyy-MM-dd_hh'h'mm'm'ss's'");
+    QString traceFileName = m_pConfig->getSettingsPath() +
+            "/engine_trace_" + timestamp + ".json";
+    if (EngineProfiler::instance()->writeTraceEvents(traceFileName)) {
+        qDebug() << "Engine trace written to" << traceFileName;
     }
 }
 
@@ -14,6 +14,12 @@ class BalanceGroupState : public EffectState {
 
     void setFilters(mixxx::audio::SampleRate sampleRate, double freq);
 
+    std::size_t allocatedBytes() const override {
+        return m_pHighBuf.size() * sizeof(CSAMPLE) +
+                sizeof(EngineFilterLinkwitzRiley4Low) +
+                sizeof(EngineFilterLinkwitzRiley4High);
+    }
+
     std::unique_ptr<EngineFilterLinkwitzRiley4Low> m_low;
     std::unique_ptr<EngineFilterLinkwitzRiley4High> m_high;
 
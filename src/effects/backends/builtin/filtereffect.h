@@ -16,6 +16,11 @@ struct FilterGroupState : public EffectState {
 
     void setFilters(mixxx::audio::SampleRate sampleRate, double lowFreq, double highFreq);
 
+    std::size_t allocatedBytes() const override {
+        return m_buffer.size() * sizeof(CSAMPLE) +
+                sizeof(EngineFilterBiquad1Low) + sizeof(EngineFilterBiquad1High);
+    }
+
     mixxx::SampleBuffer m_buffer;
     EngineFilterBiquad1Low* m_pLowFilter;
     EngineFilterBiquad1High* m_pHighFilter;
@@ -32,6 +32,10 @@ class GlitchGroupState : public EffectState {
         sample_count = 0;
     };
 
+    std::size_t allocatedBytes() const override {
+        return repeat_buf.size() * sizeof(CSAMPLE);
+    }
+
     mixxx::SampleBuffer repeat_buf;
     long long sample_count;
 };
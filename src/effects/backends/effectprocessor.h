@@ -51,6 +51,8 @@
 /// without wasting a lot of memory. (EffectStates could be (de)allocated when toggling
 /// the enable switches for EffectSlots as well, but the memory savings would be
 /// relatively small compared to the additional code complexity.)
+/// The EffectStates of an input channel are released again when its routing
+/// switch has been off for a while, see EffectChain.
 class EffectState {
   public:
     EffectState(const mixxx::EngineParameters& engineParameters) {
@@ -58,6 +60,24 @@ class EffectState {
         Q_UNUSED(engineParameters);
     };
     virtual ~EffectState(){};
+
+    /// Returns the size of the memory that the state has allocated on the heap,
+    /// e.g. for delay buffers. Only used for reporting the memory usage.
+    virtual std::size_t allocatedBytes() const {
+        return 0;
+    }
+};
+
+/// The number of EffectStates of an EffectProcessor and the memory used by them
+struct EffectStatesMemoryUsage {
+    int states = 0;
+    std::size_t bytes = 0;
+
+    EffectStatesMemoryUsage& operator+=(const EffectStatesMemoryUsage& other) {
+        states += other.states;
+        bytes += other.bytes;
+        return *this;
+    }
 };
 
 /// EffectProcessor is an abstract base class for interfacing with an EffectSlot
@@ -79,6 +99,10 @@ class EffectProcessor {
     virtual void loadEngineEffectParameters(
             const QMap<QString, EngineEffectParameterPointer>& parameters) = 0;
     virtual bool hasStatesForInputChannel(ChannelHandle inputChannel) const = 0;
+    /// Deletes the EffectStates of an input channel. The audio thread must not
+    /// process the input channel until initializeInputChannel() is called again.
+    virtual void releaseInputChannel(ChannelHandle inputChannel) = 0;
+    virtual EffectStatesMemoryUsage getStatesMemoryUsage() const = 0;
 
     /// Called from the audio thread
     /// This method takes a buffer of audio samples as pInput, processes the buffer
@@ -233,6 +257,31 @@ class EffectProcessorImpl : public EffectProcessor {
         return false;
     }
 
+    void releaseInputChannel(ChannelHandle inputChannel) final {
+        if (inputChannel.handle() >= m_channelStateMatrix.size()) {
+            return;
+        }
+        if (kEffectDebugOutput) {
+            qDebug() << this << "EffectProcessorImpl::releaseInputChannel deleting "
+                                "EffectStates for input"
+                     << inputChannel;
+        }
+        m_channelStateMatrix[inputChannel].clear();
+    }
+
+    EffectStatesMemoryUsage getStatesMemoryUsage() const final {
+        EffectStatesMemoryUsage usage;
+        for (const auto& outputChannelStates : m_channelStateMatrix) {
+            for (const auto& pState : outputChannelStates) {
+                if (pState) {
+                    ++usage.states;
+                    usage.bytes += sizeof(EffectSpecificState) + pState->allocatedBytes();
+                }
+            }
+        }
+        return usage;
+    }
+
   protected:
     /// Subclasses for external effects plugins may reimplement this, but
     /// subclasses for built-in effects should not.
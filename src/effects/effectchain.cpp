@@ -1,5 +1,7 @@
 #include "effects/effectchain.h"
 
+#include <QTimer>
+
 #include "control/controlencoder.h"
 #include "control/controlpotmeter.h"
 #include "control/controlpushbutton.h"
@@ -14,8 +16,18 @@
 #include "util/defs.h"
 #include "util/math.h"
 #include "util/sample.h"
+#include "util/time.h"
 #include "util/xml.h"
 
+namespace {
+// The EffectStates of an input channel are deleted when its routing switch
+// has been off for this long. Some effects, e.g. Echo, allocate large delay
+// buffers for each input and output channel.
+const mixxx::Duration kReleaseEffectStatesDelay = mixxx::Duration::fromSeconds(30);
+// Enough time for the audio thread to respond
+constexpr int kEffectsResponseDelayMillis = 1000;
+} // anonymous namespace
+
 EffectChain::EffectChain(const QString& group,
         EffectsManager* pEffectsManager,
         EffectsMessengerPointer pEffectsMessenger,
@@ -407,6 +419,7 @@ void EffectChain::enableForInputChannel(const ChannelHandleAndGroup& handleGroup
     m_pMessenger->writeRequest(request);
 
     m_enabledInputChannels.insert(handleGroup);
+    m_disabledInputChannelsWithStates.remove(handleGroup);
 }
 
 void EffectChain::disableForInputChannel(const ChannelHandleAndGroup& handleGroup) {
@@ -419,6 +432,54 @@ void EffectChain::disableForInputChannel(const ChannelHandleAndGroup& handleGrou
     request->pTargetChain = m_pEngineEffectChain;
     request->DisableInputChannelForChain.channelHandle = handleGroup.handle();
     m_pMessenger->writeRequest(request);
+
+    m_disabledInputChannelsWithStates.insert(handleGroup, mixxx::Time::elapsed());
+    QTimer::singleShot(kReleaseEffectStatesDelay.toIntegerMillis(),
+            this,
+            [this, handleGroup] {
+                requestReleaseEffectStates(handleGroup);
+            });
+}
+
+void EffectChain::requestReleaseEffectStates(const ChannelHandleAndGroup& handleGroup) {
+    const auto it = m_disabledInputChannelsWithStates.constFind(handleGroup);
+    if (it == m_disabledInputChannelsWithStates.constEnd() ||
+            mixxx::Time::elapsed() - it.value() < kReleaseEffectStatesDelay) {
+        // Enabled again, or disabled again after a later timer was started
+        return;
+    }
+    m_disabledInputChannelsWithStates.erase(it);
+
+    // The audio thread must confirm that the channel is not processed
+    // anymore, before the EffectStates can be deleted in the main thread.
+    EffectsRequest* request = new EffectsRequest();
+    request->type = EffectsRequest::RELEASE_EFFECT_STATES_FOR_INPUT_CHANNEL;
+    request->pTargetChain = m_pEngineEffectChain;
+    request->ReleaseEffectStatesForInputChannel.channelHandle = handleGroup.handle();
+    request->ReleaseEffectStatesForInputChannel.pChain = this;
+    m_pMessenger->writeRequest(request);
+
+    // Responses are otherwise only received when the next request is written
+    QTimer::singleShot(kEffectsResponseDelayMillis,
+            this,
+            [this] {
+                m_pMessenger->processEffectsResponses();
+            });
+}
+
+void EffectChain::releaseEffectStates(ChannelHandle inputChannel) {
+    for (const auto& handleGroup : std::as_const(m_enabledInputChannels)) {
+        if (handleGroup.handle() == inputChannel) {
+            // Enabled again after the request was sent
+            return;
+        }
+    }
+    if (kEffectDebugOutput) {
+        qDebug() << debugString() << "releasing EffectStates for input" << inputChannel;
+    }
+    for (const auto& pEffectSlot : std::as_const(m_effectSlots)) {
+        pEffectSlot->releaseInputChannel(inputChannel);
+    }
 }
 
 int EffectChain::presetIndex() const {
@@ -12,6 +12,7 @@
 #include "effects/presets/effectchainpreset.h"
 #include "engine/channelhandle.h"
 #include "util/class.h"
+#include "util/duration.h"
 #include "util/memory.h"
 
 class ControlPushButton;
@@ -78,6 +79,11 @@ class EffectChain : public QObject {
 
     virtual void loadChainPreset(EffectChainPresetPointer pPreset);
 
+    /// Deletes the EffectStates of a disabled input channel, called by the
+    /// EffectsMessenger when the audio thread has confirmed that the channel
+    /// is no longer processed.
+    void releaseEffectStates(ChannelHandle inputChannel);
+
   public slots:
     void slotControlClear(double value);
 
@@ -130,6 +136,8 @@ class EffectChain : public QObject {
     void addToEngine();
     void removeFromEngine();
 
+    void requestReleaseEffectStates(const ChannelHandleAndGroup& handleGroup);
+
     const QString m_group;
 
     std::unique_ptr<ControlPushButton> m_pControlClear;
@@ -157,6 +165,9 @@ class EffectChain : public QObject {
     SignalProcessingStage m_signalProcessingStage;
     QHash<ChannelHandleAndGroup, std::shared_ptr<ControlPushButton>> m_channelEnableButtons;
     QSet<ChannelHandleAndGroup> m_enabledInputChannels;
+    // Disabled input channels that still have EffectStates and the time
+    // when they were disabled
+    QHash<ChannelHandleAndGroup, mixxx::Duration> m_disabledInputChannelsWithStates;
     EngineEffectChain* m_pEngineEffectChain;
 
     DISALLOW_COPY_AND_ASSIGN(EffectChain);
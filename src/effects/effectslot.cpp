@@ -199,6 +199,20 @@ void EffectSlot::initalizeInputChannel(ChannelHandle inputChannel) {
     m_pEngineEffect->initalizeInputChannel(inputChannel);
 };
 
+void EffectSlot::releaseInputChannel(ChannelHandle inputChannel) {
+    if (!m_pEngineEffect) {
+        return;
+    }
+    m_pEngineEffect->releaseInputChannel(inputChannel);
+}
+
+EffectStatesMemoryUsage EffectSlot::getStatesMemoryUsage() const {
+    if (!m_pEngineEffect) {
+        return EffectStatesMemoryUsage();
+    }
+    return m_pEngineEffect->getStatesMemoryUsage();
+}
+
 EffectManifestPointer EffectSlot::getManifest() const {
     return m_pManifest;
 }
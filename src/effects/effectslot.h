@@ -124,6 +124,8 @@ class EffectSlot : public QObject {
     }
 
     void initalizeInputChannel(ChannelHandle inputChannel);
+    void releaseInputChannel(ChannelHandle inputChannel);
+    EffectStatesMemoryUsage getStatesMemoryUsage() const;
 
     EffectManifestPointer getManifest() const;
 
@@ -168,6 +168,23 @@ bool EffectsManager::isAdoptMetaknobSettingEnabled() const {
     return m_pConfig->getValue(ConfigKey("[Effects]", "AdoptMetaknobValue"), true);
 }
 
+EffectStatesMemoryUsage EffectsManager::getStatesMemoryUsage(
+        const EffectManifestPointer& pManifest) const {
+    EffectStatesMemoryUsage usage;
+    VERIFY_OR_DEBUG_ASSERT(pManifest) {
+        return usage;
+    }
+    for (const auto& pChain : std::as_const(m_effectChainSlotsByGroup)) {
+        for (const auto& pSlot : pChain->getEffectSlots()) {
+            const EffectManifestPointer pSlotManifest = pSlot->getManifest();
+            if (pSlotManifest && *pSlotManifest == *pManifest) {
+                usage += pSlot->getStatesMemoryUsage();
+            }
+        }
+    }
+    return usage;
+}
+
 void EffectsManager::readEffectsXml() {
     QDir settingsPath(m_pConfig->getSettingsPath());
     QFile file(settingsPath.absoluteFilePath(kEffectsXmlFile));
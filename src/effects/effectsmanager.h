@@ -5,6 +5,7 @@
 #include <QSet>
 
 #include "control/controlpotmeter.h"
+#include "effects/backends/effectprocessor.h"
 #include "effects/backends/effectsbackendmanager.h"
 #include "effects/presets/effectchainpresetmanager.h"
 #include "engine/channelhandle.h"
@@ -73,6 +74,9 @@ class EffectsManager {
 
     bool isAdoptMetaknobSettingEnabled() const;
 
+    /// Sums up the EffectStates of all loaded instances of an effect
+    EffectStatesMemoryUsage getStatesMemoryUsage(const EffectManifestPointer& pManifest) const;
+
   private:
     void addStandardEffectChains();
     void addOutputEffectChain();
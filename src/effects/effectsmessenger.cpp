@@ -1,5 +1,6 @@
 #include "effects/effectsmessenger.h"
 
+#include "effects/effectchain.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectchain.h"
 #include "util/make_const_iterator.h"
@@ -72,6 +73,14 @@ void EffectsMessenger::processEffectsResponses() {
 
             collectGarbage(pRequest);
 
+            // Except for releasing EffectStates, which the audio thread may
+            // refuse if the input channel has been enabled again
+            if (pRequest->type == EffectsRequest::RELEASE_EFFECT_STATES_FOR_INPUT_CHANNEL &&
+                    response.success && !m_bShuttingDown) {
+                pRequest->ReleaseEffectStatesForInputChannel.pChain->releaseEffectStates(
+                        pRequest->ReleaseEffectStatesForInputChannel.channelHandle);
+            }
+
             delete pRequest;
             it = constErase(&m_activeRequests, it);
         }
@@ -7,13 +7,55 @@
 #include "moc_enginebufferscalerubberband.cpp"
 #include "util/counter.h"
 #include "util/defs.h"
+#include "util/lightweightsemaphore.h"
 #include "util/math.h"
+#include "util/performancetimer.h"
 #include "util/sample.h"
 
 using RubberBand::RubberBandStretcher;
 
 #define RUBBERBANDV3 (RUBBERBAND_API_MAJOR_VERSION >= 2 && RUBBERBAND_API_MINOR_VERSION >= 7)
 
+namespace {
+
+// The output is only rendered ahead if the tempo and pitch have not changed
+// for this number of callbacks. Seeks, scratching and tempo changes are
+// processed in the callback.
+constexpr int kSteadyCallbacksBeforeRenderAhead = 8;
+
+// The worker stays this number of callbacks ahead of the engine
+constexpr double kRenderAheadCallbacks = 2;
+
+// Enough for two callbacks of 8192 frames at twice the speed
+constexpr int kRenderAheadBufferSamples = 65536;
+
+} // anonymous namespace
+
+RubberBandWorker::RubberBandWorker(EngineBufferScaleRubberBand* pScale)
+        : m_pScale(pScale),
+          m_stop(false) {
+}
+
+void RubberBandWorker::run() {
+    // the id of this thread, for debugging purposes
+    static auto lastId = QAtomicInt(0);
+    const auto id = lastId.fetchAndAddRelaxed(1) + 1;
+    QThread::currentThread()->setObjectName(
+            QStringLiteral("RubberBandWorker ") + QString::number(id));
+
+    while (!m_stop.load(std::memory_order_acquire)) {
+        if (!m_pScale->renderAhead()) {
+            m_semaRun.acquire();
+        }
+    }
+}
+
+void RubberBandWorker::quitWait() {
+    m_stop.store(true, std::memory_order_release);
+    m_semaRun.release();
+    wait();
+}
+
 EngineBufferScaleRubberBand::EngineBufferScaleRubberBand(
         ReadAheadManager* pReadAheadManager)
         : m_pReadAheadManager(pReadAheadManager),
@@ -21,15 +63,45 @@ EngineBufferScaleRubberBand::EngineBufferScaleRubberBand(
           m_bufferPtrs{m_buffers[0].data(), m_buffers[1].data()},
           m_interleavedReadBuffer(MAX_BUFFER_LEN),
           m_bBackwards(false),
-          m_useEngineFiner(false) {
+          m_useEngineFiner(false),
+          m_engineVersion(2),
+          m_pScheduler(nullptr),
+          m_pRunningWorker(nullptr),
+          m_stretcherOwner(StretcherOwner::Callback),
+          m_createStretcherPending(false),
+          m_clearPending(false),
+          m_scaleParametersPending(false),
+          m_renderAheadInput(kRenderAheadBufferSamples),
+          m_renderAheadOutput(kRenderAheadBufferSamples),
+          m_workerBuffer(MAX_BUFFER_LEN),
+          m_steadyCallbacks(0) {
     // Initialize the internal buffers to prevent re-allocations
     // in the real-time thread.
     onSampleRateChanged();
 }
 
+EngineBufferScaleRubberBand::~EngineBufferScaleRubberBand() {
+    if (m_pWorker) {
+        m_pWorker->quitWait();
+    }
+}
+
+void EngineBufferScaleRubberBand::startWorker() {
+    if (m_pWorker || !m_pScheduler) {
+        return;
+    }
+    m_pWorker = std::make_unique<RubberBandWorker>(this);
+    m_pWorker->setScheduler(m_pScheduler);
+    m_pWorker->start(QThread::HighPriority);
+    m_pRunningWorker.store(m_pWorker.get(), std::memory_order_release);
+}
+
 void EngineBufferScaleRubberBand::setScaleParameters(double base_rate,
                                                      double* pTempoRatio,
                                                      double* pPitchRatio) {
+    // Only called if the parameters have changed
+    m_steadyCallbacks = 0;
+
     // Negative speed means we are going backwards. pitch does not affect
     // the playback direction.
     m_bBackwards = *pTempoRatio < 0;
@@ -50,9 +122,31 @@ void EngineBufferScaleRubberBand::setScaleParameters(double base_rate,
             speed_abs = *pTempoRatio = 0;
         }
     }
+    // Used by other methods so we need to keep them up to date.
+    m_dBaseRate = base_rate;
+    m_dTempoRatio = speed_abs;
+    m_dPitchRatio = *pPitchRatio;
+
+    if (!takeBackStretcher()) {
+        // Applied once the worker has handed back the time stretcher
+        m_scaleParametersPending = true;
+        return;
+    }
+    if (applyScaleParameters()) {
+        *pTempoRatio = m_bBackwards ? -m_dTempoRatio : m_dTempoRatio;
+    }
+}
+
+bool EngineBufferScaleRubberBand::applyScaleParameters() {
+    DEBUG_ASSERT(m_stretcherOwner.load(std::memory_order_relaxed) ==
+            StretcherOwner::Callback);
+    m_scaleParametersPending = false;
+    if (!m_pRubberBand) {
+        return false;
+    }
     // RubberBand handles checking for whether the change in pitchScale is a
     // no-op.
-    double pitchScale = fabs(base_rate * *pPitchRatio);
+    double pitchScale = fabs(m_dBaseRate * m_dPitchRatio);
 
     if (pitchScale > 0) {
         //qDebug() << "EngineBufferScaleRubberBand setPitchScale" << *pitch << pitchScale;
@@ -63,7 +157,7 @@ void EngineBufferScaleRubberBand::setScaleParameters(double base_rate,
     // no-op. Time ratio is the ratio of stretched to unstretched duration. So 1
     // second in real duration is 0.5 seconds in stretched duration if tempo is
     // 2.
-    double timeRatioInverse = base_rate * speed_abs;
+    double timeRatioInverse = m_dBaseRate * m_dTempoRatio;
     if (timeRatioInverse > 0) {
         //qDebug() << "EngineBufferScaleRubberBand setTimeRatio" << 1 / timeRatioInverse;
         m_pRubberBand->setTimeRatio(1.0 / timeRatioInverse);
@@ -81,20 +175,30 @@ void EngineBufferScaleRubberBand::setScaleParameters(double base_rate,
                 timeRatioInverse += 0.001;
                 m_pRubberBand->setTimeRatio(1.0 / timeRatioInverse);
             }
-            speed_abs = timeRatioInverse / base_rate;
-            *pTempoRatio = m_bBackwards ? -speed_abs : speed_abs;
+            m_dTempoRatio = timeRatioInverse / m_dBaseRate;
+            return true;
         }
     }
-    // Used by other methods so we need to keep them up to date.
-    m_dBaseRate = base_rate;
-    m_dTempoRatio = speed_abs;
-    m_dPitchRatio = *pPitchRatio;
+    return false;
 }
 
 void EngineBufferScaleRubberBand::onSampleRateChanged() {
     // TODO: Resetting the sample rate will cause internal
     // memory allocations that may block the real-time thread.
     // When is this function actually invoked??
+    m_steadyCallbacks = 0;
+    if (!takeBackStretcher()) {
+        m_createStretcherPending = true;
+        m_renderAheadOutput.flushReadData(m_renderAheadOutput.readAvailable());
+        return;
+    }
+    createStretcher();
+}
+
+void EngineBufferScaleRubberBand::createStretcher() {
+    m_createStretcherPending = false;
+    m_renderAheadInput.flushReadData(m_renderAheadInput.readAvailable());
+    m_renderAheadOutput.flushReadData(m_renderAheadOutput.readAvailable());
     if (!getOutputSignal().isValid()) {
         m_pRubberBand.reset();
         return;
@@ -115,6 +219,11 @@ void EngineBufferScaleRubberBand::onSampleRateChanged() {
             getOutputSignal().getSampleRate(),
             getOutputSignal().getChannelCount(),
             rubberbandOptions);
+#if RUBBERBANDV3
+    m_engineVersion = m_pRubberBand->getEngineVersion();
+#else
+    m_engineVersion = 2;
+#endif
     // Setting the time ratio to a very high value will cause RubberBand
     // to preallocate buffers large enough to (almost certainly)
     // avoid memory reallocations during playback.
@@ -123,6 +232,16 @@ void EngineBufferScaleRubberBand::onSampleRateChanged() {
 }
 
 void EngineBufferScaleRubberBand::clear() {
+    m_steadyCallbacks = 0;
+    if (!takeBackStretcher()) {
+        // The input has been read before the seek. It is flushed once the
+        // worker has handed back the time stretcher.
+        m_clearPending = true;
+        m_renderAheadOutput.flushReadData(m_renderAheadOutput.readAvailable());
+        return;
+    }
+    m_renderAheadInput.flushReadData(m_renderAheadInput.readAvailable());
+    m_renderAheadOutput.flushReadData(m_renderAheadOutput.readAvailable());
     VERIFY_OR_DEBUG_ASSERT(m_pRubberBand) {
         return;
     }
@@ -188,9 +307,106 @@ double EngineBufferScaleRubberBand::scaleBuffer(
         return 0.0;
     }
 
-    double readFramesProcessed = 0;
-    SINT remaining_frames = getOutputSignal().samples2frames(iOutputBufferSize);
-    CSAMPLE* read = pOutputBuffer;
+    const SINT outputFrames = getOutputSignal().samples2frames(iOutputBufferSize);
+    const StretcherOwner owner = m_stretcherOwner.load(std::memory_order_acquire);
+    if (owner == StretcherOwner::Worker || owner == StretcherOwner::WorkerProcessing) {
+        const SINT renderedSamples = m_renderAheadOutput.read(
+                pOutputBuffer, static_cast<int>(iOutputBufferSize));
+        // All frames have been rendered with the current rate
+        const double renderedFramesProcessed = m_effectiveRate *
+                getOutputSignal().samples2frames(renderedSamples);
+        if (renderedSamples == iOutputBufferSize) {
+            readAheadInput(outputFrames);
+            m_pRunningWorker.load(std::memory_order_relaxed)->workReady();
+            return renderedFramesProcessed;
+        }
+        // The worker could not keep up or has run out of input, e.g. at
+        // the end of the track. Render the rest in the callback.
+        Counter counter("EngineBufferScaleRubberBand::renderAhead underflow");
+        counter.increment();
+        m_steadyCallbacks = 0;
+        if (!takeBackStretcher()) {
+            return renderedFramesProcessed +
+                    scaleBufferDuringHandBack(pOutputBuffer + renderedSamples,
+                            iOutputBufferSize - renderedSamples);
+        }
+        return renderedFramesProcessed +
+                scaleBufferInCallback(pOutputBuffer + renderedSamples,
+                        iOutputBufferSize - renderedSamples);
+    }
+
+    if (!takeBackStretcher()) {
+        return scaleBufferDuringHandBack(pOutputBuffer, iOutputBufferSize);
+    }
+    const double readFramesProcessed = scaleBufferInCallback(pOutputBuffer, iOutputBufferSize);
+    if (m_pRunningWorker.load(std::memory_order_acquire) &&
+            ++m_steadyCallbacks >= kSteadyCallbacksBeforeRenderAhead) {
+        startRenderAhead(outputFrames);
+    }
+    return readFramesProcessed;
+}
+
+double EngineBufferScaleRubberBand::scaleBufferDuringHandBack(
+        CSAMPLE* pOutputBuffer,
+        SINT iOutputBufferSize) {
+    SINT renderedSamples = 0;
+    if (m_clearPending) {
+        // Rendered from the position before the seek
+        m_renderAheadOutput.flushReadData(m_renderAheadOutput.readAvailable());
+    } else {
+        renderedSamples = m_renderAheadOutput.read(
+                pOutputBuffer, static_cast<int>(iOutputBufferSize));
+    }
+    const double renderedFramesProcessed = m_effectiveRate *
+            getOutputSignal().samples2frames(renderedSamples);
+    if (renderedSamples == iOutputBufferSize) {
+        // The worker hands back the time stretcher as soon as it has
+        // finished the current block, there is no need to wake it.
+        return renderedFramesProcessed;
+    }
+    if (waitForHandBack(getOutputSignal().samples2frames(iOutputBufferSize))) {
+        return renderedFramesProcessed +
+                scaleBufferInCallback(pOutputBuffer + renderedSamples,
+                        iOutputBufferSize - renderedSamples);
+    }
+    SampleUtil::clear(pOutputBuffer + renderedSamples,
+            iOutputBufferSize - renderedSamples);
+    Counter counter("EngineBufferScaleRubberBand::handBack underflow");
+    counter.increment();
+    return renderedFramesProcessed;
+}
+
+bool EngineBufferScaleRubberBand::waitForHandBack(SINT outputFrames) {
+    // The worker processes at most one block of MAX_BUFFER_LEN samples,
+    // which takes only a fraction of the duration of the callback. The
+    // timeout only protects the callback from a worker that has been
+    // preempted.
+    const auto timeout = mixxx::Duration::fromSeconds(
+            getOutputSignal().frames2secs(outputFrames));
+    PerformanceTimer timer;
+    timer.start();
+    while (!takeBackStretcher()) {
+        if (timer.elapsed() >= timeout) {
+            return false;
+        }
+        mixxx::cpuRelax();
+    }
+    return true;
+}
+
+double EngineBufferScaleRubberBand::scaleBufferInCallback(
+        CSAMPLE* pOutputBuffer,
+        SINT iOutputBufferSize) {
+    DEBUG_ASSERT(m_stretcherOwner.load(std::memory_order_relaxed) ==
+            StretcherOwner::Callback);
+    // Output that has been rendered ahead before the worker was stopped
+    const SINT renderedSamples = m_renderAheadOutput.read(
+            pOutputBuffer, static_cast<int>(iOutputBufferSize));
+    double readFramesProcessed = m_effectiveRate *
+            getOutputSignal().samples2frames(renderedSamples);
+    SINT remaining_frames = getOutputSignal().samples2frames(
+            iOutputBufferSize - renderedSamples);
+    CSAMPLE* read = pOutputBuffer + renderedSamples;
     bool last_read_failed = false;
     while (remaining_frames > 0) {
         // ReadAheadManager will eventually read the requested frames with
@@ -211,10 +427,7 @@ double EngineBufferScaleRubberBand::scaleBuffer(
         if (remaining_frames > 0 && next_block_frames_required > 0) {
             // The requested setting becomes effective after all previous frames have been processed
             m_effectiveRate = m_dBaseRate * m_dTempoRatio;
-            const SINT available_samples = m_pReadAheadManager->getNextSamples(
-                    // The value doesn't matter here. All that matters is we
-                    // are going forward or backward.
-                    (m_bBackwards ? -1.0 : 1.0) * m_dBaseRate * m_dTempoRatio,
+            const SINT available_samples = readInput(
                     m_interleavedReadBuffer.data(),
                     getOutputSignal().frames2samples(next_block_frames_required));
             const SINT available_frames = getOutputSignal().samples2frames(available_samples);
@@ -255,6 +468,150 @@ double EngineBufferScaleRubberBand::scaleBuffer(
     return readFramesProcessed;
 }
 
+SINT EngineBufferScaleRubberBand::readInput(CSAMPLE* pBuffer, SINT samples) {
+    // Input that has been read ahead before the worker was stopped
+    SINT samplesRead = m_renderAheadInput.read(pBuffer, static_cast<int>(samples));
+    if (samplesRead < samples) {
+        samplesRead += m_pReadAheadManager->getNextSamples(
+                // The value doesn't matter here. All that matters is we
+                // are going forward or backward.
+                (m_bBackwards ? -1.0 : 1.0) * m_dBaseRate * m_dTempoRatio,
+                pBuffer + samplesRead,
+                samples - samplesRead);
+    }
+    return samplesRead;
+}
+
+void EngineBufferScaleRubberBand::startRenderAhead(SINT outputFrames) {
+    DEBUG_ASSERT(m_pRunningWorker.load(std::memory_order_relaxed));
+    DEBUG_ASSERT(m_stretcherOwner.load(std::memory_order_relaxed) ==
+            StretcherOwner::Callback);
+    // All input that has been processed since the last change has the
+    // current rate, so m_effectiveRate stays valid for all rendered frames.
+    readAheadInput(outputFrames);
+    m_stretcherOwner.store(StretcherOwner::Worker, std::memory_order_release);
+    m_pRunningWorker.load(std::memory_order_relaxed)->workReady();
+}
+
+bool EngineBufferScaleRubberBand::takeBackStretcher() {
+    StretcherOwner owner = m_stretcherOwner.load(std::memory_order_acquire);
+    // The worker changes the owner at most twice per block, so this
+    // loop does not spin.
+    while (owner != StretcherOwner::Callback) {
+        if (owner == StretcherOwner::HandBackRequested) {
+            return false;
+        }
+        // The worker is either idle, then the time stretcher is taken back
+        // immediately, or processing a block and hands it back afterwards.
+        const StretcherOwner desired = owner == StretcherOwner::Worker
+                ? StretcherOwner::Callback
+                : StretcherOwner::HandBackRequested;
+        if (m_stretcherOwner.compare_exchange_weak(owner,
+                    desired,
+                    std::memory_order_acq_rel,
+                    std::memory_order_acquire)) {
+            owner = desired;
+        }
+    }
+
+    // The output that has been rendered ahead and the input that has been
+    // read ahead are used by scaleBufferInCallback().
+    if (m_createStretcherPending) {
+        createStretcher();
+        m_clearPending = false;
+    }
+    if (m_clearPending) {
+        m_clearPending = false;
+        m_renderAheadInput.flushReadData(m_renderAheadInput.readAvailable());
+        m_renderAheadOutput.flushReadData(m_renderAheadOutput.readAvailable());
+        if (m_pRubberBand) {
+            reset();
+        }
+    }
+    if (m_scaleParametersPending) {
+        applyScaleParameters();
+    }
+    return true;
+}
+
+void EngineBufferScaleRubberBand::readAheadInput(SINT outputFrames) {
+    const double rate = m_dBaseRate * m_dTempoRatio;
+    const SINT targetFrames = static_cast<SINT>(
+            std::ceil(kRenderAheadCallbacks * outputFrames * rate));
+    // The rendered output in terms of input frames
+    const SINT bufferedFrames =
+            getOutputSignal().samples2frames(m_renderAheadInput.readAvailable()) +
+            static_cast<SINT>(rate *
+                    getOutputSignal().samples2frames(
+                            m_renderAheadOutput.readAvailable()));
+    const SINT framesToRead = math_min(targetFrames - bufferedFrames,
+            getOutputSignal().samples2frames(math_min(
+                    static_cast<SINT>(m_renderAheadInput.writeAvailable()),
+                    m_interleavedReadBuffer.size())));
+    if (framesToRead <= 0) {
+        return;
+    }
+    const SINT samplesRead = m_pReadAheadManager->getNextSamples(
+            (m_bBackwards ? -1.0 : 1.0) * rate,
+            m_interleavedReadBuffer.data(),
+            getOutputSignal().frames2samples(framesToRead));
+    m_renderAheadInput.write(m_interleavedReadBuffer.data(), static_cast<int>(samplesRead));
+}
+
+bool EngineBufferScaleRubberBand::renderAhead() {
+    StretcherOwner owner = StretcherOwner::Worker;
+    if (!m_stretcherOwner.compare_exchange_strong(owner,
+                StretcherOwner::WorkerProcessing,
+                std::memory_order_acquire)) {
+        // The callback has taken back the time stretcher
+        return false;
+    }
+    const bool processed = renderAheadBlock();
+    owner = StretcherOwner::WorkerProcessing;
+    if (!m_stretcherOwner.compare_exchange_strong(owner,
+                StretcherOwner::Worker,
+                std::memory_order_release,
+                std::memory_order_relaxed)) {
+        // Acknowledge the hand back that the callback has requested while
+        // the block was processed
+        DEBUG_ASSERT(owner == StretcherOwner::HandBackRequested);
+        m_stretcherOwner.store(StretcherOwner::Callback, std::memory_order_release);
+        return false;
+    }
+    return processed;
+}
+
+bool EngineBufferScaleRubberBand::renderAheadBlock() {
+    const SINT maxFrames = getOutputSignal().samples2frames(m_workerBuffer.size());
+    const SINT freeFrames = math_min(maxFrames,
+            getOutputSignal().samples2frames(m_renderAheadOutput.writeAvailable()));
+    if (m_pRubberBand->available() > 0) {
+        if (freeFrames <= 0) {
+            // Woken up again after the engine has read the output
+            return false;
+        }
+        const SINT receivedFrames = retrieveAndDeinterleave(m_workerBuffer.data(), freeFrames);
+        m_renderAheadOutput.write(m_workerBuffer.data(),
+                static_cast<int>(getOutputSignal().frames2samples(receivedFrames)));
+        return true;
+    }
+
+    const SINT requiredFrames = math_min(maxFrames,
+            static_cast<SINT>(m_pRubberBand->getSamplesRequired()));
+    if (requiredFrames <= 0) {
+        return false;
+    }
+    const SINT inputFrames = getOutputSignal().samples2frames(m_renderAheadInput.read(
+            m_workerBuffer.data(),
+            static_cast<int>(getOutputSignal().frames2samples(requiredFrames))));
+    if (inputFrames <= 0) {
+        // Woken up again after the engine has read more input
+        return false;
+    }
+    deinterleaveAndProcess(m_workerBuffer.data(), inputFrames);
+    return true;
+}
+
 // static
 bool EngineBufferScaleRubberBand::isEngineFinerAvailable() {
     return RUBBERBANDV3;
@@ -295,14 +652,6 @@ size_t EngineBufferScaleRubberBand::getStartDelay() const {
 #endif
 }
 
-int EngineBufferScaleRubberBand::runningEngineVersion() {
-#if RUBBERBANDV3
-    return m_pRubberBand->getEngineVersion();
-#else
-    return 2;
-#endif
-}
-
 void EngineBufferScaleRubberBand::reset() {
     m_pRubberBand->reset();
 
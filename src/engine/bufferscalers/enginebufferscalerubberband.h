@@ -3,13 +3,32 @@
 #include <rubberband/RubberBandStretcher.h>
 
 #include <array>
+#include <atomic>
 
 #include "engine/bufferscalers/enginebufferscale.h"
+#include "engine/engineworker.h"
+#include "util/fifo.h"
 #include "util/memory.h"
 #include "util/samplebuffer.h"
 
+class EngineBufferScaleRubberBand;
+class EngineWorkerScheduler;
 class ReadAheadManager;
 
+// Renders the output of an EngineBufferScaleRubberBand ahead of the audio
+// callback while the deck plays at a steady tempo and pitch.
+class RubberBandWorker final : public EngineWorker {
+  public:
+    explicit RubberBandWorker(EngineBufferScaleRubberBand* pScale);
+
+    void run() override;
+    void quitWait();
+
+  private:
+    EngineBufferScaleRubberBand* const m_pScale;
+    std::atomic<bool> m_stop;
+};
+
 // Uses librubberband to scale audio.  This class is not thread safe.
 class EngineBufferScaleRubberBand final : public EngineBufferScale {
     Q_OBJECT
@@ -23,6 +42,8 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
     EngineBufferScaleRubberBand(EngineBufferScaleRubberBand&&) = delete;
     EngineBufferScaleRubberBand& operator=(EngineBufferScaleRubberBand&&) = delete;
 
+    ~EngineBufferScaleRubberBand() override;
+
     // Let EngineBuffer know if engine v3 is available
     static bool isEngineFinerAvailable();
 
@@ -40,7 +61,43 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
     // Flush buffer.
     void clear() override;
 
+    /// Sets the scheduler that wakes the worker started by startWorker().
+    void setScheduler(EngineWorkerScheduler* pScheduler) {
+        m_pScheduler = pScheduler;
+    }
+    /// Starts a worker that renders the output ahead of the callback while
+    /// the tempo and pitch do not change. Without a worker all stretching is
+    /// done in the callback. Does nothing if the worker is already running.
+    /// The worker stays registered with the scheduler until this is
+    /// destroyed, even if the deck switches to another keylock engine.
+    /// Only called from the main thread.
+    void startWorker();
+
+    bool isRenderingAhead() const {
+        return m_stretcherOwner.load(std::memory_order_acquire) != StretcherOwner::Callback;
+    }
+
+    /// The number of frames that are ready for the next callbacks
+    SINT renderedAheadFrames() const {
+        return getOutputSignal().samples2frames(m_renderAheadOutput.readAvailable());
+    }
+
   private:
+    friend class RubberBandWorker;
+
+    /// The thread that is allowed to use the time stretcher and the buffers
+    /// below. The callback and the worker hand it over without locking.
+    enum class StretcherOwner {
+        Callback,
+        /// The worker is waiting for the next callback
+        Worker,
+        /// The worker is processing a block
+        WorkerProcessing,
+        /// The callback wants it back. The worker hands it back after it
+        /// has finished the current block.
+        HandBackRequested,
+    };
+
     // Reset RubberBand library with new audio signal
     void onSampleRateChanged() override;
 
@@ -50,7 +107,11 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
     /// Calls `m_pRubberBand->getStartDelay()`, with backwards compatibility for
     /// older librubberband versions.
     size_t getStartDelay() const;
-    int runningEngineVersion();
+    int runningEngineVersion() const {
+        return m_engineVersion;
+    }
+    /// Recreates the time stretcher for the current output signal
+    void createStretcher();
     /// Reset the rubberband instance and run the prerequisite amount of padding
     /// through it. This should be used instead of calling
     /// `m_pRubberBand->reset()` directly.
@@ -59,6 +120,42 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
     void deinterleaveAndProcess(const CSAMPLE* pBuffer, SINT frames);
     SINT retrieveAndDeinterleave(CSAMPLE* pBuffer, SINT frames);
 
+    /// Passes the time ratio and pitch scale to the time stretcher.
+    /// Returns true if the tempo ratio had to be adjusted.
+    bool applyScaleParameters();
+
+    /// Runs the time stretcher in the callback. Any output that has been
+    /// rendered ahead and any input that has been read ahead is used first.
+    double scaleBufferInCallback(CSAMPLE* pOutputBuffer, SINT iOutputBufferSize);
+    /// Reads the input that has been read ahead before reading from the
+    /// read-ahead manager.
+    SINT readInput(CSAMPLE* pBuffer, SINT samples);
+
+    /// Plays the output that has been rendered ahead while the worker
+    /// has not handed back the time stretcher yet. If that does not fill
+    /// the buffer, waits for the hand back and renders the rest in the
+    /// callback.
+    double scaleBufferDuringHandBack(CSAMPLE* pOutputBuffer, SINT iOutputBufferSize);
+    /// Spins until the worker has handed back the time stretcher, for at
+    /// most the duration of outputFrames. Returns false on timeout.
+    bool waitForHandBack(SINT outputFrames);
+
+    /// Hands the time stretcher over to the worker.
+    void startRenderAhead(SINT outputFrames);
+    /// Takes the time stretcher back from the worker, if the worker is not
+    /// processing a block. Otherwise asks the worker to hand it back after
+    /// the block and returns false, without waiting. Changes that have been
+    /// deferred in the meantime are applied once the callback owns the
+    /// time stretcher again.
+    bool takeBackStretcher();
+    /// Reads enough input for the worker to stay kRenderAheadCallbacks
+    /// callbacks ahead of the engine.
+    void readAheadInput(SINT outputFrames);
+    /// Processes a single block on the worker thread. Returns false if there
+    /// is nothing to do until the next callback.
+    bool renderAhead();
+    bool renderAheadBlock();
+
     // The read-ahead manager that we use to fetch samples
     ReadAheadManager* m_pReadAheadManager;
 
@@ -84,4 +181,23 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
     SINT m_remainingPaddingInOutput = 0;
 
     bool m_useEngineFiner;
+    int m_engineVersion;
+
+    EngineWorkerScheduler* m_pScheduler;
+    std::unique_ptr<RubberBandWorker> m_pWorker;
+    /// Published to the callback once the worker has been started
+    std::atomic<RubberBandWorker*> m_pRunningWorker;
+    std::atomic<StretcherOwner> m_stretcherOwner;
+    /// Changes that could not be applied because the worker had not handed
+    /// back the time stretcher yet. Only accessed by the callback.
+    bool m_createStretcherPending;
+    bool m_clearPending;
+    bool m_scaleParametersPending;
+    /// Interleaved input that has been read ahead, but not been processed
+    FIFO<CSAMPLE> m_renderAheadInput;
+    /// Interleaved output that has been rendered ahead
+    FIFO<CSAMPLE> m_renderAheadOutput;
+    mixxx::SampleBuffer m_workerBuffer;
+    /// The number of callbacks since the tempo or pitch has changed
+    int m_steadyCallbacks;
 };
@@ -12,6 +12,7 @@
 #include "util/logger.h"
 #include "util/math.h"
 #include "util/sample.h"
+#include "util/time.h"
 
 namespace {
 
@@ -22,61 +23,80 @@ mixxx::Logger kLogger("CachingReader");
 // TODO() Do we suffer cache misses if we use an audio buffer of above 23 ms?
 constexpr SINT kDefaultHintFrames = 1024;
 
-// With CachingReaderChunk::kFrames = 8192 each chunk consumes
-// 8192 frames * 2 channels/frame * 4-bytes per sample = 65 kB.
-//
-//     80 chunks ->  5120 KB =  5 MB
-//
-// Each deck (including sample decks) will use their own CachingReader.
-// Consequently the total memory required for all allocated chunks depends
-// on the number of decks. The amount of memory reserved for a single
-// CachingReader must be multiplied by the number of decks to calculate
-// the total amount!
-//
-// NOTE(uklotzde, 2019-09-05): Reduce this number to just few chunks
-// (kNumberOfCachedChunksInMemory = 1, 2, 3, ...) for testing purposes
-// to verify that the MRU/LRU cache works as expected. Even though
-// massive drop outs are expected to occur Mixxx should run reliably!
-constexpr SINT kNumberOfCachedChunksInMemory = 80;
+// Limit the number of in-flight requests to the worker. This should
+// prevent to overload the worker when it is not able to fetch those
+// requests from the FIFO timely. Otherwise outdated requests pile up
+// in the FIFO and it would take a long time to process them, just to
+// discard the results that most likely have already become obsolete.
+// TODO(XXX): Ideally the request FIFO would be implemented as a ring
+// buffer, where new requests replace old requests when full. Those
+// old requests need to be returned immediately to the CachingReader
+// that must take ownership and free them!!!
+constexpr SINT kChunkReadRequestFIFOSize = 20;
+
+// The max. number of chunks owned by the worker at any time. The capacity
+// of the back channel must cover all of them, because the worker uses
+// writeBlocking(). Otherwise the worker could get stuck in a hot loop!!!
+constexpr SINT kMaxPendingChunkReads = 64;
+
+// Additional capacity of the back channel for status updates without a chunk
+constexpr SINT kReaderStatusUpdateFIFOHeadroom = 16;
+
+// Prefetch hints must leave room for the requests of the pinning hints.
+constexpr SINT kMaxPendingPrefetchChunkReads = kMaxPendingChunkReads / 2;
+
+// A reader that holds more than its fair share returns chunks while less
+// than this number of chunks is available in the shared pool...
+constexpr SINT kMinFreeChunksInPool = 16;
+// ...but only a few per callback to keep the callback short.
+constexpr SINT kMaxSurplusChunksReleasedPerCallback = 4;
+
+bool isPinningHint(Hint::Type type) {
+    switch (type) {
+    case Hint::Type::SlipPosition:
+    case Hint::Type::CurrentPosition:
+    case Hint::Type::LoopStartEnabled:
+    case Hint::Type::MainCue:
+    case Hint::Type::HotCue:
+    case Hint::Type::LoopEndEnabled:
+    case Hint::Type::LoopStart:
+        return true;
+    case Hint::Type::FirstSound:
+    case Hint::Type::IntroStart:
+    case Hint::Type::IntroEnd:
+    case Hint::Type::OutroStart:
+    case Hint::Type::Prefetch:
+        return false;
+    }
+    DEBUG_ASSERT(!"unreachable");
+    return false;
+}
 
 } // anonymous namespace
 
 CachingReader::CachingReader(const QString& group,
         UserSettingsPointer config)
         : m_pConfig(config),
-          // Limit the number of in-flight requests to the worker. This should
-          // prevent to overload the worker when it is not able to fetch those
-          // requests from the FIFO timely. Otherwise outdated requests pile up
-          // in the FIFO and it would take a long time to process them, just to
-          // discard the results that most likely have already become obsolete.
-          // TODO(XXX): Ideally the request FIFO would be implemented as a ring
-          // buffer, where new requests replace old requests when full. Those
-          // old requests need to be returned immediately to the CachingReader
-          // that must take ownership and free them!!!
-          m_chunkReadRequestFIFO(kNumberOfCachedChunksInMemory / 4),
-          // The capacity of the back channel must be equal to the number of
-          // allocated chunks, because the worker use writeBlocking(). Otherwise
-          // the worker could get stuck in a hot loop!!!
-          m_readerStatusUpdateFIFO(kNumberOfCachedChunksInMemory),
+          m_pChunkPool(CachingReaderChunkPool::sharedInstance(config)),
+          m_chunkReadRequestFIFO(kChunkReadRequestFIFOSize),
+          m_readerStatusUpdateFIFO(kMaxPendingChunkReads + kReaderStatusUpdateFIFOHeadroom),
           m_state(STATE_IDLE),
+          m_numAllocatedChunks(0),
+          m_numPendingChunkReads(0),
+          m_hintRound(1),
+          m_numCacheHits(0),
+          m_numCacheMisses(0),
+          m_numExpiredChunks(0),
+          m_cacheHitCounter(QStringLiteral("CachingReader chunk cache hits")),
+          m_cacheMissCounter(QStringLiteral("CachingReader chunk cache misses")),
+          m_cacheEvictionCounter(QStringLiteral("CachingReader chunk cache evictions")),
           m_mruCachingReaderChunk(nullptr),
           m_lruCachingReaderChunk(nullptr),
-          m_sampleBuffer(CachingReaderChunk::kSamples * kNumberOfCachedChunksInMemory),
-          m_worker(group, &m_chunkReadRequestFIFO, &m_readerStatusUpdateFIFO) {
-    m_allocatedCachingReaderChunks.reserve(kNumberOfCachedChunksInMemory);
-    // Divide up the allocated raw memory buffer into total_chunks
-    // chunks. Initialize each chunk to hold nothing and add it to the free
-    // list.
-    for (SINT i = 0; i < kNumberOfCachedChunksInMemory; ++i) {
-        CachingReaderChunkForOwner* c =
-                new CachingReaderChunkForOwner(
-                        mixxx::SampleBuffer::WritableSlice(
-                                m_sampleBuffer,
-                                CachingReaderChunk::kSamples * i,
-                                CachingReaderChunk::kSamples));
-        m_chunks.push_back(c);
-        m_freeChunks.push_back(c);
-    }
+          m_worker(group, config, &m_chunkReadRequestFIFO, &m_readerStatusUpdateFIFO) {
+    // Avoid rehashing in the engine thread, a single reader may use all
+    // chunks of the pool.
+    m_allocatedCachingReaderChunks.reserve(m_pChunkPool->numChunks());
+    m_pChunkPool->registerReader();
 
     // Forward signals from worker
     connect(&m_worker, &CachingReaderWorker::trackLoading,
@@ -94,7 +114,27 @@ CachingReader::CachingReader(const QString& group,
 
 CachingReader::~CachingReader() {
     m_worker.quitWait();
-    qDeleteAll(m_chunks);
+
+    // Take back all chunks from the stopped worker and return them to the
+    // shared pool together with all cached chunks.
+    CachingReaderChunkReadRequest request;
+    while (m_chunkReadRequestFIFO.read(&request, 1) == 1) {
+        auto update = ReaderStatusUpdate::readDiscarded(request.chunk);
+        freeChunk(update.takeFromWorker());
+        --m_numPendingChunkReads;
+    }
+    ReaderStatusUpdate update;
+    while (m_readerStatusUpdateFIFO.read(&update, 1) == 1) {
+        auto* pChunk = update.takeFromWorker();
+        if (pChunk) {
+            freeChunk(pChunk);
+            --m_numPendingChunkReads;
+        }
+    }
+    DEBUG_ASSERT(m_numPendingChunkReads == 0);
+    freeAllChunks();
+    DEBUG_ASSERT(m_numAllocatedChunks == 0);
+    m_pChunkPool->unregisterReader();
 }
 
 void CachingReader::freeChunkFromList(CachingReaderChunkForOwner* pChunk) {
@@ -102,7 +142,8 @@ void CachingReader::freeChunkFromList(CachingReaderChunkForOwner* pChunk) {
             &m_mruCachingReaderChunk,
             &m_lruCachingReaderChunk);
     pChunk->free();
-    m_freeChunks.push_back(pChunk);
+    m_pChunkPool->release(pChunk);
+    --m_numAllocatedChunks;
 }
 
 void CachingReader::freeChunk(CachingReaderChunkForOwner* pChunk) {
@@ -119,7 +160,7 @@ void CachingReader::freeChunk(CachingReaderChunkForOwner* pChunk) {
 }
 
 void CachingReader::freeAllChunks() {
-    for (const auto& pChunk: qAsConst(m_chunks)) {
+    for (auto* const pChunk : qAsConst(m_allocatedCachingReaderChunks)) {
         // We will receive CHUNK_READ_INVALID for all pending chunk reads
         // which should free the chunks individually.
         if (pChunk->getState() == CachingReaderChunkForOwner::READ_PENDING) {
@@ -137,11 +178,11 @@ void CachingReader::freeAllChunks() {
 }
 
 CachingReaderChunkForOwner* CachingReader::allocateChunk(SINT chunkIndex) {
-    if (m_freeChunks.empty()) {
+    CachingReaderChunkForOwner* pChunk = m_pChunkPool->allocate();
+    if (!pChunk) {
         return nullptr;
     }
-    CachingReaderChunkForOwner* pChunk = m_freeChunks.front();
-    m_freeChunks.pop_front();
+    ++m_numAllocatedChunks;
 
     pChunk->init(chunkIndex);
 
@@ -153,9 +194,20 @@ CachingReaderChunkForOwner* CachingReader::allocateChunk(SINT chunkIndex) {
 CachingReaderChunkForOwner* CachingReader::allocateChunkExpireLRU(SINT chunkIndex) {
     auto* pChunk = allocateChunk(chunkIndex);
     if (!pChunk) {
-        if (m_lruCachingReaderChunk) {
-            freeChunk(m_lruCachingReaderChunk);
-            pChunk = allocateChunk(chunkIndex);
+        pChunk = findExpirableChunk();
+        if (pChunk) {
+            // Reuse the chunk directly. If it was returned to the shared pool
+            // another reader could take it in the meantime.
+            const int removed = m_allocatedCachingReaderChunks.remove(pChunk->getIndex());
+            Q_UNUSED(removed); // only used in DEBUG_ASSERT
+            DEBUG_ASSERT(removed == 1);
+            pChunk->removeFromList(
+                    &m_mruCachingReaderChunk,
+                    &m_lruCachingReaderChunk);
+            pChunk->free();
+            pChunk->init(chunkIndex);
+            m_allocatedCachingReaderChunks.insert(chunkIndex, pChunk);
+            ++m_numExpiredChunks;
         } else {
             kLogger.warning() << "No cached LRU chunk available for freeing";
         }
@@ -166,6 +218,31 @@ CachingReaderChunkForOwner* CachingReader::allocateChunkExpireLRU(SINT chunkInde
     return pChunk;
 }
 
+CachingReaderChunkForOwner* CachingReader::findExpirableChunk() const {
+    auto* pChunk = m_lruCachingReaderChunk;
+    while (pChunk && pChunk->isPinned(m_hintRound)) {
+        pChunk = pChunk->getPrev();
+    }
+    return pChunk;
+}
+
+void CachingReader::releaseSurplusChunks() {
+    if (m_pChunkPool->numFreeChunks() >= kMinFreeChunksInPool) {
+        return;
+    }
+    const SINT numSurplusChunks = math_min(
+            m_numAllocatedChunks - m_pChunkPool->fairShare(),
+            kMaxSurplusChunksReleasedPerCallback);
+    for (SINT i = 0; i < numSurplusChunks; ++i) {
+        auto* pChunk = findExpirableChunk();
+        if (!pChunk) {
+            break;
+        }
+        freeChunk(pChunk);
+        ++m_numExpiredChunks;
+    }
+}
+
 CachingReaderChunkForOwner* CachingReader::lookupChunk(SINT chunkIndex) {
     // Defaults to nullptr if it's not in the hash.
     auto* pChunk = m_allocatedCachingReaderChunks.value(chunkIndex, nullptr);
@@ -229,6 +306,8 @@ void CachingReader::process() {
         auto* pChunk = update.takeFromWorker();
         if (pChunk) {
             // Result of a read request (with a chunk)
+            --m_numPendingChunkReads;
+            DEBUG_ASSERT(m_numPendingChunkReads >= 0);
             DEBUG_ASSERT(atomicLoadRelaxed(m_state) != STATE_IDLE);
             DEBUG_ASSERT(
                     update.status == CHUNK_READ_SUCCESS ||
@@ -436,6 +515,7 @@ CachingReader::ReadResult CachingReader::read(SINT startSample, SINT numSamples,
                 mixxx::IndexRange bufferedFrameIndexRange;
                 const CachingReaderChunkForOwner* const pChunk = lookupChunkAndFreshen(chunkIndex);
                 if (pChunk && (pChunk->getState() == CachingReaderChunkForOwner::READY)) {
+                    ++m_numCacheHits;
                     if (reverse) {
                         bufferedFrameIndexRange =
                                 pChunk->readBufferedSampleFramesReverse(
@@ -454,6 +534,7 @@ CachingReader::ReadResult CachingReader::read(SINT startSample, SINT numSamples,
                     DEBUG_ASSERT(!pChunk ||
                             (pChunk->getState() == CachingReaderChunkForOwner::READ_PENDING));
                     Counter("CachingReader::read(): Failed to read chunk on cache miss")++;
+                    ++m_numCacheMisses;
                     if (kLogger.traceEnabled()) {
                         kLogger.trace()
                                 << "Cache miss for chunk with index"
@@ -525,82 +606,153 @@ void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
         return;
     }
 
+    // Start a new round of hints. Chunks that are not hinted again by a
+    // pinning hint lose their pin after this round.
+    ++m_hintRound;
+
+    releaseSurplusChunks();
+
     // For every chunk that the hints indicated, check if it is in the cache. If
     // any are not, then wake.
     bool shouldWake = false;
+    // Only query the clock if we actually request a chunk.
+    qint64 hintTimeNanos = -1;
 
-    for (const auto& hint: hintList) {
-        SINT hintFrame = hint.frame;
-        SINT hintFrameCount = hint.frameCount;
-
-        // Handle some special length values
-        if (hintFrameCount == Hint::kFrameCountForward) {
-        	hintFrameCount = kDefaultHintFrames;
-        } else if (hintFrameCount == Hint::kFrameCountBackward) {
-        	hintFrame -= kDefaultHintFrames;
-        	hintFrameCount = kDefaultHintFrames;
-            if (hintFrame < 0) {
-            	hintFrameCount += hintFrame;
-                if (hintFrameCount <= 0) {
-                    continue;
-                }
-                hintFrame = 0;
-            }
+    for (const auto& hint : hintList) {
+        if (hint.type != Hint::Type::Prefetch) {
+            shouldWake |= hintChunks(hint, &hintTimeNanos);
         }
-
-        VERIFY_OR_DEBUG_ASSERT(hintFrameCount >= 0) {
-            kLogger.warning() << "CachingReader: Ignoring negative hint length.";
-            continue;
+    }
+    // Prefetch hints are served last so they never take the place of the
+    // chunks that are needed soon.
+    for (const auto& hint : hintList) {
+        if (hint.type == Hint::Type::Prefetch) {
+            shouldWake |= hintChunks(hint, &hintTimeNanos);
         }
+    }
 
-        const auto readableFrameIndexRange = intersect(
-                m_readableFrameIndexRange,
-                mixxx::IndexRange::forward(hintFrame, hintFrameCount));
-        if (readableFrameIndexRange.empty()) {
-            continue;
+    // If there are chunks to be read, wake up.
+    if (shouldWake) {
+        m_worker.workReady();
+    }
+
+    flushCacheStats();
+}
+
+bool CachingReader::hintChunks(const Hint& hint, qint64* pHintTimeNanos) {
+    SINT hintFrame = hint.frame;
+    SINT hintFrameCount = hint.frameCount;
+
+    // Handle some special length values
+    if (hintFrameCount == Hint::kFrameCountForward) {
+        hintFrameCount = kDefaultHintFrames;
+    } else if (hintFrameCount == Hint::kFrameCountBackward) {
+        hintFrame -= kDefaultHintFrames;
+        hintFrameCount = kDefaultHintFrames;
+        if (hintFrame < 0) {
+            hintFrameCount += hintFrame;
+            if (hintFrameCount <= 0) {
+                return false;
+            }
+            hintFrame = 0;
         }
+    }
 
-        const int firstChunkIndex = CachingReaderChunk::indexForFrame(readableFrameIndexRange.start());
-        const int lastChunkIndex = CachingReaderChunk::indexForFrame(readableFrameIndexRange.end() - 1);
-        for (int chunkIndex = firstChunkIndex; chunkIndex <= lastChunkIndex; ++chunkIndex) {
-            CachingReaderChunkForOwner* pChunk = lookupChunk(chunkIndex);
-            if (!pChunk) {
-                shouldWake = true;
-                pChunk = allocateChunkExpireLRU(chunkIndex);
+    VERIFY_OR_DEBUG_ASSERT(hintFrameCount >= 0) {
+        kLogger.warning() << "CachingReader: Ignoring negative hint length.";
+        return false;
+    }
+
+    const auto readableFrameIndexRange = intersect(
+            m_readableFrameIndexRange,
+            mixxx::IndexRange::forward(hintFrame, hintFrameCount));
+    if (readableFrameIndexRange.empty()) {
+        return false;
+    }
+
+    const bool prefetch = hint.type == Hint::Type::Prefetch;
+    const bool pin = isPinningHint(hint.type);
+    const SINT maxPendingChunkReads =
+            prefetch ? kMaxPendingPrefetchChunkReads : kMaxPendingChunkReads;
+
+    bool shouldWake = false;
+    const int firstChunkIndex = CachingReaderChunk::indexForFrame(readableFrameIndexRange.start());
+    const int lastChunkIndex = CachingReaderChunk::indexForFrame(readableFrameIndexRange.end() - 1);
+    for (int chunkIndex = firstChunkIndex; chunkIndex <= lastChunkIndex; ++chunkIndex) {
+        CachingReaderChunkForOwner* pChunk = lookupChunk(chunkIndex);
+        if (!pChunk) {
+            shouldWake = true;
+            if (m_numPendingChunkReads >= maxPendingChunkReads) {
+                // Try again with the next callback
+                continue;
+            }
+            if (prefetch && m_numAllocatedChunks >= m_pChunkPool->fairShare()) {
+                // Prefetching must not expire cached chunks unless this
+                // reader uses less than its fair share of the pool.
+                pChunk = allocateChunk(chunkIndex);
                 if (!pChunk) {
-                    kLogger.warning()
-                            << "Failed to allocate chunk"
-                            << chunkIndex
-                            << "for read request";
                     continue;
                 }
-                // Do not insert the allocated chunk into the MRU/LRU list,
-                // because it will be handed over to the worker immediately
-                CachingReaderChunkReadRequest request;
-                request.giveToWorker(pChunk);
-                if (kLogger.traceEnabled()) {
-                    kLogger.trace()
-                            << "Requesting read of chunk"
-                            << request.chunk;
-                }
-                if (m_chunkReadRequestFIFO.write(&request, 1) != 1) {
-                    kLogger.warning()
-                            << "Failed to submit read request for chunk"
-                            << chunkIndex;
-                    // Revoke the chunk from the worker and free it
-                    pChunk->takeFromWorker();
-                    freeChunk(pChunk);
-                }
-            } else if (pChunk->getState() == CachingReaderChunkForOwner::READY) {
+            } else {
+                pChunk = allocateChunkExpireLRU(chunkIndex);
+            }
+            if (!pChunk) {
+                kLogger.warning()
+                        << "Failed to allocate chunk"
+                        << chunkIndex
+                        << "for read request";
+                continue;
+            }
+            if (pin) {
+                pChunk->pin(m_hintRound);
+            }
+            // Do not insert the allocated chunk into the MRU/LRU list,
+            // because it will be handed over to the worker immediately
+            if (*pHintTimeNanos < 0) {
+                *pHintTimeNanos = mixxx::Time::elapsed().toIntegerNanos();
+            }
+            CachingReaderChunkReadRequest request;
+            request.giveToWorker(pChunk, *pHintTimeNanos);
+            if (kLogger.traceEnabled()) {
+                kLogger.trace()
+                        << "Requesting read of chunk"
+                        << request.chunk;
+            }
+            if (m_chunkReadRequestFIFO.write(&request, 1) != 1) {
+                kLogger.warning()
+                        << "Failed to submit read request for chunk"
+                        << chunkIndex;
+                // Revoke the chunk from the worker and free it
+                pChunk->takeFromWorker();
+                freeChunk(pChunk);
+                continue;
+            }
+            ++m_numPendingChunkReads;
+        } else {
+            if (pin) {
+                pChunk->pin(m_hintRound);
+            }
+            if (pChunk->getState() == CachingReaderChunkForOwner::READY) {
                 // This will cause the chunk to be 'freshened' in the cache. The
                 // chunk will be moved to the end of the LRU list.
                 freshenChunk(pChunk);
             }
         }
     }
+    return shouldWake;
+}
 
-    // If there are chunks to be read, wake up.
-    if (shouldWake) {
-        m_worker.workReady();
+void CachingReader::flushCacheStats() {
+    if (m_numCacheHits > 0) {
+        m_cacheHitCounter += m_numCacheHits;
+        m_numCacheHits = 0;
+    }
+    if (m_numCacheMisses > 0) {
+        m_cacheMissCounter += m_numCacheMisses;
+        m_numCacheMisses = 0;
+    }
+    if (m_numExpiredChunks > 0) {
+        m_cacheEvictionCounter += m_numExpiredChunks;
+        m_numExpiredChunks = 0;
     }
 }
@@ -4,13 +4,14 @@
 #include <QHash>
 #include <QList>
 #include <QVarLengthArray>
-#include <QVector>
-#include <list>
+#include <memory>
 
+#include "engine/cachingreader/cachingreaderchunkpool.h"
 #include "engine/cachingreader/cachingreaderworker.h"
 #include "engine/engineworker.h"
 #include "preferences/usersettings.h"
 #include "track/track_decl.h"
+#include "util/counter.h"
 #include "util/fifo.h"
 #include "util/types.h"
 
@@ -29,7 +30,8 @@ typedef struct Hint {
         FirstSound,
         IntroStart,
         IntroEnd,
-        OutroStart
+        OutroStart,
+        Prefetch, // lowest priority, only uses spare chunks
     };
 
     // The frame to ensure is present in memory.
@@ -37,8 +39,9 @@ typedef struct Hint {
     // If a range of frames should be present, use frameCount to indicate that the
     // range (frame, frame + frameCount) should be present in memory.
     SINT frameCount;
-    // Currently unused -- but in the future could be used to prioritize certain
-    // hints over others.
+    // The position hints for the play position, loops and cues pin their
+    // chunks in the cache. Prefetch hints are only served after all other
+    // hints.
     Type type;
 
     // for the default frame count in forward direction
@@ -75,8 +78,12 @@ typedef QVarLengthArray<Hint, 512> HintVector;
 // least recently used chunks. When a chunk is "freshened" (i.e. accessed via
 // read or hinted via hintAndMaybeWake) then it is moved to the back of the
 // least-recently-used list. When a chunk needs to be allocated and there are no
-// free chunks then the least recently used chunk is free'd (see
-// allocateChunkExpireLRU).
+// free chunks then the least recently used chunk that is not pinned by a hint
+// is free'd (see allocateChunkExpireLRU).
+//
+// The memory for the chunks is shared by all CachingReaders through the
+// CachingReaderChunkPool. A reader that holds more than its fair share of the
+// pool returns its least recently used chunks while the pool runs short.
 class CachingReader : public QObject {
     Q_OBJECT
 
@@ -129,6 +136,8 @@ class CachingReader : public QObject {
   private:
     const UserSettingsPointer m_pConfig;
 
+    const std::shared_ptr<CachingReaderChunkPool> m_pChunkPool;
+
     // Thread-safe FIFOs for communication between the engine callback and
     // reader thread.
     FIFO<CachingReaderChunkReadRequest> m_chunkReadRequestFIFO;
@@ -146,19 +155,33 @@ class CachingReader : public QObject {
     // Moves the provided chunk to the MRU position.
     void freshenChunk(CachingReaderChunkForOwner* pChunk);
 
-    // Returns a CachingReaderChunk to the free list
+    // Returns a CachingReaderChunk to the pool
     void freeChunk(CachingReaderChunkForOwner* pChunk);
     void freeChunkFromList(CachingReaderChunkForOwner* pChunk);
 
-    // Returns all allocated chunks to the free list
+    // Returns all allocated chunks to the pool
     void freeAllChunks();
 
-    // Gets a chunk from the free list. Returns nullptr if none available.
+    // Gets a chunk from the pool. Returns nullptr if none available.
     CachingReaderChunkForOwner* allocateChunk(SINT chunkIndex);
 
-    // Gets a chunk from the free list, frees the LRU CachingReaderChunk if none available.
+    // Gets a chunk from the pool, reuses the LRU CachingReaderChunk that is
+    // not pinned if none available.
     CachingReaderChunkForOwner* allocateChunkExpireLRU(SINT chunkIndex);
 
+    // Returns the least recently used chunk that is not pinned or nullptr.
+    CachingReaderChunkForOwner* findExpirableChunk() const;
+
+    // Returns a few unpinned chunks to the pool if it runs short and this
+    // reader holds more than its fair share.
+    void releaseSurplusChunks();
+
+    // Requests the chunks of a single hint from the worker. Returns true if
+    // the worker needs to be woken up.
+    bool hintChunks(const Hint& hint, qint64* pHintTimeNanos);
+
+    void flushCacheStats();
+
     enum State {
         STATE_IDLE,
         STATE_TRACK_LOADING,
@@ -167,12 +190,21 @@ class CachingReader : public QObject {
     };
     QAtomicInt m_state;
 
-    // Keeps track of all CachingReaderChunks we've allocated.
-    QVector<CachingReaderChunkForOwner*> m_chunks;
+    // The number of chunks taken from the pool, including pending reads.
+    SINT m_numAllocatedChunks;
+    // The number of chunks owned by the worker
+    SINT m_numPendingChunkReads;
 
-    // List of free chunks. Linked list so that we have constant time insertions
-    // and deletions. Iteration is not necessary.
-    std::list<CachingReaderChunkForOwner*> m_freeChunks;
+    // Incremented for each list of hints, see CachingReaderChunkForOwner::pin()
+    quint32 m_hintRound;
+
+    // Accumulated per callback and reported to the StatsManager in one go
+    int m_numCacheHits;
+    int m_numCacheMisses;
+    int m_numExpiredChunks;
+    Counter m_cacheHitCounter;
+    Counter m_cacheMissCounter;
+    Counter m_cacheEvictionCounter;
 
     // Keeps track of what CachingReaderChunks we've allocated and indexes them based on what
     // chunk number they are allocated to.
@@ -182,9 +214,6 @@ class CachingReader : public QObject {
     CachingReaderChunkForOwner* m_mruCachingReaderChunk;
     CachingReaderChunkForOwner* m_lruCachingReaderChunk;
 
-    // The raw memory buffer which is divided up into chunks.
-    mixxx::SampleBuffer m_sampleBuffer;
-
     // The readable frame index range as reported by the worker.
     mixxx::IndexRange m_readableFrameIndexRange;
 
@@ -66,6 +66,29 @@ mixxx::IndexRange CachingReaderChunk::bufferSampleFrames(
     return m_bufferedSampleFrames.frameIndexRange();
 }
 
+mixxx::IndexRange CachingReaderChunk::copySampleFrames(
+        const mixxx::AudioSourcePointer& pAudioSource,
+        const mixxx::ReadableSampleFrames& decodedSampleFrames) {
+    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+    const auto sourceFrameIndexRange = frameIndexRange(pAudioSource);
+    VERIFY_OR_DEBUG_ASSERT(sourceFrameIndexRange.isSubrangeOf(
+            decodedSampleFrames.frameIndexRange())) {
+        m_bufferedSampleFrames = mixxx::ReadableSampleFrames();
+        return mixxx::IndexRange();
+    }
+    const SINT srcSampleOffset = frames2samples(
+            sourceFrameIndexRange.start() - decodedSampleFrames.frameIndexRange().start());
+    const SINT sampleCount = frames2samples(sourceFrameIndexRange.length());
+    SampleUtil::copy(
+            m_sampleBuffer.data(),
+            decodedSampleFrames.readableData(srcSampleOffset),
+            sampleCount);
+    m_bufferedSampleFrames = mixxx::ReadableSampleFrames(
+            sourceFrameIndexRange,
+            mixxx::SampleBuffer::ReadableSlice(m_sampleBuffer.data(), sampleCount));
+    return sourceFrameIndexRange;
+}
+
 mixxx::IndexRange CachingReaderChunk::readBufferedSampleFrames(
         CSAMPLE* sampleBuffer,
         const mixxx::IndexRange& frameIndexRange) const {
@@ -107,9 +130,12 @@ mixxx::IndexRange CachingReaderChunk::readBufferedSampleFramesReverse(
 }
 
 CachingReaderChunkForOwner::CachingReaderChunkForOwner(
-        mixxx::SampleBuffer::WritableSlice sampleBuffer)
+        mixxx::SampleBuffer::WritableSlice sampleBuffer,
+        SINT poolIndex)
         : CachingReaderChunk(std::move(sampleBuffer)),
+          m_poolIndex(poolIndex),
           m_state(FREE),
+          m_pinnedHintRound(0),
           m_pPrev(nullptr),
           m_pNext(nullptr) {
 }
@@ -123,6 +149,7 @@ void CachingReaderChunkForOwner::init(SINT index) {
 
     CachingReaderChunk::init(index);
     m_state = READY;
+    m_pinnedHintRound = 0;
 }
 
 void CachingReaderChunkForOwner::free() {
@@ -67,6 +67,12 @@ public:
             const mixxx::AudioSourcePointer& pAudioSource,
             mixxx::SampleBuffer::WritableSlice tempOutputBuffer);
 
+    // Copy the sample frames from a buffer with the decoded samples
+    // of the whole track that must cover the frames of this chunk.
+    mixxx::IndexRange copySampleFrames(
+            const mixxx::AudioSourcePointer& pAudioSource,
+            const mixxx::ReadableSampleFrames& decodedSampleFrames);
+
     mixxx::IndexRange readBufferedSampleFrames(
             CSAMPLE* sampleBuffer,
             const mixxx::IndexRange& frameIndexRange) const;
@@ -99,10 +105,16 @@ private:
 // the worker thread is in control.
 class CachingReaderChunkForOwner: public CachingReaderChunk {
 public:
-    explicit CachingReaderChunkForOwner(
-            mixxx::SampleBuffer::WritableSlice sampleBuffer);
+    CachingReaderChunkForOwner(
+            mixxx::SampleBuffer::WritableSlice sampleBuffer,
+            SINT poolIndex);
     ~CachingReaderChunkForOwner() override = default;
 
+    // The index of this chunk in the CachingReaderChunkPool
+    SINT getPoolIndex() const noexcept {
+        return m_poolIndex;
+    }
+
     void init(SINT index);
     void free();
 
@@ -146,8 +158,25 @@ public:
             CachingReaderChunkForOwner** ppHead,
             CachingReaderChunkForOwner** ppTail);
 
+    // The next more recently used chunk in the MRU/LRU list
+    CachingReaderChunkForOwner* getPrev() const noexcept {
+        return m_pPrev;
+    }
+
+    // Pinned chunks are skipped when the cache needs to expire a chunk.
+    // A chunk stays pinned as long as it is hinted with a pinning hint in
+    // every round of hints, i.e. the pin expires after one round without.
+    void pin(quint32 hintRound) {
+        m_pinnedHintRound = hintRound;
+    }
+    bool isPinned(quint32 hintRound) const {
+        return m_pinnedHintRound + 1 >= hintRound;
+    }
+
 private:
+  const SINT m_poolIndex;
   State m_state;
+  quint32 m_pinnedHintRound;
 
   CachingReaderChunkForOwner* m_pPrev; // previous item in double-linked list
   CachingReaderChunkForOwner* m_pNext; // next item in double-linked list
@@ -0,0 +1,148 @@
+#include "engine/cachingreader/cachingreaderchunkpool.h"
+
+#include <QMutex>
+#include <algorithm>
+
+#include "util/assert.h"
+#include "util/compatibility/qmutex.h"
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("CachingReaderChunkPool");
+
+const QString kConfigGroup = QStringLiteral("[Master]");
+const QString kMemoryBudgetConfigKey = QStringLiteral("caching_reader_memory_budget_mb");
+
+constexpr SINT kChunkSizeBytes = CachingReaderChunk::kSamples * sizeof(CSAMPLE);
+
+// Protects the creation of the shared instance. CachingReaders are created
+// and destroyed in the main thread, but tests may create them elsewhere.
+QMutex s_sharedInstanceMutex;
+std::weak_ptr<CachingReaderChunkPool> s_sharedInstance;
+
+} // anonymous namespace
+
+// static
+int CachingReaderChunkPool::memoryBudgetMiB(const UserSettingsPointer& pConfig) {
+    if (!pConfig) {
+        return kDefaultMemoryBudgetMiB;
+    }
+    const int budget = pConfig->getValue(
+            ConfigKey(kConfigGroup, kMemoryBudgetConfigKey),
+            kDefaultMemoryBudgetMiB);
+    VERIFY_OR_DEBUG_ASSERT(budget > 0) {
+        return kDefaultMemoryBudgetMiB;
+    }
+    return budget;
+}
+
+// static
+std::shared_ptr<CachingReaderChunkPool> CachingReaderChunkPool::sharedInstance(
+        const UserSettingsPointer& pConfig) {
+    const auto locker = lockMutex(&s_sharedInstanceMutex);
+    auto pPool = s_sharedInstance.lock();
+    if (!pPool) {
+        const SINT budgetBytes = static_cast<SINT>(memoryBudgetMiB(pConfig)) * 1024 * 1024;
+        const SINT numChunks = std::max(budgetBytes / kChunkSizeBytes, kMinNumChunks);
+        kLogger.info()
+                << "Allocating"
+                << numChunks
+                << "chunks with"
+                << numChunks * kChunkSizeBytes / (1024 * 1024)
+                << "MiB";
+        pPool = std::make_shared<CachingReaderChunkPool>(numChunks);
+        s_sharedInstance = pPool;
+    }
+    return pPool;
+}
+
+CachingReaderChunkPool::CachingReaderChunkPool(SINT numChunks)
+        : m_sampleBuffer(CachingReaderChunk::kSamples * numChunks),
+          m_nextFreeChunk(std::make_unique<std::atomic<SINT>[]>(numChunks)),
+          m_freeListHead(0),
+          m_numFreeChunks(0),
+          m_numReaders(0) {
+    DEBUG_ASSERT(numChunks > 0);
+    DEBUG_ASSERT(static_cast<std::uint64_t>(numChunks) < kIndexMask);
+    m_chunks.reserve(numChunks);
+    // Divide up the allocated raw memory buffer into chunks. Initialize
+    // each chunk to hold nothing and add it to the free list.
+    for (SINT i = 0; i < numChunks; ++i) {
+        m_chunks.push_back(std::make_unique<CachingReaderChunkForOwner>(
+                mixxx::SampleBuffer::WritableSlice(
+                        m_sampleBuffer,
+                        CachingReaderChunk::kSamples * i,
+                        CachingReaderChunk::kSamples),
+                i));
+    }
+    // Push in reverse order so the chunks are handed out in memory order
+    for (SINT i = numChunks - 1; i >= 0; --i) {
+        push(i);
+    }
+}
+
+CachingReaderChunkPool::~CachingReaderChunkPool() {
+    // All readers must have returned their chunks
+    DEBUG_ASSERT(m_numReaders.load() == 0);
+    DEBUG_ASSERT(m_numFreeChunks.load() == numChunks());
+}
+
+SINT CachingReaderChunkPool::fairShare() const {
+    const int numReaders = std::max(m_numReaders.load(std::memory_order_relaxed), 1);
+    return numChunks() / numReaders;
+}
+
+CachingReaderChunkForOwner* CachingReaderChunkPool::allocate() {
+    std::uint64_t head = m_freeListHead.load(std::memory_order_acquire);
+    while (true) {
+        const SINT chunkIndex = static_cast<SINT>(head & kIndexMask) - 1;
+        if (chunkIndex < 0) {
+            return nullptr;
+        }
+        // The successor might be stale if another thread has popped this
+        // chunk in the meantime. The tag of the head then has changed and
+        // the CAS below fails.
+        const SINT nextChunkIndex =
+                m_nextFreeChunk[chunkIndex].load(std::memory_order_relaxed);
+        const std::uint64_t newHead =
+                (((head >> kTagShift) + 1) << kTagShift) |
+                static_cast<std::uint64_t>(nextChunkIndex + 1);
+        if (m_freeListHead.compare_exchange_weak(head,
+                    newHead,
+                    std::memory_order_acq_rel,
+                    std::memory_order_acquire)) {
+            m_numFreeChunks.fetch_sub(1, std::memory_order_relaxed);
+            CachingReaderChunkForOwner* pChunk = m_chunks[chunkIndex].get();
+            DEBUG_ASSERT(pChunk->getState() == CachingReaderChunkForOwner::FREE);
+            return pChunk;
+        }
+    }
+}
+
+void CachingReaderChunkPool::release(CachingReaderChunkForOwner* pChunk) {
+    DEBUG_ASSERT(pChunk);
+    DEBUG_ASSERT(pChunk->getState() == CachingReaderChunkForOwner::FREE);
+    const SINT chunkIndex = pChunk->getPoolIndex();
+    VERIFY_OR_DEBUG_ASSERT(chunkIndex >= 0 && chunkIndex < numChunks() &&
+            m_chunks[chunkIndex].get() == pChunk) {
+        return;
+    }
+    push(chunkIndex);
+}
+
+void CachingReaderChunkPool::push(SINT chunkIndex) {
+    std::uint64_t head = m_freeListHead.load(std::memory_order_relaxed);
+    std::uint64_t newHead;
+    do {
+        m_nextFreeChunk[chunkIndex].store(
+                static_cast<SINT>(head & kIndexMask) - 1,
+                std::memory_order_relaxed);
+        newHead = (((head >> kTagShift) + 1) << kTagShift) |
+                static_cast<std::uint64_t>(chunkIndex + 1);
+    } while (!m_freeListHead.compare_exchange_weak(head,
+            newHead,
+            std::memory_order_release,
+            std::memory_order_relaxed));
+    m_numFreeChunks.fetch_add(1, std::memory_order_relaxed);
+}
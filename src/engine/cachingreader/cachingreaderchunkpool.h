@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "preferences/usersettings.h"
+#include "util/class.h"
+#include "util/samplebuffer.h"
+
+// CachingReaderChunkPool owns the memory for the chunks of all CachingReaders.
+// Instead of reserving a fixed number of chunks per deck, all decks and
+// samplers share a common memory budget. A deck that is scratching or jumping
+// around can use more chunks than a sampler that is idle.
+//
+// Chunks are handed out and returned through a lock-free free list, so
+// allocate() and release() may be called from multiple engine threads
+// concurrently. Neither of them allocates memory or blocks.
+class CachingReaderChunkPool {
+  public:
+    // The default memory budget for all decoded chunks in memory.
+    static constexpr int kDefaultMemoryBudgetMiB = 64;
+
+    // Never use less chunks than a single CachingReader used before the
+    // memory has been shared.
+    static constexpr SINT kMinNumChunks = 80;
+
+    // Returns the pool that is shared by all CachingReaders. The pool is
+    // created on first use with the memory budget from the settings and is
+    // destroyed together with the last CachingReader that uses it.
+    static std::shared_ptr<CachingReaderChunkPool> sharedInstance(
+            const UserSettingsPointer& pConfig);
+
+    // Returns the configured memory budget in MiB.
+    static int memoryBudgetMiB(const UserSettingsPointer& pConfig);
+
+    explicit CachingReaderChunkPool(SINT numChunks);
+    ~CachingReaderChunkPool();
+
+    SINT numChunks() const {
+        return static_cast<SINT>(m_chunks.size());
+    }
+
+    SINT numFreeChunks() const {
+        return m_numFreeChunks.load(std::memory_order_relaxed);
+    }
+
+    // The number of chunks that each registered reader is entitled to if
+    // the pool runs out of free chunks.
+    SINT fairShare() const;
+
+    void registerReader() {
+        m_numReaders.fetch_add(1, std::memory_order_relaxed);
+    }
+    void unregisterReader() {
+        m_numReaders.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // Takes a chunk from the free list. The returned chunk is in state
+    // FREE. Returns nullptr if all chunks are in use.
+    CachingReaderChunkForOwner* allocate();
+
+    // Returns a chunk in state FREE to the free list.
+    void release(CachingReaderChunkForOwner* pChunk);
+
+  private:
+    // The head of the free list is stored as
+    //   | ABA tag (32 bits) | chunk index + 1 (32 bits) |
+    // with a chunk index of -1 for an empty list. The tag is incremented
+    // on every update to detect a concurrent pop and push of the same chunk.
+    static constexpr std::uint64_t kIndexMask = 0xFFFFFFFF;
+    static constexpr int kTagShift = 32;
+
+    void push(SINT chunkIndex);
+
+    mixxx::SampleBuffer m_sampleBuffer;
+    std::vector<std::unique_ptr<CachingReaderChunkForOwner>> m_chunks;
+    // The index of the next free chunk for each chunk on the free list
+    std::unique_ptr<std::atomic<SINT>[]> m_nextFreeChunk;
+    std::atomic<std::uint64_t> m_freeListHead;
+    std::atomic<SINT> m_numFreeChunks;
+    std::atomic<int> m_numReaders;
+
+    DISALLOW_COPY_AND_ASSIGN(CachingReaderChunkPool);
+};
@@ -0,0 +1,155 @@
+#include "engine/cachingreader/cachingreadertrackbuffer.h"
+
+#include <QDir>
+#include <atomic>
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "sources/audiosourcestereoproxy.h"
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("CachingReaderTrackBuffer");
+
+// Decode one chunk at a time. A read request that arrives while decoding
+// needs to wait for at most one block.
+constexpr SINT kDecodeBlockFrames = CachingReaderChunk::kFrames;
+
+// The total size of all track buffers that are kept in RAM
+std::atomic<SINT> s_ramBytesInUse(0);
+
+SINT bufferSizeBytes(const mixxx::IndexRange& frameIndexRange) {
+    return CachingReaderChunk::frames2samples(frameIndexRange.length()) *
+            static_cast<SINT>(sizeof(CSAMPLE));
+}
+
+} // anonymous namespace
+
+// static
+std::unique_ptr<CachingReaderTrackBuffer> CachingReaderTrackBuffer::allocate(
+        mixxx::IndexRange frameIndexRange,
+        SINT ramBudgetBytes) {
+    DEBUG_ASSERT(!frameIndexRange.empty());
+    const SINT sizeBytes = bufferSizeBytes(frameIndexRange);
+
+    if (s_ramBytesInUse.fetch_add(sizeBytes) + sizeBytes <= ramBudgetBytes) {
+        mixxx::SampleBuffer sampleBuffer(
+                CachingReaderChunk::frames2samples(frameIndexRange.length()));
+        if (sampleBuffer.size() > 0) {
+            return std::unique_ptr<CachingReaderTrackBuffer>(
+                    new CachingReaderTrackBuffer(
+                            frameIndexRange,
+                            std::move(sampleBuffer)));
+        }
+        kLogger.warning()
+                << "Failed to allocate"
+                << sizeBytes
+                << "bytes in RAM";
+    }
+    s_ramBytesInUse.fetch_sub(sizeBytes);
+
+    // Not enough RAM left, use a memory-mapped temporary file instead
+    auto pFile = std::make_unique<QTemporaryFile>(
+            QDir::tempPath() + QStringLiteral("/mixxx-track-XXXXXX.pcm"));
+    if (!pFile->open() || !pFile->resize(sizeBytes)) {
+        kLogger.warning()
+                << "Failed to create temporary file"
+                << pFile->fileName()
+                << pFile->errorString();
+        return nullptr;
+    }
+    uchar* pMappedData = pFile->map(0, sizeBytes);
+    if (!pMappedData) {
+        kLogger.warning()
+                << "Failed to map temporary file"
+                << pFile->fileName()
+                << pFile->errorString();
+        return nullptr;
+    }
+    return std::unique_ptr<CachingReaderTrackBuffer>(
+            new CachingReaderTrackBuffer(
+                    frameIndexRange,
+                    std::move(pFile),
+                    reinterpret_cast<CSAMPLE*>(pMappedData)));
+}
+
+CachingReaderTrackBuffer::CachingReaderTrackBuffer(
+        mixxx::IndexRange frameIndexRange,
+        mixxx::SampleBuffer sampleBuffer)
+        : m_frameIndexRange(frameIndexRange),
+          m_decodedFrameIndex(frameIndexRange.start()),
+          m_decodingFinished(false),
+          m_sampleBuffer(std::move(sampleBuffer)),
+          m_pData(m_sampleBuffer.data()) {
+}
+
+CachingReaderTrackBuffer::CachingReaderTrackBuffer(
+        mixxx::IndexRange frameIndexRange,
+        std::unique_ptr<QTemporaryFile> pFile,
+        CSAMPLE* pMappedData)
+        : m_frameIndexRange(frameIndexRange),
+          m_decodedFrameIndex(frameIndexRange.start()),
+          m_decodingFinished(false),
+          m_pFile(std::move(pFile)),
+          m_pData(pMappedData) {
+}
+
+CachingReaderTrackBuffer::~CachingReaderTrackBuffer() {
+    if (m_pFile) {
+        // The file is removed when it is closed by the destructor
+        m_pFile->unmap(reinterpret_cast<uchar*>(m_pData));
+    } else {
+        s_ramBytesInUse.fetch_sub(bufferSizeBytes(m_frameIndexRange));
+    }
+}
+
+void CachingReaderTrackBuffer::decodeNextFrames(
+        const mixxx::AudioSourcePointer& pAudioSource,
+        mixxx::SampleBuffer::WritableSlice tempOutputBuffer) {
+    DEBUG_ASSERT(!m_decodingFinished);
+    const auto blockFrameIndexRange = intersect(
+            mixxx::IndexRange::forward(m_decodedFrameIndex, kDecodeBlockFrames),
+            intersect(m_frameIndexRange, pAudioSource->frameIndexRange()));
+    if (blockFrameIndexRange.empty() ||
+            blockFrameIndexRange.start() != m_decodedFrameIndex) {
+        m_decodingFinished = true;
+        return;
+    }
+    mixxx::AudioSourceStereoProxy audioSourceProxy(
+            pAudioSource,
+            tempOutputBuffer);
+    const SINT sampleOffset = CachingReaderChunk::frames2samples(
+            blockFrameIndexRange.start() - m_frameIndexRange.start());
+    const auto decodedFrameIndexRange =
+            audioSourceProxy
+                    .readSampleFrames(mixxx::WritableSampleFrames(
+                            blockFrameIndexRange,
+                            mixxx::SampleBuffer::WritableSlice(
+                                    m_pData + sampleOffset,
+                                    CachingReaderChunk::frames2samples(
+                                            blockFrameIndexRange.length()))))
+                    .frameIndexRange();
+    if (decodedFrameIndexRange != blockFrameIndexRange) {
+        // Don't try to decode the rest of the track. The remaining frames
+        // are read chunk by chunk as before.
+        kLogger.warning()
+                << "Stopped decoding after a read error:"
+                << "expected =" << blockFrameIndexRange
+                << ", actual =" << decodedFrameIndexRange;
+        m_decodingFinished = true;
+        return;
+    }
+    m_decodedFrameIndex = blockFrameIndexRange.end();
+    if (m_decodedFrameIndex >= m_frameIndexRange.end()) {
+        m_decodingFinished = true;
+    }
+}
+
+mixxx::ReadableSampleFrames CachingReaderTrackBuffer::decodedSampleFrames() const {
+    const auto frameIndexRange = decodedFrameIndexRange();
+    return mixxx::ReadableSampleFrames(
+            frameIndexRange,
+            mixxx::SampleBuffer::ReadableSlice(
+                    m_pData,
+                    CachingReaderChunk::frames2samples(frameIndexRange.length())));
+}
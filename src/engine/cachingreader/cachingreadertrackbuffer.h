@@ -0,0 +1,77 @@
+#pragma once
+
+#include <QTemporaryFile>
+#include <memory>
+
+#include "sources/audiosource.h"
+#include "util/class.h"
+#include "util/samplebuffer.h"
+
+// CachingReaderTrackBuffer holds the decoded stereo samples of a whole track.
+// The CachingReaderWorker fills it block by block whenever it is idle. Once
+// the requested frames have been decoded, chunk read requests are served by
+// copying from this buffer without invoking the decoder. Seeking and
+// scratching in compressed files then costs no decoding work.
+//
+// The samples are kept in RAM as long as the memory budget that is shared by
+// all track buffers allows. Otherwise they are stored in a memory-mapped
+// temporary file and paged in by the operating system on demand.
+//
+// Not thread-safe, only accessed by the worker thread.
+class CachingReaderTrackBuffer {
+  public:
+    // Returns nullptr if neither RAM nor a temporary file could be allocated.
+    static std::unique_ptr<CachingReaderTrackBuffer> allocate(
+            mixxx::IndexRange frameIndexRange,
+            SINT ramBudgetBytes);
+
+    ~CachingReaderTrackBuffer();
+
+    bool isInRam() const {
+        return !m_pFile;
+    }
+
+    mixxx::IndexRange frameIndexRange() const {
+        return m_frameIndexRange;
+    }
+
+    // The frames from the start of the track that have been decoded so far.
+    mixxx::IndexRange decodedFrameIndexRange() const {
+        return mixxx::IndexRange::between(m_frameIndexRange.start(), m_decodedFrameIndex);
+    }
+
+    // Decoding has either finished or stopped on a read error. In the latter
+    // case the remaining frames are read through the regular chunk path.
+    bool isDecodingFinished() const {
+        return m_decodingFinished;
+    }
+
+    // Decodes the next block of sample frames from the audio source.
+    void decodeNextFrames(
+            const mixxx::AudioSourcePointer& pAudioSource,
+            mixxx::SampleBuffer::WritableSlice tempOutputBuffer);
+
+    mixxx::ReadableSampleFrames decodedSampleFrames() const;
+
+  private:
+    CachingReaderTrackBuffer(
+            mixxx::IndexRange frameIndexRange,
+            mixxx::SampleBuffer sampleBuffer);
+    CachingReaderTrackBuffer(
+            mixxx::IndexRange frameIndexRange,
+            std::unique_ptr<QTemporaryFile> pFile,
+            CSAMPLE* pMappedData);
+
+    const mixxx::IndexRange m_frameIndexRange;
+    SINT m_decodedFrameIndex;
+    bool m_decodingFinished;
+
+    // Either the samples are stored in RAM...
+    mixxx::SampleBuffer m_sampleBuffer;
+    // ...or in a memory-mapped file.
+    std::unique_ptr<QTemporaryFile> m_pFile;
+
+    CSAMPLE* const m_pData;
+
+    DISALLOW_COPY_AND_ASSIGN(CachingReaderTrackBuffer);
+};
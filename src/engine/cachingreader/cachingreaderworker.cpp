@@ -3,9 +3,11 @@
 #include <QAtomicInt>
 #include <QFileInfo>
 #include <QtDebug>
+#include <algorithm>
 
 #include "analyzer/analyzersilence.h"
 #include "control/controlobject.h"
+#include "mixer/playermanager.h"
 #include "moc_cachingreaderworker.cpp"
 #include "sources/soundsourceproxy.h"
 #include "track/track.h"
@@ -13,6 +15,8 @@
 #include "util/event.h"
 #include "util/logger.h"
 #include "util/span.h"
+#include "util/stat.h"
+#include "util/time.h"
 
 namespace {
 
@@ -21,14 +25,40 @@ mixxx::Logger kLogger("CachingReaderWorker");
 // we need the last silence frame and the first sound frame
 constexpr SINT kNumSoundFrameToVerify = 2;
 
+// The hint-to-chunk-ready latencies are collected in a histogram with this
+// resolution to keep the number of distinct values bounded.
+constexpr qint64 kLatencyHistogramResolutionNanos = 250 * 1000;
+constexpr qint64 kLatencyHistogramMaxNanos = 100 * 1000 * 1000;
+
+const Stat::ComputeFlags kLatencyStatFlags = Stat::COUNT | Stat::AVERAGE |
+        Stat::MIN | Stat::MAX | Stat::SAMPLE_VARIANCE | Stat::HISTOGRAM;
+
+const QString kConfigGroup = QStringLiteral("[Master]");
+const QString kTrackBufferEnabledConfigKey = QStringLiteral("decode_whole_tracks");
+const QString kTrackBufferRamBudgetConfigKey = QStringLiteral("decode_whole_tracks_ram_budget_mb");
+
+// Tracks that do not fit into this budget are decoded into a memory-mapped
+// temporary file. 1 GiB covers 4 decks with tracks of more than 10 minutes.
+constexpr int kDefaultTrackBufferRamBudgetMiB = 1024;
+
+qint64 quantizeLatency(qint64 latencyNanos) {
+    const qint64 clamped = std::clamp(latencyNanos, qint64{0}, kLatencyHistogramMaxNanos);
+    return (clamped / kLatencyHistogramResolutionNanos) * kLatencyHistogramResolutionNanos;
+}
+
 } // anonymous namespace
 
 CachingReaderWorker::CachingReaderWorker(
         const QString& group,
+        UserSettingsPointer pConfig,
         FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
         FIFO<ReaderStatusUpdate>* pReaderStatusFIFO)
         : m_group(group),
+          m_pConfig(std::move(pConfig)),
           m_tag(QString("CachingReaderWorker %1").arg(m_group)),
+          m_hintToChunkReadyStatTag(
+                  QStringLiteral("CachingReaderWorker %1 hint to chunk ready")
+                          .arg(m_group)),
           m_pChunkReadRequestFIFO(pChunkReadRequestFIFO),
           m_pReaderStatusFIFO(pReaderStatusFIFO) {
 }
@@ -50,10 +80,18 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
         return result;
     }
 
-    // Try to read the data required for the chunk from the audio source
-    const mixxx::IndexRange bufferedFrameIndexRange = pChunk->bufferSampleFrames(
-            m_pAudioSource,
-            mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+    // Try to read the data required for the chunk from the decoded track
+    // or otherwise from the audio source
+    const mixxx::IndexRange bufferedFrameIndexRange =
+            (m_pTrackBuffer &&
+                    chunkFrameIndexRange.isSubrangeOf(
+                            m_pTrackBuffer->decodedFrameIndexRange()))
+            ? pChunk->copySampleFrames(
+                      m_pAudioSource,
+                      m_pTrackBuffer->decodedSampleFrames())
+            : pChunk->bufferSampleFrames(
+                      m_pAudioSource,
+                      mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
     DEBUG_ASSERT(!m_pAudioSource ||
             bufferedFrameIndexRange.isSubrangeOf(m_pAudioSource->frameIndexRange()));
     // The readable frame range might have changed
@@ -130,6 +168,16 @@ void CachingReaderWorker::run() {
             // Read the requested chunk and send the result
             const ReaderStatusUpdate update = processReadRequest(request);
             m_pReaderStatusFIFO->writeBlocking(&update, 1);
+            const qint64 latencyNanos =
+                    mixxx::Time::elapsed().toIntegerNanos() - request.hintTimeNanos;
+            Stat::track(m_hintToChunkReadyStatTag,
+                    Stat::DURATION_NANOSEC,
+                    kLatencyStatFlags,
+                    static_cast<double>(quantizeLatency(latencyNanos)));
+        } else if (m_pTrackBuffer && !m_pTrackBuffer->isDecodingFinished()) {
+            // Decode the whole track in the background while there are no
+            // read requests. Check for new requests after each block.
+            decodeTrackBuffer();
         } else {
             Event::end(m_tag);
             m_semaRun.acquire();
@@ -149,6 +197,8 @@ void CachingReaderWorker::discardAllPendingRequests() {
 void CachingReaderWorker::closeAudioSource() {
     discardAllPendingRequests();
 
+    m_pTrackBuffer.reset();
+
     if (m_pAudioSource) {
         // Closes open file handles of the old track.
         m_pAudioSource->close();
@@ -228,6 +278,8 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
         mixxx::SampleBuffer(tempReadBufferSize).swap(m_tempReadBuffer);
     }
 
+    allocateTrackBuffer();
+
     const auto update =
             ReaderStatusUpdate::trackLoaded(
                     m_pAudioSource->frameIndexRange());
@@ -256,6 +308,50 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
             sampleCount);
 }
 
+void CachingReaderWorker::allocateTrackBuffer() {
+    DEBUG_ASSERT(!m_pTrackBuffer);
+    // Only decks benefit from decoding the whole track. Samples are short
+    // and mostly played from the start, and preview decks play a track
+    // only once. The memory is better spent for the decks.
+    if (!PlayerManager::isDeckGroup(m_group)) {
+        return;
+    }
+    if (!m_pConfig ||
+            !m_pConfig->getValue(
+                    ConfigKey(kConfigGroup, kTrackBufferEnabledConfigKey), false)) {
+        return;
+    }
+    const SINT ramBudgetBytes = static_cast<SINT>(m_pConfig->getValue(
+                                        ConfigKey(kConfigGroup,
+                                                kTrackBufferRamBudgetConfigKey),
+                                        kDefaultTrackBufferRamBudgetMiB)) *
+            1024 * 1024;
+    m_pTrackBuffer = CachingReaderTrackBuffer::allocate(
+            m_pAudioSource->frameIndexRange(), ramBudgetBytes);
+    if (m_pTrackBuffer) {
+        kLogger.debug()
+                << m_group
+                << "Decoding"
+                << m_pTrackBuffer->frameIndexRange()
+                << (m_pTrackBuffer->isInRam() ? "into RAM" : "into a temporary file");
+    }
+}
+
+void CachingReaderWorker::decodeTrackBuffer() {
+    DEBUG_ASSERT(m_pTrackBuffer);
+    m_pTrackBuffer->decodeNextFrames(
+            m_pAudioSource,
+            mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+    if (m_pTrackBuffer->isDecodingFinished()) {
+        kLogger.debug()
+                << m_group
+                << "Decoded"
+                << m_pTrackBuffer->decodedFrameIndexRange()
+                << "of"
+                << m_pTrackBuffer->frameIndexRange();
+    }
+}
+
 void CachingReaderWorker::quitWait() {
     m_stop = 1;
     m_semaRun.release();
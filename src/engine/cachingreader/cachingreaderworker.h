@@ -9,7 +9,9 @@
 #include "audio/frame.h"
 #include "audio/types.h"
 #include "engine/cachingreader/cachingreaderchunk.h"
+#include "engine/cachingreader/cachingreadertrackbuffer.h"
 #include "engine/engineworker.h"
+#include "preferences/usersettings.h"
 #include "sources/audiosource.h"
 #include "track/track_decl.h"
 #include "util/fifo.h"
@@ -17,10 +19,14 @@
 // POD with trivial ctor/dtor/copy for passing through FIFO
 typedef struct CachingReaderChunkReadRequest {
     CachingReaderChunk* chunk;
+    // The time when the hint that caused this request has been processed, in
+    // nanoseconds since Mixxx started. Used for latency statistics.
+    qint64 hintTimeNanos;
 
-    void giveToWorker(CachingReaderChunkForOwner* chunkForOwner) {
+    void giveToWorker(CachingReaderChunkForOwner* chunkForOwner, qint64 hintTime) {
         DEBUG_ASSERT(chunkForOwner);
         chunk = chunkForOwner;
+        hintTimeNanos = hintTime;
         chunkForOwner->giveToWorker();
     }
 } CachingReaderChunkReadRequest;
@@ -99,6 +105,7 @@ class CachingReaderWorker : public EngineWorker {
   public:
     // Construct a CachingReader with the given group.
     CachingReaderWorker(const QString& group,
+            UserSettingsPointer pConfig,
             FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
             FIFO<ReaderStatusUpdate>* pReaderStatusFIFO);
     ~CachingReaderWorker() override = default;
@@ -119,8 +126,12 @@ class CachingReaderWorker : public EngineWorker {
     void trackLoadFailed(TrackPointer pTrack, const QString& reason);
 
   private:
+    friend class CachingReaderWorkerTest;
+
     const QString m_group;
+    const UserSettingsPointer m_pConfig;
     QString m_tag;
+    const QString m_hintToChunkReadyStatTag;
 
     // Thread-safe FIFOs for communication between the engine callback and
     // reader thread.
@@ -151,6 +162,12 @@ class CachingReaderWorker : public EngineWorker {
 
     void verifyFirstSound(const CachingReaderChunk* pChunk);
 
+    // Allocates the buffer for decoding the whole track if enabled
+    void allocateTrackBuffer();
+
+    // Decodes the next block of the whole track
+    void decodeTrackBuffer();
+
     // The current audio source of the track loaded
     mixxx::AudioSourcePointer m_pAudioSource;
 
@@ -160,5 +177,8 @@ class CachingReaderWorker : public EngineWorker {
     // before conversion to a stereo signal.
     mixxx::SampleBuffer m_tempReadBuffer;
 
+    // The decoded samples of the whole track, if enabled
+    std::unique_ptr<CachingReaderTrackBuffer> m_pTrackBuffer;
+
     QAtomicInt m_stop;
 };
@@ -16,10 +16,11 @@ void ChannelMixer::applyEffectsAndMixChannels(const EngineMixer::GainCalculator&
     // 1. Clear pOutput buffer
     // 2. Calculate gains for each channel
     // 3. Pass each channel's calculated gain and input buffer to pEngineEffectsManager, which then:
-    //     A) Copies each channel input buffer to a temporary buffer
-    //     B) Applies gain to the temporary buffer
+    //     A) Mixes the input buffer with the gain applied into pOutput if no
+    //        effect chain is enabled for the channel, otherwise
+    //     B) Applies gain while copying the input buffer to a temporary buffer
     //     C) Processes effects on the temporary buffer
-    //     D) Mixes the temporary buffer into pOutput
+    //     D) Lets the last effect chain mix its output into pOutput
     // The original channel input buffers are not modified.
     SampleUtil::clear(pOutput, iBufferSize);
     ScopedTimer t(u"EngineMixer::applyEffectsAndMixChannels");
@@ -2,6 +2,7 @@
 
 #include "control/controlobject.h"
 #include "control/controlpushbutton.h"
+#include "engine/effects/engineeffectsmanager.h"
 #include "moc_enginechannel.cpp"
 
 EngineChannel::EngineChannel(const ChannelHandleAndGroup& handleGroup,
@@ -17,7 +18,9 @@ EngineChannel::EngineChannel(const ChannelHandleAndGroup& handleGroup,
           m_bIsPrimaryDeck(isPrimaryDeck),
           m_active(false),
           m_bIsTalkoverChannel(isTalkoverChannel),
-          m_channelIndex(-1) {
+          m_channelIndex(-1),
+          m_bEffectsDeferred(false),
+          m_bDeferredEffectsPending(false) {
     m_pPFL = new ControlPushButton(ConfigKey(getGroup(), "pfl"));
     m_pPFL->setButtonMode(ControlPushButton::TOGGLE);
     m_pMainMix = new ControlPushButton(ConfigKey(getGroup(), "main_mix"));
@@ -54,6 +57,39 @@ EngineChannel::~EngineChannel() {
     delete m_pTalkover;
 }
 
+void EngineChannel::processEffectsAndVuMeter(
+        CSAMPLE* pOut, const int iBufferSize, bool applyEffects) {
+    if (applyEffects) {
+        if (m_bEffectsDeferred) {
+            // The VU meter needs the output of the effects
+            m_bDeferredEffectsPending = true;
+            return;
+        }
+        applyPreFaderEffects(pOut, iBufferSize);
+    }
+    m_vuMeter.process(pOut, iBufferSize);
+}
+
+void EngineChannel::processDeferredEffects(CSAMPLE* pOut, const int iBufferSize) {
+    if (!m_bDeferredEffectsPending) {
+        return;
+    }
+    m_bDeferredEffectsPending = false;
+    applyPreFaderEffects(pOut, iBufferSize);
+    m_vuMeter.process(pOut, iBufferSize);
+}
+
+void EngineChannel::applyPreFaderEffects(CSAMPLE* pOut, const int iBufferSize) {
+    EngineEffectsManager* pEngineEffectsManager = m_pEffectsManager->getEngineEffectsManager();
+    if (pEngineEffectsManager != nullptr) {
+        pEngineEffectsManager->processPreFaderInPlace(m_group.handle(),
+                m_pEffectsManager->getMainHandle(),
+                pOut,
+                iBufferSize,
+                mixxx::audio::SampleRate::fromDouble(m_sampleRate.get()));
+    }
+}
+
 void EngineChannel::setPfl(bool enabled) {
     m_pPFL->set(enabled ? 1.0 : 0.0);
 }
@@ -68,12 +68,26 @@ class EngineChannel : public EngineObject {
 
     virtual void postProcess(const int iBuffersize) = 0;
 
+    /// While set, process() leaves the pre-fader effects and the VU meter
+    /// to processDeferredEffects(). The effect chains and their buffers are
+    /// shared by all channels, so they must not be processed on the threads
+    /// that process the channels in parallel.
+    void setEffectsDeferred(bool deferred) {
+        m_bEffectsDeferred = deferred;
+    }
+    /// Called on the callback thread with the output of process()
+    void processDeferredEffects(CSAMPLE* pOut, const int iBufferSize);
+
     // TODO(XXX) This hack needs to be removed.
     virtual EngineBuffer* getEngineBuffer() {
         return nullptr;
     }
 
   protected:
+    /// Applies the pre-fader effects if requested and updates the VU meter
+    /// at the end of process(), unless the effects are deferred
+    void processEffectsAndVuMeter(CSAMPLE* pOut, const int iBufferSize, bool applyEffects);
+
     const ChannelHandleAndGroup m_group;
     EffectsManager* m_pEffectsManager;
 
@@ -92,6 +106,8 @@ class EngineChannel : public EngineObject {
     void slotOrientationCenter(double v);
 
   private:
+    void applyPreFaderEffects(CSAMPLE* pOut, const int iBufferSize);
+
     ControlPushButton* m_pMainMix;
     ControlPushButton* m_pPFL;
     ControlPushButton* m_pOrientation;
@@ -101,4 +117,6 @@ class EngineChannel : public EngineObject {
     ControlPushButton* m_pTalkover;
     bool m_bIsTalkoverChannel;
     int m_channelIndex;
+    bool m_bEffectsDeferred;
+    bool m_bDeferredEffectsPending;
 };
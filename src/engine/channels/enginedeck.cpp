@@ -70,17 +70,8 @@ void EngineDeck::process(CSAMPLE* pOut, const int iBufferSize) {
     // Apply pregain
     m_pPregain->process(pOut, iBufferSize);
 
-    EngineEffectsManager* pEngineEffectsManager = m_pEffectsManager->getEngineEffectsManager();
-    if (pEngineEffectsManager != nullptr) {
-        pEngineEffectsManager->processPreFaderInPlace(m_group.handle(),
-                m_pEffectsManager->getMainHandle(),
-                pOut,
-                iBufferSize,
-                mixxx::audio::SampleRate::fromDouble(m_sampleRate.get()));
-    }
-
-    // Update VU meter
-    m_vuMeter.process(pOut, iBufferSize);
+    // Apply the pre-fader effects and update the VU meter
+    processEffectsAndVuMeter(pOut, iBufferSize, true);
 }
 
 void EngineDeck::collectFeatures(GroupFeatureState* pGroupFeatures) const {
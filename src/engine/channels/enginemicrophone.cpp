@@ -77,21 +77,13 @@ void EngineMicrophone::process(CSAMPLE* pOut, const int iBufferSize) {
     CSAMPLE_GAIN pregain = static_cast<CSAMPLE_GAIN>(m_pPregain->get());
     if (sampleBuffer) {
         SampleUtil::copyWithGain(pOut, sampleBuffer, pregain, iBufferSize);
-        EngineEffectsManager* pEngineEffectsManager = m_pEffectsManager->getEngineEffectsManager();
-        if (pEngineEffectsManager != nullptr) {
-            pEngineEffectsManager->processPreFaderInPlace(m_group.handle(),
-                    m_pEffectsManager->getMainHandle(),
-                    pOut,
-                    iBufferSize,
-                    mixxx::audio::SampleRate::fromDouble(m_sampleRate.get()));
-        }
     } else {
         SampleUtil::clear(pOut, iBufferSize);
     }
     m_sampleBuffer = nullptr;
 
-    // Update VU meter
-    m_vuMeter.process(pOut, iBufferSize);
+    // Apply the effects only to the input
+    processEffectsAndVuMeter(pOut, iBufferSize, sampleBuffer != nullptr);
 }
 
 void EngineMicrophone::collectFeatures(GroupFeatureState* pGroupFeatures) const {
@@ -18,6 +18,9 @@
 namespace {
 constexpr mixxx::audio::FrameDiff_t kMinimumAudibleLoopSizeFrames = 150;
 
+// Loops up to this length are hinted as a whole to keep them in the cache.
+constexpr SINT kMaxCachedLoopFrames = 4 * CachingReaderChunk::kFrames;
+
 // returns true if a is valid and is fairly close to target (within +/- 1 frame).
 bool positionNear(mixxx::audio::FramePos a, mixxx::audio::FramePos target) {
     return a.isValid() && a > target - 1 && a < target + 1;
@@ -557,6 +560,16 @@ void LoopingControl::hintReader(gsl::not_null<HintVector*> pHintList) {
             loop_hint.frame = static_cast<SINT>(
                     loopInfo.startPosition.toLowerFrameBoundary().value());
             loop_hint.frameCount = Hint::kFrameCountForward;
+            if (loopInfo.endPosition.isValid()) {
+                // Keep short loops entirely in the cache, we will play them
+                // over and over again, maybe in reverse or while scratching.
+                const SINT loopFrames = static_cast<SINT>(
+                        loopInfo.endPosition.toUpperFrameBoundary().value()) -
+                        loop_hint.frame;
+                if (loopFrames > 0 && loopFrames <= kMaxCachedLoopFrames) {
+                    loop_hint.frameCount = loopFrames;
+                }
+            }
             pHintList->append(loop_hint);
         }
         if (loopInfo.endPosition.isValid()) {
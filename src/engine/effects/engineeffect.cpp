@@ -66,6 +66,10 @@ void EngineEffect::initalizeInputChannel(ChannelHandle inputChannel) {
     m_pProcessor->initializeInputChannel(inputChannel, engineParameters);
 }
 
+void EngineEffect::releaseInputChannel(ChannelHandle inputChannel) {
+    m_pProcessor->releaseInputChannel(inputChannel);
+}
+
 bool EngineEffect::processEffectsRequest(EffectsRequest& message,
                                          EffectsResponsePipe* pResponsePipe) {
     EngineEffectParameterPointer pParameter;
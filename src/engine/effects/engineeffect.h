@@ -35,6 +35,13 @@ class EngineEffect final : public EffectsRequestHandler {
 
     /// Called from the main thread to make sure that the channel already has states
     void initalizeInputChannel(ChannelHandle inputChannel);
+    /// Called from the main thread after the audio thread has confirmed that
+    /// the channel is no longer processed
+    void releaseInputChannel(ChannelHandle inputChannel);
+    /// Called from the main thread
+    EffectStatesMemoryUsage getStatesMemoryUsage() const {
+        return m_pProcessor->getStatesMemoryUsage();
+    }
 
     /// Called in audio thread
     bool processEffectsRequest(
@@ -138,6 +138,16 @@ bool EngineEffectChain::processEffectsRequest(EffectsRequest& message,
         response.success = disableForInputChannel(
                 message.DisableInputChannelForChain.channelHandle);
         break;
+    case EffectsRequest::RELEASE_EFFECT_STATES_FOR_INPUT_CHANNEL:
+        if (kEffectDebugOutput) {
+            qDebug() << debugString() << this
+                     << "RELEASE_EFFECT_STATES_FOR_INPUT_CHANNEL"
+                     << message.pTargetChain
+                     << message.ReleaseEffectStatesForInputChannel.channelHandle;
+        }
+        response.success = releaseEffectStatesForInputChannel(
+                message.ReleaseEffectStatesForInputChannel.channelHandle);
+        break;
     default:
         return false;
     }
@@ -171,6 +181,42 @@ bool EngineEffectChain::disableForInputChannel(ChannelHandle inputHandle) {
     return true;
 }
 
+bool EngineEffectChain::releaseEffectStatesForInputChannel(ChannelHandle inputHandle) {
+    auto& outputMap = m_chainStatusForChannelMatrix[inputHandle];
+    for (const auto& outputChannelStatus : outputMap) {
+        if (outputChannelStatus.enableState == EffectEnableState::Enabling ||
+                outputChannelStatus.enableState == EffectEnableState::Enabled) {
+            // The channel has been enabled again in the meantime
+            return false;
+        }
+    }
+    for (auto&& outputChannelStatus : outputMap) {
+        // A channel that is still Disabling has not been processed since it
+        // was disabled a while ago, so the fade out can be skipped.
+        outputChannelStatus.enableState = EffectEnableState::Disabled;
+    }
+    // From now on the effects are not processed for this input channel
+    // until it is enabled again.
+    return true;
+}
+
+bool EngineEffectChain::isEnabledForChannel(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) {
+    // Mirrors the effective enable state computed in process(). The chain's
+    // own enable state does not matter, because it can not override a
+    // disabled channel.
+    if (m_chainStatusForChannelMatrix[inputHandle][outputHandle].enableState ==
+            EffectEnableState::Disabled) {
+        return false;
+    }
+    for (EngineEffect* pEffect : std::as_const(m_effects)) {
+        if (pEffect != nullptr) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         const ChannelHandle& outputHandle,
         CSAMPLE* pIn,
@@ -178,7 +224,8 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         const unsigned int numSamples,
         const mixxx::audio::SampleRate sampleRate,
         const GroupFeatureState& groupFeatures,
-        bool fadeout) {
+        bool fadeout,
+        bool mixIntoOutput) {
     DEBUG_ASSERT(numSamples <= kMaxEngineSamples);
 
     // Compute the effective enable state from the channel input routing switch and
@@ -254,9 +301,9 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
                                 m_mixMode == EffectChainMixMode::DryPlusWet;
 
                         if (!skipAddingDry) {
-                            for (SINT i = 0; i <= static_cast<SINT>(numSamples); ++i) {
-                                pIntermediateOutput[i] += pIntermediateInput[i];
-                            }
+                            SampleUtil::add(pIntermediateOutput,
+                                    pIntermediateInput,
+                                    numSamples);
                         }
 
                         firstAddDryToWetEffectProcessed = true;
@@ -277,24 +324,31 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         if (processingOccured) {
             // pIntermediateInput is the output of the last processed effect. It would be the
             // intermediate input of the next effect if there was one.
+            // Dry/Wet mode: output = (input * (1-mix knob)) + (wet * mix knob)
+            // Dry+Wet mode: output = input + (wet * mix knob)
+            CSAMPLE_GAIN lastCallbackDryGain = 1.0f;
+            CSAMPLE_GAIN currentDryGain = 1.0f;
             if (m_mixMode == EffectChainMixMode::DrySlashWet) {
-                // Dry/Wet mode: output = (input * (1-mix knob)) + (wet * mix knob)
-                SampleUtil::copy2WithRampingGain(
+                lastCallbackDryGain = 1.0f - lastCallbackMixKnob;
+                currentDryGain = 1.0f - currentMixKnob;
+            }
+            if (mixIntoOutput) {
+                // Saves the caller from mixing a copy of the output
+                SampleUtil::add2WithRampingGain(
                         pOut,
                         pIn,
-                        1.0f - lastCallbackMixKnob,
-                        1.0f - currentMixKnob,
+                        lastCallbackDryGain,
+                        currentDryGain,
                         pIntermediateInput,
                         lastCallbackMixKnob,
                         currentMixKnob,
                         numSamples);
             } else {
-                // Dry+Wet mode: output = input + (wet * mix knob)
                 SampleUtil::copy2WithRampingGain(
                         pOut,
                         pIn,
-                        1.0f,
-                        1.0f,
+                        lastCallbackDryGain,
+                        currentDryGain,
                         pIntermediateInput,
                         lastCallbackMixKnob,
                         currentMixKnob,
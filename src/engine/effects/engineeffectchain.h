@@ -38,6 +38,15 @@ class EngineEffectChain final : public EffectsRequestHandler {
             EffectsResponsePipe* pResponsePipe) override;
 
     /// called from audio thread
+    /// Returns false if the chain is certainly not processed for the channel,
+    /// so that the caller can plan its buffers before calling process().
+    bool isEnabledForChannel(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle);
+
+    /// called from audio thread
+    /// If mixIntoOutput is true, the output of the chain is added to pOut
+    /// instead of replacing it. Nothing is written to pOut if no processing
+    /// occurred.
     bool process(const ChannelHandle& inputHandle,
             const ChannelHandle& outputHandle,
             CSAMPLE* pIn,
@@ -45,7 +54,8 @@ class EngineEffectChain final : public EffectsRequestHandler {
             const unsigned int numSamples,
             const mixxx::audio::SampleRate sampleRate,
             const GroupFeatureState& groupFeatures,
-            bool fadeout);
+            bool fadeout,
+            bool mixIntoOutput);
 
   private:
     struct ChannelStatus {
@@ -66,6 +76,7 @@ class EngineEffectChain final : public EffectsRequestHandler {
     bool removeEffect(EngineEffect* pEffect, int iIndex);
     bool enableForInputChannel(ChannelHandle inputHandle);
     bool disableForInputChannel(ChannelHandle inputHandle);
+    bool releaseEffectStatesForInputChannel(ChannelHandle inputHandle);
 
     QString m_group;
     EffectEnableState m_enableState;
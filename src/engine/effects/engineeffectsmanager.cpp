@@ -30,7 +30,8 @@ void EngineEffectsManager::onCallbackStart() {
         case EffectsRequest::REMOVE_EFFECT_FROM_CHAIN:
         case EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS:
         case EffectsRequest::ENABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL:
-        case EffectsRequest::DISABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL: {
+        case EffectsRequest::DISABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL:
+        case EffectsRequest::RELEASE_EFFECT_STATES_FOR_INPUT_CHANNEL: {
             bool chainExists = false;
             for (const auto& chains : std::as_const(m_chainsByStage)) {
                 if (chains.contains(request->pTargetChain)) {
@@ -177,59 +178,93 @@ void EngineEffectsManager::processInner(
         SampleUtil::applyRampingGain(pIn, oldGain, newGain, numSamples);
         for (EngineEffectChain* pChain : chains) {
             if (pChain) {
-                if (pChain->process(inputHandle,
-                            outputHandle,
-                            pIn,
-                            pOut,
-                            numSamples,
-                            sampleRate,
-                            groupFeatures,
-                            fadeout)) {
-                }
+                pChain->process(inputHandle,
+                        outputHandle,
+                        pIn,
+                        pOut,
+                        numSamples,
+                        sampleRate,
+                        groupFeatures,
+                        fadeout,
+                        false);
             }
         }
-    } else {
-        // Do not modify the input buffer.
-        // 1. Copy input buffer to a temporary buffer
-        // 2. Apply gain to temporary buffer
-        // 2. Process temporary buffer with each effect chain in series
-        // 3. Mix the temporary buffer into pOut
-        //    ChannelMixer::applyEffectsAndMixChannels use
-        //    this to mix channels into pOut regardless of whether any effects were processed.
-        CSAMPLE* pIntermediateInput = m_buffer1.data();
-        if (oldGain == CSAMPLE_GAIN_ONE && newGain == CSAMPLE_GAIN_ONE) {
-            // Avoid an unnecessary copy. EngineEffectChain::process does not modify the
-            // input buffer when its input & output buffers are different, so this is okay.
-            pIntermediateInput = pIn;
-        } else {
-            SampleUtil::copyWithRampingGain(pIntermediateInput, pIn, oldGain, newGain, numSamples);
+        return;
+    }
+
+    // Do not modify the input buffer.
+    // ChannelMixer::applyEffectsAndMixChannels uses this to mix channels into
+    // pOut regardless of whether any effects were processed. Plan the buffers
+    // first to avoid copies:
+    // 1. If no chain is enabled for the channel, apply the gain while mixing
+    //    the input buffer into pOut.
+    // 2. Otherwise apply the gain to a temporary buffer, unless it is unity.
+    // 3. Process the buffer with each effect chain in series, alternating
+    //    between the temporary buffers.
+    // 4. The last enabled chain mixes its output into pOut directly.
+    int lastEnabledChainIndex = -1;
+    for (int i = 0; i < chains.size(); ++i) {
+        EngineEffectChain* pChain = chains.at(i);
+        if (pChain && pChain->isEnabledForChannel(inputHandle, outputHandle)) {
+            lastEnabledChainIndex = i;
         }
+    }
 
-        CSAMPLE* pIntermediateOutput;
-        for (EngineEffectChain* pChain : chains) {
-            if (pChain) {
-                // Select an unused intermediate buffer for the next output
-                if (pIntermediateInput == m_buffer1.data()) {
-                    pIntermediateOutput = m_buffer2.data();
-                } else {
-                    pIntermediateOutput = m_buffer1.data();
-                }
+    CSAMPLE* pIntermediateInput = pIn;
+    if (lastEnabledChainIndex < 0) {
+        SampleUtil::addWithRampingGain(pOut, pIn, oldGain, newGain, numSamples);
+    } else if (oldGain != CSAMPLE_GAIN_ONE || newGain != CSAMPLE_GAIN_ONE) {
+        pIntermediateInput = m_buffer1.data();
+        SampleUtil::copyWithRampingGain(pIntermediateInput, pIn, oldGain, newGain, numSamples);
+    }
+    // Otherwise EngineEffectChain::process does not modify the input buffer
+    // when its input & output buffers are different, so this is okay.
 
-                if (pChain->process(inputHandle,
-                            outputHandle,
-                            pIntermediateInput,
-                            pIntermediateOutput,
-                            numSamples,
-                            sampleRate,
-                            groupFeatures,
-                            fadeout)) {
-                    // Output of this chain becomes the input of the next chain.
-                    pIntermediateInput = pIntermediateOutput;
-                }
+    bool mixedIntoOutput = lastEnabledChainIndex < 0;
+    for (int i = 0; i < chains.size(); ++i) {
+        EngineEffectChain* pChain = chains.at(i);
+        if (!pChain) {
+            continue;
+        }
+        // Chains that are not enabled are still called to update their state
+        // but do not touch the buffers.
+        if (i == lastEnabledChainIndex) {
+            if (pChain->process(inputHandle,
+                        outputHandle,
+                        pIntermediateInput,
+                        pOut,
+                        numSamples,
+                        sampleRate,
+                        groupFeatures,
+                        fadeout,
+                        true)) {
+                mixedIntoOutput = true;
             }
+            continue;
+        }
+        // Select an unused intermediate buffer for the next output
+        CSAMPLE* pIntermediateOutput;
+        if (pIntermediateInput == m_buffer1.data()) {
+            pIntermediateOutput = m_buffer2.data();
+        } else {
+            pIntermediateOutput = m_buffer1.data();
         }
-        // pIntermediateInput is the output of the last processed chain. It would
-        // be the intermediate input of the next chain if there was one.
+        if (pChain->process(inputHandle,
+                    outputHandle,
+                    pIntermediateInput,
+                    pIntermediateOutput,
+                    numSamples,
+                    sampleRate,
+                    groupFeatures,
+                    fadeout,
+                    false)) {
+            // Output of this chain becomes the input of the next chain.
+            pIntermediateInput = pIntermediateOutput;
+        }
+    }
+    if (!mixedIntoOutput) {
+        // None of the effects of the last enabled chain were processed.
+        // pIntermediateInput is the output of the last processed chain.
         SampleUtil::add(pOut, pIntermediateInput, numSamples);
     }
 }
@@ -10,6 +10,7 @@
 #include "util/memory.h"
 #include "util/messagepipe.h"
 
+class EffectChain;
 class EngineEffectChain;
 class EngineEffect;
 
@@ -25,6 +26,9 @@ struct EffectsRequest {
         // the outputs that effects are applied to are hardwired in EngineMixer
         ENABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL,
         DISABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL,
+        // Confirms that a disabled input channel is no longer processed, so
+        // that its EffectStates can be deleted in the main thread.
+        RELEASE_EFFECT_STATES_FOR_INPUT_CHANNEL,
 
         // Messages for EngineEffect
         SET_EFFECT_PARAMETERS,
@@ -55,6 +59,7 @@ struct EffectsRequest {
         // - SET_EFFECT_CHAIN_PARAMETERS
         // - ENABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL
         // - DISABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL
+        // - RELEASE_EFFECT_STATES_FOR_INPUT_CHANNEL
         EngineEffectChain* pTargetChain;
         // Used by:
         // - SET_EFFECT_PARAMETER
@@ -77,6 +82,12 @@ struct EffectsRequest {
         struct {
             ChannelHandle channelHandle;
         } DisableInputChannelForChain;
+        struct {
+            ChannelHandle channelHandle;
+            // Only accessed in the main thread when the response is received.
+            // EffectChains are deleted after the EffectsMessenger is shut down.
+            EffectChain* pChain;
+        } ReleaseEffectStatesForInputChannel;
         struct {
             EngineEffect* pEffect;
             int iIndex;
@@ -329,6 +329,10 @@ EngineBuffer::~EngineBuffer() {
 
 void EngineBuffer::bindWorkers(EngineWorkerScheduler* pWorkerScheduler) {
     m_pReader->setScheduler(pWorkerScheduler);
+    m_pScaleRB->setScheduler(pWorkerScheduler);
+    if (m_pScaleKeylock == m_pScaleRB) {
+        m_pScaleRB->startWorker();
+    }
 }
 
 void EngineBuffer::enableIndependentPitchTempoScaling(bool bEnable,
@@ -452,6 +456,15 @@ void EngineBuffer::requestClonePosition(EngineChannel* pChannel) {
     atomicStoreRelaxed(m_pChannelToCloneFrom, pChannel);
 }
 
+bool EngineBuffer::canProcessConcurrently() const {
+    return m_pSyncControl->getSyncMode() == SyncMode::None &&
+            atomicLoadRelaxed(m_iEnableSyncQueued) == SYNC_REQUEST_NONE &&
+            atomicLoadRelaxed(m_iSyncModeQueued) == static_cast<int>(SyncMode::Invalid) &&
+            atomicLoadRelaxed(m_iSeekPhaseQueued) == 0 &&
+            atomicLoadRelaxed(m_pChannelToCloneFrom) == nullptr &&
+            m_queuedSeek.getValue().seekType == SEEK_NONE;
+}
+
 void EngineBuffer::readToCrossfadeBuffer(const int iBufferSize) {
     if (!m_bCrossfadeReady) {
         // Read buffer, as if there where no parameter change
@@ -814,11 +827,14 @@ void EngineBuffer::slotKeylockEngineChanged(double dIndex) {
         break;
     case KeylockEngine::RubberBandFaster:
         m_pScaleRB->useEngineFiner(false);
+        // Decks that use SoundTouch don't need a thread for rendering ahead
+        m_pScaleRB->startWorker();
         m_pScaleKeylock = m_pScaleRB;
         break;
     case KeylockEngine::RubberBandFiner:
         m_pScaleRB->useEngineFiner(
                 true); // in case of Rubberband V2 it falls back to RUBBERBAND_FASTER
+        m_pScaleRB->startWorker();
         m_pScaleKeylock = m_pScaleRB;
         break;
     default:
@@ -839,8 +855,11 @@ void EngineBuffer::processTrackLocked(
         baserate = m_trackSampleRateOld / sampleRate;
     }
 
-    // Sync requests can affect rate, so process those first.
-    processSyncRequests();
+    // Sync requests can affect rate, so process those first. They are
+    // deferred while processed concurrently with other decks.
+    if (!m_bProcessingConcurrently) {
+        processSyncRequests();
+    }
 
     // Note: play is also active during cue preview
     bool paused = !m_playButton->toBool();
@@ -1272,6 +1291,13 @@ void EngineBuffer::processSyncRequests() {
 
 void EngineBuffer::processSeek(bool paused) {
     m_previousBufferSeek = false;
+    if (m_bProcessingConcurrently) {
+        // Cloning reads the position of the other deck and phase seeks
+        // read the beat distance of the sync target. The request has
+        // arrived after EngineMixer checked canProcessConcurrently(),
+        // so it is processed in the next callback instead.
+        return;
+    }
     // Check if we are cloning another channel before doing any seeking.
     EngineChannel* pChannel = m_pChannelToCloneFrom.fetchAndStoreRelaxed(nullptr);
     if (pChannel) {
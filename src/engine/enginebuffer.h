@@ -125,6 +125,19 @@ class EngineBuffer : public EngineObject {
     void requestSyncMode(SyncMode mode);
     void requestClonePosition(EngineChannel* pChannel);
 
+    /// Returns true if processing the next buffer only touches the state
+    /// of this deck. Synchronized decks and pending sync, seek or clone
+    /// requests involve EngineSync or other decks and must not be processed
+    /// concurrently with other decks.
+    bool canProcessConcurrently() const;
+    /// Set by EngineMixer while the deck is processed concurrently with
+    /// other decks. Sync, seek and clone requests that arrive after
+    /// canProcessConcurrently() has been checked are deferred to the next
+    /// callback.
+    void setProcessingConcurrently(bool concurrently) {
+        m_bProcessingConcurrently = concurrently;
+    }
+
     // The process methods all run in the audio callback.
     void process(CSAMPLE* pOut, const int iBufferSize) override;
     void processSlip(int iBufferSize);
@@ -424,6 +437,9 @@ class EngineBuffer : public EngineObject {
     QAtomicInt m_iSyncModeQueued;
     ControlValueAtomic<QueuedSeek> m_queuedSeek;
     bool m_previousBufferSeek = false;
+    // Only accessed from the callback thread before and after the fork
+    // and by the worker that processes the deck
+    bool m_bProcessingConcurrently = false;
 
     /// Indicates that no seek is queued
     static constexpr QueuedSeek kNoQueuedSeek = {mixxx::audio::kInvalidFramePos, SEEK_NONE};
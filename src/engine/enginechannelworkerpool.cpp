@@ -0,0 +1,216 @@
+#include "engine/enginechannelworkerpool.h"
+
+#include <QtDebug>
+#include <algorithm>
+
+#ifdef __LINUX__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "util/assert.h"
+#include "util/denormalsarezero.h"
+
+namespace {
+
+// Leave one core for the callback thread itself and cap the pool size. More
+// workers than decks and samplers that are playing at once do not help.
+constexpr int kMaxWorkers = 7;
+
+constexpr std::uint64_t kNextJobMask = 0xFFFF;
+constexpr int kNumJobsShift = 16;
+constexpr std::uint64_t kNumJobsMask = 0xFFFF;
+constexpr int kGenerationShift = 32;
+
+inline std::uint64_t makeBatchState(std::uint32_t generation, int numJobs) {
+    return (static_cast<std::uint64_t>(generation) << kGenerationShift) |
+            (static_cast<std::uint64_t>(numJobs) << kNumJobsShift);
+}
+
+} // anonymous namespace
+
+class EngineChannelWorkerPool::Worker : public QThread {
+  public:
+    Worker(EngineChannelWorkerPool* pPool, int index)
+            : m_pPool(pPool),
+#ifdef __LINUX__
+              m_schedPolicy(SCHED_OTHER),
+              m_schedPriority(0),
+#endif
+              m_index(index) {
+    }
+
+    int index() const {
+        return m_index;
+    }
+
+  protected:
+    void run() override {
+        m_pPool->workerLoop(this);
+    }
+
+  private:
+    friend class EngineChannelWorkerPool;
+
+    EngineChannelWorkerPool* const m_pPool;
+#ifdef __LINUX__
+    // The scheduling currently applied to this worker thread.
+    int m_schedPolicy;
+    int m_schedPriority;
+#endif
+    const int m_index;
+};
+
+EngineChannelWorkerPool::EngineChannelWorkerPool(int numWorkers)
+        : m_batchState(0),
+          m_pendingJobs(0),
+          m_quit(false),
+          m_generation(0),
+          m_pJobFunction(nullptr),
+          m_pJobContext(nullptr)
+#ifdef __LINUX__
+          ,
+          m_callbackSchedPolicy(SCHED_OTHER),
+          m_callbackSchedPriority(0),
+          m_callbackSchedulingQueried(false)
+#endif
+{
+    if (numWorkers <= 0) {
+        numWorkers = std::clamp(QThread::idealThreadCount() - 1, 1, kMaxWorkers);
+    }
+    m_workers.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        m_workers.push_back(std::make_unique<Worker>(this, i));
+    }
+    for (const auto& pWorker : m_workers) {
+        pWorker->start(QThread::TimeCriticalPriority);
+    }
+}
+
+EngineChannelWorkerPool::~EngineChannelWorkerPool() {
+    m_quit.store(true);
+    m_wakeWorkers.release(numWorkers());
+    for (const auto& pWorker : m_workers) {
+        pWorker->wait();
+    }
+}
+
+int EngineChannelWorkerPool::claimJob() {
+    std::uint64_t state = m_batchState.load(std::memory_order_acquire);
+    while (true) {
+        const auto nextJob = static_cast<int>(state & kNextJobMask);
+        const auto numJobs = static_cast<int>((state >> kNumJobsShift) & kNumJobsMask);
+        if (nextJob >= numJobs) {
+            return -1;
+        }
+        if (m_batchState.compare_exchange_weak(state,
+                    state + 1,
+                    std::memory_order_acq_rel,
+                    std::memory_order_acquire)) {
+            return nextJob;
+        }
+    }
+}
+
+void EngineChannelWorkerPool::processJobs() {
+    int jobIndex;
+    while ((jobIndex = claimJob()) >= 0) {
+        // A successful claim guarantees that the publishing thread is still
+        // waiting for this batch, so the job parameters are stable.
+        m_pJobFunction(m_pJobContext, jobIndex);
+        m_pendingJobs.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+void EngineChannelWorkerPool::run(JobFunction pJobFunction, void* pContext, int numJobs) {
+    VERIFY_OR_DEBUG_ASSERT(numJobs <= kMaxJobs) {
+        numJobs = kMaxJobs;
+    }
+    if (numJobs <= 0) {
+        return;
+    }
+    if (numJobs == 1 || m_workers.empty()) {
+        // Not worth waking anybody up.
+        for (int i = 0; i < numJobs; ++i) {
+            pJobFunction(pContext, i);
+        }
+        return;
+    }
+
+#ifdef __LINUX__
+    if (!m_callbackSchedulingQueried) {
+        // Query this only once, the sound device does not change the
+        // scheduling of a running callback thread.
+        int policy;
+        sched_param param;
+        if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+            m_callbackSchedPriority.store(param.sched_priority, std::memory_order_relaxed);
+            m_callbackSchedPolicy.store(policy, std::memory_order_relaxed);
+        }
+        m_callbackSchedulingQueried = true;
+    }
+#endif
+
+    m_pJobFunction = pJobFunction;
+    m_pJobContext = pContext;
+    m_pendingJobs.store(numJobs, std::memory_order_relaxed);
+
+    // Publish the batch. The release store makes the job parameters above
+    // visible to every thread that claims a job of this batch.
+    ++m_generation;
+    m_batchState.store(makeBatchState(m_generation, numJobs), std::memory_order_release);
+    // We process one of the jobs ourselves. A worker that wakes up too late
+    // finds no jobs left and goes back to sleep.
+    m_wakeWorkers.release(std::min(numJobs - 1, numWorkers()));
+
+    // Fork: take part in the work ourselves.
+    processJobs();
+
+    // Join: wait for jobs that have been claimed by the workers.
+    while (m_pendingJobs.load(std::memory_order_acquire) > 0) {
+        mixxx::cpuRelax();
+    }
+}
+
+void EngineChannelWorkerPool::applyCallbackSchedulingToWorker(Worker* pWorker) {
+#ifdef __LINUX__
+    const int policy = m_callbackSchedPolicy.load(std::memory_order_relaxed);
+    const int priority = m_callbackSchedPriority.load(std::memory_order_relaxed);
+    if (policy == pWorker->m_schedPolicy && priority == pWorker->m_schedPriority) {
+        return;
+    }
+    sched_param param;
+    param.sched_priority = priority;
+    const int result = pthread_setschedparam(pthread_self(), policy, &param);
+    if (result != 0) {
+        qWarning() << "EngineChannelWorkerPool: Failed to set the scheduling of worker"
+                   << pWorker->index() << "to policy" << policy
+                   << "with priority" << priority << "error" << result;
+    }
+    // Do not try again on failure, the result will not change.
+    pWorker->m_schedPolicy = policy;
+    pWorker->m_schedPriority = priority;
+#else
+    Q_UNUSED(pWorker);
+#endif
+}
+
+void EngineChannelWorkerPool::workerLoop(Worker* pWorker) {
+    QThread::currentThread()->setObjectName(
+            QStringLiteral("EngineChannelWorker %1").arg(pWorker->index() + 1));
+
+#ifdef __SSE__
+    // Same as the callback thread, see SoundDevicePortAudio::callbackProcess()
+    _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+#endif
+
+    while (true) {
+        m_wakeWorkers.acquire();
+        if (m_quit.load()) {
+            return;
+        }
+        applyCallbackSchedulingToWorker(pWorker);
+        processJobs();
+    }
+}
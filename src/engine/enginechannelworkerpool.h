@@ -0,0 +1,80 @@
+#pragma once
+
+#include <QThread>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "util/class.h"
+#include "util/lightweightsemaphore.h"
+
+// EngineChannelWorkerPool implements a fork/join helper for the audio
+// callback. It owns a fixed set of worker threads that are spawned up front
+// and sleep on a mixxx::LightweightSemaphore until the callback publishes a
+// new batch of jobs.
+//
+// The callback thread takes part in processing the batch and then spins until
+// all claimed jobs are finished. No locks are taken on the callback side, so
+// the callback never blocks on a worker that is not running a job. If no
+// worker wakes up in time, the callback simply processes all jobs itself.
+class EngineChannelWorkerPool {
+  public:
+    // A job is identified by its index within the current batch.
+    typedef void (*JobFunction)(void* pContext, int jobIndex);
+
+    // The max number of jobs that can be published in a single batch.
+    static constexpr int kMaxJobs = 0xFFFF;
+
+    // Spawns numWorkers threads. A value <= 0 selects a worker count based on
+    // the number of available CPU cores.
+    explicit EngineChannelWorkerPool(int numWorkers = 0);
+    ~EngineChannelWorkerPool();
+
+    int numWorkers() const {
+        return static_cast<int>(m_workers.size());
+    }
+
+    // Runs pJobFunction(pContext, i) for every i in [0, numJobs) and returns
+    // after all jobs have finished. Must only be called from one thread at a
+    // time, typically the audio callback thread.
+    void run(JobFunction pJobFunction, void* pContext, int numJobs);
+
+  private:
+    class Worker;
+
+    // Claims the next unprocessed job of the current batch and returns its
+    // index, or -1 if all jobs of the batch have been claimed.
+    int claimJob();
+    void processJobs();
+    void workerLoop(Worker* pWorker);
+    void applyCallbackSchedulingToWorker(Worker* pWorker);
+
+    // The batch state is packed into a single word to allow claiming jobs
+    // with a single CAS. The layout is:
+    //   | generation (32 bits) | number of jobs (16 bits) | next job (16 bits) |
+    // Packing the number of jobs into the same word guarantees that a late
+    // worker never claims a job from a batch that has already been joined.
+    std::atomic<std::uint64_t> m_batchState;
+    // Number of jobs of the current batch that have not finished yet.
+    std::atomic<int> m_pendingJobs;
+    mixxx::LightweightSemaphore m_wakeWorkers;
+    std::atomic<bool> m_quit;
+
+    // Only modified by the calling thread before a batch is published.
+    std::uint32_t m_generation;
+    JobFunction m_pJobFunction;
+    void* m_pJobContext;
+
+#ifdef __LINUX__
+    // The scheduling policy and priority of the callback thread. Workers
+    // adopt these so they are not preempted by the callback's peers.
+    std::atomic<int> m_callbackSchedPolicy;
+    std::atomic<int> m_callbackSchedPriority;
+    bool m_callbackSchedulingQueried;
+#endif
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    DISALLOW_COPY_AND_ASSIGN(EngineChannelWorkerPool);
+};
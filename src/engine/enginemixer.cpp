@@ -14,7 +14,9 @@
 #include "engine/channels/enginedeck.h"
 #include "engine/effects/engineeffectsmanager.h"
 #include "engine/enginebuffer.h"
+#include "engine/enginechannelworkerpool.h"
 #include "engine/enginedelay.h"
+#include "engine/engineprofiler.h"
 #include "engine/enginetalkoverducking.h"
 #include "engine/enginevumeter.h"
 #include "engine/engineworkerscheduler.h"
@@ -43,6 +45,7 @@ EngineMixer::EngineMixer(
         bool bEnableSidechain)
         : m_pChannelHandleFactory(pChannelHandleFactory),
           m_pEngineEffectsManager(pEffectsManager->getEngineEffectsManager()),
+          m_parallelJobsBufferSize(0),
           m_mainGainOld(0.0),
           m_boothGainOld(0.0),
           m_headphoneMainGainOld(0.0),
@@ -72,7 +75,6 @@ EngineMixer::EngineMixer(
     m_bBusOutputConnected[EngineChannel::RIGHT] = false;
     m_bExternalRecordBroadcastInputConnected = false;
     m_pWorkerScheduler = new EngineWorkerScheduler(this);
-    m_pWorkerScheduler->start(QThread::HighPriority);
 
     // Main sample rate
     m_pSampleRate = new ControlObject(
@@ -194,6 +196,16 @@ EngineMixer::EngineMixer(
             pConfig->getValue(ConfigKey(group, "keylock_engine"),
                     EngineBuffer::defaultKeylockEngine())));
 
+    // Multi-threaded channel processing. The worker threads are spawned up
+    // front, because this is not possible from within the callback.
+    m_pChannelWorkerPool = std::make_unique<EngineChannelWorkerPool>();
+    m_pParallelChannelProcessing = new ControlObject(
+            ConfigKey(kAppGroup, QStringLiteral("parallel_channel_processing")));
+    m_pParallelChannelProcessing->set(
+            pConfig->getValue(ConfigKey(group, "parallel_channel_processing"), false)
+                    ? 1.0
+                    : 0.0);
+
     // TODO: Make this read only and make EngineMixer decide whether
     // processing the main mix is necessary.
     m_pMainEnabled = new ControlObject(ConfigKey(group, "enabled"),
@@ -217,6 +229,7 @@ EngineMixer::EngineMixer(
 EngineMixer::~EngineMixer() {
     // qDebug() << "in ~EngineMixer()";
     delete m_pKeylockEngine;
+    delete m_pParallelChannelProcessing;
     delete m_pCrossfader;
     delete m_pBalance;
     delete m_pHeadMix;
@@ -250,7 +263,8 @@ EngineMixer::~EngineMixer() {
     delete m_pMicMonitorMode;
     delete m_pHeadphoneEnabled;
 
-    delete m_pWorkerScheduler;
+    // Join the channel workers before the channels are deleted.
+    m_pChannelWorkerPool.reset();
 
     for (int i = 0; i < m_channels.size(); ++i) {
         ChannelInfo* pChannelInfo = m_channels[i];
@@ -259,6 +273,9 @@ EngineMixer::~EngineMixer() {
         delete pChannelInfo->m_pMuteControl;
         delete pChannelInfo;
     }
+
+    // The workers of the channels unregister themselves on destruction
+    delete m_pWorkerScheduler;
 }
 
 const CSAMPLE* EngineMixer::getMainBuffer() const {
@@ -288,7 +305,7 @@ void EngineMixer::processChannels(int iBufferSize) {
     m_activeTalkoverChannels.clear();
     m_activeChannels.clear();
 
-    // ScopedTimer timer(u"EngineMixer::processChannels");
+    EngineProfiler::ScopedStage profilerStage(EngineProfiler::Stage::Channels);
     EngineChannel* pLeaderChannel = m_pEngineSync->getLeaderChannel();
     // Reserve the first place for the main channel which
     // should be processed first
@@ -366,18 +383,65 @@ void EngineMixer::processChannels(int iBufferSize) {
     }
 
     // Now that the list is built and ordered, do the processing.
-    for (int i = activeChannelsStartIndex;
-             i < m_activeChannels.size(); ++i) {
-        ChannelInfo* pChannelInfo = m_activeChannels[i];
-        EngineChannel* pChannel = pChannelInfo->m_pChannel;
-        DEBUG_ASSERT(pChannelInfo->m_pBuffer.size() >= iBufferSize);
-        pChannel->process(pChannelInfo->m_pBuffer.data(), iBufferSize);
+    if (m_pParallelChannelProcessing->toBool()) {
+        // Decks that are synchronized or have pending sync, seek or clone
+        // requests access EngineSync and other decks. They are processed
+        // serially on the callback thread, starting with the sync leader
+        // that the followers adopt their rate and beat distance from.
+        m_concurrentChannels.clear();
+        for (int i = activeChannelsStartIndex;
+                i < m_activeChannels.size();
+                ++i) {
+            ChannelInfo* pChannelInfo = m_activeChannels[i];
+            EngineBuffer* pBuffer = pChannelInfo->m_pChannel->getEngineBuffer();
+            if (pBuffer && !pBuffer->canProcessConcurrently()) {
+                processChannel(pChannelInfo, iBufferSize);
+                collectChannelFeatures(pChannelInfo);
+            } else {
+                if (pBuffer) {
+                    pBuffer->setProcessingConcurrently(true);
+                }
+                pChannelInfo->m_pChannel->setEffectsDeferred(true);
+                m_concurrentChannels.append(pChannelInfo);
+            }
+        }
+        // Fork the remaining channels to the worker threads. This returns
+        // after all of them have been processed, so onCallbackEnd() and
+        // postProcess() below see the same state as in the serial case.
+        m_parallelJobsBufferSize = iBufferSize;
+        m_pChannelWorkerPool->run(&EngineMixer::processChannelJob,
+                this,
+                m_concurrentChannels.size());
+        // The effect chains are shared by all channels, so the pre-fader
+        // effects of the forked channels are processed here, in order.
+        for (ChannelInfo* pChannelInfo : std::as_const(m_concurrentChannels)) {
+            EngineChannel* pChannel = pChannelInfo->m_pChannel;
+            EngineBuffer* pBuffer = pChannel->getEngineBuffer();
+            if (pBuffer) {
+                pBuffer->setProcessingConcurrently(false);
+            }
+            pChannel->setEffectsDeferred(false);
+            pChannel->processDeferredEffects(pChannelInfo->m_pBuffer.data(), iBufferSize);
+            collectChannelFeatures(pChannelInfo);
+        }
+    } else {
+        for (int i = activeChannelsStartIndex;
+                i < m_activeChannels.size();
+                ++i) {
+            processChannel(m_activeChannels[i], iBufferSize);
+            collectChannelFeatures(m_activeChannels[i]);
+        }
+    }
 
-        // Collect metadata for effects
-        if (m_pEngineEffectsManager) {
-            GroupFeatureState features;
-            pChannel->collectFeatures(&features);
-            pChannelInfo->m_features = features;
+    if (EngineProfiler::s_bEngineProfilerEnabled) {
+        for (int i = activeChannelsStartIndex;
+                i < m_activeChannels.size();
+                ++i) {
+            const ChannelInfo* pChannelInfo = m_activeChannels[i];
+            EngineProfiler::record(EngineProfiler::Stage::Channel,
+                    pChannelInfo->m_processStartNanos,
+                    pChannelInfo->m_processEndNanos,
+                    pChannelInfo->m_index);
         }
     }
 
@@ -398,6 +462,37 @@ void EngineMixer::processChannels(int iBufferSize) {
     }
 }
 
+void EngineMixer::processChannel(ChannelInfo* pChannelInfo, int iBufferSize) {
+    EngineChannel* pChannel = pChannelInfo->m_pChannel;
+    DEBUG_ASSERT(pChannelInfo->m_pBuffer.size() >= iBufferSize);
+    const bool profile = EngineProfiler::s_bEngineProfilerEnabled;
+    if (profile) {
+        pChannelInfo->m_processStartNanos = EngineProfiler::now();
+    }
+    pChannel->process(pChannelInfo->m_pBuffer.data(), iBufferSize);
+    if (profile) {
+        pChannelInfo->m_processEndNanos = EngineProfiler::now();
+    }
+}
+
+void EngineMixer::collectChannelFeatures(ChannelInfo* pChannelInfo) {
+    // Collect metadata for effects
+    if (m_pEngineEffectsManager) {
+        GroupFeatureState features;
+        pChannelInfo->m_pChannel->collectFeatures(&features);
+        pChannelInfo->m_features = features;
+    }
+}
+
+// static
+void EngineMixer::processChannelJob(void* pContext, int jobIndex) {
+    auto* pEngineMixer = static_cast<EngineMixer*>(pContext);
+    // The features are collected after the deferred effects
+    pEngineMixer->processChannel(
+            pEngineMixer->m_concurrentChannels[jobIndex],
+            pEngineMixer->m_parallelJobsBufferSize);
+}
+
 void EngineMixer::process(const int iBufferSize) {
     DEBUG_ASSERT(iBufferSize <= static_cast<int>(kMaxEngineSamples));
 
@@ -406,7 +501,7 @@ void EngineMixer::process(const int iBufferSize) {
         QThread::currentThread()->setObjectName("Engine");
         haveSetName = true;
     }
-    // Trace t("EngineMixer::process");
+    EngineProfiler::ScopedStage profilerStage(EngineProfiler::Stage::Engine);
 
     bool mainEnabled = m_pMainEnabled->toBool();
     bool boothEnabled = m_pBoothEnabled->toBool();
@@ -440,6 +535,7 @@ void EngineMixer::process(const int iBufferSize) {
     m_headphoneGain.setGain(pflMixGainInHeadphones);
 
     if (headphoneEnabled) {
+        EngineProfiler::ScopedStage profilerStage(EngineProfiler::Stage::HeadphoneMix);
         // Process effects and mix PFL channels together for the headphones.
         // Effects will be reprocessed post-fader for the crossfader buses
         // and main mix, so the channel input buffers cannot be modified here.
@@ -477,6 +573,7 @@ void EngineMixer::process(const int iBufferSize) {
 
     // Mix all the talkover enabled channels together.
     // Effects processing is done in place to avoid unnecessary buffer copying.
+    const qint64 talkoverMixStartNanos = EngineProfiler::now();
     ChannelMixer::applyEffectsInPlaceAndMixChannels(
             m_talkoverGain,
             m_activeTalkoverChannels,
@@ -518,6 +615,10 @@ void EngineMixer::process(const int iBufferSize) {
         m_pTalkoverDucking->setAboveThreshold(false);
         break;
     }
+    const qint64 busMixStartNanos = EngineProfiler::now();
+    EngineProfiler::record(EngineProfiler::Stage::TalkoverMix,
+            talkoverMixStartNanos,
+            busMixStartNanos);
 
     // Calculate the crossfader gains for left and right side of the crossfader
     CSAMPLE_GAIN crossfaderLeftGain, crossfaderRightGain;
@@ -581,6 +682,9 @@ void EngineMixer::process(const int iBufferSize) {
                 CSAMPLE_GAIN_ONE,
                 false);
     }
+    EngineProfiler::record(EngineProfiler::Stage::BusMix,
+            busMixStartNanos,
+            EngineProfiler::now());
 
     if (mainEnabled) {
         // Mix the crossfader orientation buffers together into the main mix
@@ -753,12 +857,14 @@ void EngineMixer::process(const int iBufferSize) {
         // EngineSideChain::receiveBuffer has copied the input buffer to m_pSidechainMix
         // via before (called by SoundManager::pushInputBuffers())
         if (m_pEngineSideChain) {
+            EngineProfiler::ScopedStage profilerStage(EngineProfiler::Stage::Sidechain);
             m_pEngineSideChain->writeSamples(m_sidechainMix.data(), iFrames);
         }
 
         // Process effects that apply to main hardware output only but not
         // record/broadcast signal
         if (m_pEngineEffectsManager) {
+            EngineProfiler::ScopedStage profilerStage(EngineProfiler::Stage::MainEffects);
             GroupFeatureState mainFeatures;
             mainFeatures.has_gain = true;
             mainFeatures.gain = m_pMainGain->get();
@@ -803,6 +909,7 @@ void EngineMixer::process(const int iBufferSize) {
         SampleUtil::mixStereoToMono(m_main.data(), iBufferSize);
     }
 
+    const qint64 outputDelaysStartNanos = EngineProfiler::now();
     if (mainEnabled) {
         m_pMainDelay->process(m_main.data(), iBufferSize);
     } else {
@@ -814,6 +921,9 @@ void EngineMixer::process(const int iBufferSize) {
     if (boothEnabled) {
         m_pBoothDelay->process(m_booth.data(), iBufferSize);
     }
+    EngineProfiler::record(EngineProfiler::Stage::OutputDelays,
+            outputDelaysStartNanos,
+            EngineProfiler::now());
 
     // We're close to the end of the callback. Wake up the engine worker
     // scheduler so that it runs the workers.
@@ -823,6 +933,7 @@ void EngineMixer::process(const int iBufferSize) {
 void EngineMixer::applyMainEffects(int bufferSize) {
     // Apply main effects
     if (m_pEngineEffectsManager) {
+        EngineProfiler::ScopedStage profilerStage(EngineProfiler::Stage::MainEffects);
         GroupFeatureState mainFeatures;
         mainFeatures.has_gain = true;
         mainFeatures.gain = m_pMainGain->get();
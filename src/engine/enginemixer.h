@@ -3,6 +3,7 @@
 #include <QObject>
 #include <QVarLengthArray>
 #include <atomic>
+#include <memory>
 
 #include "audio/types.h"
 #include "control/controlobject.h"
@@ -17,6 +18,7 @@
 #include "util/samplebuffer.h"
 
 class EngineWorkerScheduler;
+class EngineChannelWorkerPool;
 class EngineBuffer;
 class EngineChannel;
 class EngineDeck;
@@ -115,7 +117,9 @@ class EngineMixer : public QObject, public AudioSource {
                 : m_pChannel(NULL),
                   m_pVolumeControl(NULL),
                   m_pMuteControl(NULL),
-                  m_index(index) {
+                  m_index(index),
+                  m_processStartNanos(0),
+                  m_processEndNanos(0) {
         }
         ChannelHandle m_handle;
         EngineChannel* m_pChannel;
@@ -124,6 +128,10 @@ class EngineMixer : public QObject, public AudioSource {
         ControlPushButton* m_pMuteControl;
         GroupFeatureState m_features;
         int m_index;
+        // Reported to the EngineProfiler by the engine thread, because the
+        // channel might have been processed by a worker thread.
+        qint64 m_processStartNanos;
+        qint64 m_processEndNanos;
     };
 
     struct GainCache {
@@ -262,6 +270,11 @@ class EngineMixer : public QObject, public AudioSource {
     // m_activeTalkoverChannels with each channel that is active for the
     // respective output.
     void processChannels(int iBufferSize);
+    void processChannel(ChannelInfo* pChannelInfo, int iBufferSize);
+    void collectChannelFeatures(ChannelInfo* pChannelInfo);
+    // EngineChannelWorkerPool::JobFunction for processing the channels in
+    // m_concurrentChannels.
+    static void processChannelJob(void* pContext, int jobIndex);
 
     ChannelHandleFactoryPointer m_pChannelHandleFactory;
     void applyMainEffects(int bufferSize);
@@ -300,6 +313,13 @@ class EngineMixer : public QObject, public AudioSource {
     EngineWorkerScheduler* m_pWorkerScheduler;
     EngineSync* m_pEngineSync;
 
+    // Processes the active channels that don't depend on EngineSync or
+    // other decks concurrently if m_pParallelChannelProcessing is enabled.
+    std::unique_ptr<EngineChannelWorkerPool> m_pChannelWorkerPool;
+    ControlObject* m_pParallelChannelProcessing;
+    QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_concurrentChannels;
+    int m_parallelJobsBufferSize;
+
     ControlObject* m_pMainGain;
     ControlObject* m_pBoothGain;
     ControlObject* m_pHeadGain;
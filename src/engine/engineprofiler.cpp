@@ -0,0 +1,326 @@
+#include "engine/engineprofiler.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtDebug>
+#include <algorithm>
+#include <limits>
+
+#include "moc_engineprofiler.cpp"
+#include "util/compatibility/qmutex.h"
+
+namespace {
+
+// About 100 ms of samples at the smallest buffer size with many decks
+constexpr std::size_t kQueueSize = 1 << 14;
+// The percentiles are computed from the most recent samples of each stage
+constexpr std::size_t kRecentSamplesPerStage = 4096;
+// About 10 seconds of samples for the trace export
+constexpr std::size_t kTimelineSize = 1 << 17;
+constexpr std::size_t kMaxRecentOverruns = 100;
+constexpr unsigned long kProcessIntervalMillis = 100;
+
+bool isContainerStage(EngineProfiler::Stage stage) {
+    switch (stage) {
+    case EngineProfiler::Stage::Callback:
+    case EngineProfiler::Stage::Engine:
+    case EngineProfiler::Stage::Channels:
+        return true;
+    default:
+        return false;
+    }
+}
+
+qint64 percentile(std::vector<qint64>* pValues, int percent) {
+    DEBUG_ASSERT(!pValues->empty());
+    const auto nth = pValues->begin() +
+            static_cast<std::ptrdiff_t>((pValues->size() - 1) * percent / 100);
+    std::nth_element(pValues->begin(), nth, pValues->end());
+    return *nth;
+}
+
+} // anonymous namespace
+
+// static
+bool EngineProfiler::s_bEngineProfilerEnabled = false;
+
+// static
+QString EngineProfiler::stageName(Stage stage) {
+    switch (stage) {
+    case Stage::Callback:
+        return QStringLiteral("Callback");
+    case Stage::Engine:
+        return QStringLiteral("Engine");
+    case Stage::Channels:
+        return QStringLiteral("Channels");
+    case Stage::Channel:
+        return QStringLiteral("Channel");
+    case Stage::HeadphoneMix:
+        return QStringLiteral("HeadphoneMix");
+    case Stage::TalkoverMix:
+        return QStringLiteral("TalkoverMix");
+    case Stage::BusMix:
+        return QStringLiteral("BusMix");
+    case Stage::MainEffects:
+        return QStringLiteral("MainEffects");
+    case Stage::Sidechain:
+        return QStringLiteral("Sidechain");
+    case Stage::OutputDelays:
+        return QStringLiteral("OutputDelays");
+    case Stage::ComposeOutput:
+        return QStringLiteral("ComposeOutput");
+    }
+    DEBUG_ASSERT(!"unreachable");
+    return QString();
+}
+
+EngineProfiler::EngineProfiler()
+        : QThread(),
+          m_callback(0),
+          m_budgetNanos(0),
+          m_lastXrunCount(0),
+          m_warnedAboutOverflow(false),
+          m_xrunCount(0),
+          m_queue(kQueueSize),
+          m_stageSamples(kStageCount),
+          m_previousCallbackSample{},
+          m_previousCallbackOverrun(false),
+          m_quit(0) {
+    for (auto& stageSamples : m_stageSamples) {
+        stageSamples.recentNanos.reserve(kRecentSamplesPerStage);
+    }
+    m_currentCallback.reserve(64);
+    m_previousCallback.reserve(64);
+    setObjectName("EngineProfiler");
+    start(QThread::LowPriority);
+    s_bEngineProfilerEnabled = true;
+}
+
+EngineProfiler::~EngineProfiler() {
+    s_bEngineProfilerEnabled = false;
+    m_quit = 1;
+    m_waitCondition.wakeAll();
+    wait();
+}
+
+void EngineProfiler::beginCallbackImpl(
+        SINT framesPerBuffer, mixxx::audio::SampleRate sampleRate) {
+    // An xrun is detected at the start of the callback after the one that
+    // was too late
+    const int xrunCount = m_xrunCount.loadRelaxed();
+    if (xrunCount != m_lastXrunCount) {
+        m_lastXrunCount = xrunCount;
+        push(Sample{now(), 0, 0, m_callback, Stage::Callback, -1, true});
+    }
+    ++m_callback;
+    m_budgetNanos = sampleRate.isValid()
+            ? framesPerBuffer * 1000000000LL / sampleRate.value()
+            : 0;
+}
+
+void EngineProfiler::recordImpl(
+        Stage stage, qint64 startNanos, qint64 endNanos, int channel) {
+    push(Sample{startNanos,
+            endNanos - startNanos,
+            stage == Stage::Callback ? m_budgetNanos : 0,
+            m_callback,
+            stage,
+            static_cast<qint8>(channel),
+            false});
+}
+
+void EngineProfiler::push(const Sample& sample) {
+    if (!m_queue.try_push(sample) && !m_warnedAboutOverflow) {
+        // Only warn once, logging from the audio thread is expensive
+        qWarning() << "EngineProfiler queue overflowed, some samples are lost";
+        m_warnedAboutOverflow = true;
+    }
+}
+
+void EngineProfiler::run() {
+    while (m_quit.loadAcquire() == 0) {
+        m_waitMutex.lock();
+        m_waitCondition.wait(&m_waitMutex, kProcessIntervalMillis);
+        m_waitMutex.unlock();
+        processQueuedSamples();
+    }
+}
+
+void EngineProfiler::processQueuedSamples() {
+    const auto locker = lockMutex(&m_mutex);
+    while (const Sample* pSample = m_queue.front()) {
+        processSample(*pSample);
+        m_queue.pop();
+    }
+}
+
+void EngineProfiler::processSample(const Sample& sample) {
+    m_timeline.push_back(sample);
+    if (m_timeline.size() > kTimelineSize) {
+        m_timeline.pop_front();
+    }
+
+    if (sample.xrun) {
+        if (sample.callback == 0 || sample.callback != m_previousCallbackSample.callback) {
+            // The callback has not been recorded completely
+            return;
+        }
+        if (m_previousCallbackOverrun) {
+            if (!m_overruns.empty() && m_overruns.back().callback == sample.callback) {
+                m_overruns.back().xrun = true;
+            }
+        } else {
+            attributeOverrun(m_previousCallbackSample, true);
+            m_previousCallbackOverrun = true;
+        }
+        return;
+    }
+
+    StageSamples& stageSamples = m_stageSamples[static_cast<int>(sample.stage)];
+    ++stageSamples.count;
+    if (stageSamples.recentNanos.size() < kRecentSamplesPerStage) {
+        stageSamples.recentNanos.push_back(sample.durationNanos);
+    } else {
+        stageSamples.recentNanos[stageSamples.nextIndex] = sample.durationNanos;
+    }
+    stageSamples.nextIndex = (stageSamples.nextIndex + 1) % kRecentSamplesPerStage;
+
+    if (!m_currentCallback.empty() && m_currentCallback.front().callback != sample.callback) {
+        // Samples recorded outside of an instrumented callback
+        m_currentCallback.clear();
+    }
+    if (sample.stage == Stage::Callback) {
+        finishCallback(sample);
+    } else {
+        m_currentCallback.push_back(sample);
+    }
+}
+
+void EngineProfiler::finishCallback(const Sample& callbackSample) {
+    // The callback is recorded last, when all of its stages are done
+    m_previousCallback.swap(m_currentCallback);
+    m_currentCallback.clear();
+    m_previousCallbackSample = callbackSample;
+    m_previousCallbackOverrun = callbackSample.budgetNanos > 0 &&
+            callbackSample.durationNanos > callbackSample.budgetNanos;
+    if (m_previousCallbackOverrun) {
+        attributeOverrun(callbackSample, false);
+    }
+}
+
+void EngineProfiler::attributeOverrun(const Sample& callbackSample, bool xrun) {
+    // Blame the stage that exceeded its usual duration the most. Nested
+    // stages are skipped in favor of their children.
+    const Sample* pCulprit = &callbackSample;
+    qint64 maxExcessNanos = std::numeric_limits<qint64>::min();
+    for (const auto& sample : m_previousCallback) {
+        if (isContainerStage(sample.stage)) {
+            continue;
+        }
+        const qint64 excessNanos = sample.durationNanos - medianNanos(sample.stage);
+        if (excessNanos > maxExcessNanos) {
+            maxExcessNanos = excessNanos;
+            pCulprit = &sample;
+        }
+    }
+    ++m_stageSamples[static_cast<int>(pCulprit->stage)].overruns;
+
+    m_overruns.push_back(Overrun{callbackSample.callback,
+            callbackSample.startNanos,
+            callbackSample.durationNanos,
+            callbackSample.budgetNanos,
+            xrun,
+            pCulprit->stage,
+            pCulprit->channel,
+            pCulprit->durationNanos});
+    if (m_overruns.size() > kMaxRecentOverruns) {
+        m_overruns.pop_front();
+    }
+}
+
+qint64 EngineProfiler::medianNanos(Stage stage) const {
+    std::vector<qint64> values = m_stageSamples[static_cast<int>(stage)].recentNanos;
+    if (values.empty()) {
+        return 0;
+    }
+    return percentile(&values, 50);
+}
+
+QList<EngineProfiler::StageStats> EngineProfiler::stageStats() const {
+    const auto locker = lockMutex(&m_mutex);
+    QList<StageStats> result;
+    for (int i = 0; i < kStageCount; ++i) {
+        const StageSamples& stageSamples = m_stageSamples[i];
+        StageStats stats;
+        stats.stage = static_cast<Stage>(i);
+        stats.count = stageSamples.count;
+        stats.overruns = stageSamples.overruns;
+        if (!stageSamples.recentNanos.empty()) {
+            std::vector<qint64> values = stageSamples.recentNanos;
+            stats.p50Nanos = percentile(&values, 50);
+            stats.p90Nanos = percentile(&values, 90);
+            stats.p99Nanos = percentile(&values, 99);
+            stats.maxNanos = *std::max_element(values.begin(), values.end());
+        }
+        result.append(stats);
+    }
+    return result;
+}
+
+QList<EngineProfiler::Overrun> EngineProfiler::recentOverruns() const {
+    const auto locker = lockMutex(&m_mutex);
+    return QList<Overrun>(m_overruns.begin(), m_overruns.end());
+}
+
+bool EngineProfiler::writeTraceEvents(const QString& fileName) const {
+    QJsonArray events;
+    {
+        const auto locker = lockMutex(&m_mutex);
+        if (m_timeline.empty()) {
+            qDebug() << "EngineProfiler: No samples recorded";
+            return false;
+        }
+        const qint64 originNanos = m_timeline.front().startNanos;
+        for (const auto& sample : m_timeline) {
+            QJsonObject event;
+            event.insert(QStringLiteral("ts"), (sample.startNanos - originNanos) / 1000.0);
+            event.insert(QStringLiteral("pid"), 0);
+            // Channels that are processed in parallel get their own tracks
+            event.insert(QStringLiteral("tid"), sample.channel < 0 ? 0 : 1 + sample.channel);
+            event.insert(QStringLiteral("cat"), QStringLiteral("engine"));
+            if (sample.xrun) {
+                event.insert(QStringLiteral("name"), QStringLiteral("xrun"));
+                event.insert(QStringLiteral("ph"), QStringLiteral("i"));
+                event.insert(QStringLiteral("s"), QStringLiteral("g"));
+            } else {
+                QString name = stageName(sample.stage);
+                if (sample.channel >= 0) {
+                    name += QStringLiteral(" %1").arg(sample.channel);
+                }
+                event.insert(QStringLiteral("name"), name);
+                event.insert(QStringLiteral("ph"), QStringLiteral("X"));
+                event.insert(QStringLiteral("dur"), sample.durationNanos / 1000.0);
+                QJsonObject args;
+                args.insert(QStringLiteral("callback"), static_cast<qint64>(sample.callback));
+                if (sample.stage == Stage::Callback) {
+                    args.insert(QStringLiteral("budget_us"), sample.budgetNanos / 1000.0);
+                }
+                event.insert(QStringLiteral("args"), args);
+            }
+            events.append(event);
+        }
+    }
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "EngineProfiler: Could not open" << fileName << "for writing";
+        return false;
+    }
+    QJsonObject trace;
+    trace.insert(QStringLiteral("traceEvents"), events);
+    trace.insert(QStringLiteral("displayTimeUnit"), QStringLiteral("ns"));
+    file.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+    return true;
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <QAtomicInt>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QWaitCondition>
+#include <chrono>
+#include <deque>
+#include <vector>
+
+#include "audio/types.h"
+#include "rigtorp/SPSCQueue.h"
+#include "util/singleton.h"
+#include "util/types.h"
+
+// EngineProfiler measures the stages of every engine callback. Recording a
+// stage only reads the clock twice and pushes a sample into a lock-free
+// queue, so unlike ScopedTimer and the StatsManager it is cheap enough to
+// stay enabled in the audio thread.
+//
+// A low priority thread drains the queue, computes percentiles per stage
+// and keeps the samples of the last seconds for exporting them as Chrome
+// trace events. Callbacks that took longer than the duration of their
+// buffer or that were followed by an xrun are attributed to the stage that
+// exceeded its median the most.
+//
+// Samples must only be recorded from the thread that processes the engine,
+// i.e. the callback thread of the clock reference device.
+class EngineProfiler : public QThread, public Singleton<EngineProfiler> {
+    Q_OBJECT
+  public:
+    enum class Stage : quint8 {
+        // The whole callback of the clock reference device
+        Callback,
+        // EngineMixer::process()
+        Engine,
+        // EngineMixer::processChannels(), including the sync
+        Channels,
+        // EngineChannel::process() of one channel, might run in parallel
+        Channel,
+        // Effects and mixing of the channels for the headphones
+        HeadphoneMix,
+        // Effects and mixing of the microphones
+        TalkoverMix,
+        // Effects and mixing of the crossfader buses
+        BusMix,
+        // Effects on the main mix and the main output
+        MainEffects,
+        // Handing the main mix over to recording and broadcasting
+        Sidechain,
+        // The output delays
+        OutputDelays,
+        // SoundDevice::composeOutputBuffer()
+        ComposeOutput,
+    };
+    static constexpr int kStageCount = static_cast<int>(Stage::ComposeOutput) + 1;
+
+    static QString stageName(Stage stage);
+
+    struct StageStats {
+        Stage stage;
+        qint64 count = 0;
+        // Percentiles of the recent samples
+        qint64 p50Nanos = 0;
+        qint64 p90Nanos = 0;
+        qint64 p99Nanos = 0;
+        qint64 maxNanos = 0;
+        // The number of overruns that were attributed to this stage
+        qint64 overruns = 0;
+    };
+
+    struct Overrun {
+        quint32 callback;
+        qint64 timeNanos;
+        qint64 callbackNanos;
+        qint64 budgetNanos;
+        bool xrun;
+        Stage stage;
+        // -1 if the stage is not specific to a channel
+        int channel;
+        qint64 stageNanos;
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    static qint64 now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now().time_since_epoch())
+                .count();
+    }
+
+    // Starts a new callback. The budget is the duration of the buffer.
+    static void beginCallback(SINT framesPerBuffer, mixxx::audio::SampleRate sampleRate) {
+        if (s_bEngineProfilerEnabled) {
+            instance()->beginCallbackImpl(framesPerBuffer, sampleRate);
+        }
+    }
+
+    static void record(Stage stage, qint64 startNanos, qint64 endNanos, int channel = -1) {
+        if (s_bEngineProfilerEnabled) {
+            instance()->recordImpl(stage, startNanos, endNanos, channel);
+        }
+    }
+
+    // Thread-safe, can be called from any sound device
+    static void reportXrun() {
+        if (s_bEngineProfilerEnabled) {
+            instance()->m_xrunCount.fetchAndAddRelaxed(1);
+        }
+    }
+
+    // Records the time from construction to destruction
+    class ScopedStage {
+      public:
+        explicit ScopedStage(Stage stage, int channel = -1)
+                : m_stage(stage),
+                  m_channel(channel),
+                  m_startNanos(s_bEngineProfilerEnabled ? now() : 0) {
+        }
+        ~ScopedStage() {
+            if (s_bEngineProfilerEnabled) {
+                record(m_stage, m_startNanos, now(), m_channel);
+            }
+        }
+
+      private:
+        const Stage m_stage;
+        const int m_channel;
+        const qint64 m_startNanos;
+    };
+
+    EngineProfiler();
+    ~EngineProfiler() override;
+
+    QList<StageStats> stageStats() const;
+    QList<Overrun> recentOverruns() const;
+
+    // Writes the recent samples in the Chrome trace event format that can
+    // be opened in chrome://tracing or https://ui.perfetto.dev
+    bool writeTraceEvents(const QString& fileName) const;
+
+    // Processes all queued samples. Called periodically by the thread.
+    void processQueuedSamples();
+
+    static bool s_bEngineProfilerEnabled;
+
+  protected:
+    void run() override;
+
+  private:
+    struct Sample {
+        qint64 startNanos;
+        qint64 durationNanos;
+        // Only set for the Callback stage
+        qint64 budgetNanos;
+        quint32 callback;
+        Stage stage;
+        qint8 channel;
+        // Marks an xrun after the callback, without a duration
+        bool xrun;
+    };
+
+    struct StageSamples {
+        qint64 count = 0;
+        qint64 overruns = 0;
+        // Ring of the most recent durations
+        std::vector<qint64> recentNanos;
+        std::size_t nextIndex = 0;
+    };
+
+    void beginCallbackImpl(SINT framesPerBuffer, mixxx::audio::SampleRate sampleRate);
+    void recordImpl(Stage stage, qint64 startNanos, qint64 endNanos, int channel);
+    void push(const Sample& sample);
+
+    void processSample(const Sample& sample);
+    void finishCallback(const Sample& callbackSample);
+    void attributeOverrun(const Sample& callbackSample, bool xrun);
+    qint64 medianNanos(Stage stage) const;
+
+    // Producer side, only accessed by the engine thread
+    quint32 m_callback;
+    qint64 m_budgetNanos;
+    int m_lastXrunCount;
+    bool m_warnedAboutOverflow;
+
+    QAtomicInt m_xrunCount;
+    rigtorp::SPSCQueue<Sample> m_queue;
+
+    // Consumer side, guarded by m_mutex
+    mutable QMutex m_mutex;
+    std::vector<StageSamples> m_stageSamples;
+    std::deque<Sample> m_timeline;
+    // The samples of the callback that is currently being collected and of
+    // the previous one, which might still be followed by an xrun marker.
+    std::vector<Sample> m_currentCallback;
+    std::vector<Sample> m_previousCallback;
+    Sample m_previousCallbackSample;
+    bool m_previousCallbackOverrun;
+    std::deque<Overrun> m_overruns;
+
+    QMutex m_waitMutex;
+    QWaitCondition m_waitCondition;
+    QAtomicInt m_quit;
+};
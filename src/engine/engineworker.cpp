@@ -9,6 +9,9 @@ EngineWorker::EngineWorker()
 }
 
 EngineWorker::~EngineWorker() {
+    if (m_pScheduler) {
+        m_pScheduler->removeWorker(this);
+    }
 }
 
 void EngineWorker::run() {
@@ -2,9 +2,10 @@
 
 #include <atomic>
 #include <QObject>
-#include <QSemaphore>
 #include <QThread>
 
+#include "util/lightweightsemaphore.h"
+
 // EngineWorker is an interface for running background processing work when the
 // audio callback is not active. While the audio callback is active, an
 // EngineWorker can emit its workReady signal, and an EngineWorkerManager will
@@ -25,7 +26,9 @@ class EngineWorker : public QThread {
     void wakeIfReady();
 
   protected:
-    QSemaphore m_semaRun;
+    // Released from the callback thread via wakeIfReady(). This does not
+    // enter the kernel unless the worker is actually sleeping.
+    mixxx::LightweightSemaphore m_semaRun;
 
   private:
     EngineWorkerScheduler* m_pScheduler;
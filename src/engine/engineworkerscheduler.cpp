@@ -1,61 +1,76 @@
 #include "engine/engineworkerscheduler.h"
 
-#include <QtDebug>
+#include <QThread>
+#include <algorithm>
 
 #include "engine/engineworker.h"
 #include "moc_engineworkerscheduler.cpp"
+#include "util/assert.h"
 #include "util/compatibility/qmutex.h"
-#include "util/event.h"
 
 EngineWorkerScheduler::EngineWorkerScheduler(QObject* pParent)
-        : m_bWakeScheduler(false),
-          m_bQuit(false) {
-    Q_UNUSED(pParent);
+        : QObject(pParent),
+          m_bWakeScheduler(false),
+          m_pWorkers(new WorkerList()),
+          m_bRunningWorkers(false) {
 }
 
 EngineWorkerScheduler::~EngineWorkerScheduler() {
-    m_bQuit = true;
-    m_waitCondition.wakeAll();
-    wait();
+    const WorkerList* pWorkers = m_pWorkers.load(std::memory_order_acquire);
+    // Workers unregister themselves when they are destroyed, which must
+    // happen before the scheduler is destroyed.
+    DEBUG_ASSERT(pWorkers->empty());
+    delete pWorkers;
 }
 
 void EngineWorkerScheduler::workerReady() {
-    m_bWakeScheduler = true;
+    m_bWakeScheduler.store(true, std::memory_order_release);
 }
 
 void EngineWorkerScheduler::addWorker(EngineWorker* pWorker) {
     DEBUG_ASSERT(pWorker);
-    const auto locker = lockMutex(&m_mutex);
-    m_workers.push_back(pWorker);
+    const auto locker = lockMutex(&m_workersMutex);
+    const WorkerList* pWorkers = m_pWorkers.load(std::memory_order_relaxed);
+    DEBUG_ASSERT(std::find(pWorkers->begin(), pWorkers->end(), pWorker) ==
+            pWorkers->end());
+    auto pNewWorkers = std::make_unique<WorkerList>(*pWorkers);
+    pNewWorkers->push_back(pWorker);
+    publishWorkers(std::move(pNewWorkers));
 }
 
-void EngineWorkerScheduler::runWorkers() {
-    // Wake the scheduler if we have written a worker-ready message to the
-    // scheduler. There is no race condition in accessing this boolean because
-    // both workerReady and runWorkers are called from the callback thread.
-    if (m_bWakeScheduler) {
-        m_bWakeScheduler = false;
-        m_waitCondition.wakeAll();
+void EngineWorkerScheduler::removeWorker(EngineWorker* pWorker) {
+    const auto locker = lockMutex(&m_workersMutex);
+    const WorkerList* pWorkers = m_pWorkers.load(std::memory_order_relaxed);
+    auto pNewWorkers = std::make_unique<WorkerList>(*pWorkers);
+    const auto it = std::find(pNewWorkers->begin(), pNewWorkers->end(), pWorker);
+    VERIFY_OR_DEBUG_ASSERT(it != pNewWorkers->end()) {
+        return;
+    }
+    pNewWorkers->erase(it);
+    publishWorkers(std::move(pNewWorkers));
+}
+
+void EngineWorkerScheduler::publishWorkers(std::unique_ptr<WorkerList> pWorkers) {
+    // Both the exchange here and the accesses in runWorkers() are
+    // sequentially consistent: Either runWorkers() already loads the new
+    // list, or we see m_bRunningWorkers set and wait until it is done with
+    // the old one. Walking the list takes only a few microseconds.
+    const WorkerList* pOldWorkers = m_pWorkers.exchange(pWorkers.release());
+    while (m_bRunningWorkers.load()) {
+        QThread::yieldCurrentThread();
     }
+    delete pOldWorkers;
 }
 
-void EngineWorkerScheduler::run() {
-    static const QString tag("EngineWorkerScheduler");
-    while (!m_bQuit) {
-        Event::start(tag);
-        {
-            const auto locker = lockMutex(&m_mutex);
-            for(const auto& pWorker: m_workers) {
-                pWorker->wakeIfReady();
-            }
-        }
-        Event::end(tag);
-        {
-            const auto lock = lockMutex(&m_mutex);
-            if (!m_bQuit) {
-                // Wait for next runWorkers() call
-                m_waitCondition.wait(&m_mutex); // unlock mutex and wait
-            }
-        }
+void EngineWorkerScheduler::runWorkers() {
+    // Wake the workers only if any of them has written a worker-ready message
+    // since the last callback.
+    if (!m_bWakeScheduler.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    m_bRunningWorkers.store(true);
+    for (EngineWorker* pWorker : *m_pWorkers.load()) {
+        pWorker->wakeIfReady();
     }
+    m_bRunningWorkers.store(false, std::memory_order_release);
 }
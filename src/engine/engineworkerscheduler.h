@@ -1,38 +1,53 @@
 #pragma once
 
 #include <QMutex>
-#include <QThreadPool>
-#include <QWaitCondition>
-
-#include "util/fifo.h"
-
-// The max engine workers that can be expected to run within a callback
-// (e.g. the max that we will schedule). Must be a power of 2.
-#define MAX_ENGINE_WORKERS 32
+#include <QObject>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 class EngineWorker;
 
-class EngineWorkerScheduler : public QThread {
+// EngineWorkerScheduler wakes up all EngineWorkers that have signaled
+// workReady() during the audio callback, once the callback is about to finish.
+//
+// Each EngineWorker runs on its own thread and sleeps on a
+// mixxx::LightweightSemaphore, so a slow worker (e.g. a deck decoding a large
+// FLAC file) never delays the others. Waking a worker that is still busy
+// does not involve a syscall, and no locks are taken on the callback thread.
+class EngineWorkerScheduler : public QObject {
     Q_OBJECT
   public:
-    EngineWorkerScheduler(QObject* pParent=NULL);
-    virtual ~EngineWorkerScheduler();
+    EngineWorkerScheduler(QObject* pParent = nullptr);
+    ~EngineWorkerScheduler() override;
 
+    // Registers or unregisters a worker. Only called from the main thread,
+    // but safe to be called while the callback is running. Once
+    // removeWorker() returns, runWorkers() no longer touches the worker.
     void addWorker(EngineWorker* pWorker);
+    void removeWorker(EngineWorker* pWorker);
+    // Called at the end of the callback.
     void runWorkers();
     void workerReady();
 
-  protected:
-    void run();
-
   private:
-    // Indicates whether workerReady has been called since the last time
-    // runWorkers was run. This should only be touched from the engine callback.
-    bool m_bWakeScheduler;
+    using WorkerList = std::vector<EngineWorker*>;
 
-    std::vector<EngineWorker*> m_workers;
+    // Publishes a modified copy of the worker list and frees the old one
+    // once runWorkers() no longer uses it. Must be called with
+    // m_workersMutex locked.
+    void publishWorkers(std::unique_ptr<WorkerList> pWorkers);
 
-    QWaitCondition m_waitCondition;
-    QMutex m_mutex;
-    volatile bool m_bQuit;
+    // Indicates whether workerReady has been called since the last time
+    // runWorkers was run.
+    std::atomic<bool> m_bWakeScheduler;
+
+    // Serializes addWorker() and removeWorker(). Never locked by the callback.
+    QMutex m_workersMutex;
+    // Copy-on-write list of workers. runWorkers() walks the current list
+    // without locking, while a modified copy replaces it.
+    std::atomic<const WorkerList*> m_pWorkers;
+    // Set while runWorkers() walks the list, so the previous list is not
+    // freed under its feet.
+    std::atomic<bool> m_bRunningWorkers;
 };
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
+#include <iterator>
 
 #define MIXXX
 #include <fidlib.h>
 
 #include "engine/engineobject.h"
+#include "engine/filters/iirstereosample.h"
 #include "util/sample.h"
 
 // set to 1 to print some analysis data using qDebug()
@@ -83,11 +86,9 @@ class EngineFilterIIR : public EngineFilterIIRBase {
 
     void initBuffers() {
         // Copy the current buffers into the old buffers
-        memcpy(m_oldBuf1, m_buf1, sizeof(m_buf1));
-        memcpy(m_oldBuf2, m_buf2, sizeof(m_buf2));
+        std::copy(std::begin(m_buf), std::end(m_buf), m_oldBuf);
         // Set the current buffers to 0
-        memset(m_buf1, 0, sizeof(m_buf1));
-        memset(m_buf2, 0, sizeof(m_buf2));
+        std::fill(std::begin(m_buf), std::end(m_buf), IIRStereoSample());
         m_doRamping = true;
     }
 
@@ -233,81 +234,93 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     virtual void process(const CSAMPLE* pIn, CSAMPLE* pOutput,
                          const int iBufferSize) {
         if (!m_doRamping) {
+            // Keep the state in registers instead of reloading it from
+            // memory after every store to pOutput
+            IIRStereoSample buf[SIZE];
+            std::copy(std::begin(m_buf), std::end(m_buf), buf);
             for (int i = 0; i < iBufferSize; i += 2) {
-                pOutput[i] = static_cast<CSAMPLE>(processSample(m_coef, m_buf1, pIn[i]));
-                pOutput[i + 1] = static_cast<CSAMPLE>(processSample(m_coef, m_buf2, pIn[i + 1]));
+                processSample(m_coef, buf, IIRStereoSample::load(pIn + i))
+                        .store(pOutput + i);
             }
+            std::copy(std::begin(buf), std::end(buf), m_buf);
+        } else if (!m_doStart) {
+            // Process old filter, but only if we do not do a fresh start.
+            // Its state is discarded after the ramp.
+            IIRStereoSample oldBuf[SIZE];
+            std::copy(std::begin(m_oldBuf), std::end(m_oldBuf), oldBuf);
+            processRamping(pIn, pOutput, iBufferSize, [this, &oldBuf](IIRStereoSample in) {
+                return processSample(m_oldCoef, oldBuf, in).roundToSample();
+            });
+        } else if (m_startFromDry) {
+            processRamping(pIn, pOutput, iBufferSize, [](IIRStereoSample in) {
+                return in;
+            });
         } else {
-            double cross_mix = 0.0;
-            double cross_inc = 4.0 / static_cast<double>(iBufferSize);
-            for (int i = 0; i < iBufferSize; i += 2) {
-                // Do a linear cross fade between the output of the old
-                // Filter and the new filter.
-                // The new filter is settled for Input = 0 and it sees
-                // all frequencies of the rectangular start impulse.
-                // Since the group delay, after which the start impulse
-                // has passed is unknown here, we just what the half
-                // iBufferSize until we use the samples of the new filter.
-                // In one of the previous version we have faded the Input
-                // of the new filter but it turns out that this produces
-                // a gain drop due to the filter delay which is more
-                // conspicuous than the settling noise.
-                double old1;
-                double old2;
-                if (!m_doStart) {
-                    // Process old filter, but only if we do not do a fresh start
-                    old1 = static_cast<CSAMPLE>(processSample(m_oldCoef, m_oldBuf1, pIn[i]));
-                    old2 = static_cast<CSAMPLE>(processSample(m_oldCoef, m_oldBuf2, pIn[i + 1]));
-                } else {
-                    if (m_startFromDry) {
-                        old1 = pIn[i];
-                        old2 = pIn[i + 1];
-                    } else {
-                        old1 = 0;
-                        old2 = 0;
-                    }
-                }
-                double new1 = static_cast<CSAMPLE>(processSample(m_coef, m_buf1, pIn[i]));
-                double new2 = static_cast<CSAMPLE>(processSample(m_coef, m_buf2, pIn[i + 1]));
-
-                if (i < iBufferSize / 2) {
-                    pOutput[i] = static_cast<CSAMPLE>(old1);
-                    pOutput[i + 1] = static_cast<CSAMPLE>(old2);
-                } else {
-                    pOutput[i] = static_cast<CSAMPLE>(new1 * cross_mix + old1 * (1.0 - cross_mix));
-                    pOutput[i + 1] = static_cast<CSAMPLE>(
-                            new2 * cross_mix + old2 * (1.0 - cross_mix));
-                    cross_mix += cross_inc;
-                }
-            }
-            m_doRamping = false;
-            m_doStart = false;
+            processRamping(pIn, pOutput, iBufferSize, [](IIRStereoSample) {
+                return IIRStereoSample();
+            });
         }
     }
 
   protected:
-    inline double processSample(double* coef, double* buf, double val);
+    inline IIRStereoSample processSample(
+            const double* coef, IIRStereoSample* buf, IIRStereoSample val);
     inline void pauseFilterInner() {
         // Set the current buffers to 0
-        memset(m_buf1, 0, sizeof(m_buf1));
-        memset(m_buf2, 0, sizeof(m_buf2));
+        std::fill(std::begin(m_buf), std::end(m_buf), IIRStereoSample());
         m_doRamping = true;
         m_doStart = true;
     }
 
+    // Do a linear cross fade between the output of the old
+    // Filter and the new filter.
+    // The new filter is settled for Input = 0 and it sees
+    // all frequencies of the rectangular start impulse.
+    // Since the group delay, after which the start impulse
+    // has passed is unknown here, we just what the half
+    // iBufferSize until we use the samples of the new filter.
+    // In one of the previous version we have faded the Input
+    // of the new filter but it turns out that this produces
+    // a gain drop due to the filter delay which is more
+    // conspicuous than the settling noise.
+    // The old output is either the old filter, the dry signal or silence.
+    // This is decided once per buffer by the caller, so that both loops
+    // are free of branches.
+    template<typename OldOutput>
+    inline void processRamping(const CSAMPLE* pIn,
+            CSAMPLE* pOutput,
+            const int iBufferSize,
+            OldOutput oldOutput) {
+        IIRStereoSample buf[SIZE];
+        std::copy(std::begin(m_buf), std::end(m_buf), buf);
+        int i = 0;
+        for (; i < iBufferSize / 2; i += 2) {
+            const auto in = IIRStereoSample::load(pIn + i);
+            oldOutput(in).store(pOutput + i);
+            processSample(m_coef, buf, in);
+        }
+        double cross_mix = 0.0;
+        const double cross_inc = 4.0 / static_cast<double>(iBufferSize);
+        for (; i < iBufferSize; i += 2) {
+            const auto in = IIRStereoSample::load(pIn + i);
+            const auto oldOut = oldOutput(in);
+            const auto newOut = processSample(m_coef, buf, in).roundToSample();
+            (newOut * cross_mix + oldOut * (1.0 - cross_mix)).store(pOutput + i);
+            cross_mix += cross_inc;
+        }
+        std::copy(std::begin(buf), std::end(buf), m_buf);
+        m_doRamping = false;
+        m_doStart = false;
+    }
+
     double m_coef[SIZE + 1];
     // Old coefficients needed for ramping
     double m_oldCoef[SIZE + 1];
 
-    // Channel 1 state
-    double m_buf1[SIZE];
-    // Old channel 1 buffer needed for ramping
-    double m_oldBuf1[SIZE];
-
-    // Channel 2 state
-    double m_buf2[SIZE];
-    // Old channel 2 buffer needed for ramping
-    double m_oldBuf2[SIZE];
+    // Channel 1 and 2 state
+    IIRStereoSample m_buf[SIZE];
+    // Old channel 1 and 2 state needed for ramping
+    IIRStereoSample m_oldBuf[SIZE];
 
     // Flag set to true if ramping needs to be done
     bool m_doRamping;
@@ -318,10 +331,10 @@ class EngineFilterIIR : public EngineFilterIIRBase {
 };
 
 template<>
-inline double EngineFilterIIR<2, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<2, IIR_LP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -332,10 +345,10 @@ inline double EngineFilterIIR<2, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<2, IIR_BP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = -tmp;
@@ -346,10 +359,10 @@ inline double EngineFilterIIR<2, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<2, IIR_HP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -360,10 +373,10 @@ inline double EngineFilterIIR<2, IIR_HP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<4, IIR_LP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -379,10 +392,10 @@ inline double EngineFilterIIR<4, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<8, IIR_BP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     iir = val * coef[0];
@@ -409,10 +422,10 @@ inline double EngineFilterIIR<8, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<4, IIR_HP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     iir= val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -428,10 +441,10 @@ inline double EngineFilterIIR<4, IIR_HP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<8, IIR_LP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     iir = val * coef[0];
@@ -458,10 +471,10 @@ inline double EngineFilterIIR<8, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<16, IIR_BP>::processSample(double* coef,
-                                                         double* buf,
-                                                         double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<16, IIR_BP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     buf[7] = buf[8]; buf[8] = buf[9]; buf[9] = buf[10]; buf[10] = buf[11];
@@ -510,10 +523,10 @@ inline double EngineFilterIIR<16, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<8, IIR_HP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
     buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
     iir = val * coef[0];
@@ -541,10 +554,10 @@ inline double EngineFilterIIR<8, IIR_HP>::processSample(double* coef,
 
 // IIR_LP and IIR_HP use the same processSample routine
 template<>
-inline double EngineFilterIIR<5, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<5, IIR_BP>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = coef[2] * tmp;
@@ -555,10 +568,10 @@ inline double EngineFilterIIR<5, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-   double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<4, IIR_LPMO>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+   IIRStereoSample tmp, fir, iir;
    tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
    iir= val * coef[0];
    iir -= coef[1]*tmp; fir= tmp;
@@ -581,10 +594,10 @@ inline double EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef,
 
 
 template<>
-inline double EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-   double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<4, IIR_HPMO>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+   IIRStereoSample tmp, fir, iir;
    tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
    iir= val * coef[0];
    iir -= coef[1]*tmp; fir= -tmp;
@@ -606,10 +619,10 @@ inline double EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_LP2>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<2, IIR_LP2>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0];
     iir = val * coef[0];
     iir -= coef[1] * tmp; fir = tmp;
@@ -627,10 +640,10 @@ inline double EngineFilterIIR<2, IIR_LP2>::processSample(double* coef,
 
 
 template<>
-inline double EngineFilterIIR<2, IIR_HP2>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
+inline IIRStereoSample EngineFilterIIR<2, IIR_HP2>::processSample(const double* coef,
+        IIRStereoSample* buf,
+        IIRStereoSample val) {
+    IIRStereoSample tmp, fir, iir;
     tmp = buf[0];
     iir = val * -coef[0]; // swap gain to be in phase with LP2
     iir -= coef[1] * tmp; fir = -tmp;
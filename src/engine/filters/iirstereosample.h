@@ -0,0 +1,140 @@
+#pragma once
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IIR_STEREO_SAMPLE_SSE2 1
+#include <emmintrin.h>
+#else
+#define IIR_STEREO_SAMPLE_SSE2 0
+#endif
+
+#include "util/types.h"
+
+// A left/right pair of double precision values that is processed in the two
+// lanes of a SIMD register. EngineFilterIIR runs the filter state of both
+// channels through a single instruction stream this way.
+// All operations are lane-wise and round exactly like their scalar
+// counterparts, so the filtered output does not depend on whether SSE2 is
+// available or not.
+class IIRStereoSample {
+  public:
+    IIRStereoSample()
+#if IIR_STEREO_SAMPLE_SSE2
+            : m_value(_mm_setzero_pd()) {
+#else
+            : m_left(0.0),
+              m_right(0.0) {
+#endif
+    }
+
+    IIRStereoSample(double left, double right)
+#if IIR_STEREO_SAMPLE_SSE2
+            : m_value(_mm_set_pd(right, left)) {
+#else
+            : m_left(left),
+              m_right(right) {
+#endif
+    }
+
+    // Loads an interleaved stereo frame
+    static IIRStereoSample load(const CSAMPLE* pFrame) {
+        return IIRStereoSample(pFrame[0], pFrame[1]);
+    }
+
+    // Stores the values as an interleaved stereo frame
+    void store(CSAMPLE* pFrame) const {
+#if IIR_STEREO_SAMPLE_SSE2
+        const __m128 value = _mm_cvtpd_ps(m_value);
+        _mm_store_ss(pFrame, value);
+        _mm_store_ss(pFrame + 1, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1)));
+#else
+        pFrame[0] = static_cast<CSAMPLE>(m_left);
+        pFrame[1] = static_cast<CSAMPLE>(m_right);
+#endif
+    }
+
+    // Returns the values rounded to the precision of CSAMPLE
+    IIRStereoSample roundToSample() const {
+#if IIR_STEREO_SAMPLE_SSE2
+        return IIRStereoSample(_mm_cvtps_pd(_mm_cvtpd_ps(m_value)));
+#else
+        return IIRStereoSample(
+                static_cast<CSAMPLE>(m_left),
+                static_cast<CSAMPLE>(m_right));
+#endif
+    }
+
+    double left() const {
+#if IIR_STEREO_SAMPLE_SSE2
+        return _mm_cvtsd_f64(m_value);
+#else
+        return m_left;
+#endif
+    }
+
+    double right() const {
+#if IIR_STEREO_SAMPLE_SSE2
+        return _mm_cvtsd_f64(_mm_unpackhi_pd(m_value, m_value));
+#else
+        return m_right;
+#endif
+    }
+
+    IIRStereoSample& operator+=(IIRStereoSample rhs) {
+        *this = *this + rhs;
+        return *this;
+    }
+
+    IIRStereoSample& operator-=(IIRStereoSample rhs) {
+        *this = *this - rhs;
+        return *this;
+    }
+
+    friend IIRStereoSample operator+(IIRStereoSample lhs, IIRStereoSample rhs) {
+#if IIR_STEREO_SAMPLE_SSE2
+        return IIRStereoSample(_mm_add_pd(lhs.m_value, rhs.m_value));
+#else
+        return IIRStereoSample(lhs.m_left + rhs.m_left, lhs.m_right + rhs.m_right);
+#endif
+    }
+
+    friend IIRStereoSample operator-(IIRStereoSample lhs, IIRStereoSample rhs) {
+#if IIR_STEREO_SAMPLE_SSE2
+        return IIRStereoSample(_mm_sub_pd(lhs.m_value, rhs.m_value));
+#else
+        return IIRStereoSample(lhs.m_left - rhs.m_left, lhs.m_right - rhs.m_right);
+#endif
+    }
+
+    friend IIRStereoSample operator-(IIRStereoSample value) {
+#if IIR_STEREO_SAMPLE_SSE2
+        // Flip the sign bit like the scalar negation does
+        return IIRStereoSample(_mm_xor_pd(value.m_value, _mm_set1_pd(-0.0)));
+#else
+        return IIRStereoSample(-value.m_left, -value.m_right);
+#endif
+    }
+
+    friend IIRStereoSample operator*(IIRStereoSample lhs, double rhs) {
+#if IIR_STEREO_SAMPLE_SSE2
+        return IIRStereoSample(_mm_mul_pd(lhs.m_value, _mm_set1_pd(rhs)));
+#else
+        return IIRStereoSample(lhs.m_left * rhs, lhs.m_right * rhs);
+#endif
+    }
+
+    friend IIRStereoSample operator*(double lhs, IIRStereoSample rhs) {
+        return rhs * lhs;
+    }
+
+  private:
+#if IIR_STEREO_SAMPLE_SSE2
+    explicit IIRStereoSample(__m128d value)
+            : m_value(value) {
+    }
+
+    __m128d m_value;
+#else
+    double m_left;
+    double m_right;
+#endif
+};
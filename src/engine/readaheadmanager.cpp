@@ -1,5 +1,7 @@
 #include "engine/readaheadmanager.h"
 
+#include <algorithm>
+
 #include "engine/cachingreader/cachingreader.h"
 #include "engine/controls/loopingcontrol.h"
 #include "engine/controls/ratecontrol.h"
@@ -7,6 +9,15 @@
 #include "util/math.h"
 #include "util/sample.h"
 
+namespace {
+
+// The number of chunks to prefetch beyond the hinted play position at a
+// rate of 1.0, i.e. about 0.7 seconds at 48 kHz.
+constexpr SINT kPrefetchChunksAtUnityRate = 4;
+constexpr SINT kMaxPrefetchChunks = 16;
+
+} // anonymous namespace
+
 ReadAheadManager::ReadAheadManager()
         : m_pLoopingControl(nullptr),
           m_pRateControl(nullptr),
@@ -239,6 +250,40 @@ void ReadAheadManager::hintReader(double dRate, gsl::not_null<HintVector*> pHint
     // top priority, we need to read this data immediately
     current_position.type = Hint::Type::CurrentPosition;
     pHintList->append(current_position);
+
+    // Keep the chunk behind the play position, so we can instantly change
+    // the direction when scratching.
+    Hint behind_position;
+    behind_position.type = Hint::Type::CurrentPosition;
+    behind_position.frameCount = CachingReaderChunk::kFrames;
+    if (in_reverse) {
+        behind_position.frame = current_position.frame + frameCountToCache;
+    } else {
+        behind_position.frame = current_position.frame - behind_position.frameCount;
+    }
+    if (behind_position.frame + behind_position.frameCount > 0) {
+        pHintList->append(behind_position);
+    }
+
+    // Prefetch further ahead in play direction with spare chunks. The
+    // distance grows with the rate, because we will get there sooner.
+    const SINT prefetchChunks = std::clamp(
+            static_cast<SINT>(ceil(fabs(dRate) * kPrefetchChunksAtUnityRate)),
+            SINT{0},
+            kMaxPrefetchChunks);
+    if (prefetchChunks > 0) {
+        Hint prefetch;
+        prefetch.type = Hint::Type::Prefetch;
+        prefetch.frameCount = prefetchChunks * CachingReaderChunk::kFrames;
+        if (in_reverse) {
+            prefetch.frame = current_position.frame - prefetch.frameCount;
+        } else {
+            prefetch.frame = current_position.frame + frameCountToCache;
+        }
+        if (prefetch.frame + prefetch.frameCount > 0) {
+            pHintList->append(prefetch);
+        }
+    }
 }
 
 // Not thread-save, call from engine thread only
@@ -4,7 +4,8 @@
 // to increase the amount of time the CPU has to do whatever work needs to
 // be done, and that work is executed in a separate thread. (Threading
 // allows the next buffer to be filled while processing a buffer that's is
-// already full.)
+// already full.) Each buffer is then passed to all workers without copying
+// it, and every worker processes it in its own thread.
 
 #include "engine/sidechain/enginesidechain.h"
 
@@ -15,11 +16,17 @@
 #include "moc_enginesidechain.cpp"
 #include "util/counter.h"
 #include "util/event.h"
+#include "util/math.h"
 #include "util/sample.h"
 #include "util/timer.h"
 #include "util/trace.h"
 
-#define SIDECHAIN_BUFFER_SIZE 65536
+namespace {
+
+// Lost wake-ups from the engine thread are recovered after this time
+constexpr unsigned long kMaxWaitForSamplesMillis = 500;
+
+} // anonymous namespace
 
 EngineSideChain::EngineSideChain(
         UserSettingsPointer pConfig,
@@ -27,7 +34,6 @@ EngineSideChain::EngineSideChain(
         : m_pConfig(pConfig),
           m_bStopThread(false),
           m_sampleFifo(SIDECHAIN_BUFFER_SIZE),
-          m_pWorkBuffer(SampleUtil::alloc(SIDECHAIN_BUFFER_SIZE)),
           m_pSidechainMix(sidechainMix) {
     // We use HighPriority to prevent starvation by lower-priority processes (Qt
     // main thread, analysis, etc.). This used to be LowPriority but that is not
@@ -48,19 +54,35 @@ EngineSideChain::~EngineSideChain() {
     wait();
 
     MMutexLocker locker(&m_workerLock);
-    while (!m_workers.empty()) {
-        SideChainWorker* pWorker = m_workers.takeLast();
+    while (!m_workerThreads.empty()) {
+        // Process the remaining samples before shutting down the worker
+        std::unique_ptr<SideChainWorkerThread> pWorkerThread =
+                std::move(m_workerThreads.back());
+        m_workerThreads.pop_back();
+        pWorkerThread->stop();
+        SideChainWorker* pWorker = pWorkerThread->worker();
+        pWorkerThread.reset();
         pWorker->shutdown();
         delete pWorker;
     }
     locker.unlock();
-
-    SampleUtil::free(m_pWorkBuffer);
 }
 
 void EngineSideChain::addSideChainWorker(SideChainWorker* pWorker) {
+    auto pWorkerThread = std::make_unique<SideChainWorkerThread>(
+            pWorker, kMaxWorkerBacklogSamples);
+    pWorkerThread->start(QThread::HighPriority);
+    MMutexLocker locker(&m_workerLock);
+    m_workerThreads.push_back(std::move(pWorkerThread));
+}
+
+QList<SideChainWorkerStats> EngineSideChain::workerStats() const {
+    QList<SideChainWorkerStats> stats;
     MMutexLocker locker(&m_workerLock);
-    m_workers.append(pWorker);
+    for (const auto& pWorkerThread : m_workerThreads) {
+        stats.append(pWorkerThread->stats());
+    }
+    return stats;
 }
 
 void EngineSideChain::receiveBuffer(const AudioInput& input,
@@ -104,17 +126,26 @@ void EngineSideChain::run() {
         m_waitLock.lock();
 
         Event::end(tag);
-        m_waitForSamples.wait(&m_waitLock);
+        m_waitForSamples.wait(&m_waitLock, kMaxWaitForSamplesMillis);
         m_waitLock.unlock();
         Event::start(tag);
 
-        int samples_read;
-        while ((samples_read = m_sampleFifo.read(m_pWorkBuffer,
-                                                 SIDECHAIN_BUFFER_SIZE))) {
+        while (m_sampleFifo.readAvailable() > 0) {
+            // The chunk is shared by all workers and released by the last
+            // worker that has processed it
+            const int numSamples = math_min(
+                    m_sampleFifo.readAvailable(), SIDECHAIN_BUFFER_SIZE);
+            auto pChunk = std::make_shared<SideChainChunk>(numSamples);
+            pChunk->size = m_sampleFifo.read(pChunk->samples.data(), numSamples);
+            if (pChunk->size <= 0) {
+                break;
+            }
             Trace process("EngineSideChain::process");
             MMutexLocker locker(&m_workerLock);
-            foreach (SideChainWorker* pWorker, m_workers) {
-                pWorker->process(m_pWorkBuffer, samples_read);
+            for (const auto& pWorkerThread : m_workerThreads) {
+                if (!pWorkerThread->enqueue(pChunk)) {
+                    Counter("EngineSideChain::process worker overrun").increment();
+                }
             }
         }
 
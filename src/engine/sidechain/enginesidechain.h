@@ -4,9 +4,12 @@
 #include <QMutex>
 #include <QWaitCondition>
 #include <QList>
+#include <memory>
+#include <vector>
 
 #include "preferences/usersettings.h"
 #include "engine/sidechain/sidechainworker.h"
+#include "engine/sidechain/sidechainworkerthread.h"
 #include "soundio/soundmanagerutil.h"
 #include "util/fifo.h"
 #include "util/mutex.h"
@@ -29,10 +32,16 @@ class EngineSideChain : public QThread, public AudioDestination {
             const CSAMPLE* pBuffer,
             unsigned int iFrames) override;
 
-    // Thread-safe, blocking.
+    // Thread-safe, blocking. Each worker is run in its own thread, so a
+    // worker that can't keep up does not delay the others.
     void addSideChainWorker(SideChainWorker* pWorker);
 
+    // Thread-safe. The backlog and drop statistics of all workers.
+    QList<SideChainWorkerStats> workerStats() const;
+
     static constexpr int SIDECHAIN_BUFFER_SIZE = 65536;
+    // Samples are dropped for a worker whose backlog would exceed this
+    static constexpr int kMaxWorkerBacklogSamples = 8 * SIDECHAIN_BUFFER_SIZE;
 
   private:
     void run() override;
@@ -42,7 +51,6 @@ class EngineSideChain : public QThread, public AudioDestination {
     volatile bool m_bStopThread;
 
     FIFO<CSAMPLE> m_sampleFifo;
-    CSAMPLE* m_pWorkBuffer;
     CSAMPLE* m_pSidechainMix;
 
     // Provides thread safety around the wait condition below.
@@ -51,6 +59,7 @@ class EngineSideChain : public QThread, public AudioDestination {
     QWaitCondition m_waitForSamples;
 
     // Sidechain workers registered with EngineSideChain.
-    MMutex m_workerLock;
-    QList<SideChainWorker*> m_workers GUARDED_BY(m_workerLock);
+    mutable MMutex m_workerLock;
+    std::vector<std::unique_ptr<SideChainWorkerThread>> m_workerThreads
+            GUARDED_BY(m_workerLock);
 };
@@ -0,0 +1,82 @@
+#include "engine/sidechain/sidechainworkerthread.h"
+
+#include "engine/sidechain/sidechainworker.h"
+#include "util/assert.h"
+#include "util/compatibility/qmutex.h"
+#include "util/counter.h"
+#include "util/trace.h"
+
+SideChainWorkerThread::SideChainWorkerThread(
+        SideChainWorker* pWorker, SINT maxBacklogSamples)
+        : m_pWorker(pWorker),
+          m_maxBacklogSamples(maxBacklogSamples),
+          m_stop(false),
+          m_backlogSamples(0),
+          m_processedSamples(0),
+          m_droppedSamples(0) {
+    DEBUG_ASSERT(m_pWorker);
+}
+
+SideChainWorkerThread::~SideChainWorkerThread() {
+    stop();
+}
+
+bool SideChainWorkerThread::enqueue(SideChainChunkPointer pChunk) {
+    DEBUG_ASSERT(pChunk);
+    {
+        const auto locker = lockMutex(&m_queueLock);
+        if (m_backlogSamples.load() + pChunk->size > m_maxBacklogSamples) {
+            m_droppedSamples += pChunk->size;
+            Counter("SideChainWorkerThread::enqueue chunk dropped").increment();
+            return false;
+        }
+        m_backlogSamples += pChunk->size;
+        m_queue.push_back(std::move(pChunk));
+    }
+    m_chunksAvailable.wakeOne();
+    return true;
+}
+
+void SideChainWorkerThread::stop() {
+    {
+        const auto locker = lockMutex(&m_queueLock);
+        m_stop = true;
+    }
+    m_chunksAvailable.wakeOne();
+    wait();
+}
+
+SideChainWorkerStats SideChainWorkerThread::stats() const {
+    return SideChainWorkerStats{
+            m_pWorker,
+            m_backlogSamples.load(),
+            m_processedSamples.load(),
+            m_droppedSamples.load()};
+}
+
+void SideChainWorkerThread::run() {
+    static std::atomic<unsigned> id = 0;
+    QThread::currentThread()->setObjectName(
+            QString("SideChainWorker %1").arg(++id));
+    while (true) {
+        SideChainChunkPointer pChunk;
+        {
+            auto locker = lockMutex(&m_queueLock);
+            while (m_queue.empty() && !m_stop) {
+                m_chunksAvailable.wait(&m_queueLock);
+            }
+            if (m_queue.empty()) {
+                // Stopped after all chunks have been processed
+                return;
+            }
+            pChunk = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        {
+            Trace process("SideChainWorkerThread::process");
+            m_pWorker->process(pChunk->samples.data(), static_cast<int>(pChunk->size));
+        }
+        m_backlogSamples -= pChunk->size;
+        m_processedSamples += pChunk->size;
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+#include <atomic>
+#include <deque>
+#include <memory>
+
+#include "util/samplebuffer.h"
+#include "util/types.h"
+
+class SideChainWorker;
+
+// A block of samples that EngineSideChain has read from the engine. The same
+// block is shared by all workers without copying it and is released when the
+// last worker has processed it.
+struct SideChainChunk {
+    explicit SideChainChunk(SINT capacity)
+            : samples(capacity),
+              size(0) {
+    }
+
+    mixxx::SampleBuffer samples;
+    SINT size;
+};
+
+typedef std::shared_ptr<const SideChainChunk> SideChainChunkPointer;
+
+struct SideChainWorkerStats {
+    const SideChainWorker* pWorker;
+    // The number of samples that have been queued, but not processed yet
+    SINT backlogSamples;
+    quint64 processedSamples;
+    // The number of samples that have been skipped, because the worker
+    // could not keep up
+    quint64 droppedSamples;
+};
+
+// Runs a single SideChainWorker in its own thread, so that a slow encoder
+// only delays its own output. Chunks are queued by EngineSideChain and are
+// dropped if the backlog of the worker exceeds maxBacklogSamples.
+class SideChainWorkerThread : public QThread {
+  public:
+    SideChainWorkerThread(SideChainWorker* pWorker, SINT maxBacklogSamples);
+    ~SideChainWorkerThread() override;
+
+    SideChainWorker* worker() const {
+        return m_pWorker;
+    }
+
+    // Thread-safe. Returns false if the chunk has been dropped.
+    bool enqueue(SideChainChunkPointer pChunk);
+
+    // Processes the remaining chunks and stops the thread.
+    void stop();
+
+    SideChainWorkerStats stats() const;
+
+  private:
+    void run() override;
+
+    SideChainWorker* const m_pWorker;
+    const SINT m_maxBacklogSamples;
+
+    QMutex m_queueLock;
+    QWaitCondition m_chunksAvailable;
+    std::deque<SideChainChunkPointer> m_queue;
+    bool m_stop;
+
+    std::atomic<SINT> m_backlogSamples;
+    std::atomic<quint64> m_processedSamples;
+    std::atomic<quint64> m_droppedSamples;
+};
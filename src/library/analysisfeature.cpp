@@ -26,8 +26,25 @@ const QString kViewName = QStringLiteral("Analysis");
 // Utilize all available cores for batch analysis of tracks
 const int kNumberOfAnalyzerThreads = math_max(1, QThread::idealThreadCount());
 
+// In pipelined mode each analyzer thread keeps the decoder and roughly two
+// analyzers (beats and key) busy at the same time
+const int kNumberOfPipelinedAnalyzerThreads = math_max(1, QThread::idealThreadCount() / 3);
+
+const ConfigKey kPipelinedAnalysisConfigKey =
+        ConfigKey(QStringLiteral("[Library]"), QStringLiteral("PipelinedAnalysis"));
+
 inline
-int numberOfAnalyzerThreads() {
+bool isPipelinedAnalysisEnabled(
+        const UserSettingsPointer& pConfig) {
+    return pConfig->getValue<bool>(kPipelinedAnalysisConfigKey, false);
+}
+
+inline
+int numberOfAnalyzerThreads(
+        const UserSettingsPointer& pConfig) {
+    if (isPipelinedAnalysisEnabled(pConfig)) {
+        return kNumberOfPipelinedAnalyzerThreads;
+    }
     return kNumberOfAnalyzerThreads;
 }
 
@@ -43,6 +60,9 @@ AnalyzerModeFlags getAnalyzerModeFlags(
     if (pConfig->getValue<bool>(ConfigKey("[Library]", "EnableWaveformGenerationWithAnalysis"), true)) {
         modeFlags |= AnalyzerModeFlags::WithWaveform;
     }
+    if (isPipelinedAnalysisEnabled(pConfig)) {
+        modeFlags |= AnalyzerModeFlags::Pipelined;
+    }
     return static_cast<AnalyzerModeFlags>(modeFlags);
 }
 
@@ -135,7 +155,7 @@ void AnalysisFeature::activate() {
 
 void AnalysisFeature::analyzeTracks(const QList<AnalyzerScheduledTrack>& tracks) {
     if (!m_pTrackAnalysisScheduler) {
-        const int numAnalyzerThreads = numberOfAnalyzerThreads();
+        const int numAnalyzerThreads = numberOfAnalyzerThreads(m_pConfig);
         kLogger.info()
                 << "Starting analysis using"
                 << numAnalyzerThreads
@@ -13,6 +13,107 @@ namespace {
 
 constexpr bool sDebug = false;
 
+// The value types and sort orders must match the sort expressions
+// of ColumnCache, see also ColumnCache::setColumns()
+std::vector<ColumnarTrackIndex::ColumnSpec> makeIndexColumnSpecs(
+        const ColumnCache& columnCache, int columnCount) {
+    using ValueType = ColumnarTrackIndex::ValueType;
+    using SortType = ColumnarTrackIndex::SortType;
+
+    const auto setValueType = [&](auto* pSpecs, ValueType valueType,
+                                      std::initializer_list<ColumnCache::Column> columns) {
+        for (const auto column : columns) {
+            const int index = columnCache.fieldIndex(column);
+            if (index >= 0 && index < columnCount) {
+                (*pSpecs)[index].valueType = valueType;
+            }
+        }
+    };
+    const auto setSortType = [&](auto* pSpecs, SortType sortType,
+                                     std::initializer_list<ColumnCache::Column> columns) {
+        for (const auto column : columns) {
+            const int index = columnCache.fieldIndex(column);
+            if (index >= 0 && index < columnCount) {
+                (*pSpecs)[index].sortType = sortType;
+            }
+        }
+    };
+
+    std::vector<ColumnarTrackIndex::ColumnSpec> specs(columnCount);
+    for (int i = 0; i < columnCount; ++i) {
+        specs[i].name = columnCache.columnNameForFieldIndex(i);
+    }
+    setValueType(&specs,
+            ValueType::String,
+            {ColumnCache::COLUMN_LIBRARYTABLE_ARTIST,
+                    ColumnCache::COLUMN_LIBRARYTABLE_TITLE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_ALBUM,
+                    ColumnCache::COLUMN_LIBRARYTABLE_ALBUMARTIST,
+                    ColumnCache::COLUMN_LIBRARYTABLE_YEAR,
+                    ColumnCache::COLUMN_LIBRARYTABLE_GENRE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COMPOSER,
+                    ColumnCache::COLUMN_LIBRARYTABLE_GROUPING,
+                    ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER,
+                    ColumnCache::COLUMN_LIBRARYTABLE_FILETYPE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COMMENT,
+                    ColumnCache::COLUMN_LIBRARYTABLE_KEY,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COVERART_LOCATION,
+                    ColumnCache::COLUMN_TRACKLOCATIONSTABLE_LOCATION});
+    setValueType(&specs,
+            ValueType::Double,
+            {ColumnCache::COLUMN_LIBRARYTABLE_DURATION,
+                    ColumnCache::COLUMN_LIBRARYTABLE_BPM,
+                    ColumnCache::COLUMN_LIBRARYTABLE_REPLAYGAIN});
+    setValueType(&specs,
+            ValueType::Integer,
+            {ColumnCache::COLUMN_LIBRARYTABLE_ID,
+                    ColumnCache::COLUMN_LIBRARYTABLE_BITRATE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_SAMPLERATE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_CHANNELS,
+                    ColumnCache::COLUMN_LIBRARYTABLE_MIXXXDELETED,
+                    ColumnCache::COLUMN_LIBRARYTABLE_HEADERPARSED,
+                    ColumnCache::COLUMN_LIBRARYTABLE_TIMESPLAYED,
+                    ColumnCache::COLUMN_LIBRARYTABLE_PLAYED,
+                    ColumnCache::COLUMN_LIBRARYTABLE_RATING,
+                    ColumnCache::COLUMN_LIBRARYTABLE_KEY_ID,
+                    ColumnCache::COLUMN_LIBRARYTABLE_BPM_LOCK,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COLOR,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COVERART_SOURCE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COVERART_TYPE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COVERART_COLOR,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COVERART_HASH,
+                    ColumnCache::COLUMN_TRACKLOCATIONSTABLE_FSDELETED});
+    setSortType(&specs,
+            SortType::NoCaseCollated,
+            {ColumnCache::COLUMN_LIBRARYTABLE_ARTIST,
+                    ColumnCache::COLUMN_LIBRARYTABLE_TITLE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_ALBUM,
+                    ColumnCache::COLUMN_LIBRARYTABLE_ALBUMARTIST,
+                    ColumnCache::COLUMN_LIBRARYTABLE_GENRE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COMPOSER,
+                    ColumnCache::COLUMN_LIBRARYTABLE_GROUPING,
+                    ColumnCache::COLUMN_LIBRARYTABLE_COMMENT});
+    setSortType(&specs,
+            SortType::NoCase,
+            {ColumnCache::COLUMN_LIBRARYTABLE_YEAR,
+                    ColumnCache::COLUMN_LIBRARYTABLE_FILETYPE,
+                    ColumnCache::COLUMN_TRACKLOCATIONSTABLE_LOCATION});
+    setSortType(&specs,
+            SortType::LeadingInteger,
+            {ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER,
+                    ColumnCache::COLUMN_LIBRARYTABLE_BITRATE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_SAMPLERATE,
+                    ColumnCache::COLUMN_LIBRARYTABLE_TIMESPLAYED});
+    const int keyColumn = columnCache.fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_KEY);
+    const int keyIdColumn = columnCache.fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_KEY_ID);
+    if (keyColumn >= 0 && keyColumn < columnCount &&
+            keyIdColumn >= 0 && keyIdColumn < columnCount) {
+        specs[keyColumn].sortType = SortType::Key;
+        specs[keyColumn].keyIdColumn = keyIdColumn;
+    }
+    return specs;
+}
+
 }  // namespace
 
 BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
@@ -30,6 +131,7 @@ BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
                   pTrackCollection, std::move(searchColumns))),
           m_bIndexBuilt(false),
           m_bIsCaching(isCaching),
+          m_trackIndex(makeIndexColumnSpecs(m_columnCache, m_columnCount)),
           m_database(pTrackCollection->database()) {
 }
 
@@ -77,7 +179,7 @@ void BaseTrackCache::slotTracksRemoved(const QSet<TrackId>& trackIds) {
         qDebug() << this << "slotTracksRemoved" << trackIds.size();
     }
     for (const auto& trackId : qAsConst(trackIds)) {
-        m_trackInfo.remove(trackId);
+        m_trackIndex.removeRow(trackId);
         m_dirtyTracks.remove(trackId);
     }
 }
@@ -99,7 +201,7 @@ void BaseTrackCache::slotTrackClean(TrackId trackId) {
 }
 
 bool BaseTrackCache::isCached(TrackId trackId) const {
-    return m_trackInfo.contains(trackId);
+    return m_trackIndex.contains(trackId);
 }
 
 void BaseTrackCache::ensureCached(TrackId trackId) {
@@ -200,13 +302,14 @@ bool BaseTrackCache::updateTrackInIndex(
 
     TrackId trackId = pTrack->getId();
     if (trackId.isValid()) {
-        // m_trackInfo[id] will insert a QVector<QVariant> into the
-        // m_trackInfo HashTable with the key "id"
-        QVector<QVariant>& record = m_trackInfo[trackId];
-        // preallocate memory for all columns at once
-        record.resize(numColumns);
+        const int row = m_trackIndex.insertRow(trackId);
         for (int i = 0; i < numColumns; ++i) {
-            getTrackValueForColumn(pTrack, i, record[i]);
+            QVariant trackValue;
+            getTrackValueForColumn(pTrack, i, trackValue);
+            // Columns that are not provided by the track are kept
+            if (trackValue.isValid()) {
+                m_trackIndex.setValue(row, i, trackValue);
+            }
         }
         if (m_bIsCaching) {
             replaceRecentTrack(std::move(trackId), pTrack);
@@ -244,23 +347,20 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
 
     int numColumns = columnCount();
     int idColumn = query.record().indexOf(m_idColumn);
+    const int locationColumn = fieldIndex(ColumnCache::COLUMN_TRACKLOCATIONSTABLE_LOCATION);
 
     while (query.next()) {
         TrackId trackId(query.value(idColumn));
-
-        //m_trackInfo[id] will insert a QVector<QVariant> into the
-        //m_trackInfo HashTable with the key "id"
-        QVector<QVariant>& record = m_trackInfo[trackId];
-        record.resize(numColumns);
+        const int row = m_trackIndex.insertRow(trackId);
 
         for (int i = 0; i < numColumns; ++i) {
-            if (fieldIndex(ColumnCache::COLUMN_TRACKLOCATIONSTABLE_LOCATION) == i) {
+            if (locationColumn == i) {
                 // Database stores all locations with Qt separators: "/"
                 // Here we want to cache the display string with native separators.
                 QString location = query.value(i).toString();
-                record[i] = QDir::toNativeSeparators(location);
+                m_trackIndex.setValue(row, i, QDir::toNativeSeparators(location));
             } else {
-                record[i] = query.value(i);
+                m_trackIndex.setValue(row, i, query.value(i));
             }
         }
     }
@@ -284,7 +384,7 @@ void BaseTrackCache::buildIndex() {
     // TODO(rryan) for very large tables, it probably makes more sense to NOT
     // clear the table, and keep track of what IDs we see, then delete the ones
     // we don't see.
-    m_trackInfo.clear();
+    m_trackIndex.clear();
 
     if (!updateIndexWithQuery(queryString)) {
         qDebug() << "buildIndex failed!";
@@ -427,10 +527,9 @@ QVariant BaseTrackCache::data(TrackId trackId, int column) const {
     // metadata. Currently the upper-levels will not delegate row-specific
     // columns to this method, but there should still be a check here I think.
     if (!result.isValid()) {
-        auto it = m_trackInfo.constFind(trackId);
-        if (it != m_trackInfo.constEnd()) {
-            const QVector<QVariant>& fields = it.value();
-            result = fields.value(column, result);
+        const int row = m_trackIndex.row(trackId);
+        if (row >= 0 && column >= 0 && column < m_trackIndex.columnCount()) {
+            result = m_trackIndex.value(row, column);
         }
     }
     return result;
@@ -452,71 +551,37 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         buildIndex();
     }
 
-    QStringList idStrings;
     // TODO(rryan) consider making this the data passed in and a separate
     // QVector for output
     QSet<TrackId> dirtyTracks;
     for (const auto& trackId: trackIds) {
-        idStrings << trackId.toString();
         if (m_dirtyTracks.contains(trackId)) {
             dirtyTracks.insert(trackId);
         }
     }
 
-    QStringList queryFragments;
+    QString filter;
     if (!extraFilter.isNull() && extraFilter != "") {
-        queryFragments << QString("(%1)").arg(extraFilter);
-    }
-    if (idStrings.size() > 0) {
-        queryFragments << QString("%1 in (%2)")
-                .arg(m_idColumn, idStrings.join(","));
+        filter = QString("(%1)").arg(extraFilter);
     }
 
     const std::unique_ptr<QueryNode> pQuery =
-            m_pQueryParser->parseQuery(
-                    searchQuery,
-                    queryFragments.join(" AND "));
-
-    QString filter = pQuery->toSql();
-    if (!filter.isEmpty()) {
-        filter.prepend("WHERE ");
-    }
-
-    QString queryString = QString("SELECT %1 FROM %2 %3 %4")
-            .arg(m_idColumn, m_tableName, filter, orderByClause);
-
-    if (sDebug) {
-        qDebug() << this << "select() executing:" << queryString;
-    }
-
-    QSqlQuery query(m_database);
-    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
-    // won't allocate a giant in-memory table that we won't use at all.
-    query.setForwardOnly(true);
-    query.prepare(queryString);
-
-    if (!query.exec()) {
-        LOG_FAILED_QUERY(query);
-    }
-
-    int idColumn = query.record().indexOf(m_idColumn);
-    int rows = query.size();
-
-    if (sDebug) {
-        qDebug() << "Rows returned:" << rows;
-    }
+            m_pQueryParser->parseQuery(searchQuery, filter);
 
     m_trackOrder.resize(0); // keeps allocated memory
-    trackToIndex->clear();
-    if (rows > 0) {
-        trackToIndex->reserve(rows);
-        m_trackOrder.reserve(rows);
+    if (!filterAndSortIndex(trackIds,
+                *pQuery,
+                orderByClause,
+                sortColumns,
+                columnOffset)) {
+        m_trackOrder.resize(0);
+        filterAndSortSql(trackIds, *pQuery, orderByClause);
     }
 
-    while (query.next()) {
-        TrackId trackId(query.value(idColumn));
-        (*trackToIndex)[trackId] = m_trackOrder.size();
-        m_trackOrder.append(trackId);
+    trackToIndex->clear();
+    trackToIndex->reserve(m_trackOrder.size());
+    for (int i = 0; i < m_trackOrder.size(); ++i) {
+        (*trackToIndex)[m_trackOrder[i]] = i;
     }
 
     // At this point, the original set of tracks have been divided into two
@@ -594,6 +659,113 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
     }
 }
 
+bool BaseTrackCache::filterAndSortIndex(const QSet<TrackId>& trackIds,
+        const QueryNode& query,
+        const QString& orderByClause,
+        const QList<SortColumn>& sortColumns,
+        const int columnOffset) {
+    if (!query.canMatchIndex()) {
+        return false;
+    }
+
+    std::vector<ColumnarTrackIndex::SortKey> sortKeys;
+    // Without an ORDER BY clause only the matching tracks are needed
+    if (!orderByClause.isEmpty()) {
+        if (orderByClause.contains(QStringLiteral("RANDOM()"))) {
+            return false;
+        }
+        // Same mapping of the sort columns as in BaseSqlTableModel::setSort()
+        for (const auto& sc : sortColumns) {
+            int column;
+            if (sc.m_column > columnOffset) {
+                column = sc.m_column - columnOffset;
+            } else if (sc.m_column == 0) {
+                // The id column
+                column = 0;
+            } else {
+                continue;
+            }
+            VERIFY_OR_DEBUG_ASSERT(column < m_trackIndex.columnCount()) {
+                return false;
+            }
+            sortKeys.push_back({column, sc.m_order});
+        }
+        m_trackIndex.setKeyNotation(m_columnCache.keyNotation());
+    }
+
+    std::vector<int> rows;
+    rows.reserve(trackIds.size());
+    for (const auto& trackId : trackIds) {
+        const int row = m_trackIndex.row(trackId);
+        if (row < 0) {
+            // Tracks that are not cached are only known by the database,
+            // e.g. hidden tracks
+            return false;
+        }
+        if (query.match(m_trackIndex, row)) {
+            rows.push_back(row);
+        }
+    }
+    m_trackIndex.sortRows(&rows, sortKeys);
+
+    m_trackOrder.reserve(static_cast<int>(rows.size()));
+    for (const int row : rows) {
+        m_trackOrder.append(m_trackIndex.trackId(row));
+    }
+
+    if (sDebug) {
+        qDebug() << this << "filterAndSortIndex() matched" << m_trackOrder.size() << "tracks";
+    }
+    return true;
+}
+
+void BaseTrackCache::filterAndSortSql(const QSet<TrackId>& trackIds,
+        const QueryNode& query,
+        const QString& orderByClause) {
+    QStringList idStrings;
+    for (const auto& trackId : trackIds) {
+        idStrings << trackId.toString();
+    }
+
+    QString filter = QString("%1 in (%2)").arg(m_idColumn, idStrings.join(","));
+    const QString querySql = query.toSql();
+    if (!querySql.isEmpty()) {
+        filter = QString("(%1) AND (%2)").arg(filter, querySql);
+    }
+
+    QString queryString = QString("SELECT %1 FROM %2 WHERE %3 %4")
+            .arg(m_idColumn, m_tableName, filter, orderByClause);
+
+    if (sDebug) {
+        qDebug() << this << "select() executing:" << queryString;
+    }
+
+    QSqlQuery sqlQuery(m_database);
+    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
+    // won't allocate a giant in-memory table that we won't use at all.
+    sqlQuery.setForwardOnly(true);
+    sqlQuery.prepare(queryString);
+
+    if (!sqlQuery.exec()) {
+        LOG_FAILED_QUERY(sqlQuery);
+    }
+
+    int idColumn = sqlQuery.record().indexOf(m_idColumn);
+    int rows = sqlQuery.size();
+
+    if (sDebug) {
+        qDebug() << "Rows returned:" << rows;
+    }
+
+    if (rows > 0) {
+        m_trackOrder.reserve(rows);
+    }
+
+    while (sqlQuery.next()) {
+        m_trackOrder.append(TrackId(sqlQuery.value(idColumn)));
+    }
+}
+
 int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
         const QList<SortColumn>& sortColumns,
         const int columnOffset,
@@ -624,7 +796,7 @@ int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
 
         // This should not happen, but it's a recoverable error so we should
         // only log it.
-        if (!m_trackInfo.contains(otherTrackId)) {
+        if (!m_trackIndex.contains(otherTrackId)) {
             qDebug() << "WARNING: track" << otherTrackId << "was not in index";
             //updateTrackInIndex(otherTrackId);
         }
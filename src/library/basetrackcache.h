@@ -10,12 +10,14 @@
 #include <QVector>
 #include <memory>
 
+#include "library/columnartrackindex.h"
 #include "library/columncache.h"
 #include "track/track_decl.h"
 #include "track/trackid.h"
 #include "util/class.h"
 #include "util/string.h"
 
+class QueryNode;
 class SearchQueryParser;
 class TrackCollection;
 
@@ -99,6 +101,17 @@ class BaseTrackCache : public QObject {
     void getTrackValueForColumn(TrackPointer pTrack, int column,
                                 QVariant& trackValue) const;
 
+    // Evaluates the query on the in-memory index. Fails if the query
+    // contains SQL expressions or if some tracks are not cached.
+    bool filterAndSortIndex(const QSet<TrackId>& trackIds,
+            const QueryNode& query,
+            const QString& orderByClause,
+            const QList<SortColumn>& sortColumns,
+            const int columnOffset);
+    void filterAndSortSql(const QSet<TrackId>& trackIds,
+            const QueryNode& query,
+            const QString& orderByClause);
+
     int findSortInsertionPoint(TrackPointer pTrack,
                                const QList<SortColumn>& sortColumns,
                                const int columnOffset,
@@ -144,7 +157,7 @@ class BaseTrackCache : public QObject {
 
     bool m_bIndexBuilt;
     bool m_bIsCaching;
-    QHash<TrackId, QVector<QVariant>> m_trackInfo;
+    ColumnarTrackIndex m_trackIndex;
     QSqlDatabase m_database;
 
     DISALLOW_COPY_AND_ASSIGN(BaseTrackCache);
@@ -0,0 +1,599 @@
+#include "library/columnartrackindex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+
+#include "util/assert.h"
+#include "util/db/dbconnection.h"
+
+namespace {
+
+constexpr qlonglong kNullInteger = std::numeric_limits<qlonglong>::min();
+
+// The storage classes of SQLite in sort order
+enum class ValueClass {
+    Null,
+    Numeric,
+    Text,
+    Blob,
+};
+
+template<typename T>
+int compareValues(T lhs, T rhs) {
+    if (lhs < rhs) {
+        return -1;
+    }
+    if (rhs < lhs) {
+        return 1;
+    }
+    return 0;
+}
+
+// The built-in lower() of SQLite only converts ASCII characters
+QString asciiLower(QString string) {
+    QChar* pChar = string.data();
+    for (int i = 0; i < string.size(); ++i) {
+        const char16_t c = pChar[i].unicode();
+        if (c >= u'A' && c <= u'Z') {
+            pChar[i] = QChar(static_cast<char16_t>(c + (u'a' - u'A')));
+        }
+    }
+    return string;
+}
+
+// Mimics cast(%1 as integer) that parses the longest integer prefix
+// and evaluates to 0 if there is none
+qlonglong leadingInteger(const QString& string) {
+    int i = 0;
+    while (i < string.size() && string[i].isSpace()) {
+        ++i;
+    }
+    bool negative = false;
+    if (i < string.size() &&
+            (string[i].unicode() == u'-' || string[i].unicode() == u'+')) {
+        negative = string[i].unicode() == u'-';
+        ++i;
+    }
+    qlonglong result = 0;
+    while (i < string.size() && string[i].isDigit() && string[i].unicode() <= u'9') {
+        result = result * 10 + (string[i].unicode() - u'0');
+        ++i;
+    }
+    return negative ? -result : result;
+}
+
+constexpr int kTrigramLength = 3;
+
+quint64 trigramKey(const QChar* pChars) {
+    return (static_cast<quint64>(pChars[0].unicode()) << 32) |
+            (static_cast<quint64>(pChars[1].unicode()) << 16) |
+            static_cast<quint64>(pChars[2].unicode());
+}
+
+ValueClass classOfVariant(const QVariant& value) {
+    if (value.isNull()) {
+        return ValueClass::Null;
+    }
+    switch (value.userType()) {
+    case QMetaType::Bool:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Float:
+    case QMetaType::Double:
+        return ValueClass::Numeric;
+    case QMetaType::QByteArray:
+        return ValueClass::Blob;
+    default:
+        return ValueClass::Text;
+    }
+}
+
+} // anonymous namespace
+
+ColumnarTrackIndex::ColumnarTrackIndex(std::vector<ColumnSpec> columns)
+        : m_keyNotation(KeyUtils::KeyNotation::Custom) {
+    m_columns.resize(columns.size());
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        m_columnIndexByName.insert(columns[i].name, static_cast<int>(i));
+        m_columns[i].spec = std::move(columns[i]);
+    }
+    for (const auto& column : m_columns) {
+        if (column.spec.sortType == SortType::Key) {
+            VERIFY_OR_DEBUG_ASSERT(column.spec.keyIdColumn >= 0 &&
+                    column.spec.keyIdColumn < columnCount()) {
+                continue;
+            }
+            m_columns[column.spec.keyIdColumn].isKeyIdColumn = true;
+        }
+    }
+    clear();
+}
+
+void ColumnarTrackIndex::clear() {
+    for (auto& column : m_columns) {
+        column.stringIds.clear();
+        column.doubles.clear();
+        column.integers.clear();
+        column.variants.clear();
+    }
+    m_trackIds.clear();
+    m_rowByTrackId.clear();
+    m_strings.assign(1, QString());
+    m_latinLowStrings.assign(1, QString());
+    m_stringIds.clear();
+    m_stringIdsByTrigram.clear();
+    m_collatorSortKeys.clear();
+    invalidateSortRanks();
+}
+
+int ColumnarTrackIndex::insertRow(TrackId trackId) {
+    DEBUG_ASSERT(trackId.isValid());
+    const auto it = m_rowByTrackId.constFind(trackId);
+    if (it != m_rowByTrackId.constEnd()) {
+        return it.value();
+    }
+    const int row = rowCount();
+    m_trackIds.push_back(trackId);
+    m_rowByTrackId.insert(trackId, row);
+    for (auto& column : m_columns) {
+        switch (column.spec.valueType) {
+        case ValueType::String:
+            column.stringIds.push_back(0);
+            break;
+        case ValueType::Double:
+            column.doubles.push_back(std::numeric_limits<double>::quiet_NaN());
+            break;
+        case ValueType::Integer:
+            column.integers.push_back(kNullInteger);
+            break;
+        case ValueType::Variant:
+            column.variants.push_back(column.nullValue);
+            break;
+        }
+    }
+    invalidateSortRanks();
+    return row;
+}
+
+bool ColumnarTrackIndex::removeRow(TrackId trackId) {
+    const auto it = m_rowByTrackId.find(trackId);
+    if (it == m_rowByTrackId.end()) {
+        return false;
+    }
+    const int row = it.value();
+    m_rowByTrackId.erase(it);
+    const int lastRow = rowCount() - 1;
+    if (row != lastRow) {
+        m_trackIds[row] = m_trackIds[lastRow];
+        m_rowByTrackId[m_trackIds[row]] = row;
+    }
+    m_trackIds.pop_back();
+    for (auto& column : m_columns) {
+        switch (column.spec.valueType) {
+        case ValueType::String:
+            column.stringIds[row] = column.stringIds[lastRow];
+            column.stringIds.pop_back();
+            break;
+        case ValueType::Double:
+            column.doubles[row] = column.doubles[lastRow];
+            column.doubles.pop_back();
+            break;
+        case ValueType::Integer:
+            column.integers[row] = column.integers[lastRow];
+            column.integers.pop_back();
+            break;
+        case ValueType::Variant:
+            column.variants[row] = std::move(column.variants[lastRow]);
+            column.variants.pop_back();
+            break;
+        }
+    }
+    invalidateSortRanks();
+    return true;
+}
+
+quint32 ColumnarTrackIndex::internString(const QString& string) {
+    const auto it = m_stringIds.constFind(string);
+    if (it != m_stringIds.constEnd()) {
+        return it.value();
+    }
+    const auto stringId = static_cast<quint32>(m_strings.size());
+    m_strings.push_back(string);
+    QString latinLow = string;
+    mixxx::DbConnection::makeStringLatinLow(&latinLow);
+    m_latinLowStrings.push_back(std::move(latinLow));
+    m_stringIds.insert(string, stringId);
+    addTrigrams(stringId);
+    return stringId;
+}
+
+void ColumnarTrackIndex::addTrigrams(quint32 stringId) {
+    const QString& latinLow = m_latinLowStrings[stringId];
+    for (int i = 0; i + kTrigramLength <= latinLow.size(); ++i) {
+        auto& stringIds = m_stringIdsByTrigram[trigramKey(latinLow.constData() + i)];
+        // Strings are added in ascending order and may contain the
+        // same trigram more than once
+        if (stringIds.empty() || stringIds.back() != stringId) {
+            stringIds.push_back(stringId);
+        }
+    }
+}
+
+std::vector<bool> ColumnarTrackIndex::findStrings(const QString& latinLowPattern) const {
+    std::vector<bool> found(m_latinLowStrings.size(), false);
+    if (latinLowPattern.size() < kTrigramLength) {
+        // Too short for the trigram index, but still cheaper than
+        // checking each row
+        for (std::size_t stringId = 1; stringId < m_latinLowStrings.size(); ++stringId) {
+            found[stringId] = m_latinLowStrings[stringId].contains(latinLowPattern);
+        }
+        return found;
+    }
+
+    std::vector<const std::vector<quint32>*> postings;
+    for (int i = 0; i + kTrigramLength <= latinLowPattern.size(); ++i) {
+        const auto it = m_stringIdsByTrigram.constFind(
+                trigramKey(latinLowPattern.constData() + i));
+        if (it == m_stringIdsByTrigram.constEnd()) {
+            return found;
+        }
+        postings.push_back(&it.value());
+    }
+    // Repeated trigrams
+    std::sort(postings.begin(), postings.end(), std::less<>());
+    postings.erase(std::unique(postings.begin(), postings.end()), postings.end());
+    std::sort(postings.begin(), postings.end(), [](const auto* pLhs, const auto* pRhs) {
+        return pLhs->size() < pRhs->size();
+    });
+
+    // Intersect starting with the shortest list
+    std::vector<quint32> candidates = *postings.front();
+    for (std::size_t i = 1; i < postings.size() && !candidates.empty(); ++i) {
+        const auto& stringIds = *postings[i];
+        candidates.erase(
+                std::remove_if(candidates.begin(),
+                        candidates.end(),
+                        [&stringIds](quint32 stringId) {
+                            return !std::binary_search(
+                                    stringIds.begin(), stringIds.end(), stringId);
+                        }),
+                candidates.end());
+    }
+    // The trigrams might occur in a different order
+    for (const auto stringId : candidates) {
+        found[stringId] = m_latinLowStrings[stringId].contains(latinLowPattern);
+    }
+    return found;
+}
+
+void ColumnarTrackIndex::setValue(int row, int column, const QVariant& value) {
+    DEBUG_ASSERT(row >= 0 && row < rowCount());
+    DEBUG_ASSERT(column >= 0 && column < columnCount());
+    Column& col = m_columns[column];
+    const bool null = value.isNull();
+    if (null && !col.nullValue.isValid()) {
+        col.nullValue = value;
+    }
+    switch (col.spec.valueType) {
+    case ValueType::String:
+        col.stringIds[row] = null ? 0 : internString(value.toString());
+        break;
+    case ValueType::Double:
+        col.doubles[row] = null
+                ? std::numeric_limits<double>::quiet_NaN()
+                : value.toDouble();
+        break;
+    case ValueType::Integer:
+        col.integers[row] = null ? kNullInteger : value.toLongLong();
+        break;
+    case ValueType::Variant:
+        col.variants[row] = value;
+        break;
+    }
+    col.sortRanksValid = false;
+    if (col.isKeyIdColumn) {
+        for (auto& keyColumn : m_columns) {
+            if (keyColumn.spec.keyIdColumn == column) {
+                keyColumn.sortRanksValid = false;
+            }
+        }
+    }
+}
+
+QVariant ColumnarTrackIndex::value(int row, int column) const {
+    DEBUG_ASSERT(row >= 0 && row < rowCount());
+    DEBUG_ASSERT(column >= 0 && column < columnCount());
+    const Column& col = m_columns[column];
+    switch (col.spec.valueType) {
+    case ValueType::String: {
+        const quint32 stringId = col.stringIds[row];
+        if (stringId == 0) {
+            return col.nullValue;
+        }
+        return m_strings[stringId];
+    }
+    case ValueType::Double: {
+        const double value = col.doubles[row];
+        if (std::isnan(value)) {
+            return col.nullValue;
+        }
+        return value;
+    }
+    case ValueType::Integer: {
+        const qlonglong value = col.integers[row];
+        if (value == kNullInteger) {
+            return col.nullValue;
+        }
+        return value;
+    }
+    case ValueType::Variant:
+        return col.variants[row];
+    }
+    return QVariant();
+}
+
+bool ColumnarTrackIndex::isNull(int row, int column) const {
+    const Column& col = m_columns[column];
+    switch (col.spec.valueType) {
+    case ValueType::String:
+        return col.stringIds[row] == 0;
+    case ValueType::Double:
+        return std::isnan(col.doubles[row]);
+    case ValueType::Integer:
+        return col.integers[row] == kNullInteger;
+    case ValueType::Variant:
+        return col.variants[row].isNull();
+    }
+    return true;
+}
+
+double ColumnarTrackIndex::numericValue(int row, int column) const {
+    const Column& col = m_columns[column];
+    switch (col.spec.valueType) {
+    case ValueType::Double:
+        return col.doubles[row];
+    case ValueType::Integer: {
+        const qlonglong value = col.integers[row];
+        if (value == kNullInteger) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return static_cast<double>(value);
+    }
+    case ValueType::String:
+    case ValueType::Variant:
+        if (isNull(row, column)) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return value(row, column).toDouble();
+    }
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+QString ColumnarTrackIndex::latinLowString(int row, int column) const {
+    const Column& col = m_columns[column];
+    if (col.spec.valueType == ValueType::String) {
+        return m_latinLowStrings[col.stringIds[row]];
+    }
+    if (isNull(row, column)) {
+        return QString();
+    }
+    QString string = value(row, column).toString();
+    mixxx::DbConnection::makeStringLatinLow(&string);
+    return string;
+}
+
+void ColumnarTrackIndex::setKeyNotation(KeyUtils::KeyNotation keyNotation) {
+    if (m_keyNotation == keyNotation) {
+        return;
+    }
+    m_keyNotation = keyNotation;
+    for (auto& column : m_columns) {
+        if (column.spec.sortType == SortType::Key) {
+            column.sortRanksValid = false;
+        }
+    }
+}
+
+void ColumnarTrackIndex::invalidateSortRanks() {
+    for (auto& column : m_columns) {
+        column.sortRanksValid = false;
+    }
+}
+
+const QCollatorSortKey& ColumnarTrackIndex::collatorSortKey(quint32 stringId) const {
+    // Resized in advance, because the returned references must stay valid
+    DEBUG_ASSERT(stringId < m_collatorSortKeys.size());
+    auto& sortKey = m_collatorSortKeys[stringId];
+    if (!sortKey) {
+        sortKey = m_collator.sortKey(m_strings[stringId]);
+    }
+    return *sortKey;
+}
+
+void ColumnarTrackIndex::computeStringSortRanks(const Column& column) const {
+    // Sort the distinct strings instead of all rows. Artists, albums and
+    // genres are repeated a lot.
+    std::vector<quint32> stringIds = column.stringIds;
+    std::sort(stringIds.begin(), stringIds.end());
+    stringIds.erase(std::unique(stringIds.begin(), stringIds.end()), stringIds.end());
+
+    // Comparing the precomputed values is much cheaper than converting
+    // them in each comparison
+    std::vector<QString> lowerStrings;
+    std::vector<qlonglong> integers;
+    if (column.spec.sortType == SortType::NoCase) {
+        lowerStrings.resize(m_strings.size());
+        for (const auto stringId : stringIds) {
+            lowerStrings[stringId] = asciiLower(m_strings[stringId]);
+        }
+    } else if (column.spec.sortType == SortType::NoCaseCollated) {
+        m_collatorSortKeys.resize(m_strings.size());
+    } else if (column.spec.sortType == SortType::LeadingInteger) {
+        integers.resize(m_strings.size());
+        for (const auto stringId : stringIds) {
+            integers[stringId] = leadingInteger(m_strings[stringId]);
+        }
+    }
+    const auto compareStrings = [&](quint32 lhs, quint32 rhs) {
+        // NULL first
+        if (lhs == 0 || rhs == 0) {
+            return compareValues(lhs != 0, rhs != 0);
+        }
+        switch (column.spec.sortType) {
+        case SortType::NoCase:
+            return lowerStrings[lhs].compare(lowerStrings[rhs]);
+        case SortType::NoCaseCollated:
+            return collatorSortKey(lhs).compare(collatorSortKey(rhs));
+        case SortType::LeadingInteger:
+            return compareValues(integers[lhs], integers[rhs]);
+        case SortType::Value:
+        case SortType::Key:
+            break;
+        }
+        return m_strings[lhs].compare(m_strings[rhs]);
+    };
+    std::sort(stringIds.begin(), stringIds.end(), [&](quint32 lhs, quint32 rhs) {
+        return compareStrings(lhs, rhs) < 0;
+    });
+
+    std::vector<int> rankByStringId(m_strings.size(), 0);
+    int rank = 0;
+    for (std::size_t i = 0; i < stringIds.size(); ++i) {
+        if (i > 0 && compareStrings(stringIds[i - 1], stringIds[i]) != 0) {
+            ++rank;
+        }
+        rankByStringId[stringIds[i]] = rank;
+    }
+    column.sortRanks.resize(column.stringIds.size());
+    for (std::size_t row = 0; row < column.stringIds.size(); ++row) {
+        column.sortRanks[row] = rankByStringId[column.stringIds[row]];
+    }
+}
+
+const std::vector<int>& ColumnarTrackIndex::sortRanks(int column) const {
+    const Column& col = m_columns[column];
+    if (col.sortRanksValid) {
+        return col.sortRanks;
+    }
+    if (col.spec.valueType == ValueType::String &&
+            col.spec.sortType != SortType::Key) {
+        computeStringSortRanks(col);
+        col.sortRanksValid = true;
+        return col.sortRanks;
+    }
+
+    std::vector<double> numbers;
+    if (col.spec.sortType == SortType::Key) {
+        // CASE key_id WHEN 0 THEN ... END evaluates to NULL for all
+        // other values
+        const int keyIdColumn = col.spec.keyIdColumn;
+        numbers.assign(rowCount(), std::numeric_limits<double>::quiet_NaN());
+        VERIFY_OR_DEBUG_ASSERT(keyIdColumn >= 0 && keyIdColumn < columnCount()) {
+            col.sortRanks.assign(rowCount(), 0);
+            col.sortRanksValid = true;
+            return col.sortRanks;
+        }
+        for (int row = 0; row < rowCount(); ++row) {
+            const double keyId = numericValue(row, keyIdColumn);
+            if (keyId >= 0 && keyId <= 24) {
+                numbers[row] = KeyUtils::keyToCircleOfFifthsOrder(
+                        static_cast<mixxx::track::io::key::ChromaticKey>(
+                                static_cast<int>(keyId)),
+                        m_keyNotation);
+            }
+        }
+    } else if (col.spec.valueType != ValueType::Variant) {
+        numbers.resize(rowCount());
+        for (int row = 0; row < rowCount(); ++row) {
+            numbers[row] = numericValue(row, column);
+        }
+    }
+    // Text and blobs are only expected in variant columns
+    const auto compareRows = [&](int lhs, int rhs) {
+        if (!numbers.empty()) {
+            const bool lhsNull = std::isnan(numbers[lhs]);
+            const bool rhsNull = std::isnan(numbers[rhs]);
+            if (lhsNull || rhsNull) {
+                return compareValues(!lhsNull, !rhsNull);
+            }
+            return compareValues(numbers[lhs], numbers[rhs]);
+        }
+        const QVariant& lhsValue = col.variants[lhs];
+        const QVariant& rhsValue = col.variants[rhs];
+        const ValueClass lhsClass = classOfVariant(lhsValue);
+        const ValueClass rhsClass = classOfVariant(rhsValue);
+        if (lhsClass != rhsClass) {
+            return compareValues(lhsClass, rhsClass);
+        }
+        switch (lhsClass) {
+        case ValueClass::Null:
+            return 0;
+        case ValueClass::Numeric:
+            return compareValues(lhsValue.toDouble(), rhsValue.toDouble());
+        case ValueClass::Blob:
+            return compareValues(lhsValue.toByteArray(), rhsValue.toByteArray());
+        case ValueClass::Text:
+            break;
+        }
+        switch (col.spec.sortType) {
+        case SortType::NoCase:
+            return asciiLower(lhsValue.toString()).compare(asciiLower(rhsValue.toString()));
+        case SortType::NoCaseCollated:
+            return m_collator.compare(lhsValue.toString(), rhsValue.toString());
+        case SortType::LeadingInteger:
+            return compareValues(leadingInteger(lhsValue.toString()),
+                    leadingInteger(rhsValue.toString()));
+        case SortType::Value:
+        case SortType::Key:
+            break;
+        }
+        return lhsValue.toString().compare(rhsValue.toString());
+    };
+
+    std::vector<int> rows(rowCount());
+    std::iota(rows.begin(), rows.end(), 0);
+    std::sort(rows.begin(), rows.end(), [&](int lhs, int rhs) {
+        return compareRows(lhs, rhs) < 0;
+    });
+    col.sortRanks.resize(rowCount());
+    int rank = 0;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        if (i > 0 && compareRows(rows[i - 1], rows[i]) != 0) {
+            ++rank;
+        }
+        col.sortRanks[rows[i]] = rank;
+    }
+    col.sortRanksValid = true;
+    return col.sortRanks;
+}
+
+void ColumnarTrackIndex::sortRows(
+        std::vector<int>* pRows,
+        const std::vector<SortKey>& sortKeys) const {
+    DEBUG_ASSERT(pRows);
+    if (sortKeys.empty()) {
+        return;
+    }
+    std::vector<const std::vector<int>*> ranks;
+    ranks.reserve(sortKeys.size());
+    for (const auto& sortKey : sortKeys) {
+        ranks.push_back(&sortRanks(sortKey.column));
+    }
+    std::sort(pRows->begin(), pRows->end(), [&](int lhs, int rhs) {
+        for (std::size_t i = 0; i < sortKeys.size(); ++i) {
+            const int lhsRank = (*ranks[i])[lhs];
+            const int rhsRank = (*ranks[i])[rhs];
+            if (lhsRank != rhsRank) {
+                return (sortKeys[i].order == Qt::AscendingOrder)
+                        ? lhsRank < rhsRank
+                        : lhsRank > rhsRank;
+            }
+        }
+        return m_trackIds[lhs] < m_trackIds[rhs];
+    });
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <QCollator>
+#include <QHash>
+#include <QString>
+#include <QVariant>
+#include <optional>
+#include <vector>
+
+#include "track/keyutils.h"
+#include "track/trackid.h"
+#include "util/class.h"
+#include "util/string.h"
+
+// ColumnarTrackIndex stores the rows of a BaseTrackCache column by column
+// in typed arrays instead of a QVector<QVariant> per track. Strings are
+// interned and stored together with their lowercase form for searching.
+//
+// All strings are also added to a trigram index. A substring search then
+// only needs to check the strings that contain all trigrams of the search
+// term instead of every row.
+//
+// The sort order of each column is computed lazily as a rank per row and
+// cached until the next modification. Sorting the rows of a query result
+// then only needs to compare integers instead of QVariants.
+//
+// The comparisons follow the SQL expressions of ColumnCache, i.e. the
+// results are ordered as if the rows were sorted by the database.
+class ColumnarTrackIndex {
+  public:
+    enum class ValueType {
+        // Interned QString
+        String,
+        // double, NaN for NULL
+        Double,
+        // qlonglong
+        Integer,
+        // Everything else is stored as a QVariant
+        Variant,
+    };
+
+    enum class SortType {
+        // NULL < numbers < strings < blobs, strings are compared binary
+        Value,
+        // lower(%1)
+        NoCase,
+        // lower(%1) with the lexicographical collation
+        NoCaseCollated,
+        // cast(%1 as integer)
+        LeadingInteger,
+        // Circle of fifths order of the key ids in keyIdColumn
+        Key,
+    };
+
+    struct ColumnSpec {
+        QString name;
+        ValueType valueType = ValueType::Variant;
+        SortType sortType = SortType::Value;
+        int keyIdColumn = -1;
+    };
+
+    struct SortKey {
+        int column;
+        Qt::SortOrder order;
+    };
+
+    explicit ColumnarTrackIndex(std::vector<ColumnSpec> columns);
+
+    int columnCount() const {
+        return static_cast<int>(m_columns.size());
+    }
+
+    int rowCount() const {
+        return static_cast<int>(m_trackIds.size());
+    }
+
+    // Returns -1 for unknown column names
+    int columnIndex(const QString& name) const {
+        return m_columnIndexByName.value(name, -1);
+    }
+
+    // Returns -1 if the track is not contained in the index
+    int row(TrackId trackId) const {
+        return m_rowByTrackId.value(trackId, -1);
+    }
+
+    TrackId trackId(int row) const {
+        return m_trackIds[row];
+    }
+
+    bool contains(TrackId trackId) const {
+        return m_rowByTrackId.contains(trackId);
+    }
+
+    void clear();
+
+    // Returns the row of the track, a new row with NULL values is
+    // appended if the track is not contained yet.
+    int insertRow(TrackId trackId);
+    // The last row is moved into the place of the removed row
+    bool removeRow(TrackId trackId);
+
+    void setValue(int row, int column, const QVariant& value);
+
+    // Restores the QVariant as received from the database
+    QVariant value(int row, int column) const;
+    bool isNull(int row, int column) const;
+
+    // For numeric comparisons, returns NaN for NULL
+    double numericValue(int row, int column) const;
+    // The lowercase string for searching, see DbConnection::makeStringLatinLow()
+    QString latinLowString(int row, int column) const;
+
+    bool isStringColumn(int column) const {
+        return m_columns[column].spec.valueType == ValueType::String;
+    }
+    // Only for string columns, 0 for NULL
+    quint32 stringId(int row, int column) const {
+        DEBUG_ASSERT(isStringColumn(column));
+        return m_columns[column].stringIds[row];
+    }
+    // Returns a flag for each string id that is set if the lowercase
+    // string contains the lowercase pattern.
+    std::vector<bool> findStrings(const QString& latinLowPattern) const;
+
+    // Invalidates the cached sort order of the key column
+    void setKeyNotation(KeyUtils::KeyNotation keyNotation);
+
+    // Sorts the rows by the given columns. Rows that compare equal are
+    // ordered by their track id.
+    void sortRows(std::vector<int>* pRows, const std::vector<SortKey>& sortKeys) const;
+
+  private:
+    struct Column {
+        ColumnSpec spec;
+        std::vector<quint32> stringIds;
+        std::vector<double> doubles;
+        std::vector<qlonglong> integers;
+        std::vector<QVariant> variants;
+        // Null values have a type that depends on the database driver
+        QVariant nullValue;
+        // The sort order of the key column depends on this column
+        bool isKeyIdColumn = false;
+        // Lazily computed, equal values share the same rank
+        mutable std::vector<int> sortRanks;
+        mutable bool sortRanksValid = false;
+    };
+
+    quint32 internString(const QString& string);
+    void addTrigrams(quint32 stringId);
+    const QCollatorSortKey& collatorSortKey(quint32 stringId) const;
+
+    const std::vector<int>& sortRanks(int column) const;
+    void computeStringSortRanks(const Column& column) const;
+    void invalidateSortRanks();
+
+    std::vector<Column> m_columns;
+    QHash<QString, int> m_columnIndexByName;
+
+    std::vector<TrackId> m_trackIds;
+    QHash<TrackId, int> m_rowByTrackId;
+
+    // The id 0 is reserved for NULL
+    std::vector<QString> m_strings;
+    std::vector<QString> m_latinLowStrings;
+    QHash<QString, quint32> m_stringIds;
+    // The ids of all strings that contain a trigram in ascending order
+    QHash<quint64, std::vector<quint32>> m_stringIdsByTrigram;
+
+    const mixxx::StringCollator m_collator;
+    mutable std::vector<std::optional<QCollatorSortKey>> m_collatorSortKeys;
+
+    KeyUtils::KeyNotation m_keyNotation;
+
+    DISALLOW_COPY_AND_ASSIGN(ColumnarTrackIndex);
+};
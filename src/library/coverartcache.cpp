@@ -1,9 +1,17 @@
 #include "library/coverartcache.h"
 
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
 #include <QFutureWatcher>
+#include <QImageWriter>
 #include <QPixmapCache>
+#include <QSaveFile>
+#include <QThread>
 #include <QtConcurrentRun>
 #include <QtDebug>
+#include <algorithm>
+#include <vector>
 
 #include "library/coverartutils.h"
 #include "moc_coverartcache.cpp"
@@ -29,6 +37,16 @@ QString pixmapCacheKey(mixxx::cache_key_t hash, int width) {
             .arg(QString::number(hash), QString::number(width));
 }
 
+// Decoding covers is mostly I/O bound and the table view only needs the
+// covers of the visible rows
+constexpr int kMaxLoaderThreads = 4;
+
+// Thumbnails are stored as JPEG unless they have an alpha channel. A few
+// KB per cover are enough for a library with 50k tracks and multiple
+// column widths.
+constexpr int kThumbnailJpegQuality = 90;
+constexpr qint64 kMaxThumbnailCacheSizeBytes = 256 * 1024 * 1024;
+
 // The transformation mode when scaling images
 const Qt::TransformationMode kTransformationMode = Qt::SmoothTransformation;
 
@@ -39,8 +57,141 @@ inline QImage resizeImageWidth(const QImage& image, int width) {
 
 } // anonymous namespace
 
+// static
+QString CoverArtCache::s_thumbnailCacheDir;
+
 CoverArtCache::CoverArtCache() {
     QPixmapCache::setCacheLimit(kPixmapCacheLimit);
+    m_threadPool.setMaxThreadCount(
+            std::clamp(QThread::idealThreadCount(), 1, kMaxLoaderThreads));
+    if (!s_thumbnailCacheDir.isEmpty()) {
+        QtConcurrent::run(&m_threadPool,
+                &CoverArtCache::trimThumbnailCache,
+                kMaxThumbnailCacheSizeBytes);
+    }
+}
+
+CoverArtCache::~CoverArtCache() {
+    for (const auto& pCancelled : std::as_const(m_runningRequests)) {
+        *pCancelled = true;
+    }
+    // Wait for the running requests before their watchers are deleted
+    m_threadPool.waitForDone();
+}
+
+// static
+void CoverArtCache::setThumbnailCacheDir(const QString& cacheDir) {
+    s_thumbnailCacheDir = cacheDir;
+    if (!s_thumbnailCacheDir.isEmpty()) {
+        kLogger.debug() << "Caching thumbnails in" << s_thumbnailCacheDir;
+    }
+}
+
+// static
+QString CoverArtCache::thumbnailFilePath(mixxx::cache_key_t cacheKey, int width) {
+    if (s_thumbnailCacheDir.isEmpty()) {
+        return QString();
+    }
+    // Spread the files over 256 subdirectories to keep the directories small
+    return QDir(s_thumbnailCacheDir)
+            .filePath(QStringLiteral("%1/%2_%3")
+                              .arg(cacheKey & 0xff, 2, 16, QChar('0'))
+                              .arg(cacheKey, 16, 16, QChar('0'))
+                              .arg(width));
+}
+
+// static
+QImage CoverArtCache::loadThumbnail(const CoverInfo& coverInfo, int width) {
+    // Only covers with a digest are cached, the legacy hash is too short
+    // to identify an image reliably
+    if (width <= 0 || coverInfo.imageDigest().isEmpty()) {
+        return QImage();
+    }
+    const QString filePath = thumbnailFilePath(coverInfo.cacheKey(), width);
+    if (filePath.isEmpty()) {
+        return QImage();
+    }
+    // The format is detected from the contents
+    QImage image;
+    if (!image.load(filePath) || image.width() != width) {
+        return QImage();
+    }
+    return image;
+}
+
+// static
+void CoverArtCache::storeThumbnail(
+        const CoverInfo& coverInfo, int width, const QImage& image) {
+    if (width <= 0 || coverInfo.imageDigest().isEmpty() || image.isNull()) {
+        return;
+    }
+    const QString filePath = thumbnailFilePath(coverInfo.cacheKey(), width);
+    if (filePath.isEmpty()) {
+        return;
+    }
+    QDir().mkpath(QFileInfo(filePath).absolutePath());
+    // Write to a temporary file to never leave a partially written
+    // thumbnail behind
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        kLogger.warning() << "Failed to open thumbnail file" << filePath;
+        return;
+    }
+    QImageWriter writer(&file, image.hasAlphaChannel() ? "png" : "jpg");
+    writer.setQuality(image.hasAlphaChannel() ? -1 : kThumbnailJpegQuality);
+    if (!writer.write(image) || !file.commit()) {
+        kLogger.warning()
+                << "Failed to write thumbnail file"
+                << filePath
+                << writer.errorString();
+    }
+}
+
+// static
+void CoverArtCache::trimThumbnailCache(qint64 maxSizeBytes) {
+    if (s_thumbnailCacheDir.isEmpty()) {
+        return;
+    }
+    std::vector<QFileInfo> files;
+    qint64 totalSizeBytes = 0;
+    QDirIterator it(s_thumbnailCacheDir, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        it.next();
+        files.push_back(it.fileInfo());
+        totalSizeBytes += files.back().size();
+    }
+    if (totalSizeBytes <= maxSizeBytes) {
+        return;
+    }
+    std::sort(files.begin(),
+            files.end(),
+            [](const QFileInfo& lhs, const QFileInfo& rhs) {
+                return lhs.lastModified() < rhs.lastModified();
+            });
+    int numRemovedFiles = 0;
+    for (const auto& fileInfo : files) {
+        if (totalSizeBytes <= maxSizeBytes) {
+            break;
+        }
+        if (QFile::remove(fileInfo.filePath())) {
+            totalSizeBytes -= fileInfo.size();
+            ++numRemovedFiles;
+        }
+    }
+    kLogger.info()
+            << "Removed"
+            << numRemovedFiles
+            << "thumbnails from the cache";
+}
+
+void CoverArtCache::cancelRequests(const QObject* pRequester) {
+    for (auto it = m_runningRequests.constBegin();
+            it != m_runningRequests.constEnd();
+            ++it) {
+        if (it.key().first == pRequester) {
+            *it.value() = true;
+        }
+    }
 }
 
 //static
@@ -102,7 +253,9 @@ QPixmap CoverArtCache::tryLoadCover(
     // keep a list of trackIds for which a future is currently running
     // to avoid loading the same picture again while we are loading it
     QPair<const QObject*, mixxx::cache_key_t> requestId = qMakePair(pRequester, requestedCacheKey);
-    if (m_runningRequests.contains(requestId)) {
+    const auto runningRequest = m_runningRequests.constFind(requestId);
+    if (runningRequest != m_runningRequests.constEnd() && !*runningRequest.value()) {
+        // A cancelled request is replaced by a new one below
         return QPixmap();
     }
 
@@ -139,16 +292,19 @@ QPixmap CoverArtCache::tryLoadCover(
                 << "requestCover starting future for"
                 << coverInfo;
     }
-    m_runningRequests.insert(requestId);
+    const auto pCancelled = std::make_shared<std::atomic<bool>>(false);
+    m_runningRequests.insert(requestId, pCancelled);
     // The watcher will be deleted in coverLoaded()
     QFutureWatcher<FutureResult>* watcher = new QFutureWatcher<FutureResult>(this);
     QFuture<FutureResult> future = QtConcurrent::run(
+            &m_threadPool,
             &CoverArtCache::loadCover,
             pRequester,
             pTrack,
             coverInfo,
             desiredWidth,
-            loading == Loading::Default);
+            loading == Loading::Default,
+            pCancelled);
     connect(watcher,
             &QFutureWatcher<FutureResult>::finished,
             this,
@@ -163,7 +319,8 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
         TrackPointer pTrack,
         CoverInfo coverInfo,
         int desiredWidth,
-        bool signalWhenDone) {
+        bool signalWhenDone,
+        CancelFlag pCancelled) {
     if (kLogger.traceEnabled()) {
         kLogger.trace()
                 << "loadCover"
@@ -180,6 +337,25 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
             signalWhenDone);
     DEBUG_ASSERT(!res.coverInfoUpdated);
 
+    // Requests may wait in the queue of the thread pool until the rows
+    // have been scrolled out of view
+    if (pCancelled && *pCancelled) {
+        res.cancelled = true;
+        return res;
+    }
+
+    QImage thumbnail = loadThumbnail(coverInfo, desiredWidth);
+    if (!thumbnail.isNull()) {
+        CoverInfo::LoadedImage loadedImage(CoverInfo::LoadedImage::Result::Ok);
+        loadedImage.image = std::move(thumbnail);
+        loadedImage.location = thumbnailFilePath(coverInfo.cacheKey(), desiredWidth);
+        res.coverArt = CoverArt(
+                std::move(coverInfo),
+                std::move(loadedImage),
+                desiredWidth);
+        return res;
+    }
+
     auto loadedImage = coverInfo.loadImage(pTrack);
     if (!loadedImage.image.isNull()) {
         // Refresh hash before resizing the original image!
@@ -196,6 +372,7 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
             // Adjust the cover size according to the request
             // or downsize the image for efficiency.
             loadedImage.image = resizeImageWidth(loadedImage.image, desiredWidth);
+            storeThumbnail(coverInfo, desiredWidth, loadedImage.image);
         }
     }
 
@@ -219,6 +396,16 @@ void CoverArtCache::coverLoaded() {
         pFutureWatcher->deleteLater();
     }
 
+    const auto requestId = qMakePair(res.pRequester, res.requestedCacheKey);
+    if (res.cancelled) {
+        const auto it = m_runningRequests.find(requestId);
+        // Unless the cover has been requested again in the meantime
+        if (it != m_runningRequests.end() && *it.value()) {
+            m_runningRequests.erase(it);
+        }
+        return;
+    }
+
     if (kLogger.traceEnabled()) {
         kLogger.trace() << "coverLoaded" << res.coverArt;
     }
@@ -264,7 +451,7 @@ void CoverArtCache::coverLoaded() {
         }
     }
 
-    m_runningRequests.remove(qMakePair(res.pRequester, res.requestedCacheKey));
+    m_runningRequests.remove(requestId);
 
     if (res.signalWhenDone) {
         emit coverFound(
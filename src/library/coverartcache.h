@@ -3,8 +3,11 @@
 #include <QObject>
 #include <QPair>
 #include <QPixmap>
-#include <QSet>
+#include <QHash>
+#include <QThreadPool>
 #include <QtDebug>
+#include <atomic>
+#include <memory>
 
 #include "library/coverart.h"
 #include "track/track_decl.h"
@@ -52,13 +55,30 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
                 loading);
     }
 
+    /// Cancels the requests of pRequester that are still loading. No
+    /// coverFound signal is emitted for them and the requester has to
+    /// request the covers again if they are still needed, e.g. for rows
+    /// that are visible again after scrolling.
+    void cancelRequests(const QObject* pRequester);
+
+    /// Enables the persistent cache of resized covers in the given
+    /// directory, which avoids reopening audio files and rescaling the
+    /// original images after a restart. An empty path disables the cache.
+    /// Must be configured before any cover is requested.
+    static void setThumbnailCacheDir(const QString& cacheDir);
+
+    /// Deletes the oldest thumbnails until the cache does not exceed the
+    /// given size.
+    static void trimThumbnailCache(qint64 maxSizeBytes);
+
     // Only public for testing
     struct FutureResult {
         FutureResult()
                 : pRequester(nullptr),
                   requestedCacheKey(CoverImageUtils::defaultCacheKey()),
                   signalWhenDone(false),
-                  coverInfoUpdated(false) {
+                  coverInfoUpdated(false),
+                  cancelled(false) {
         }
         FutureResult(
                 const QObject* pRequestorArg,
@@ -67,7 +87,8 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
                 : pRequester(pRequestorArg),
                   requestedCacheKey(requestedCacheKeyArg),
                   signalWhenDone(signalWhenDoneArg),
-                  coverInfoUpdated(false) {
+                  coverInfoUpdated(false),
+                  cancelled(false) {
         }
 
         const QObject* pRequester;
@@ -76,7 +97,9 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
 
         CoverArt coverArt;
         bool coverInfoUpdated;
+        bool cancelled;
     };
+    using CancelFlag = std::shared_ptr<std::atomic<bool>>;
     // Load cover from path indicated in coverInfo. WARNING: This is run in a
     // worker thread.
     static FutureResult loadCover(
@@ -84,7 +107,11 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
             TrackPointer pTrack,
             CoverInfo coverInfo,
             int desiredWidth,
-            bool emitSignals);
+            bool emitSignals,
+            CancelFlag pCancelled = nullptr);
+
+    // Only public for testing
+    static QString thumbnailFilePath(mixxx::cache_key_t cacheKey, int width);
 
   private slots:
     // Called when loadCover is complete in the main thread.
@@ -100,7 +127,7 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
 
   protected:
     CoverArtCache();
-    ~CoverArtCache() override = default;
+    ~CoverArtCache() override;
     friend class Singleton<CoverArtCache>;
 
   private:
@@ -116,7 +143,18 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
             int desiredWidth,
             Loading loading);
 
-    QSet<QPair<const QObject*, mixxx::cache_key_t>> m_runningRequests;
+    static QImage loadThumbnail(const CoverInfo& coverInfo, int width);
+    static void storeThumbnail(
+            const CoverInfo& coverInfo, int width, const QImage& image);
+
+    static QString s_thumbnailCacheDir;
+
+    // Bounds the number of covers that are decoded concurrently, so that
+    // scrolling through the library does not occupy the global thread pool
+    QThreadPool m_threadPool;
+
+    // The cancellation flags of the requests that are currently running
+    QHash<QPair<const QObject*, mixxx::cache_key_t>, CancelFlag> m_runningRequests;
 };
 
 inline
@@ -62,7 +62,18 @@ void CoverArtDelegate::emitRowsChanged(
 void CoverArtDelegate::slotInhibitLazyLoading(
         bool inhibitLazyLoading) {
     m_inhibitLazyLoading = inhibitLazyLoading;
-    if (m_inhibitLazyLoading || m_cacheMissRows.isEmpty()) {
+    if (m_inhibitLazyLoading) {
+        // The rows of the pending requests are likely to be scrolled out
+        // of view. Only the rows that are still visible are repainted and
+        // requested again after scrolling.
+        if (m_pCache && !m_pendingCacheRows.isEmpty()) {
+            m_pCache->cancelRequests(this);
+            m_cacheMissRows.append(m_pendingCacheRows.values());
+            m_pendingCacheRows.clear();
+        }
+        return;
+    }
+    if (m_cacheMissRows.isEmpty()) {
         return;
     }
     // If we can request non-cache covers now, request updates
@@ -40,7 +40,8 @@ class CoverArtDelegate : public TableItemDelegate {
     // it is NOT desirable to start multiple expensive file
     // system operations in worker threads for loading and
     // scaling cover images that are not even displayed after
-    // scrolling beyond them.
+    // scrolling beyond them. Requests that are still pending
+    // are cancelled for the same reason.
     void slotInhibitLazyLoading(
             bool inhibitLazyLoading);
 
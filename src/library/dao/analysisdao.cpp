@@ -1,3 +1,4 @@
+#include <QSaveFile>
 #include <QSqlQuery>
 #include <QSqlResult>
 #include <QSqlError>
@@ -5,9 +6,11 @@
 
 #include "library/dao/analysisdao.h"
 #include "library/queryutil.h"
+#include "util/assert.h"
 #include "preferences/waveformsettings.h"
 #include "util/performancetimer.h"
 #include "waveform/waveform.h"
+#include "waveform/waveformfactory.h"
 
 const QString AnalysisDao::s_analysisTableName = "track_analysis";
 
@@ -17,6 +20,16 @@ const QString AnalysisDao::s_analysisTableName = "track_analysis";
 // CPU time so I think we should stick with the default. rryan 4/3/2012
 constexpr int kCompressionLevel = -1;
 
+namespace {
+
+Waveform::StorageCompression storageCompression(const WaveformSettings& waveformSettings) {
+    return waveformSettings.waveformCacheCompressionEnabled()
+            ? Waveform::StorageCompression::Deflate
+            : Waveform::StorageCompression::None;
+}
+
+} // anonymous namespace
+
 AnalysisDao::AnalysisDao(UserSettingsPointer pConfig)
         : m_pConfig(pConfig) {
     QDir storagePath = getAnalysisStoragePath();
@@ -72,36 +85,56 @@ QList<AnalysisDao::AnalysisInfo> AnalysisDao::loadAnalysesFromQuery(TrackId trac
     const int descriptionColumn = queryRecord.indexOf("description");
     const int versionColumn = queryRecord.indexOf("version");
     const int dataChecksumColumn = queryRecord.indexOf("data_checksum");
+    // Only selected when loading the analyses of other tracks
+    const int trackIdColumn = queryRecord.indexOf("track_id");
 
     QDir analysisPath(getAnalysisStoragePath());
+    QList<int> legacyAnalyses;
     while (query->next()) {
         AnalysisDao::AnalysisInfo info;
         info.analysisId = query->value(idColumn).toInt();
-        info.trackId = trackId;
+        info.trackId = trackIdColumn >= 0
+                ? TrackId(query->value(trackIdColumn))
+                : trackId;
         info.type = static_cast<AnalysisType>(query->value(typeColumn).toInt());
         info.description = query->value(descriptionColumn).toString();
         info.version = query->value(versionColumn).toString();
         int checksum = query->value(dataChecksumColumn).toInt();
         QString dataPath = analysisPath.absoluteFilePath(
             QString::number(info.analysisId));
-        const QByteArray compressedData = loadDataFromFile(dataPath);
+        // Unmapped at the end of the iteration, so that the file can be
+        // replaced while the analysis is in use
+        QFile file(dataPath);
+        const QByteArray storedData = mapDataFromFile(&file);
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
         const int file_checksum = qChecksum(
-                compressedData);
+                storedData);
 #else
         const int file_checksum = qChecksum(
-                compressedData.constData(),
-                compressedData.length());
+                storedData.constData(),
+                storedData.length());
 #endif
         if (checksum != file_checksum) {
             qDebug() << "WARNING: Corrupt analysis loaded from" << dataPath
-                     << "length" << compressedData.length();
+                     << "length" << storedData.length();
             continue;
         }
-        info.data = qUncompress(compressedData);
+        if (Waveform::isCompactByteArray(storedData)) {
+            // Detach from the mapped file
+            info.data = QByteArray(storedData.constData(), storedData.size());
+        } else {
+            info.data = qUncompress(storedData);
+            if (needsMigration(info)) {
+                legacyAnalyses.append(analyses.size());
+            }
+        }
         bytes += info.data.length();
         analyses.append(info);
     }
+    // Not while iterating over the query results
+    for (int i : std::as_const(legacyAnalyses)) {
+        migrateAnalysis(&analyses[i]);
+    }
     qDebug() << "AnalysisDAO fetched" << analyses.size() << "analyses,"
              << bytes << "bytes for track"
              << trackId << "in" << time.elapsed().debugMillisWithUnit();
@@ -120,23 +153,30 @@ bool AnalysisDao::saveAnalysis(AnalysisDao::AnalysisInfo* info) {
     PerformanceTimer time;
     time.start();
 
-    const QByteArray compressedData = qCompress(info->data, kCompressionLevel);
+    // The compact waveform format is stored as is, it has its own optional
+    // compression and is memory-mapped when loading.
+    const QByteArray storedData = Waveform::isCompactByteArray(info->data)
+            ? info->data
+            : qCompress(info->data, kCompressionLevel);
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
     const int checksum = qChecksum(
-            compressedData);
+            storedData);
 #else
     const int checksum = qChecksum(
-            compressedData.constData(),
-            compressedData.length());
+            storedData.constData(),
+            storedData.length());
 #endif
     QSqlQuery query(m_database);
     if (info->analysisId == -1) {
         query.prepare(QString(
-            "INSERT INTO %1 (track_id, type, description, version, data_checksum) "
-            "VALUES (:trackId,:type,:description,:version,:data_checksum)")
+            "INSERT INTO %1 (track_id, type, description, version, data_checksum, "
+            "audio_digest) "
+            "VALUES (:trackId,:type,:description,:version,:data_checksum,"
+            "(SELECT audio_digest FROM library WHERE id=:digestTrackId))")
                       .arg(s_analysisTableName));
 
         query.bindValue(":trackId", info->trackId.toVariant());
+        query.bindValue(":digestTrackId", info->trackId.toVariant());
         query.bindValue(":type", info->type);
         query.bindValue(":description", info->description);
         query.bindValue(":version", info->version);
@@ -154,11 +194,13 @@ bool AnalysisDao::saveAnalysis(AnalysisDao::AnalysisInfo* info) {
             "type = :type,"
             "description = :description,"
             "version = :version,"
-            "data_checksum = :data_checksum "
+            "data_checksum = :data_checksum,"
+            "audio_digest = (SELECT audio_digest FROM library WHERE id = :digestTrackId) "
             "WHERE id = :analysisId").arg(s_analysisTableName));
 
         query.bindValue(":analysisId", info->analysisId);
         query.bindValue(":trackId", info->trackId.toVariant());
+        query.bindValue(":digestTrackId", info->trackId.toVariant());
         query.bindValue(":type", info->type);
         query.bindValue(":description", info->description);
         query.bindValue(":version", info->version);
@@ -172,14 +214,14 @@ bool AnalysisDao::saveAnalysis(AnalysisDao::AnalysisInfo* info) {
 
     QString dataPath = getAnalysisStoragePath().absoluteFilePath(
         QString::number(info->analysisId));
-    if (!saveDataToFile(dataPath, compressedData)) {
+    if (!saveDataToFile(dataPath, storedData)) {
         qDebug() << "WARNING: Couldn't save analysis data to file" << dataPath;
         return false;
     }
 
     qDebug() << "AnalysisDAO saved analysis" << info->analysisId
-             << QString("%1 (%2 compressed)").arg(QString::number(info->data.length()),
-                                                  QString::number(compressedData.length()))
+             << QString("%1 (%2 stored)").arg(QString::number(info->data.length()),
+                                              QString::number(storedData.length()))
              << "bytes for track"
              << info->trackId << "in" << time.elapsed().debugMillisWithUnit();
     return true;
@@ -262,15 +304,59 @@ QDir AnalysisDao::getAnalysisStoragePath() const {
     return dir.absolutePath().append("/");
 }
 
-QByteArray AnalysisDao::loadDataFromFile(const QString& filename) const {
-    QFile file(filename);
-    if (!file.exists()) {
+QByteArray AnalysisDao::mapDataFromFile(QFile* pFile) const {
+    if (!pFile->exists()) {
         return QByteArray();
     }
-    if (!file.open(QIODevice::ReadOnly)) {
+    if (!pFile->open(QIODevice::ReadOnly)) {
         return QByteArray();
     }
-    return file.readAll();
+    const qint64 size = pFile->size();
+    if (size <= 0) {
+        return QByteArray();
+    }
+    const uchar* pData = pFile->map(0, size);
+    if (!pData) {
+        // Not supported by all file engines
+        return pFile->readAll();
+    }
+    return QByteArray::fromRawData(reinterpret_cast<const char*>(pData), static_cast<int>(size));
+}
+
+bool AnalysisDao::needsMigration(const AnalysisInfo& analysis) const {
+    // Only the protobuf format of the previous version is migrated, the
+    // others are either outdated or kept for older versions of Mixxx.
+    switch (analysis.type) {
+    case TYPE_WAVEFORM:
+        return analysis.version == WAVEFORM_5_VERSION;
+    case TYPE_WAVESUMMARY:
+        return analysis.version == WAVEFORMSUMMARY_5_VERSION;
+    default:
+        return false;
+    }
+}
+
+void AnalysisDao::migrateAnalysis(AnalysisInfo* pAnalysis) {
+    const Waveform waveform(pAnalysis->data);
+    if (waveform.saveState() != Waveform::SaveState::Saved) {
+        // Could not be parsed, leave it to the analyzer
+        return;
+    }
+    AnalysisInfo migrated = *pAnalysis;
+    migrated.data = waveform.toCompactByteArray(
+            storageCompression(WaveformSettings(m_pConfig)));
+    if (pAnalysis->type == TYPE_WAVEFORM) {
+        migrated.version = WaveformFactory::currentWaveformVersion();
+        migrated.description = WaveformFactory::currentWaveformDescription();
+    } else {
+        migrated.version = WaveformFactory::currentWaveformSummaryVersion();
+        migrated.description = WaveformFactory::currentWaveformSummaryDescription();
+    }
+    if (!saveAnalysis(&migrated)) {
+        qDebug() << "WARNING: Failed to migrate analysis" << pAnalysis->analysisId;
+        return;
+    }
+    *pAnalysis = migrated;
 }
 
 bool AnalysisDao::deleteFile(const QString& fileName) const {
@@ -279,40 +365,19 @@ bool AnalysisDao::deleteFile(const QString& fileName) const {
 }
 
 bool AnalysisDao::saveDataToFile(const QString& fileName, const QByteArray& data) const {
-    QFile file(fileName);
-
-    // If the file exists, do the right thing. Write to a temp file, unlink the
-    // existing file, and then move the temp file to the real file's name.
-    if (file.exists()) {
-        QString tempFileName = fileName + ".tmp";
-        QFile tempFile(tempFileName);
-        if (!tempFile.open(QIODevice::WriteOnly)) {
-            return false;
-        }
-        int bytesWritten = tempFile.write(data);
-        if (bytesWritten == -1 || bytesWritten != data.length()) {
-            return false;
-        }
-        tempFile.close();
-        if (!file.remove()) {
-            return false;
-        }
-        if (!tempFile.rename(fileName)) {
-            return false;
-        }
-        return true;
-    }
-
-    // If the file doesn't exist, just create a new file and write the data.
+    // The new data is written to a temporary file that atomically replaces
+    // the existing file on commit. Files are never truncated in place,
+    // which would crash another thread that is reading the mapped file.
+    QSaveFile file(fileName);
     if (!file.open(QIODevice::WriteOnly)) {
         return false;
     }
-    int bytesWritten = file.write(data);
-    if (bytesWritten == -1 || bytesWritten != data.length()) {
+    const qint64 bytesWritten = file.write(data);
+    if (bytesWritten != data.length()) {
+        file.cancelWriting();
         return false;
     }
-    file.close();
-    return true;
+    return file.commit();
 }
 
 void AnalysisDao::saveTrackAnalyses(
@@ -332,6 +397,7 @@ void AnalysisDao::saveTrackAnalyses(
         return;
     }
 
+    const auto compression = storageCompression(waveformSettings);
     AnalysisDao::AnalysisInfo analysis;
     analysis.trackId = trackId;
     if (pWaveform->getId() != -1) {
@@ -340,7 +406,7 @@ void AnalysisDao::saveTrackAnalyses(
     analysis.type = AnalysisDao::TYPE_WAVEFORM;
     analysis.description = pWaveform->getDescription();
     analysis.version = pWaveform->getVersion();
-    analysis.data = pWaveform->toByteArray();
+    analysis.data = pWaveform->toCompactByteArray(compression);
     bool success = saveAnalysis(&analysis);
     if (success) {
         pWaveform->setSaveState(Waveform::SaveState::Saved);
@@ -355,7 +421,7 @@ void AnalysisDao::saveTrackAnalyses(
     analysis.type = AnalysisDao::TYPE_WAVESUMMARY;
     analysis.description = pWaveSummary->getDescription();
     analysis.version = pWaveSummary->getVersion();
-    analysis.data = pWaveSummary->toByteArray();
+    analysis.data = pWaveSummary->toCompactByteArray(compression);
 
     success = saveAnalysis(&analysis);
     if (success) {
@@ -366,6 +432,126 @@ void AnalysisDao::saveTrackAnalyses(
              << "analysisId" << analysis.analysisId;
 }
 
+QByteArray AnalysisDao::getAudioDigest(TrackId trackId) const {
+    if (!m_database.isOpen() || !trackId.isValid()) {
+        return QByteArray();
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral("SELECT audio_digest FROM library WHERE id=:trackId"));
+    query.bindValue(":trackId", trackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't get audio digest of track" << trackId;
+        return QByteArray();
+    }
+    if (!query.next()) {
+        return QByteArray();
+    }
+    return query.value(0).toByteArray();
+}
+
+bool AnalysisDao::saveAudioDigest(TrackId trackId, const QByteArray& audioDigest) {
+    if (!m_database.isOpen() || !trackId.isValid()) {
+        return false;
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "UPDATE library SET audio_digest=:audioDigest WHERE id=:trackId"));
+    query.bindValue(":audioDigest", audioDigest);
+    query.bindValue(":trackId", trackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't save audio digest of track" << trackId;
+        return false;
+    }
+    // Analyses that have been saved before the digest was known
+    query.prepare(QString(
+            "UPDATE %1 SET audio_digest=:audioDigest WHERE track_id=:trackId")
+                          .arg(s_analysisTableName));
+    query.bindValue(":audioDigest", audioDigest);
+    query.bindValue(":trackId", trackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't save audio digest of analyses for track" << trackId;
+        return false;
+    }
+    return true;
+}
+
+QList<AnalysisDao::AnalysisInfo> AnalysisDao::getAnalysesForAudioDigest(
+        const QByteArray& audioDigest,
+        AnalysisType type,
+        TrackId excludedTrackId) {
+    if (!m_database.isOpen() || audioDigest.isEmpty()) {
+        return QList<AnalysisInfo>();
+    }
+
+    QSqlQuery query(m_database);
+    query.prepare(QString(
+        "SELECT id, track_id, type, description, version, data_checksum FROM %1 "
+        "WHERE audio_digest=:audioDigest AND type=:type AND track_id!=:trackId "
+        "ORDER BY id DESC").arg(s_analysisTableName));
+    query.bindValue(":audioDigest", audioDigest);
+    query.bindValue(":type", type);
+    query.bindValue(":trackId", excludedTrackId.toVariant());
+
+    return loadAnalysesFromQuery(TrackId(), &query);
+}
+
+std::optional<AnalysisDao::LibraryAnalysis> AnalysisDao::getLibraryAnalysisForAudioDigest(
+        const QByteArray& audioDigest,
+        TrackId excludedTrackId) const {
+    if (!m_database.isOpen() || audioDigest.isEmpty()) {
+        return std::nullopt;
+    }
+
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "SELECT beats_version, beats_sub_version, beats, bpm_lock,"
+            "keys_version, keys_sub_version, keys,"
+            "replaygain, replaygain_peak FROM library "
+            "WHERE audio_digest=:audioDigest AND id!=:trackId "
+            "ORDER BY (IFNULL(LENGTH(beats), 0) > 0) + (IFNULL(LENGTH(keys), 0) > 0) "
+            "+ (IFNULL(replaygain, 0) > 0) DESC LIMIT 1"));
+    query.bindValue(":audioDigest", audioDigest);
+    query.bindValue(":trackId", excludedTrackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't get library analysis for audio digest";
+        return std::nullopt;
+    }
+    if (!query.next()) {
+        return std::nullopt;
+    }
+
+    LibraryAnalysis analysis;
+    analysis.beatsVersion = query.value(0).toString();
+    analysis.beatsSubVersion = query.value(1).toString();
+    analysis.beats = query.value(2).toByteArray();
+    analysis.bpmLocked = query.value(3).toBool();
+    analysis.keysVersion = query.value(4).toString();
+    analysis.keysSubVersion = query.value(5).toString();
+    analysis.keys = query.value(6).toByteArray();
+    analysis.replayGain = mixxx::ReplayGain(
+            query.value(7).toDouble(),
+            query.value(8).toFloat());
+    return analysis;
+}
+
+bool AnalysisDao::adoptAnalysis(AnalysisInfo* pAnalysis, TrackId trackId) {
+    VERIFY_OR_DEBUG_ASSERT(pAnalysis) {
+        return false;
+    }
+    AnalysisInfo copy = *pAnalysis;
+    copy.analysisId = -1;
+    copy.trackId = trackId;
+    if (!saveAnalysis(&copy)) {
+        return false;
+    }
+    qDebug() << "AnalysisDAO adopted analysis" << pAnalysis->analysisId
+             << "of track" << pAnalysis->trackId
+             << "for track" << trackId
+             << "with the same audio";
+    *pAnalysis = copy;
+    return true;
+}
+
 size_t AnalysisDao::getDiskUsageInBytes(
         const QSqlDatabase& database,
         AnalysisType type) const {
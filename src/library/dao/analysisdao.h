@@ -2,10 +2,13 @@
 
 #include <QObject>
 #include <QDir>
+#include <QFile>
 #include <QSqlDatabase>
+#include <optional>
 
 #include "preferences/usersettings.h"
 #include "library/dao/dao.h"
+#include "track/replaygain.h"
 #include "track/trackid.h"
 #include "waveform/waveform.h"
 
@@ -32,6 +35,19 @@ class AnalysisDao : public DAO {
         QByteArray data;
     };
 
+    /// The results of the analyzers that are stored in the library
+    /// table instead of the track_analysis table.
+    struct LibraryAnalysis {
+        QString beatsVersion;
+        QString beatsSubVersion;
+        QByteArray beats;
+        bool bpmLocked = false;
+        QString keysVersion;
+        QString keysSubVersion;
+        QByteArray keys;
+        mixxx::ReplayGain replayGain;
+    };
+
     explicit AnalysisDao(UserSettingsPointer pConfig);
     ~AnalysisDao() override = default;
 
@@ -57,12 +73,35 @@ class AnalysisDao : public DAO {
             ConstWaveformPointer pWaveform,
             ConstWaveformPointer pWaveSummary);
 
+    // Tracks with the same audio content, i.e. copies, relocated files
+    // and re-imports, share their analyses. They are identified by the
+    // audio digest of the track, see mixxx::digestAudioSource().
+    QByteArray getAudioDigest(TrackId trackId) const;
+    bool saveAudioDigest(TrackId trackId, const QByteArray& audioDigest);
+    QList<AnalysisInfo> getAnalysesForAudioDigest(
+            const QByteArray& audioDigest,
+            AnalysisType type,
+            TrackId excludedTrackId);
+    /// Returns the analysis with most results among the tracks with
+    /// the given audio digest.
+    std::optional<LibraryAnalysis> getLibraryAnalysisForAudioDigest(
+            const QByteArray& audioDigest,
+            TrackId excludedTrackId) const;
+    /// Saves a copy of the analysis of another track for the given
+    /// track, which then no longer depends on the other track.
+    bool adoptAnalysis(AnalysisInfo* pAnalysis, TrackId trackId);
+
   private:
     QDir getAnalysisStoragePath() const;
-    QByteArray loadDataFromFile(const QString& fileName) const;
+    // The returned data is only valid as long as the file stays open
+    // The returned data points into the mapped file and must not be used
+    // after the file has been closed.
+    QByteArray mapDataFromFile(QFile* pFile) const;
     bool saveDataToFile(const QString& fileName, const QByteArray& data) const;
     bool deleteFile(const QString& filename) const;
     QList<AnalysisInfo> loadAnalysesFromQuery(TrackId trackId, QSqlQuery* query);
+    bool needsMigration(const AnalysisInfo& analysis) const;
+    void migrateAnalysis(AnalysisInfo* pAnalysis);
 
     const UserSettingsPointer m_pConfig;
 };
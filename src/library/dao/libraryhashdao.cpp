@@ -144,6 +144,29 @@ void LibraryHashDAO::invalidateAllDirectories() {
     }
 }
 
+void LibraryHashDAO::invalidateDirectories(const QStringList& dirPaths,
+                                           const QStringList& deletedDirPaths) {
+    // Only the given directories and all subdirectories of deleted
+    // directories need verification.
+    FieldEscaper escaper(m_database);
+    QStringList conditions;
+    conditions << QString("directory_path IN (%1)")
+                          .arg(escaper.escapeStrings(dirPaths + deletedDirPaths)
+                                          .join(","));
+    for (const auto& dirPath : deletedDirPaths) {
+        conditions << QString("instr(directory_path,%1)=1")
+                              .arg(escaper.escapeString(dirPath + QChar('/')));
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QString("UPDATE LibraryHashes "
+                          "SET needs_verification=(%1)")
+                          .arg(conditions.join(" OR ")));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query)
+                << "Couldn't mark changed directories as needing verification.";
+    }
+}
+
 void LibraryHashDAO::markUnverifiedDirectoriesAsDeleted() {
     //qDebug() << "LibraryHashDAO::markUnverifiedDirectoriesAsDeleted"
     //<< QThread::currentThread() << m_database.connectionName();
@@ -167,6 +190,19 @@ void LibraryHashDAO::removeDeletedDirectoryHashes() {
     }
 }
 
+void LibraryHashDAO::removeDirectoryHashes(const QString& rootDirPath) {
+    FieldEscaper escaper(m_database);
+    QSqlQuery query(m_database);
+    query.prepare(QString("DELETE FROM LibraryHashes WHERE "
+                          "directory_path=%1 OR instr(directory_path,%2)=1")
+                          .arg(escaper.escapeString(rootDirPath),
+                                  escaper.escapeString(rootDirPath + QChar('/'))));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query)
+                << "Couldn't remove the hashes of directory" << rootDirPath;
+    }
+}
+
 QStringList LibraryHashDAO::getDeletedDirectories() {
     QStringList result;
     QSqlQuery query(m_database);
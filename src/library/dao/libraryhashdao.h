@@ -19,8 +19,13 @@ class LibraryHashDAO : public DAO {
                              int dir_deleted);
     void markAsExisting(const QString& dirPath);
     void invalidateAllDirectories();
+    void invalidateDirectories(const QStringList& dirPaths,
+                               const QStringList& deletedDirPaths);
     void markUnverifiedDirectoriesAsDeleted();
     void removeDeletedDirectoryHashes();
+    // Removes the hashes of a directory and all its subdirectories, e.g.
+    // after the directory has been removed from the library.
+    void removeDirectoryHashes(const QString& rootDirPath);
     void updateDirectoryStatuses(const QStringList& dirPaths,
                                  const bool deleted, const bool verified);
     QStringList getDeletedDirectories();
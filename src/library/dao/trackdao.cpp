@@ -496,6 +496,20 @@ void TrackDAO::addTracksPrepare() {
             "WHERE location=:location");
 }
 
+void TrackDAO::addTracksCommit() {
+    VERIFY_OR_DEBUG_ASSERT(m_pTransaction) {
+        return;
+    }
+    if (!m_pTransaction->commit()) {
+        // Keep the transaction open and try again later
+        return;
+    }
+    m_pTransaction = std::make_unique<SqlTransaction>(m_database);
+
+    emit tracksAdded(m_tracksAddedSet);
+    m_tracksAddedSet.clear();
+}
+
 void TrackDAO::addTracksFinish(bool rollback) {
     if (m_pTransaction) {
         if (rollback) {
@@ -820,7 +834,8 @@ TrackId TrackDAO::addTracksAddTrack(const TrackPointer& pTrack, bool unremove) {
 
 TrackPointer TrackDAO::addTracksAddFile(
         const mixxx::FileAccess& fileAccess,
-        bool unremove) {
+        bool unremove,
+        const PreImportedTrackMetadata* pPreImportedMetadata) {
     // Check that track is a supported extension.
     // TODO(uklotzde): The following check can be skipped if
     // the track is already in the library. A refactoring is
@@ -870,7 +885,8 @@ TrackPointer TrackDAO::addTracksAddFile(
     // from the file.
     SoundSourceProxy(pTrack).updateTrackFromSource(
             SoundSourceProxy::UpdateTrackFromSourceMode::Once,
-            SyncTrackMetadataParams::readFromUserSettings(*m_pConfig));
+            SyncTrackMetadataParams::readFromUserSettings(*m_pConfig),
+            pPreImportedMetadata);
     if (!pTrack->checkSourceSynchronized()) {
         qWarning() << "TrackDAO::addTracksAddFile:"
                 << "Failed to parse track metadata from file"
@@ -1732,6 +1748,32 @@ void TrackDAO::markTrackLocationsAsVerified(const QStringList& locations) const
     }
 }
 
+void TrackDAO::invalidateTrackLocationsInDirectories(
+        const QStringList& directories,
+        const QStringList& deletedDirectories) const {
+    // Flags that have been left over by an interrupted scan are reset
+    QStringList conditions;
+    conditions << QString("directory IN (%1)")
+                          .arg(SqlStringFormatter::formatList(
+                                  m_database, directories + deletedDirectories));
+    for (const auto& directory : deletedDirectories) {
+        conditions << QString("instr(directory,%1)=1")
+                              .arg(SqlStringFormatter::format(
+                                      m_database, directory + QChar('/')));
+    }
+    QSqlQuery query(m_database);
+    query.prepare(
+            QString("UPDATE track_locations SET needs_verification=(%1)")
+                    .arg(conditions.join(" OR ")));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query)
+                << "Couldn't mark tracks in"
+                << directories.size() + deletedDirectories.size()
+                << "directories as needing verification.";
+        DEBUG_ASSERT(!"Failed query");
+    }
+}
+
 void TrackDAO::markTracksInDirectoriesAsVerified(const QStringList& directories) const {
     //qDebug() << "TrackDAO::markTracksInDirectoryAsVerified" << QThread::currentThread() << m_database.connectionName();
 
@@ -16,6 +16,7 @@
 
 class FwdSqlQuery;
 class SqlTransaction;
+struct PreImportedTrackMetadata;
 class PlaylistDAO;
 class AnalysisDao;
 class CueDAO;
@@ -151,16 +152,26 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     TrackId addTracksAddTrack(
             const TrackPointer& pTrack,
             bool unremove);
+    // Metadata that has been pre-imported from the file, e.g. by a worker
+    // thread of the library scanner, is used instead of parsing the file
+    // again while the GlobalTrackCache is locked.
     TrackPointer addTracksAddFile(
             const mixxx::FileAccess& fileAccess,
-            bool unremove);
+            bool unremove,
+            const PreImportedTrackMetadata* pPreImportedMetadata = nullptr);
     TrackPointer addTracksAddFile(
             const QString& filePath,
-            bool unremove) {
+            bool unremove,
+            const PreImportedTrackMetadata* pPreImportedMetadata = nullptr) {
         return addTracksAddFile(
                 mixxx::FileAccess(mixxx::FileInfo(filePath)),
-                unremove);
+                unremove,
+                pPreImportedMetadata);
     }
+    // Commits all tracks that have been added since addTracksPrepare()
+    // or the last commit and begins a new transaction, reusing the
+    // prepared queries.
+    void addTracksCommit();
     void addTracksFinish(bool rollback = false);
 
     bool updateTrack(const Track& track) const;
@@ -186,6 +197,11 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     void markTrackLocationsAsVerified(const QStringList& locations) const;
     void markTracksInDirectoriesAsVerified(const QStringList& directories) const;
     void invalidateTrackLocationsInLibrary() const;
+    // Only the tracks in the given directories need to be verified,
+    // including all subdirectories of directories that have been deleted.
+    void invalidateTrackLocationsInDirectories(
+            const QStringList& directories,
+            const QStringList& deletedDirectories) const;
     void markUnverifiedTracksAsDeleted();
 
     bool verifyRemainingTracks(
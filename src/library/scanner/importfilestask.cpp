@@ -2,6 +2,7 @@
 
 #include "library/scanner/libraryscanner.h"
 #include "moc_importfilestask.cpp"
+#include "sources/soundsourceproxy.h"
 #include "util/timer.h"
 
 ImportFilesTask::ImportFilesTask(LibraryScanner* pScanner,
@@ -50,6 +51,18 @@ void ImportFilesTask::run() {
             }
             qDebug() << "Importing track" << trackLocation;
 
+            // Parse the file here instead of on the scanner thread, which
+            // only needs to insert the new track into the database then.
+            auto preImportedMetadata =
+                    SoundSourceProxy::preImportTrackMetadataAndCoverImageFromFile(
+                            mixxx::FileAccess(mixxx::FileInfo(fileInfo), m_pToken),
+                            m_scannerGlobal->resetMissingTagMetadataOnImport());
+            if (preImportedMetadata &&
+                    !m_scannerGlobal->addPreImportedTrackMetadata(
+                            trackLocation, std::move(*preImportedMetadata))) {
+                setSuccess(false);
+                return;
+            }
             emit addNewTrack(trackLocation);
         }
     }
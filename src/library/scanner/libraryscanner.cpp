@@ -1,5 +1,8 @@
 #include "library/scanner/libraryscanner.h"
 
+#include <algorithm>
+#include <optional>
+
 #include "library/coverartutils.h"
 #include "library/queryutil.h"
 #include "library/scanner/libraryscannerdlg.h"
@@ -19,8 +22,15 @@
 
 namespace {
 
-// TODO(rryan) make configurable
-constexpr int kScannerThreadPoolSize = 1;
+// Parsing the metadata of new files is distributed among the worker
+// threads. More threads than this would only compete for disk I/O.
+constexpr int kMaxScannerThreadPoolSize = 4;
+
+// The number of new tracks that are added to the database in a single
+// transaction. Committing in batches preserves the progress of a scan
+// that is interrupted, because the hashes of directories that have been
+// scanned completely are committed together with their tracks.
+constexpr int kAddTracksBatchSize = 500;
 
 mixxx::Logger kLogger("LibraryScanner");
 
@@ -98,12 +108,14 @@ LibraryScanner::LibraryScanner(
         mixxx::DbConnectionPoolPtr pDbConnectionPool,
         const UserSettingsPointer& pConfig)
         : m_pDbConnectionPool(std::move(pDbConnectionPool)),
+          m_pConfig(pConfig),
           m_analysisDao(pConfig),
           m_trackDao(m_cueDao, m_playlistDao,
                   m_analysisDao, m_libraryHashDao,
                   pConfig),
           m_stateSema(1), // only one transaction is possible at a time
-          m_state(IDLE) {
+          m_state(IDLE),
+          m_numTracksAddedSinceCommit(0) {
     // Move LibraryScanner to its own thread so that our signals/slots will
     // queue to our event loop.
     moveToThread(this);
@@ -112,11 +124,16 @@ LibraryScanner::LibraryScanner(
     const int instanceId = s_instanceCounter.fetchAndAddAcquire(1) + 1;
     setObjectName(QString("LibraryScanner %1").arg(instanceId));
 
-    m_pool.setMaxThreadCount(kScannerThreadPoolSize);
+    m_pool.setMaxThreadCount(
+            std::clamp(QThread::idealThreadCount(), 1, kMaxScannerThreadPoolSize));
 
     // Listen to signals from our public methods (invoked by other threads) and
     // connect them to our slots to run the command on the scanner thread.
     connect(this, &LibraryScanner::startScan, this, &LibraryScanner::slotStartScan);
+    connect(this,
+            &LibraryScanner::startScanDirectories,
+            this,
+            &LibraryScanner::slotStartScanDirectories);
 
     m_pProgressDlg.reset(new LibraryScannerDlg());
     connect(this,
@@ -198,6 +215,52 @@ void LibraryScanner::slotStartScan() {
     }
     changeScannerState(SCANNING);
 
+    // First, we're going to mark all the directories that we've previously
+    // hashed as needing verification. As we search through the directory tree
+    // when we rescan, we'll mark any directory that does still exist as
+    // verified.
+    m_libraryHashDao.invalidateAllDirectories();
+
+    // Mark all the tracks in the library as needing verification of their
+    // existence. (ie. we want to check they're still on your hard drive where
+    // we think they are)
+    m_trackDao.invalidateTrackLocationsInLibrary();
+
+    startScanning(false);
+}
+
+void LibraryScanner::slotStartScanDirectories(const QStringList& directories) {
+    kLogger.debug() << "slotStartScanDirectories()" << directories;
+    DEBUG_ASSERT(m_state == STARTING);
+
+    // Only the changed directories are scanned and verified. Deleted
+    // directories are kept as roots to detect their deleted tracks.
+    m_libraryRootDirs.clear();
+    QStringList existingDirectories;
+    QStringList deletedDirectories;
+    for (const auto& directory : directories) {
+        auto dirInfo = mixxx::FileInfo(directory);
+        if (dirInfo.exists() && dirInfo.isDir()) {
+            existingDirectories.append(dirInfo.location());
+        } else {
+            deletedDirectories.append(dirInfo.location());
+        }
+        m_libraryRootDirs.append(std::move(dirInfo));
+    }
+    if (m_libraryRootDirs.isEmpty()) {
+        changeScannerState(IDLE);
+        return;
+    }
+    changeScannerState(SCANNING);
+
+    m_libraryHashDao.invalidateDirectories(existingDirectories, deletedDirectories);
+    m_trackDao.invalidateTrackLocationsInDirectories(
+            existingDirectories, deletedDirectories);
+
+    startScanning(true);
+}
+
+void LibraryScanner::startScanning(bool incremental) {
     QSet<QString> trackLocations = m_trackDao.getAllTrackLocations();
     QHash<QString, mixxx::cache_key_t> directoryHashes = m_libraryHashDao.getDirectoryHashes();
     QRegularExpression extensionFilter(SoundSourceProxy::getSupportedFileNamesRegex());
@@ -206,30 +269,25 @@ void LibraryScanner::slotStartScan() {
                     QRegularExpression::CaseInsensitiveOption);
     QStringList directoryBlacklist = ScannerUtil::getDirectoryBlacklist();
 
-    m_scannerGlobal = ScannerGlobalPointer(
-            new ScannerGlobal(trackLocations, directoryHashes, extensionFilter,
-                              coverExtensionFilter, directoryBlacklist));
+    m_scannerGlobal = ScannerGlobalPointer(new ScannerGlobal(trackLocations,
+            directoryHashes,
+            extensionFilter,
+            coverExtensionFilter,
+            directoryBlacklist,
+            SyncTrackMetadataParams::readFromUserSettings(*m_pConfig)
+                    .resetMissingTagMetadataOnImport,
+            incremental));
 
     m_scannerGlobal->startTimer();
 
     emit scanStarted();
 
-    // First, we're going to mark all the directories that we've previously
-    // hashed as needing verification. As we search through the directory tree
-    // when we rescan, we'll mark any directory that does still exist as
-    // verified.
-    m_libraryHashDao.invalidateAllDirectories();
-
-    // Mark all the tracks in the library as needing verification of their
-    // existence. (ie. we want to check they're still on your hard drive where
-    // we think they are)
-    m_trackDao.invalidateTrackLocationsInLibrary();
-
     kLogger.debug() << "Recursively scanning library.";
 
     // Start scanning the library. This prepares insertion queries in TrackDAO
     // (must be called before calling addTracksAdd) and begins a transaction.
     m_trackDao.addTracksPrepare();
+    m_numTracksAddedSinceCommit = 0;
 
     // First Scan all known directories we have a hash for.
     // In a second stage, we scan all new directories. This guarantees,
@@ -403,7 +461,9 @@ void LibraryScanner::slotFinishUnhashedScan() {
     }
 
     // Finish adding the tracks -- rollback the transaction if the scan did not
-    // finish cleanly and the user did not cancel the transaction.
+    // finish cleanly and the user did not cancel the transaction. Only the
+    // last batch of tracks is affected, preceding batches have already been
+    // committed.
     m_trackDao.addTracksFinish(!m_scannerGlobal->shouldCancel() &&
                                !bScanFinishedCleanly);
 
@@ -411,11 +471,17 @@ void LibraryScanner::slotFinishUnhashedScan() {
         cleanUpScan();
     }
 
-    if (!m_scannerGlobal->shouldCancel() && bScanFinishedCleanly) {
+    if (!m_scannerGlobal->shouldCancel() && bScanFinishedCleanly &&
+            !m_scannerGlobal->isIncremental()) {
         const auto dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
         updateQueryPlannerStatisticsForDatabase(dbConnection);
     }
 
+    if (!m_scannerGlobal->shouldCancel() && bScanFinishedCleanly) {
+        emit directoriesScanned(m_scannerGlobal->scannedDirectories(),
+                !m_scannerGlobal->isIncremental());
+    }
+
     if (!m_scannerGlobal->shouldCancel() && bScanFinishedCleanly) {
         kLogger.debug() << "Scan finished cleanly";
     } else {
@@ -447,6 +513,14 @@ void LibraryScanner::scan() {
     }
 }
 
+bool LibraryScanner::scanDirectories(const QStringList& directories) {
+    if (!changeScannerState(STARTING)) {
+        return false;
+    }
+    emit startScanDirectories(directories);
+    return true;
+}
+
 // this is called after pressing the cancel button in the scanner
 // progress dialog
 void LibraryScanner::slotCancel() {
@@ -541,6 +615,10 @@ void LibraryScanner::slotDirectoryHashedAndScanned(const QString& directoryPath,
         m_scannerGlobal->directoryScanned();
     }
 
+    if (m_scannerGlobal) {
+        m_scannerGlobal->addScannedDirectory(directoryPath);
+    }
+
     if (newDirectory) {
         m_libraryHashDao.saveDirectoryHash(directoryPath, hash);
     } else {
@@ -554,6 +632,7 @@ void LibraryScanner::slotDirectoryUnchanged(const QString& directoryPath) {
     //kLogger.debug() << "slotDirectoryUnchanged" << directoryPath;
     if (m_scannerGlobal) {
         m_scannerGlobal->addVerifiedDirectory(directoryPath);
+        m_scannerGlobal->addScannedDirectory(directoryPath);
     }
     emit progressHashing(directoryPath);
 }
@@ -569,10 +648,19 @@ void LibraryScanner::slotTrackExists(const QString& trackPath) {
 void LibraryScanner::slotAddNewTrack(const QString& trackPath) {
     //kLogger.debug() << "slotAddNewTrack" << trackPath;
     ScopedTimer timer(u"LibraryScanner::addNewTrack");
+    std::optional<PreImportedTrackMetadata> preImportedMetadata;
+    if (m_scannerGlobal) {
+        preImportedMetadata = m_scannerGlobal->takePreImportedTrackMetadata(trackPath);
+    }
     // For statistics tracking and to detect moved tracks
     TrackPointer pTrack = m_trackDao.addTracksAddFile(
             trackPath,
-            false);
+            false,
+            preImportedMetadata ? &*preImportedMetadata : nullptr);
+    if (++m_numTracksAddedSinceCommit >= kAddTracksBatchSize) {
+        m_trackDao.addTracksCommit();
+        m_numTracksAddedSinceCommit = 0;
+    }
     if (pTrack) {
         DEBUG_ASSERT(!pTrack->isDirty());
         // The track's actual location might differ from the
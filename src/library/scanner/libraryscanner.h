@@ -37,6 +37,11 @@ class LibraryScanner : public QThread {
     // in progress.
     void scan();
 
+    // Call from any thread to scan only the given directories that have
+    // changed, including new subdirectories. Returns false if a scan is
+    // already in progress.
+    bool scanDirectories(const QStringList& directories);
+
     // Call from any thread to cancel the scan.
     void slotCancel();
 
@@ -50,9 +55,15 @@ class LibraryScanner : public QThread {
     void tracksChanged(const QSet<TrackId>& changedTrackIds);
     void tracksRelocated(const QList<RelocatedTrack>& relocatedTracks);
 
+    // Emitted after a scan has finished cleanly with the locations of all
+    // directories that have been scanned. If allDirectories is false only
+    // the changed and new directories have been scanned.
+    void directoriesScanned(const QStringList& directories, bool allDirectories);
+
     // Emitted by scan() to invoke slotStartScan in the scanner thread's event
     // loop.
     void startScan();
+    void startScanDirectories(const QStringList& directories);
 
   protected:
     void run() override;
@@ -62,6 +73,7 @@ class LibraryScanner : public QThread {
 
   private slots:
     void slotStartScan();
+    void slotStartScanDirectories(const QStringList& directories);
     void slotFinishHashedScan();
     void slotFinishUnhashedScan();
 
@@ -94,9 +106,11 @@ class LibraryScanner : public QThread {
     // CANCELING -> IDLE
     bool changeScannerState(LibraryScanner::ScannerState newState);
 
+    void startScanning(bool incremental);
     void cleanUpScan();
 
     mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+    const UserSettingsPointer m_pConfig;
 
     // The pool of threads used for worker tasks.
     QThreadPool m_pool;
@@ -119,6 +133,9 @@ class LibraryScanner : public QThread {
     // this is accessed main and LibraryScanner thread
     volatile ScannerState m_state;
 
+    // Tracks that have been added in the current transaction
+    int m_numTracksAddedSinceCommit;
+
     QList<mixxx::FileInfo> m_libraryRootDirs;
     QScopedPointer<LibraryScannerDlg> m_pProgressDlg;
 };
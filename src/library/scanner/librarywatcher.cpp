@@ -0,0 +1,234 @@
+#include "library/scanner/librarywatcher.h"
+
+#ifdef __LINUX__
+#include <QFile>
+#endif
+#include <utility>
+
+#include "library/library_prefs.h"
+#include "library/scanner/libraryscanner.h"
+#include "moc_librarywatcher.cpp"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("LibraryWatcher");
+
+// Changes are scanned after no more changes have been reported for this
+// time, but not later than kMaxDebounceMillis after the first change.
+constexpr int kDebounceMillis = 3000;
+constexpr qint64 kMaxDebounceMillis = 30000;
+
+constexpr int kPeriodicRescanMillis = 15 * 60 * 1000;
+
+constexpr int kDefaultMaxWatchedDirectories = 8192;
+
+} // anonymous namespace
+
+LibraryWatcher::LibraryWatcher(
+        LibraryScanner* pScanner,
+        UserSettingsPointer pConfig,
+        QObject* parent)
+        : QObject(parent),
+          m_pScanner(pScanner),
+          m_pConfig(std::move(pConfig)),
+          m_maxWatchedDirectories(maxWatchedDirectories()),
+          m_maxDebounceMillis(kMaxDebounceMillis) {
+    DEBUG_ASSERT(m_pScanner);
+    m_debounceTimer.setSingleShot(true);
+    m_debounceTimer.setInterval(kDebounceMillis);
+    m_periodicRescanTimer.setInterval(kPeriodicRescanMillis);
+
+    connect(&m_watcher,
+            &QFileSystemWatcher::directoryChanged,
+            this,
+            &LibraryWatcher::slotDirectoryChanged);
+    connect(&m_debounceTimer,
+            &QTimer::timeout,
+            this,
+            &LibraryWatcher::slotScanChangedDirectories);
+    connect(&m_periodicRescanTimer,
+            &QTimer::timeout,
+            this,
+            &LibraryWatcher::slotPeriodicRescan);
+}
+
+bool LibraryWatcher::isEnabled() const {
+    return m_pConfig->getValue(
+            mixxx::library::prefs::kWatchDirectoriesConfigKey, false);
+}
+
+void LibraryWatcher::setRootDirectories(const QStringList& rootDirectories) {
+    m_rootDirectories = rootDirectories;
+    QStringList removedDirectories;
+    const QStringList watchedDirectories = m_watcher.directories();
+    for (const auto& directory : watchedDirectories) {
+        if (!isInRootDirectory(directory)) {
+            removedDirectories.append(directory);
+        }
+    }
+    if (!removedDirectories.isEmpty()) {
+        kLogger.debug()
+                << "Unwatching"
+                << removedDirectories.size()
+                << "directories that are no longer in the library";
+        m_watcher.removePaths(removedDirectories);
+    }
+}
+
+bool LibraryWatcher::isInRootDirectory(const QString& directory) const {
+    for (const auto& rootDirectory : m_rootDirectories) {
+        if (directory == rootDirectory ||
+                directory.startsWith(rootDirectory + QChar('/'))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// static
+int LibraryWatcher::maxWatchedDirectories() {
+#ifdef __LINUX__
+    QFile file(QStringLiteral("/proc/sys/fs/inotify/max_user_watches"));
+    if (file.open(QIODevice::ReadOnly)) {
+        bool ok = false;
+        const int maxUserWatches = file.readAll().trimmed().toInt(&ok);
+        if (ok && maxUserWatches > 0) {
+            return maxUserWatches / 2;
+        }
+    }
+#endif
+    return kDefaultMaxWatchedDirectories;
+}
+
+void LibraryWatcher::slotDirectoriesScanned(
+        const QStringList& directories, bool allDirectories) {
+    if (!isEnabled()) {
+        stopWatching();
+        m_periodicRescanTimer.stop();
+        return;
+    }
+
+    if (allDirectories) {
+        // Keep the pending changes that have been reported during the scan
+        const QStringList previousDirectories = m_watcher.directories();
+        if (!previousDirectories.isEmpty()) {
+            m_watcher.removePaths(previousDirectories);
+        }
+    }
+    const QStringList watchedDirectoryList = m_watcher.directories();
+    const QSet<QString> watchedDirectories(
+            watchedDirectoryList.cbegin(), watchedDirectoryList.cend());
+    QStringList newDirectories;
+    for (const auto& directory : directories) {
+        // The root might have been removed while it was scanned
+        if (!watchedDirectories.contains(directory) && isInRootDirectory(directory)) {
+            newDirectories.append(directory);
+        }
+    }
+
+    if (watchedDirectories.size() + newDirectories.size() > m_maxWatchedDirectories) {
+        kLogger.warning()
+                << "Unable to watch more than"
+                << m_maxWatchedDirectories
+                << "directories, falling back to periodic rescans";
+        stopWatching();
+        startPeriodicRescan();
+        return;
+    }
+    if (!newDirectories.isEmpty()) {
+        const QStringList failedDirectories = m_watcher.addPaths(newDirectories);
+        if (!failedDirectories.isEmpty()) {
+            kLogger.warning()
+                    << "Failed to watch"
+                    << failedDirectories.size()
+                    << "directories, falling back to periodic rescans";
+            stopWatching();
+            startPeriodicRescan();
+            return;
+        }
+    }
+    kLogger.debug()
+            << "Watching"
+            << m_watcher.directories().size()
+            << "directories";
+    m_periodicRescanTimer.stop();
+}
+
+void LibraryWatcher::slotScanFinished() {
+    // Scan the changes that have been reported while the scanner was busy
+    if (!m_changedDirectories.isEmpty() && !m_debounceTimer.isActive()) {
+        m_debounceTimer.start();
+    }
+}
+
+void LibraryWatcher::slotDirectoryChanged(const QString& directory) {
+    if (!isEnabled()) {
+        stopWatching();
+        return;
+    }
+    m_changedDirectories.insert(directory);
+    if (!m_pendingTimer.isValid()) {
+        m_pendingTimer.start();
+    }
+    // Restart the timer unless the changes have been pending for too long
+    if (!m_debounceTimer.isActive() || m_pendingTimer.elapsed() < m_maxDebounceMillis) {
+        m_debounceTimer.start();
+    }
+}
+
+void LibraryWatcher::slotScanChangedDirectories() {
+    // Changes in roots that have been removed in the meantime must not
+    // be imported
+    for (auto it = m_changedDirectories.begin(); it != m_changedDirectories.end();) {
+        if (isInRootDirectory(*it)) {
+            ++it;
+        } else {
+            it = m_changedDirectories.erase(it);
+        }
+    }
+    if (m_changedDirectories.isEmpty()) {
+        m_pendingTimer.invalidate();
+        return;
+    }
+    const QStringList directories(
+            m_changedDirectories.cbegin(), m_changedDirectories.cend());
+    if (!m_pScanner->scanDirectories(directories)) {
+        // Retried when the scan in progress has finished
+        kLogger.debug()
+                << "Postponing scan of"
+                << directories.size()
+                << "changed directories";
+        return;
+    }
+    kLogger.debug()
+            << "Scanning"
+            << directories.size()
+            << "changed directories";
+    m_changedDirectories.clear();
+    m_pendingTimer.invalidate();
+}
+
+void LibraryWatcher::slotPeriodicRescan() {
+    if (!isEnabled()) {
+        m_periodicRescanTimer.stop();
+        return;
+    }
+    m_pScanner->scan();
+}
+
+void LibraryWatcher::stopWatching() {
+    const QStringList directories = m_watcher.directories();
+    if (!directories.isEmpty()) {
+        m_watcher.removePaths(directories);
+    }
+    m_debounceTimer.stop();
+    m_changedDirectories.clear();
+    m_pendingTimer.invalidate();
+}
+
+void LibraryWatcher::startPeriodicRescan() {
+    if (!m_periodicRescanTimer.isActive()) {
+        m_periodicRescanTimer.start();
+    }
+}
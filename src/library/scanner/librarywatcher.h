@@ -0,0 +1,88 @@
+#pragma once
+
+#include <gtest/gtest_prod.h>
+
+#include <QElapsedTimer>
+#include <QFileSystemWatcher>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+
+#include "preferences/usersettings.h"
+
+class LibraryScanner;
+
+/// Watches the directories of the library for changes and scans only the
+/// changed directories, instead of rehashing the whole library.
+///
+/// The set of watched directories is taken from the scans that have finished
+/// cleanly, so the library must have been scanned once after enabling the
+/// watcher. Only directories inside of the root directories of the library
+/// are watched and scanned. Bursts of changes, e.g. when copying an album,
+/// are collected into a single scan. If the directories cannot be watched
+/// within the limits of the kernel the library is rescanned periodically
+/// instead.
+class LibraryWatcher : public QObject {
+    Q_OBJECT
+    FRIEND_TEST(LibraryWatcherTest, WatchScannedDirectories);
+    FRIEND_TEST(LibraryWatcherTest, DebounceIsCapped);
+    FRIEND_TEST(LibraryWatcherTest, PeriodicRescanAboveWatchLimit);
+    FRIEND_TEST(LibraryWatcherTest, ChangesOutsideOfRootsAreIgnored);
+  public:
+    LibraryWatcher(
+            LibraryScanner* pScanner,
+            UserSettingsPointer pConfig,
+            QObject* parent = nullptr);
+    ~LibraryWatcher() override = default;
+
+    bool isEnabled() const;
+
+    /// Updates the root directories of the library after they have been
+    /// added, removed or relocated. Directories outside of the new roots
+    /// are no longer watched. The directories of new roots are watched
+    /// after they have been scanned.
+    void setRootDirectories(const QStringList& rootDirectories);
+
+    bool isWatching() const {
+        return !m_watcher.directories().isEmpty();
+    }
+
+    bool isPeriodicRescanActive() const {
+        return m_periodicRescanTimer.isActive();
+    }
+
+    /// The maximum number of directories that are watched. Only a share of
+    /// the inotify watches of the user is used to leave some for other
+    /// applications.
+    static int maxWatchedDirectories();
+
+  public slots:
+    void slotDirectoriesScanned(const QStringList& directories, bool allDirectories);
+    void slotScanFinished();
+
+  private slots:
+    void slotDirectoryChanged(const QString& directory);
+    void slotScanChangedDirectories();
+    void slotPeriodicRescan();
+
+  private:
+    void stopWatching();
+    void startPeriodicRescan();
+    bool isInRootDirectory(const QString& directory) const;
+
+    LibraryScanner* const m_pScanner;
+    const UserSettingsPointer m_pConfig;
+
+    QStringList m_rootDirectories;
+    int m_maxWatchedDirectories;
+    qint64 m_maxDebounceMillis;
+
+    QFileSystemWatcher m_watcher;
+    QTimer m_debounceTimer;
+    QTimer m_periodicRescanTimer;
+    // Measures the time since the first change that has not been scanned
+    QElapsedTimer m_pendingTimer;
+    QSet<QString> m_changedDirectories;
+};
@@ -117,6 +117,13 @@ void RecursiveScanDirectoryTask::run() {
 
     // Process all of the sub-directories.
     for (const mixxx::FileInfo& dirInfo : dirsToScan) {
+        // Known directories are watched on their own during incremental
+        // scans and are only rescanned if they have changed themselves.
+        if (m_scannerGlobal->isIncremental() &&
+                mixxx::isValidCacheKey(m_scannerGlobal->directoryHashInDatabase(
+                        dirInfo.location()))) {
+            continue;
+        }
         // Atomically test and mark the directory as scanned to avoid
         // that the same directory is scanned multiple times by different
         // tasks.
@@ -4,10 +4,13 @@
 #include <QHash>
 #include <QMutex>
 #include <QRegularExpression>
+#include <QSemaphore>
 #include <QSet>
 #include <QSharedPointer>
 #include <QStringList>
+#include <optional>
 
+#include "sources/soundsourceproxy.h"
 #include "util/cache.h"
 #include "util/compatibility/qmutex.h"
 #include "util/fileaccess.h"
@@ -20,12 +23,17 @@ class ScannerGlobal {
             const QHash<QString, mixxx::cache_key_t>& directoryHashes,
             const QRegularExpression& supportedExtensionsMatcher,
             const QRegularExpression& supportedCoverExtensionsMatcher,
-            const QStringList& directoriesBlacklist)
+            const QStringList& directoriesBlacklist,
+            bool resetMissingTagMetadataOnImport,
+            bool incremental)
             : m_trackLocations(trackLocations),
               m_directoryHashes(directoryHashes),
               m_supportedExtensionsMatcher(supportedExtensionsMatcher),
               m_supportedCoverExtensionsMatcher(supportedCoverExtensionsMatcher),
               m_directoriesBlacklist(directoriesBlacklist),
+              m_resetMissingTagMetadataOnImport(resetMissingTagMetadataOnImport),
+              m_incremental(incremental),
+              m_preImportedTrackMetadataSlots(kMaxPreImportedTrackMetadata),
               // Unless marked un-clean, we assume it will finish cleanly.
               m_scanFinishedCleanly(true),
               m_shouldCancel(false),
@@ -94,6 +102,47 @@ class ScannerGlobal {
         return match.hasMatch();
     }
 
+    bool resetMissingTagMetadataOnImport() const {
+        return m_resetMissingTagMetadataOnImport;
+    }
+
+    // Incremental scans only cover the directories that have changed and
+    // do not descend into subdirectories that have been scanned before.
+    bool isIncremental() const {
+        return m_incremental;
+    }
+
+    // Stores the metadata of a new track that has been imported by a
+    // worker thread until the track is added on the scanner thread.
+    // Blocks while the scanner thread is lagging behind to limit the
+    // memory used by decoded cover images. Returns false if the scan
+    // has been cancelled in the meantime.
+    bool addPreImportedTrackMetadata(const QString& trackLocation,
+            PreImportedTrackMetadata&& metadata) {
+        while (!m_preImportedTrackMetadataSlots.tryAcquire(
+                1, kPreImportedTrackMetadataWaitMillis)) {
+            if (shouldCancel()) {
+                return false;
+            }
+        }
+        const auto locker = lockMutex(&m_preImportedTrackMetadataMutex);
+        m_preImportedTrackMetadata.insert(trackLocation, std::move(metadata));
+        return true;
+    }
+
+    std::optional<PreImportedTrackMetadata> takePreImportedTrackMetadata(
+            const QString& trackLocation) {
+        const auto locker = lockMutex(&m_preImportedTrackMetadataMutex);
+        const auto it = m_preImportedTrackMetadata.find(trackLocation);
+        if (it == m_preImportedTrackMetadata.end()) {
+            return std::nullopt;
+        }
+        PreImportedTrackMetadata metadata = std::move(it.value());
+        m_preImportedTrackMetadata.erase(it);
+        m_preImportedTrackMetadataSlots.release();
+        return metadata;
+    }
+
     bool shouldCancel() const {
         return m_shouldCancel;
     }
@@ -139,6 +188,14 @@ class ScannerGlobal {
         return m_timer.elapsed();
     }
 
+    // All directories that have been hashed or found unchanged.
+    const QStringList& scannedDirectories() const {
+        return m_scannedDirectories;
+    }
+    void addScannedDirectory(const QString& directory) {
+        m_scannedDirectories << directory;
+    }
+
     const QStringList& addedTracks() const {
         return m_addedTracks;
     }
@@ -154,6 +211,9 @@ class ScannerGlobal {
     }
 
   private:
+    static constexpr int kMaxPreImportedTrackMetadata = 64;
+    static constexpr int kPreImportedTrackMetadataWaitMillis = 100;
+
     TaskWatcher m_watcher;
 
     QSet<QString> m_trackLocations;
@@ -182,12 +242,23 @@ class ScannerGlobal {
     // this has never been investigated.
     QStringList m_directoriesBlacklist;
 
+    const bool m_resetMissingTagMetadataOnImport;
+    const bool m_incremental;
+
+    // Pre-imported metadata of new tracks that have not been added yet.
+    QSemaphore m_preImportedTrackMetadataSlots;
+    mutable QMutex m_preImportedTrackMetadataMutex;
+    QHash<QString, PreImportedTrackMetadata> m_preImportedTrackMetadata;
+
     // The list of directories verified by the scan.
     QStringList m_verifiedDirectories;
 
     // The list of tracks verified by the scan.
     QStringList m_verifiedTracks;
 
+    // The list of directories hashed or verified by the scan.
+    QStringList m_scannedDirectories;
+
     // The list of tracks added by the scan.
     QStringList m_addedTracks;
 
@@ -3,6 +3,7 @@
 #include <QRegularExpression>
 #include <QtDebug>
 
+#include "library/columnartrackindex.h"
 #include "library/dao/trackschema.h"
 #include "library/queryutil.h"
 #include "library/trackset/crate/crateschema.h"
@@ -98,6 +99,29 @@ QString concatSqlClauses(
 
 } // namespace
 
+const std::vector<int>& IndexColumns::resolve(
+        const ColumnarTrackIndex& index,
+        const QStringList& columnNames) const {
+    if (m_pIndex != &index) {
+        m_columns.clear();
+        for (const auto& columnName : columnNames) {
+            // Unknown columns never match like NULL values
+            m_columns.push_back(index.columnIndex(columnName));
+        }
+        m_pIndex = &index;
+    }
+    return m_columns;
+}
+
+bool GroupNode::canMatchIndex() const {
+    for (const auto& pNode : m_nodes) {
+        if (!pNode->canMatchIndex()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool AndNode::match(const TrackPointer& pTrack) const {
     for (const auto& pNode : m_nodes) {
         if (!pNode->match(pTrack)) {
@@ -109,6 +133,15 @@ bool AndNode::match(const TrackPointer& pTrack) const {
     return true;
 }
 
+bool AndNode::match(const ColumnarTrackIndex& index, int row) const {
+    for (const auto& pNode : m_nodes) {
+        if (!pNode->match(index, row)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 QString AndNode::toSql() const {
     QStringList queryFragments;
     queryFragments.reserve(static_cast<int>(m_nodes.size()));
@@ -138,6 +171,18 @@ bool OrNode::match(const TrackPointer& pTrack) const {
     return false;
 }
 
+bool OrNode::match(const ColumnarTrackIndex& index, int row) const {
+    VERIFY_OR_DEBUG_ASSERT(!m_nodes.empty()) {
+        return true;
+    }
+    for (const auto& pNode : m_nodes) {
+        if (pNode->match(index, row)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 QString OrNode::toSql() const {
     QStringList queryFragments;
     queryFragments.reserve(static_cast<int>(m_nodes.size()));
@@ -154,6 +199,10 @@ bool NotNode::match(const TrackPointer& pTrack) const {
     return !m_pNode->match(pTrack);
 }
 
+bool NotNode::match(const ColumnarTrackIndex& index, int row) const {
+    return !m_pNode->match(index, row);
+}
+
 QString NotNode::toSql() const {
     QString sql(m_pNode->toSql());
     if (sql.isEmpty()) {
@@ -171,7 +220,8 @@ TextFilterNode::TextFilterNode(const QSqlDatabase& database,
         const QString& argument)
         : m_database(database),
           m_sqlColumns(sqlColumns),
-          m_argument(argument) {
+          m_argument(argument),
+          m_pMatchedIndex(nullptr) {
     mixxx::DbConnection::makeStringLatinLow(&m_argument);
 }
 
@@ -191,6 +241,28 @@ bool TextFilterNode::match(const TrackPointer& pTrack) const {
     return false;
 }
 
+bool TextFilterNode::match(const ColumnarTrackIndex& index, int row) const {
+    if (m_pMatchedIndex != &index) {
+        // Search each distinct string only once
+        m_matchingStringIds = index.findStrings(m_argument);
+        m_pMatchedIndex = &index;
+    }
+    for (const int column : m_indexColumns.resolve(index, m_sqlColumns)) {
+        if (column < 0 || index.isNull(row, column)) {
+            continue;
+        }
+        if (index.isStringColumn(column)) {
+            const quint32 stringId = index.stringId(row, column);
+            if (stringId < m_matchingStringIds.size() && m_matchingStringIds[stringId]) {
+                return true;
+            }
+        } else if (index.latinLowString(row, column).contains(m_argument)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 QString TextFilterNode::toSql() const {
     FieldEscaper escaper(m_database);
     QString argument = m_argument;
@@ -222,6 +294,19 @@ bool NullOrEmptyTextFilterNode::match(const TrackPointer& pTrack) const {
     return false;
 }
 
+bool NullOrEmptyTextFilterNode::match(const ColumnarTrackIndex& index, int row) const {
+    const auto& columns = m_indexColumns.resolve(index, m_sqlColumns);
+    if (!columns.empty()) {
+        // only use the major column
+        const int column = columns.front();
+        if (column < 0 || index.isNull(row, column)) {
+            return true;
+        }
+        return index.value(row, column).toString().isEmpty();
+    }
+    return false;
+}
+
 QString NullOrEmptyTextFilterNode::toSql() const {
     if (!m_sqlColumns.isEmpty()) {
         // only use the major column
@@ -238,6 +323,14 @@ CrateFilterNode::CrateFilterNode(const CrateStorage* pCrateStorage,
 }
 
 bool CrateFilterNode::match(const TrackPointer& pTrack) const {
+    return matchTrackId(pTrack->getId());
+}
+
+bool CrateFilterNode::match(const ColumnarTrackIndex& index, int row) const {
+    return matchTrackId(index.trackId(row));
+}
+
+bool CrateFilterNode::matchTrackId(TrackId trackId) const {
     if (!m_matchInitialized) {
         CrateTrackSelectResult crateTracks(
                 m_pCrateStorage->selectTracksSortedByCrateNameLike(m_crateNameLike));
@@ -249,7 +342,7 @@ bool CrateFilterNode::match(const TrackPointer& pTrack) const {
         m_matchInitialized = true;
     }
 
-    return std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), pTrack->getId());
+    return std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), trackId);
 }
 
 QString CrateFilterNode::toSql() const {
@@ -264,6 +357,14 @@ NoCrateFilterNode::NoCrateFilterNode(const CrateStorage* pCrateStorage)
 }
 
 bool NoCrateFilterNode::match(const TrackPointer& pTrack) const {
+    return matchTrackId(pTrack->getId());
+}
+
+bool NoCrateFilterNode::match(const ColumnarTrackIndex& index, int row) const {
+    return matchTrackId(index.trackId(row));
+}
+
+bool NoCrateFilterNode::matchTrackId(TrackId trackId) const {
     if (!m_matchInitialized) {
         TrackSelectResult tracks(
                 m_pCrateStorage->selectAllTracksSorted());
@@ -275,7 +376,7 @@ bool NoCrateFilterNode::match(const TrackPointer& pTrack) const {
         m_matchInitialized = true;
     }
 
-    return !std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), pTrack->getId());
+    return !std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), trackId);
 }
 
 QString NoCrateFilterNode::toSql() const {
@@ -364,6 +465,40 @@ bool NumericFilterNode::match(const TrackPointer& pTrack) const {
     return false;
 }
 
+double NumericFilterNode::indexValue(
+        const ColumnarTrackIndex& index, int row, int column) const {
+    return index.numericValue(row, column);
+}
+
+bool NumericFilterNode::match(const ColumnarTrackIndex& index, int row) const {
+    const auto& columns = m_indexColumns.resolve(index, m_sqlColumns);
+    if (m_bNullQuery) {
+        // only use the major column
+        return !columns.empty() &&
+                (columns.front() < 0 || index.isNull(row, columns.front()));
+    }
+    for (const int column : columns) {
+        // Comparisons with NULL evaluate to false like in SQL
+        if (column < 0 || index.isNull(row, column)) {
+            continue;
+        }
+        const double dValue = indexValue(index, row, column);
+        if (m_bOperatorQuery) {
+            if ((m_operator == "=" && dValue == m_dOperatorArgument) ||
+                    (m_operator == "<" && dValue < m_dOperatorArgument) ||
+                    (m_operator == ">" && dValue > m_dOperatorArgument) ||
+                    (m_operator == "<=" && dValue <= m_dOperatorArgument) ||
+                    (m_operator == ">=" && dValue >= m_dOperatorArgument)) {
+                return true;
+            }
+        } else if (m_bRangeQuery && dValue >= m_dRangeLow &&
+                dValue <= m_dRangeHigh) {
+            return true;
+        }
+    }
+    return false;
+}
+
 QString NumericFilterNode::toSql() const {
     if (m_bNullQuery) {
         for (const auto& sqlColumn : m_sqlColumns) {
@@ -414,6 +549,15 @@ bool NullNumericFilterNode::match(const TrackPointer& pTrack) const {
     return false;
 }
 
+bool NullNumericFilterNode::match(const ColumnarTrackIndex& index, int row) const {
+    const auto& columns = m_indexColumns.resolve(index, m_sqlColumns);
+    if (!columns.empty()) {
+        // only use the major column
+        return columns.front() < 0 || index.isNull(row, columns.front());
+    }
+    return false;
+}
+
 QString NullNumericFilterNode::toSql() const {
     if (!m_sqlColumns.isEmpty()) {
         // only use the major column
@@ -472,6 +616,17 @@ bool KeyFilterNode::match(const TrackPointer& pTrack) const {
     return m_matchKeys.contains(pTrack->getKey());
 }
 
+bool KeyFilterNode::match(const ColumnarTrackIndex& index, int row) const {
+    static const QStringList kKeyIdColumn = {LIBRARYTABLE_KEY_ID};
+    const int column = m_indexColumns.resolve(index, kKeyIdColumn).front();
+    // "key_id IS NULL" is never part of the query
+    if (column < 0 || index.isNull(row, column)) {
+        return false;
+    }
+    return m_matchKeys.contains(static_cast<mixxx::track::io::key::ChromaticKey>(
+            static_cast<int>(index.numericValue(row, column))));
+}
+
 QString KeyFilterNode::toSql() const {
     QStringList searchClauses;
     for (const auto& matchKey : m_matchKeys) {
@@ -485,6 +640,12 @@ YearFilterNode::YearFilterNode(
         : NumericFilterNode(sqlColumns, argument) {
 }
 
+double YearFilterNode::indexValue(
+        const ColumnarTrackIndex& index, int row, int column) const {
+    // Only the first four characters like in toSql()
+    return index.value(row, column).toString().left(4).toDouble();
+}
+
 QString YearFilterNode::toSql() const {
     if (m_bNullQuery) {
         return QStringLiteral("year IS NULL");
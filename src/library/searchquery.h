@@ -14,6 +14,8 @@
 #include "util/assert.h"
 #include "util/memory.h"
 
+class ColumnarTrackIndex;
+
 const QString kMissingFieldSearchTerm = "\"\""; // "" searches for an empty string
 
 class QueryNode {
@@ -22,12 +24,33 @@ class QueryNode {
     virtual ~QueryNode() = default;
 
     virtual bool match(const TrackPointer& pTrack) const = 0;
+    // Evaluates the query on a row of the in-memory index of
+    // BaseTrackCache instead of querying the database
+    virtual bool match(const ColumnarTrackIndex& index, int row) const = 0;
     virtual QString toSql() const = 0;
 
+    // Only the database is able to evaluate SQL expressions
+    virtual bool canMatchIndex() const {
+        return true;
+    }
+
   protected:
     QueryNode() = default;
 };
 
+// Resolves the names of the columns once per index instead of
+// once per row
+class IndexColumns {
+  public:
+    const std::vector<int>& resolve(
+            const ColumnarTrackIndex& index,
+            const QStringList& columnNames) const;
+
+  private:
+    mutable const ColumnarTrackIndex* m_pIndex = nullptr;
+    mutable std::vector<int> m_columns;
+};
+
 class GroupNode : public QueryNode {
   public:
     void addNode(std::unique_ptr<QueryNode> pNode) {
@@ -35,6 +58,8 @@ class GroupNode : public QueryNode {
         m_nodes.push_back(std::move(pNode));
     }
 
+    bool canMatchIndex() const override;
+
   protected:
     // NOTE(uklotzde): std::vector is more suitable (efficiency)
     // than a QList for a private member. And QList from Qt 4
@@ -45,12 +70,14 @@ class GroupNode : public QueryNode {
 class OrNode : public GroupNode {
   public:
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 };
 
 class AndNode : public GroupNode {
   public:
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 };
 
@@ -62,8 +89,13 @@ class NotNode : public QueryNode {
     }
 
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 
+    bool canMatchIndex() const override {
+        return m_pNode->canMatchIndex();
+    }
+
   private:
     std::unique_ptr<QueryNode> m_pNode;
 };
@@ -75,12 +107,17 @@ class TextFilterNode : public QueryNode {
             const QString& argument);
 
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 
   private:
     QSqlDatabase m_database;
     QStringList m_sqlColumns;
     QString m_argument;
+    IndexColumns m_indexColumns;
+    // The strings of the index that contain the argument
+    mutable const ColumnarTrackIndex* m_pMatchedIndex;
+    mutable std::vector<bool> m_matchingStringIds;
 };
 
 class NullOrEmptyTextFilterNode : public QueryNode {
@@ -92,11 +129,13 @@ class NullOrEmptyTextFilterNode : public QueryNode {
     }
 
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 
   private:
     QSqlDatabase m_database;
     QStringList m_sqlColumns;
+    IndexColumns m_indexColumns;
 };
 
 class CrateFilterNode : public QueryNode {
@@ -105,9 +144,12 @@ class CrateFilterNode : public QueryNode {
             const QString& crateNameLike);
 
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 
   private:
+    bool matchTrackId(TrackId trackId) const;
+
     const CrateStorage* m_pCrateStorage;
     QString m_crateNameLike;
     mutable bool m_matchInitialized;
@@ -119,9 +161,12 @@ class NoCrateFilterNode : public QueryNode {
     explicit NoCrateFilterNode(const CrateStorage* pCrateStorage);
 
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 
   private:
+    bool matchTrackId(TrackId trackId) const;
+
     const CrateStorage* m_pCrateStorage;
     QString m_crateNameLike;
     mutable bool m_matchInitialized;
@@ -133,6 +178,7 @@ class NumericFilterNode : public QueryNode {
     NumericFilterNode(const QStringList& sqlColumns, const QString& argument);
 
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 
   protected:
@@ -146,8 +192,10 @@ class NumericFilterNode : public QueryNode {
     void init(QString argument);
 
     virtual double parse(const QString& arg, bool* ok);
+    virtual double indexValue(const ColumnarTrackIndex& index, int row, int column) const;
 
     QStringList m_sqlColumns;
+    IndexColumns m_indexColumns;
     bool m_bOperatorQuery;
     bool m_bNullQuery;
     QString m_operator;
@@ -162,9 +210,11 @@ class NullNumericFilterNode : public QueryNode {
     explicit NullNumericFilterNode(const QStringList& sqlColumns);
 
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 
     QStringList m_sqlColumns;
+    IndexColumns m_indexColumns;
 };
 
 class DurationFilterNode : public NumericFilterNode {
@@ -180,10 +230,12 @@ class KeyFilterNode : public QueryNode {
     KeyFilterNode(mixxx::track::io::key::ChromaticKey key, bool fuzzy);
 
     bool match(const TrackPointer& pTrack) const override;
+    bool match(const ColumnarTrackIndex& index, int row) const override;
     QString toSql() const override;
 
   private:
     QList<mixxx::track::io::key::ChromaticKey> m_matchKeys;
+    IndexColumns m_indexColumns;
 };
 
 class SqlNode : public QueryNode {
@@ -202,10 +254,20 @@ class SqlNode : public QueryNode {
         return true;
     }
 
+    bool match(const ColumnarTrackIndex& index, int row) const override {
+        Q_UNUSED(index);
+        Q_UNUSED(row);
+        return true;
+    }
+
     QString toSql() const override {
         return m_sql;
     }
 
+    bool canMatchIndex() const override {
+        return false;
+    }
+
   private:
     QString m_sql;
 };
@@ -214,6 +276,9 @@ class YearFilterNode : public NumericFilterNode {
   public:
     YearFilterNode(const QStringList& sqlColumns, const QString& argument);
     QString toSql() const override;
+
+  private:
+    double indexValue(const ColumnarTrackIndex& index, int row, int column) const override;
 };
 
 #endif /* SEARCHQUERY_H */
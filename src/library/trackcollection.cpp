@@ -171,6 +171,9 @@ bool TrackCollection::removeDirectory(const mixxx::FileInfo& rootDir) {
     SqlTransaction transaction(m_database);
     switch (m_directoryDao.removeDirectory(rootDir)) {
     case DirectoryDAO::RemoveResult::Ok:
+        // Otherwise the unchanged subdirectories would be skipped by
+        // incremental scans if the directory is added again
+        m_libraryHashDao.removeDirectoryHashes(rootDir.location());
         transaction.commit();
         return true;
     case DirectoryDAO::RemoveResult::NotFound:
@@ -197,6 +200,7 @@ void TrackCollection::relocateDirectory(const QString& oldDir, const QString& ne
     SqlTransaction transaction(m_database);
     QList<RelocatedTrack> relocatedTracks =
             m_directoryDao.relocateDirectory(oldDir, newDir);
+    m_libraryHashDao.removeDirectoryHashes(oldDir);
     transaction.commit();
 
     if (relocatedTracks.isEmpty()) {
@@ -5,6 +5,7 @@
 #include "library/externaltrackcollection.h"
 #include "library/library_prefs.h"
 #include "library/scanner/libraryscanner.h"
+#include "library/scanner/librarywatcher.h"
 #include "library/trackcollection.h"
 #include "moc_trackcollectionmanager.cpp"
 #include "sources/soundsourceproxy.h"
@@ -123,12 +124,26 @@ TrackCollectionManager::TrackCollectionManager(
                 pTrackDAO,
                 &TrackDAO::slotDatabaseTracksRelocated);
 
+        // Scans the changed directories after the library has been scanned
+        m_pWatcher = std::make_unique<LibraryWatcher>(m_pScanner.get(), pConfig);
+        connect(m_pScanner.get(),
+                &LibraryScanner::directoriesScanned,
+                m_pWatcher.get(),
+                &LibraryWatcher::slotDirectoriesScanned);
+        connect(m_pScanner.get(),
+                &LibraryScanner::scanFinished,
+                m_pWatcher.get(),
+                &LibraryWatcher::slotScanFinished);
+        updateWatchedRootDirectories();
+
         kLogger.info() << "Starting library scanner thread";
         m_pScanner->start();
     }
 }
 
 TrackCollectionManager::~TrackCollectionManager() {
+    // Stop watching before the scanner is deleted
+    m_pWatcher.reset();
     if (m_pScanner) {
         while (m_pScanner->isRunning()) {
             kLogger.info() << "Stopping library scanner thread";
@@ -342,13 +357,17 @@ ExportTrackMetadataResult TrackCollectionManager::exportTrackMetadataBeforeSavin
 bool TrackCollectionManager::addDirectory(const mixxx::FileInfo& newDir) const {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
 
-    return m_pInternalCollection->addDirectory(newDir);
+    const bool added = m_pInternalCollection->addDirectory(newDir);
+    updateWatchedRootDirectories();
+    return added;
 }
 
 bool TrackCollectionManager::removeDirectory(const mixxx::FileInfo& oldDir) const {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
 
-    return m_pInternalCollection->removeDirectory(oldDir);
+    const bool removed = m_pInternalCollection->removeDirectory(oldDir);
+    updateWatchedRootDirectories();
+    return removed;
 }
 
 void TrackCollectionManager::relocateDirectory(const QString& oldDir, const QString& newDir) const {
@@ -361,6 +380,7 @@ void TrackCollectionManager::relocateDirectory(const QString& oldDir, const QStr
             << newDir;
     // TODO(XXX): Add error handling in TrackCollection::relocateDirectory()
     m_pInternalCollection->relocateDirectory(oldDir, newDir);
+    updateWatchedRootDirectories();
     if (m_externalCollections.isEmpty()) {
         return;
     }
@@ -376,6 +396,18 @@ void TrackCollectionManager::relocateDirectory(const QString& oldDir, const QStr
     }
 }
 
+void TrackCollectionManager::updateWatchedRootDirectories() const {
+    if (!m_pWatcher) {
+        return;
+    }
+    QStringList rootDirectories;
+    const QList<mixxx::FileInfo> rootDirs = m_pInternalCollection->loadRootDirs();
+    for (const auto& rootDir : rootDirs) {
+        rootDirectories.append(rootDir.location());
+    }
+    m_pWatcher->setRootDirectories(rootDirectories);
+}
+
 bool TrackCollectionManager::hideTracks(const QList<TrackId>& trackIds) const {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
 
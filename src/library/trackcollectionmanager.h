@@ -14,6 +14,7 @@
 #include "util/thread_affinity.h"
 
 class LibraryScanner;
+class LibraryWatcher;
 class TrackCollection;
 class ExternalTrackCollection;
 
@@ -104,6 +105,9 @@ class TrackCollectionManager: public QObject,
     void afterTracksUpdated(const QSet<TrackId>& updatedTrackIds) const;
     void afterTracksRelocated(const QList<RelocatedTrack>& relocatedTracks) const;
 
+    // Passes the root directories of the library to the watcher
+    void updateWatchedRootDirectories() const;
+
     // Callback for GlobalTrackCache
     void saveEvictedTrack(Track* pTrack) noexcept override;
 
@@ -127,4 +131,5 @@ class TrackCollectionManager: public QObject,
 
     // TODO: Extract and decouple LibraryScanner from TrackCollectionManager
     std::unique_ptr<LibraryScanner> m_pScanner;
+    std::unique_ptr<LibraryWatcher> m_pWatcher;
 };
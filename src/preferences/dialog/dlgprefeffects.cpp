@@ -17,6 +17,7 @@ DlgPrefEffects::DlgPrefEffects(QWidget* pParent,
           m_pFocusedChainList(nullptr),
           m_pFocusedEffectList(nullptr),
           m_pConfig(pConfig),
+          m_pEffectsManager(pEffectsManager),
           m_pVisibleEffectsList(pEffectsManager->getVisibleEffectsList()),
           m_pChainPresetManager(pEffectsManager->getChainPresetManager()),
           m_pBackendManager(pEffectsManager->getBackendManager()) {
@@ -149,6 +150,7 @@ void DlgPrefEffects::clearEffectInfo() {
     effectDescription->clear();
     effectVersion->clear();
     effectType->clear();
+    effectMemory->clear();
 }
 
 void DlgPrefEffects::clearChainInfoDisableButtons() {
@@ -203,6 +205,11 @@ void DlgPrefEffects::effectsTableItemSelected(const QModelIndex& selected) {
     effectDescription->setText(pManifest->description());
     effectVersion->setText(pManifest->version());
     effectType->setText(EffectsBackend::translatedBackendName(pManifest->backendType()));
+    // Only a snapshot, idle states are released in the background
+    const EffectStatesMemoryUsage memoryUsage =
+            m_pEffectsManager->getStatesMemoryUsage(pManifest);
+    effectMemory->setText(tr("%1 KiB in %n channel state(s)", "", memoryUsage.states)
+                                  .arg(QString::number((memoryUsage.bytes + 1023) / 1024)));
 }
 
 void DlgPrefEffects::slotChainPresetSelected(const QModelIndex& selected) {
@@ -48,6 +48,7 @@ class DlgPrefEffects : public DlgPreferencePage, public Ui::DlgPrefEffectsDlg {
     QList<QLabel*> m_effectsLabels;
 
     UserSettingsPointer m_pConfig;
+    std::shared_ptr<EffectsManager> m_pEffectsManager;
     VisibleEffectsListPointer m_pVisibleEffectsList;
     EffectChainPresetManagerPointer m_pChainPresetManager;
     EffectsBackendManagerPointer m_pBackendManager;
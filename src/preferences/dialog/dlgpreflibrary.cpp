@@ -198,6 +198,7 @@ void DlgPrefLibrary::initializeDirList() {
 
 void DlgPrefLibrary::slotResetToDefaults() {
     checkBox_library_scan->setChecked(false);
+    checkBox_watch_directories->setChecked(false);
     spinbox_history_track_duplicate_distance->setValue(
             kHistoryTrackDuplicateDistanceDefault);
     spinbox_history_min_tracks_to_keep->setValue(1);
@@ -229,6 +230,8 @@ void DlgPrefLibrary::slotUpdate() {
     initializeDirList();
     checkBox_library_scan->setChecked(m_pConfig->getValue(
             kRescanOnStartupConfigKey, false));
+    checkBox_watch_directories->setChecked(m_pConfig->getValue(
+            kWatchDirectoriesConfigKey, false));
 
     spinbox_history_track_duplicate_distance->setValue(m_pConfig->getValue(
             kHistoryTrackDuplicateDistanceConfigKey,
@@ -443,6 +446,16 @@ void DlgPrefLibrary::slotApply() {
     m_pConfig->set(kRescanOnStartupConfigKey,
             ConfigValue((int)checkBox_library_scan->isChecked()));
 
+    const bool watchDirectories = checkBox_watch_directories->isChecked();
+    if (watchDirectories != m_pConfig->getValue(kWatchDirectoriesConfigKey, false)) {
+        m_pConfig->set(kWatchDirectoriesConfigKey,
+                ConfigValue((int)watchDirectories));
+        if (watchDirectories) {
+            // The watched directories are taken from a full scan
+            emit scanLibrary();
+        }
+    }
+
     m_pConfig->set(kHistoryTrackDuplicateDistanceConfigKey,
             ConfigValue(spinbox_history_track_duplicate_distance->value()));
     m_pConfig->set(kHistoryMinTracksToKeepConfigKey,
@@ -184,6 +184,10 @@ DlgPrefSound::DlgPrefSound(QWidget* pParent,
             QOverload<int>::of(&QComboBox::currentIndexChanged),
             this,
             &DlgPrefSound::settingChanged);
+    connect(parallelChannelProcessingCheckBox,
+            &QCheckBox::toggled,
+            this,
+            &DlgPrefSound::settingChanged);
 
     connect(queryButton, &QAbstractButton::clicked, this, &DlgPrefSound::queryClicked);
 
@@ -236,6 +240,8 @@ DlgPrefSound::DlgPrefSound(QWidget* pParent,
 
     m_pKeylockEngine =
             new ControlProxy(kAppGroup, QStringLiteral("keylock_engine"), this);
+    m_pParallelChannelProcessing = new ControlProxy(
+            kAppGroup, QStringLiteral("parallel_channel_processing"), this);
 
 #ifdef __LINUX__
     qDebug() << "RLimit Cur " << RLimit::getCurRtPrio();
@@ -304,6 +310,12 @@ void DlgPrefSound::slotApply() {
         m_pSettings->set(ConfigKey("[Master]", "keylock_engine"),
                 ConfigValue(static_cast<int>(keylockEngine)));
 
+        const bool parallelChannelProcessing =
+                parallelChannelProcessingCheckBox->isChecked();
+        m_pParallelChannelProcessing->set(parallelChannelProcessing ? 1.0 : 0.0);
+        m_pSettings->setValue(ConfigKey("[Master]", "parallel_channel_processing"),
+                parallelChannelProcessing);
+
         status = m_pSoundManager->setConfig(m_config);
     }
     if (status != SoundDeviceStatus::Ok) {
@@ -494,6 +506,9 @@ void DlgPrefSound::loadSettings(const SoundManagerConfig &config) {
         keylockComboBox->setCurrentIndex(keylockComboBox->count() - 1);
     }
 
+    parallelChannelProcessingCheckBox->setChecked(m_pSettings->getValue(
+            ConfigKey("[Master]", "parallel_channel_processing"), false));
+
     m_loading = false;
     // DlgPrefSoundItem has it's own inhibit flag
     emit loadPaths(m_config);
@@ -708,6 +723,9 @@ void DlgPrefSound::slotResetToDefaults() {
     }
     m_pKeylockEngine->set(static_cast<double>(keylockEngine));
 
+    parallelChannelProcessingCheckBox->setChecked(false);
+    m_pParallelChannelProcessing->set(0.0);
+
     mainMixComboBox->setCurrentIndex(1);
     m_pMainEnabled->set(1.0);
 
@@ -92,6 +92,7 @@ class DlgPrefSound : public DlgPreferencePage, public Ui::DlgPrefSoundDlg  {
     ControlProxy* m_pBoothDelay;
     ControlProxy* m_pLatencyCompensation;
     ControlProxy* m_pKeylockEngine;
+    ControlProxy* m_pParallelChannelProcessing;
     ControlProxy* m_pMainEnabled;
     ControlProxy* m_pMainMonoMixdown;
     ControlProxy* m_pMicMonitorMode;
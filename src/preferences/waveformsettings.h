@@ -16,6 +16,12 @@ class WaveformSettings {
                 ConfigKey("[Library]", "EnableWaveformCaching"), enabled);
     }
 
+    // Trades a slower loading of stored waveforms for less disk usage
+    bool waveformCacheCompressionEnabled() const {
+        return m_pConfig->getValue<bool>(
+                ConfigKey("[Library]", "EnableWaveformCacheCompression"), false);
+    }
+
     bool waveformGenerationWithAnalysisEnabled() const {
         return m_pConfig->getValue<bool>(
                 ConfigKey("[Library]", "EnableWaveformGenerationWithAnalysis"), true);
@@ -3,6 +3,7 @@
 #include <QtDebug>
 #include <cstring> // for memcpy and strcmp
 
+#include "engine/engineprofiler.h"
 #include "soundio/soundmanager.h"
 #include "soundio/soundmanagerconfig.h"
 #include "soundio/soundmanagerutil.h"
@@ -88,6 +89,8 @@ void SoundDevice::composeOutputBuffer(CSAMPLE* outputBuffer,
                                       const SINT framesToCompose,
                                       const SINT framesReadOffset,
                                       const int iFrameSize) {
+    EngineProfiler::ScopedStage profilerStage(EngineProfiler::Stage::ComposeOutput);
+
     //qDebug() << "SoundDevice::composeOutputBuffer()"
     //         << device->getInternalName()
     //         << framesToCompose << iFrameSize;
@@ -4,6 +4,7 @@
 
 #include "control/controlobject.h"
 #include "control/controlproxy.h"
+#include "engine/engineprofiler.h"
 #include "engine/sidechain/enginenetworkstream.h"
 #include "float.h"
 #include "moc_sounddevicenetwork.cpp"
@@ -439,6 +440,8 @@ void SoundDeviceNetwork::callbackProcessClkRef() {
 
     Trace trace("SoundDeviceNetwork::callbackProcessClkRef %1",
                 m_deviceId.name);
+    EngineProfiler::beginCallback(framesPerBuffer, m_sampleRate);
+    EngineProfiler::ScopedStage profilerStage(EngineProfiler::Stage::Callback);
 
 
     if (!m_denormals) {
@@ -8,6 +8,7 @@
 
 #include "control/controlobject.h"
 #include "control/controlproxy.h"
+#include "engine/engineprofiler.h"
 #include "sounddevicenetwork.h"
 #include "soundio/sounddevice.h"
 #include "soundio/soundmanager.h"
@@ -886,6 +887,8 @@ int SoundDevicePortAudio::callbackProcessClkRef(
 
     Trace trace("SoundDevicePortAudio::callbackProcessClkRef %1",
             m_deviceId.debugName());
+    EngineProfiler::beginCallback(framesPerBuffer, m_sampleRate);
+    EngineProfiler::ScopedStage profilerStage(EngineProfiler::Stage::Callback);
 
     //qDebug() << "SoundDevicePortAudio::callbackProcess:" << m_deviceId;
 
@@ -9,6 +9,7 @@
 
 #include "audio/types.h"
 #include "control/pollingcontrolproxy.h"
+#include "engine/engineprofiler.h"
 #include "engine/sidechain/enginenetworkstream.h"
 #include "preferences/usersettings.h"
 #include "soundio/sounddevice.h"
@@ -100,6 +101,7 @@ class SoundManager : public QObject {
 
     void underflowHappened(int code) {
         m_underflowHappened = 1;
+        EngineProfiler::reportXrun();
         // Disable the engine warnings by default, because printing a warning is a
         // locking function that will make the problem worse
         if (CmdlineArgs::Instance().getDeveloper()) {
@@ -0,0 +1,100 @@
+#include "sources/audiodigest.h"
+
+#include <QtEndian>
+#include <cmath>
+
+#include "util/assert.h"
+#include "util/math.h"
+#include "util/samplebuffer.h"
+
+namespace mixxx {
+
+namespace {
+
+constexpr QCryptographicHash::Algorithm kAudioHashAlgorithm = QCryptographicHash::Sha256;
+
+constexpr SINT kReadChunkFrames = 8192;
+
+void addData(QCryptographicHash* pCryptoHash, const void* pData, size_t size) {
+    pCryptoHash->addData(QByteArray::fromRawData(
+            static_cast<const char*>(pData),
+            static_cast<int>(size)));
+}
+
+void addValue(QCryptographicHash* pCryptoHash, qint64 value) {
+    const qint64 littleEndianValue = qToLittleEndian(value);
+    addData(pCryptoHash, &littleEndianValue, sizeof(littleEndianValue));
+}
+
+} // anonymous namespace
+
+AudioDigestCalculator::AudioDigestCalculator(
+        const audio::SignalInfo& signalInfo,
+        SINT frameLength)
+        : m_signalInfo(signalInfo),
+          m_cryptoHash(kAudioHashAlgorithm),
+          m_framesAdded(0) {
+    DEBUG_ASSERT(m_signalInfo.isValid());
+    addValue(&m_cryptoHash, m_signalInfo.getSampleRate().value());
+    addValue(&m_cryptoHash, m_signalInfo.getChannelCount().value());
+    addValue(&m_cryptoHash, frameLength);
+}
+
+void AudioDigestCalculator::addSamples(const CSAMPLE* pSamples, SINT sampleCount) {
+    if (sampleCount <= 0) {
+        return;
+    }
+    if (static_cast<SINT>(m_quantized.size()) < sampleCount) {
+        m_quantized.resize(sampleCount);
+    }
+    for (SINT i = 0; i < sampleCount; ++i) {
+        const CSAMPLE sample = math_clamp(pSamples[i], -1.0f, 1.0f);
+        m_quantized[i] = qToLittleEndian(
+                static_cast<qint16>(std::lround(sample * 32767.0f)));
+    }
+    addData(&m_cryptoHash, m_quantized.data(), sampleCount * sizeof(qint16));
+    m_framesAdded += m_signalInfo.samples2frames(sampleCount);
+}
+
+AudioDigest AudioDigestCalculator::finish() {
+    if (m_framesAdded <= 0) {
+        return AudioDigest();
+    }
+    // Corrupt or truncated files are hashed up to the last readable frame
+    addValue(&m_cryptoHash, m_framesAdded);
+    return m_cryptoHash.result();
+}
+
+AudioDigest digestAudioSource(AudioSource* pAudioSource) {
+    VERIFY_OR_DEBUG_ASSERT(pAudioSource) {
+        return AudioDigest();
+    }
+    const auto& signalInfo = pAudioSource->getSignalInfo();
+    IndexRange frameRange = pAudioSource->frameIndexRange();
+    if (!signalInfo.isValid() || frameRange.empty()) {
+        return AudioDigest();
+    }
+
+    // All samples are hashed. Edits of the same length that only differ
+    // in a few seconds, e.g. a clean and an explicit version, must not
+    // share the digest.
+    AudioDigestCalculator calculator(signalInfo, frameRange.length());
+    SampleBuffer sampleBuffer(signalInfo.frames2samples(kReadChunkFrames));
+    while (!frameRange.empty()) {
+        const auto chunkFrameRange = frameRange.splitAndShrinkFront(
+                math_min(kReadChunkFrames, frameRange.length()));
+        const auto readableSampleFrames = pAudioSource->readSampleFrames(
+                WritableSampleFrames(
+                        chunkFrameRange,
+                        SampleBuffer::WritableSlice(sampleBuffer)));
+        if (readableSampleFrames.readableLength() <= 0) {
+            break;
+        }
+        calculator.addSamples(
+                readableSampleFrames.readableData(),
+                readableSampleFrames.readableLength());
+    }
+    return calculator.finish();
+}
+
+} // namespace mixxx
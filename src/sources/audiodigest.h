@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <vector>
+
+#include "sources/audiosource.h"
+
+namespace mixxx {
+
+/// Identifies the decoded audio content of a file independent of its
+/// location and metadata. Copies of a file and files that only differ
+/// in their tags share the same digest.
+typedef QByteArray AudioDigest;
+
+/// Calculates the digest from the signal properties and the decoded PCM
+/// data of the whole track, which is quantized to 16 bit before hashing.
+///
+/// The samples are added in order while the track is decoded, e.g. by
+/// the analysis, so the track does not need to be decoded twice.
+class AudioDigestCalculator final {
+  public:
+    AudioDigestCalculator(
+            const audio::SignalInfo& signalInfo,
+            SINT frameLength);
+
+    /// Adds the next interleaved samples of the track
+    void addSamples(const CSAMPLE* pSamples, SINT sampleCount);
+
+    /// Returns an empty digest if no samples have been added
+    AudioDigest finish();
+
+  private:
+    const audio::SignalInfo m_signalInfo;
+    QCryptographicHash m_cryptoHash;
+    std::vector<qint16> m_quantized;
+    SINT m_framesAdded;
+};
+
+/// Reads the whole audio source and calculates its digest. Returns an
+/// empty digest if the audio source is not readable.
+///
+/// The frames are read in order from the start, which takes about as long
+/// as decoding the track for the analysis. Subsequent reads from the audio
+/// source need to seek back.
+AudioDigest digestAudioSource(AudioSource* pAudioSource);
+
+} // namespace mixxx
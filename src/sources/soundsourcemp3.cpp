@@ -1,11 +1,19 @@
 #include "sources/soundsourcemp3.h"
 #include "sources/mp3decoding.h"
 
+#include "util/cache.h"
 #include "util/logger.h"
 #include "util/math.h"
 
 #include <id3tag.h>
 
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QSaveFile>
+#include <cstring>
+
 namespace mixxx {
 
 namespace {
@@ -90,6 +98,42 @@ constexpr SINT kMaxMp3FramesPerSecond = 39; // fixed: 1 MP3 frame = 26 ms -> ~ 1
 constexpr SINT kSeekFrameListCapacity =
         kMinutesPerFile * kSecondsPerMinute * kMaxMp3FramesPerSecond;
 
+// The seek frame cache contains the properties of the stream and the
+// seek frames as variable-length deltas of the frame index and the
+// offset in the file, compressed with zlib. The frame index and offset
+// usually grow in constant steps that compress extremely well.
+const char kSeekFrameCacheMagic[] = {'M', 'S', 'F', 'C'};
+constexpr quint8 kSeekFrameCacheVersion = 1;
+const QString kSeekFrameCacheFileSuffix = QStringLiteral(".seek");
+
+void appendVarUInt(QByteArray* pData, quint64 value) {
+    while (value >= 0x80) {
+        pData->append(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    pData->append(static_cast<char>(value));
+}
+
+bool readVarUInt(const QByteArray& data, int* pPos, quint64* pValue) {
+    quint64 value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (*pPos >= data.size()) {
+            return false;
+        }
+        const auto byte = static_cast<quint8>(data[(*pPos)++]);
+        value |= static_cast<quint64>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *pValue = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+qint64 fileModificationTime(const QFile& file) {
+    return file.fileTime(QFileDevice::FileModificationTime).toMSecsSinceEpoch();
+}
+
 inline QString formatHeaderFlags(int headerFlags) {
     return QString("0x%1").arg(headerFlags, 4, 16, QLatin1Char('0'));
 }
@@ -168,6 +212,19 @@ const QStringList SoundSourceProviderMp3::kSupportedFileTypes = {
         QStringLiteral("mp3"),
 };
 
+//static
+QString SoundSourceMp3::s_seekFrameCacheDir;
+
+//static
+void SoundSourceMp3::setSeekFrameCacheDir(const QString& cacheDir) {
+    if (!cacheDir.isEmpty() && !QDir().mkpath(cacheDir)) {
+        kLogger.warning() << "Failed to create seek frame cache directory:" << cacheDir;
+        s_seekFrameCacheDir.clear();
+        return;
+    }
+    s_seekFrameCacheDir = cacheDir;
+}
+
 QString SoundSourceProviderMp3::getVersionString() const {
     return QString(QString(mad_version) + QChar(' ') + QString(mad_build)).trimmed();
 }
@@ -180,7 +237,8 @@ SoundSourceMp3::SoundSourceMp3(const QUrl& url)
           m_avgSeekFrameCount(0),
           m_curFrameIndex(0),
           m_madSynthCount(0),
-          m_leftoverBuffer(kMaxBytesPerMp3Frame + MAD_BUFFER_GUARD) {
+          m_leftoverBuffer(kMaxBytesPerMp3Frame + MAD_BUFFER_GUARD),
+          m_pLeftoverInputData(nullptr) {
     m_seekFrameList.reserve(kSeekFrameListCapacity);
     initDecoding();
 }
@@ -230,6 +288,14 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
     DEBUG_ASSERT(m_seekFrameList.empty());
     m_avgSeekFrameCount = 0;
     m_curFrameIndex = 0;
+
+    auto cachedChannelCount = audio::ChannelCount();
+    auto cachedSampleRate = audio::SampleRate();
+    auto cachedBitrate = audio::Bitrate();
+    if (readSeekFrameCache(&cachedChannelCount, &cachedSampleRate, &cachedBitrate)) {
+        return initAudioStream(cachedChannelCount, cachedSampleRate, cachedBitrate);
+    }
+
     int headerPerSampleRate[kSampleRateCount];
     for (int i = 0; i < kSampleRateCount; ++i) {
         headerPerSampleRate[i] = 0;
@@ -357,7 +423,14 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
         // Count valid frames separated by its sample rate
         headerPerSampleRate[sampleRateIndex]++;
 
-        addSeekFrame(m_curFrameIndex, m_madStream.this_frame);
+        const unsigned char* pInputData = m_madStream.this_frame;
+        if (m_madStream.buffer == m_leftoverBuffer.data()) {
+            // Restart decoding of the last frame at its original position
+            // in the file, not in the temporary leftover buffer
+            pInputData = m_pLeftoverInputData +
+                    (m_madStream.this_frame - m_leftoverBuffer.data());
+        }
+        addSeekFrame(m_curFrameIndex, pInputData);
 
         // Accumulate data from the header
         if (audio::Bitrate(madHeader.bitrate).isValid()) {
@@ -433,7 +506,6 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
         // Abort
         return OpenResult::Failed;
     }
-    initChannelCountOnce(maxChannelCount);
     if (mostCommonSampleRateIndex > kSampleRateCount) {
         kLogger.warning()
                 << "Unknown sample rate in MP3 file:"
@@ -441,19 +513,41 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
         // Abort
         return OpenResult::Failed;
     }
-    initSampleRateOnce(getSampleRateByIndex(mostCommonSampleRateIndex));
-    initFrameIndexRangeOnce(IndexRange::forward(0, m_curFrameIndex));
 
     // Calculate average bitrate values
-    DEBUG_ASSERT(m_seekFrameList.size() > 0); // see above
-    m_avgSeekFrameCount = frameLength() / static_cast<SINT>(m_seekFrameList.size());
+    auto avgBitrate = audio::Bitrate();
     if (cntBitrateFrames > 0) {
-        const unsigned long avgBitrate = sumBitrateFrames / cntBitrateFrames;
-        initBitrateOnce(avgBitrate / 1000); // bps -> kbps
+        avgBitrate = audio::Bitrate(static_cast<audio::Bitrate::value_t>(
+                sumBitrateFrames / cntBitrateFrames / 1000)); // bps -> kbps
     } else {
         kLogger.warning() << "Bitrate cannot be calculated from headers";
     }
 
+    const OpenResult result = initAudioStream(
+            maxChannelCount,
+            getSampleRateByIndex(mostCommonSampleRateIndex),
+            avgBitrate);
+    if (result == OpenResult::Succeeded) {
+        writeSeekFrameCache();
+    }
+    return result;
+}
+
+SoundSource::OpenResult SoundSourceMp3::initAudioStream(
+        audio::ChannelCount channelCount,
+        audio::SampleRate sampleRate,
+        audio::Bitrate bitrate) {
+    DEBUG_ASSERT(!m_seekFrameList.empty());
+    DEBUG_ASSERT(m_seekFrameList.front().frameIndex == 0);
+    initChannelCountOnce(channelCount);
+    initSampleRateOnce(sampleRate);
+    initFrameIndexRangeOnce(IndexRange::forward(0, m_curFrameIndex));
+
+    m_avgSeekFrameCount = frameLength() / static_cast<SINT>(m_seekFrameList.size());
+    if (bitrate.isValid()) {
+        initBitrateOnce(bitrate);
+    }
+
     // Terminate m_seekFrameList
     addSeekFrame(m_curFrameIndex, nullptr);
     DEBUG_ASSERT(m_seekFrameList.back().frameIndex == frameIndexMax());
@@ -470,6 +564,171 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
     return OpenResult::Succeeded;
 }
 
+QString SoundSourceMp3::seekFrameCacheFilePath() const {
+    if (s_seekFrameCacheDir.isEmpty()) {
+        return QString();
+    }
+    const cache_key_t cacheKey = cacheKeyFromMessageDigest(
+            QCryptographicHash::hash(
+                    m_file.fileName().toUtf8(), QCryptographicHash::Sha1));
+    return QDir(s_seekFrameCacheDir)
+            .filePath(QString::number(cacheKey, 16) + kSeekFrameCacheFileSuffix);
+}
+
+bool SoundSourceMp3::readSeekFrameCache(
+        audio::ChannelCount* pChannelCount,
+        audio::SampleRate* pSampleRate,
+        audio::Bitrate* pBitrate) {
+    const QString cacheFilePath = seekFrameCacheFilePath();
+    if (cacheFilePath.isEmpty()) {
+        return false;
+    }
+    QFile cacheFile(cacheFilePath);
+    if (!cacheFile.open(QIODevice::ReadOnly)) {
+        // Not cached yet
+        return false;
+    }
+
+    QDataStream stream(&cacheFile);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setVersion(QDataStream::Qt_5_0);
+    char magic[sizeof(kSeekFrameCacheMagic)];
+    quint8 version = 0;
+    QString fileName;
+    quint64 fileSize = 0;
+    qint64 modificationTime = 0;
+    quint8 channelCount = 0;
+    quint32 sampleRate = 0;
+    quint32 bitrate = 0;
+    qint64 cachedFrameLength = 0;
+    quint32 seekFrameCount = 0;
+    QByteArray compressedSeekFrames;
+    if (stream.readRawData(magic, sizeof(magic)) != sizeof(magic) ||
+            memcmp(magic, kSeekFrameCacheMagic, sizeof(magic)) != 0) {
+        kLogger.warning() << "Ignoring invalid seek frame cache:" << cacheFilePath;
+        return false;
+    }
+    stream >> version;
+    if (version != kSeekFrameCacheVersion) {
+        kLogger.info() << "Ignoring seek frame cache with unsupported version"
+                       << static_cast<int>(version) << ":" << cacheFilePath;
+        return false;
+    }
+    stream >> fileName >> fileSize >> modificationTime >> channelCount >>
+            sampleRate >> bitrate >> cachedFrameLength >> seekFrameCount >>
+            compressedSeekFrames;
+    if (stream.status() != QDataStream::Ok) {
+        kLogger.warning() << "Ignoring corrupt seek frame cache:" << cacheFilePath;
+        return false;
+    }
+    if (fileName != m_file.fileName() ||
+            fileSize != m_fileSize ||
+            modificationTime != fileModificationTime(m_file)) {
+        // The file has been modified or the cache key collides
+        return false;
+    }
+    if (channelCount == 0 || channelCount > kChannelCountMax ||
+            getIndexBySampleRate(audio::SampleRate(sampleRate)) >= kSampleRateCount ||
+            cachedFrameLength <= 0 || seekFrameCount == 0) {
+        kLogger.warning() << "Ignoring seek frame cache with invalid properties:"
+                          << cacheFilePath;
+        return false;
+    }
+
+    const QByteArray seekFrames = qUncompress(compressedSeekFrames);
+    // Each seek frame occupies at least 2 bytes
+    if (seekFrameCount > static_cast<quint64>(seekFrames.size()) / 2) {
+        kLogger.warning() << "Ignoring corrupt seek frame cache:" << cacheFilePath;
+        return false;
+    }
+    SeekFrameList seekFrameList;
+    seekFrameList.reserve(seekFrameCount);
+    int pos = 0;
+    quint64 frameIndex = 0;
+    quint64 offset = 0;
+    for (quint32 i = 0; i < seekFrameCount; ++i) {
+        quint64 frameIndexDelta;
+        quint64 offsetDelta;
+        if (!readVarUInt(seekFrames, &pos, &frameIndexDelta) ||
+                !readVarUInt(seekFrames, &pos, &offsetDelta)) {
+            break;
+        }
+        // Both must be strictly increasing, starting at frame index 0
+        if ((i == 0) != (frameIndexDelta == 0) || (i > 0 && offsetDelta == 0)) {
+            break;
+        }
+        frameIndex += frameIndexDelta;
+        offset += offsetDelta;
+        if (frameIndex >= static_cast<quint64>(cachedFrameLength) || offset >= m_fileSize) {
+            break;
+        }
+        seekFrameList.push_back(SeekFrameType{
+                static_cast<SINT>(frameIndex), m_pFileData + offset});
+    }
+    if (seekFrameList.size() != seekFrameCount || pos != seekFrames.size()) {
+        kLogger.warning() << "Ignoring corrupt seek frame cache:" << cacheFilePath;
+        return false;
+    }
+
+    m_seekFrameList.assign(seekFrameList.begin(), seekFrameList.end());
+    m_curFrameIndex = static_cast<SINT>(cachedFrameLength);
+    *pChannelCount = audio::ChannelCount(channelCount);
+    *pSampleRate = audio::SampleRate(sampleRate);
+    *pBitrate = audio::Bitrate(bitrate);
+    if (kLogger.debugEnabled()) {
+        kLogger.debug() << "Restored" << seekFrameCount
+                        << "seek frames from cache:" << cacheFilePath;
+    }
+    return true;
+}
+
+void SoundSourceMp3::writeSeekFrameCache() const {
+    const QString cacheFilePath = seekFrameCacheFilePath();
+    if (cacheFilePath.isEmpty()) {
+        return;
+    }
+    // The terminating seek frame is restored from the frame length
+    DEBUG_ASSERT(m_seekFrameList.size() > 1);
+    const auto seekFrameCount = static_cast<quint32>(m_seekFrameList.size() - 1);
+    QByteArray seekFrames;
+    seekFrames.reserve(static_cast<int>(seekFrameCount) * 4);
+    SINT prevFrameIndex = 0;
+    const unsigned char* pPrevInputData = m_pFileData;
+    for (quint32 i = 0; i < seekFrameCount; ++i) {
+        const SeekFrameType& seekFrame = m_seekFrameList[i];
+        DEBUG_ASSERT(seekFrame.pInputData >= m_pFileData &&
+                seekFrame.pInputData < m_pFileData + m_fileSize);
+        appendVarUInt(&seekFrames, static_cast<quint64>(seekFrame.frameIndex - prevFrameIndex));
+        appendVarUInt(&seekFrames, static_cast<quint64>(seekFrame.pInputData - pPrevInputData));
+        prevFrameIndex = seekFrame.frameIndex;
+        pPrevInputData = seekFrame.pInputData;
+    }
+
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream.writeRawData(kSeekFrameCacheMagic, sizeof(kSeekFrameCacheMagic));
+    stream << kSeekFrameCacheVersion
+           << m_file.fileName()
+           << static_cast<quint64>(m_fileSize)
+           << fileModificationTime(m_file)
+           << static_cast<quint8>(getSignalInfo().getChannelCount().value())
+           << static_cast<quint32>(getSignalInfo().getSampleRate().value())
+           << static_cast<quint32>(getBitrate().value())
+           << static_cast<qint64>(frameLength())
+           << seekFrameCount
+           << qCompress(seekFrames);
+
+    // Files might be opened concurrently, e.g. by the analyzer and a deck
+    QSaveFile cacheFile(cacheFilePath);
+    if (!cacheFile.open(QIODevice::WriteOnly) ||
+            cacheFile.write(data) != data.size() ||
+            !cacheFile.commit()) {
+        kLogger.warning() << "Failed to write seek frame cache:" << cacheFilePath;
+    }
+}
+
 void SoundSourceMp3::close() {
     finishDecoding();
 
@@ -845,6 +1104,7 @@ bool SoundSourceMp3::copyLeftoverFrame() {
         const SINT leftoverBytes = remainingBytes + MAD_BUFFER_GUARD;
         if ((remainingBytes > 0) && (leftoverBytes <= SINT(m_leftoverBuffer.size()))) {
             // Copy the data of the last MP3 frame into the leftover buffer...
+            m_pLeftoverInputData = m_madStream.next_frame;
             std::copy(m_madStream.next_frame,
                     m_madStream.next_frame + remainingBytes,
                     pLeftoverBuffer);
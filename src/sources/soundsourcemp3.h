@@ -23,6 +23,12 @@ class SoundSourceMp3 final : public SoundSource {
 
     void close() override;
 
+    /// Enables the persistent cache of seek frames in the given directory,
+    /// which avoids decoding all MP3 frame headers when reopening a file.
+    /// An empty path disables the cache. Must be configured before any
+    /// file is opened.
+    static void setSeekFrameCacheDir(const QString& cacheDir);
+
   protected:
     ReadableSampleFrames readSampleFramesClamped(
             const WritableSampleFrames& sampleFrames) override;
@@ -32,6 +38,8 @@ class SoundSourceMp3 final : public SoundSource {
             OpenMode mode,
             const OpenParams& params) override;
 
+    static QString s_seekFrameCacheDir;
+
     QFile m_file;
     quint64 m_fileSize;
     unsigned char* m_pFileData;
@@ -56,6 +64,22 @@ class SoundSourceMp3 final : public SoundSource {
     /** Returns the position in m_seekFrameList of the requested frame index. */
     SINT findSeekFrameIndex(SINT frameIndex) const;
 
+    /// Initializes the stream properties after m_seekFrameList has been
+    /// populated and starts decoding at the beginning of the stream.
+    OpenResult initAudioStream(
+            audio::ChannelCount channelCount,
+            audio::SampleRate sampleRate,
+            audio::Bitrate bitrate);
+
+    /// Restores m_seekFrameList from the cache if the file has not been
+    /// modified since the cache has been written.
+    bool readSeekFrameCache(
+            audio::ChannelCount* pChannelCount,
+            audio::SampleRate* pSampleRate,
+            audio::Bitrate* pBitrate);
+    void writeSeekFrameCache() const;
+    QString seekFrameCacheFilePath() const;
+
     bool copyLeftoverFrame();
 
     SINT m_curFrameIndex;
@@ -74,6 +98,8 @@ class SoundSourceMp3 final : public SoundSource {
     SINT m_madSynthCount; // left overs from the previous read
 
     std::vector<unsigned char> m_leftoverBuffer;
+    // The position in the file of the data in m_leftoverBuffer
+    const unsigned char* m_pLeftoverInputData;
 };
 
 class SoundSourceProviderMp3 : public SoundSourceProvider {
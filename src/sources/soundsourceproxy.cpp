@@ -573,6 +573,49 @@ SoundSourceProxy::importTrackMetadataAndCoverImageFromFile(
             resetMissingTagMetadata);
 }
 
+//static
+std::optional<PreImportedTrackMetadata>
+SoundSourceProxy::preImportTrackMetadataAndCoverImageFromFile(
+        mixxx::FileAccess trackFileAccess,
+        bool resetMissingTagMetadata) {
+    if (!trackFileAccess.info().checkFileExists()) {
+        return std::nullopt;
+    }
+    const auto trackRef = TrackRef::fromFileInfo(trackFileAccess.info());
+    if (GlobalTrackCacheLocker().lookupTrackByRef(trackRef)) {
+        // Metadata might be written into the file at any time while
+        // the track is cached
+        return std::nullopt;
+    }
+    const QDateTime modifiedBefore =
+            mixxx::MetadataSource::getFileSynchronizedAt(
+                    trackFileAccess.info().toQFile());
+
+    const auto pTrack = Track::newTemporary(std::move(trackFileAccess));
+    const SoundSourceProxy proxy(pTrack);
+    if (!proxy.m_pSoundSource) {
+        return std::nullopt;
+    }
+    PreImportedTrackMetadata preImported;
+    preImported.fileType = proxy.m_pSoundSource->getType();
+    const auto [importResult, sourceSynchronizedAt] =
+            proxy.importTrackMetadataAndCoverImage(
+                    &preImported.trackMetadata,
+                    &preImported.coverImage,
+                    resetMissingTagMetadata);
+    preImported.importResult = importResult;
+    preImported.sourceSynchronizedAt = sourceSynchronizedAt;
+
+    // The file has been read without locking the cache. Discard the
+    // results if the track has been loaded or the file has been
+    // modified in the meantime.
+    if (preImported.sourceSynchronizedAt != modifiedBefore ||
+            GlobalTrackCacheLocker().lookupTrackByRef(trackRef)) {
+        return std::nullopt;
+    }
+    return preImported;
+}
+
 std::pair<mixxx::MetadataSource::ImportResult, QDateTime>
 SoundSourceProxy::importTrackMetadataAndCoverImage(
         mixxx::TrackMetadata* pTrackMetadata,
@@ -601,6 +644,16 @@ inline bool shouldUpdateTrackMetadataFromSource(
                     sourceSyncStatus == mixxx::TrackRecord::SourceSyncStatus::Void);
 }
 
+std::pair<mixxx::MetadataSource::ImportResult, QDateTime> takePreImportedMetadata(
+        const PreImportedTrackMetadata& preImportedMetadata,
+        mixxx::TrackMetadata* pTrackMetadata,
+        QImage* pCoverImage) {
+    *pTrackMetadata = preImportedMetadata.trackMetadata;
+    *pCoverImage = preImportedMetadata.coverImage;
+    return std::make_pair(preImportedMetadata.importResult,
+            preImportedMetadata.sourceSynchronizedAt);
+}
+
 inline bool shouldImportSeratoTagsFromSource(
         mixxx::TrackRecord::SourceSyncStatus sourceSyncStatus,
         const SyncTrackMetadataParams& syncParams) {
@@ -618,7 +671,8 @@ inline bool shouldImportSeratoTagsFromSource(
 
 SoundSourceProxy::UpdateTrackFromSourceResult SoundSourceProxy::updateTrackFromSource(
         UpdateTrackFromSourceMode mode,
-        const SyncTrackMetadataParams& syncParams) {
+        const SyncTrackMetadataParams& syncParams,
+        const PreImportedTrackMetadata* pPreImportedMetadata) {
     DEBUG_ASSERT(m_pTrack);
 
     if (getUrl().isEmpty()) {
@@ -688,13 +742,21 @@ SoundSourceProxy::UpdateTrackFromSourceResult SoundSourceProxy::updateTrackFromS
         }
     }
 
+    // Pre-imported metadata has been parsed starting with empty default
+    // values, which is only equivalent when initializing a new track.
+    const bool usePreImportedMetadata = pPreImportedMetadata &&
+            sourceSyncStatus == mixxx::TrackRecord::SourceSyncStatus::Void &&
+            pCoverImg &&
+            pPreImportedMetadata->fileType == newType;
+
     // Parse the tags stored in the audio file and the date and time when the
     // file has been last modified to detect future changes of the tags.
-    auto [metadataImportResult, sourceSynchronizedAt] =
-            importTrackMetadataAndCoverImage(
-                    &trackMetadata,
-                    pCoverImg,
-                    syncParams.resetMissingTagMetadataOnImport);
+    auto [metadataImportResult, sourceSynchronizedAt] = usePreImportedMetadata
+            ? takePreImportedMetadata(*pPreImportedMetadata, &trackMetadata, pCoverImg)
+            : importTrackMetadataAndCoverImage(
+                      &trackMetadata,
+                      pCoverImg,
+                      syncParams.resetMissingTagMetadataOnImport);
     VERIFY_OR_DEBUG_ASSERT(!sourceSynchronizedAt.isValid() ||
             sourceSynchronizedAt.timeSpec() == Qt::UTC) {
         qWarning() << "Converting source synchronization time to UTC:" << sourceSynchronizedAt;
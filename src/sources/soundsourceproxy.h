@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QMimeType>
+#include <optional>
 
 #include "sources/soundsourceproviderregistry.h"
 #include "track/track_decl.h"
@@ -12,6 +13,16 @@ class FileAccess;
 
 } // namespace mixxx
 
+/// Track metadata and embedded cover image of a file that have been
+/// imported before a track object for this file has been created.
+struct PreImportedTrackMetadata {
+    QString fileType;
+    mixxx::MetadataSource::ImportResult importResult;
+    QDateTime sourceSynchronizedAt;
+    mixxx::TrackMetadata trackMetadata;
+    QImage coverImage;
+};
+
 /// Creates sound sources for tracks. Only intended to be used
 /// in a narrow scope and not shareable between multiple threads!
 class SoundSourceProxy {
@@ -121,6 +132,21 @@ class SoundSourceProxy {
             QImage* pCoverImage,
             bool resetMissingTagMetadata) const;
 
+    /// Import both track metadata and cover image from a file that is
+    /// not yet in the library, e.g. on a worker thread of the library
+    /// scanner. The result is passed to updateTrackFromSource() later.
+    ///
+    /// This function is thread-safe and can be invoked from any thread.
+    /// Unlike importTrackMetadataAndCoverImageFromFile() it does not keep
+    /// the GlobalTrackCache locked while reading, which allows to read
+    /// many files concurrently. Only files that are not cached are read,
+    /// because metadata is only written into files of cached tracks.
+    /// Returns std::nullopt if the file is cached or if it has been
+    /// modified while reading it.
+    static std::optional<PreImportedTrackMetadata> preImportTrackMetadataAndCoverImageFromFile(
+            mixxx::FileAccess trackFileAccess,
+            bool resetMissingTagMetadata);
+
     /// Controls which (metadata/coverart) and how tags are (re-)imported from
     /// audio files when creating a SoundSourceProxy.
     ///
@@ -172,10 +198,15 @@ class SoundSourceProxy {
     /// properly. The application log will contain warning messages for a detailed
     /// analysis in case unexpected behavior has been reported.
     ///
+    /// Metadata that has been pre-imported from the file is only used when
+    /// initially importing metadata for a new track object and discarded
+    /// otherwise.
+    ///
     /// Returns true if the track has been modified and false otherwise.
     UpdateTrackFromSourceResult updateTrackFromSource(
             UpdateTrackFromSourceMode mode,
-            const SyncTrackMetadataParams& syncParams);
+            const SyncTrackMetadataParams& syncParams,
+            const PreImportedTrackMetadata* pPreImportedMetadata = nullptr);
 
     /// Opening the audio source through the proxy will update the
     /// audio properties of the corresponding track object. Returns
@@ -0,0 +1,406 @@
+#include "library/dao/analysisdao.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QTemporaryDir>
+#include <cmath>
+
+#include "sources/audiodigest.h"
+#include "sources/soundsourceproxy.h"
+#include "test/librarytest.h"
+#include "track/keyfactory.h"
+#include "track/track.h"
+#include "util/math.h"
+#include "util/samplebuffer.h"
+#include "waveform/waveform.h"
+#include "waveform/waveformfactory.h"
+
+namespace {
+
+const QString kTrackLocation = QStringLiteral("id3-test-data/cover-test-png.mp3");
+// The same audio stream as kTrackLocation with different tags
+const QString kSameAudioTrackLocation = QStringLiteral("id3-test-data/cover-test-jpg.mp3");
+const QString kOtherAudioTrackLocation = QStringLiteral("id3-test-data/cover-test-vbr.mp3");
+
+// 5 minutes of audio, using the sample rates of AnalyzerWaveform
+constexpr int kSampleRate = 44100;
+constexpr SINT kFrameLength = 5 * 60 * kSampleRate;
+constexpr int kMainWaveformSampleRate = 441;
+constexpr int kSummaryWaveformSamples = 2 * 1920;
+
+WaveformPointer makeWaveform(int maxVisualSamples) {
+    auto pWaveform = WaveformPointer::create(
+            kSampleRate, kFrameLength, kMainWaveformSampleRate, maxVisualSamples);
+    WaveformData* pData = pWaveform->data();
+    for (int i = 0; i < pWaveform->getDataSize(); ++i) {
+        // Slowly changing values like real waveforms
+        pData[i].filtered.low = static_cast<unsigned char>(i / 7);
+        pData[i].filtered.mid = static_cast<unsigned char>(i / 13);
+        pData[i].filtered.high = static_cast<unsigned char>(i / 3);
+        pData[i].filtered.all = static_cast<unsigned char>(i / 5 + i % 2);
+    }
+    pWaveform->setCompletion(pWaveform->getDataSize());
+    return pWaveform;
+}
+
+void expectEqualWaveforms(const Waveform& expected, const Waveform& actual) {
+    ASSERT_EQ(expected.getDataSize(), actual.getDataSize());
+    EXPECT_EQ(expected.getAudioVisualRatio(), actual.getAudioVisualRatio());
+    EXPECT_EQ(expected.getDataSize(), actual.getCompletion());
+    for (int i = 0; i < expected.getDataSize(); ++i) {
+        ASSERT_EQ(expected.get(i).m_i, actual.get(i).m_i) << "at " << i;
+    }
+}
+
+// A sine wave, optionally with a muted range like an edited version
+class SineAudioSource : public mixxx::AudioSource {
+  public:
+    SineAudioSource(SINT frameLength, mixxx::IndexRange mutedFrameRange)
+            : AudioSource(QUrl::fromLocalFile(QStringLiteral("sine.wav"))),
+              m_frameLength(frameLength),
+              m_mutedFrameRange(mutedFrameRange) {
+    }
+
+    void close() override {
+    }
+
+  protected:
+    OpenResult tryOpen(
+            OpenMode mode,
+            const OpenParams& params) override {
+        Q_UNUSED(mode);
+        Q_UNUSED(params);
+        if (!initChannelCountOnce(mixxx::audio::ChannelCount::stereo()) ||
+                !initSampleRateOnce(mixxx::audio::SampleRate(kSampleRate)) ||
+                !initFrameIndexRangeOnce(mixxx::IndexRange::forward(0, m_frameLength))) {
+            return OpenResult::Failed;
+        }
+        return OpenResult::Succeeded;
+    }
+
+    mixxx::ReadableSampleFrames readSampleFramesClamped(
+            const mixxx::WritableSampleFrames& sampleFrames) override {
+        const auto frameIndexRange = sampleFrames.frameIndexRange();
+        CSAMPLE* pSample = sampleFrames.writableData();
+        for (SINT frameIndex = frameIndexRange.start();
+                frameIndex < frameIndexRange.end();
+                ++frameIndex) {
+            const CSAMPLE sample = m_mutedFrameRange.containsIndex(frameIndex)
+                    ? 0.0f
+                    : static_cast<CSAMPLE>(std::sin(frameIndex * 0.05) * 0.5);
+            *pSample++ = sample;
+            *pSample++ = sample;
+        }
+        return mixxx::ReadableSampleFrames(frameIndexRange,
+                mixxx::SampleBuffer::ReadableSlice(sampleFrames.writableData(),
+                        getSignalInfo().frames2samples(frameIndexRange.length())));
+    }
+
+  private:
+    const SINT m_frameLength;
+    const mixxx::IndexRange m_mutedFrameRange;
+};
+
+class AnalysisDaoTest : public LibraryTest {
+  protected:
+    AnalysisDao& analysisDao() const {
+        return internalCollection()->getAnalysisDAO();
+    }
+
+    mixxx::AudioDigest digestAudioFile(const QString& location) const {
+        const auto pAudioSource = SoundSourceProxy(
+                Track::newTemporary(getTestDir().filePath(location)))
+                                          .openAudioSource();
+        if (!pAudioSource) {
+            return mixxx::AudioDigest();
+        }
+        return mixxx::digestAudioSource(pAudioSource.get());
+    }
+};
+
+TEST_F(AnalysisDaoTest, CompactWaveformRoundTrip) {
+    for (int maxVisualSamples : {-1, kSummaryWaveformSamples}) {
+        const auto pWaveform = makeWaveform(maxVisualSamples);
+        for (auto compression : {Waveform::StorageCompression::None,
+                     Waveform::StorageCompression::Deflate}) {
+            const QByteArray data = pWaveform->toCompactByteArray(compression);
+            ASSERT_TRUE(Waveform::isCompactByteArray(data));
+            const Waveform waveform(data);
+            EXPECT_EQ(Waveform::SaveState::Saved, waveform.saveState());
+            expectEqualWaveforms(*pWaveform, waveform);
+        }
+    }
+}
+
+TEST_F(AnalysisDaoTest, RejectCorruptCompactWaveform) {
+    const auto pWaveform = makeWaveform(kSummaryWaveformSamples);
+    for (auto compression : {Waveform::StorageCompression::None,
+                 Waveform::StorageCompression::Deflate}) {
+        const QByteArray data = pWaveform->toCompactByteArray(compression);
+        const Waveform truncated(data.left(data.size() - 1));
+        EXPECT_EQ(Waveform::SaveState::NotSaved, truncated.saveState());
+        EXPECT_EQ(0, truncated.getDataSize());
+    }
+
+    // Unknown format version
+    QByteArray data = pWaveform->toCompactByteArray();
+    data[4] = 2;
+    const Waveform waveform(data);
+    EXPECT_EQ(Waveform::SaveState::NotSaved, waveform.saveState());
+    EXPECT_EQ(0, waveform.getDataSize());
+}
+
+TEST_F(AnalysisDaoTest, SaveAndLoadCompactWaveform) {
+    const TrackPointer pTrack = getOrAddTrackByLocation(getTestDir().filePath(kTrackLocation));
+    ASSERT_TRUE(pTrack);
+    const auto pWaveform = makeWaveform(-1);
+
+    AnalysisDao::AnalysisInfo info;
+    info.trackId = pTrack->getId();
+    info.type = AnalysisDao::TYPE_WAVEFORM;
+    info.version = WaveformFactory::currentWaveformVersion();
+    info.data = pWaveform->toCompactByteArray();
+    ASSERT_TRUE(analysisDao().saveAnalysis(&info));
+
+    const auto analyses = analysisDao().getAnalysesForTrack(pTrack->getId());
+    ASSERT_EQ(1, analyses.size());
+    EXPECT_EQ(info.analysisId, analyses.first().analysisId);
+    expectEqualWaveforms(*pWaveform, Waveform(analyses.first().data));
+}
+
+TEST_F(AnalysisDaoTest, ReplaceAnalysisWhileInUse) {
+    const TrackPointer pTrack = getOrAddTrackByLocation(getTestDir().filePath(kTrackLocation));
+    ASSERT_TRUE(pTrack);
+    const auto pWaveform = makeWaveform(-1);
+
+    AnalysisDao::AnalysisInfo info;
+    info.trackId = pTrack->getId();
+    info.type = AnalysisDao::TYPE_WAVEFORM;
+    info.version = WaveformFactory::currentWaveformVersion();
+    info.data = pWaveform->toCompactByteArray();
+    ASSERT_TRUE(analysisDao().saveAnalysis(&info));
+    const auto analyses = analysisDao().getAnalysesForTrack(pTrack->getId());
+    ASSERT_EQ(1, analyses.size());
+
+    // A shorter waveform replaces the file of the loaded analysis
+    const auto pSummary = makeWaveform(kSummaryWaveformSamples);
+    info.data = pSummary->toCompactByteArray();
+    ASSERT_TRUE(analysisDao().saveAnalysis(&info));
+
+    expectEqualWaveforms(*pWaveform, Waveform(analyses.first().data));
+    const auto replaced = analysisDao().getAnalysesForTrack(pTrack->getId());
+    ASSERT_EQ(1, replaced.size());
+    expectEqualWaveforms(*pSummary, Waveform(replaced.first().data));
+}
+
+TEST_F(AnalysisDaoTest, MigrateLegacyWaveformOnLoad) {
+    const TrackPointer pTrack = getOrAddTrackByLocation(getTestDir().filePath(kTrackLocation));
+    ASSERT_TRUE(pTrack);
+    const auto pWaveform = makeWaveform(kSummaryWaveformSamples);
+
+    AnalysisDao::AnalysisInfo info;
+    info.trackId = pTrack->getId();
+    info.type = AnalysisDao::TYPE_WAVESUMMARY;
+    info.version = WAVEFORMSUMMARY_5_VERSION;
+    info.data = pWaveform->toByteArray();
+    ASSERT_TRUE(analysisDao().saveAnalysis(&info));
+
+    // The first load returns the migrated analysis
+    auto analyses = analysisDao().getAnalysesForTrack(pTrack->getId());
+    ASSERT_EQ(1, analyses.size());
+    EXPECT_EQ(info.analysisId, analyses.first().analysisId);
+    EXPECT_EQ(WaveformFactory::currentWaveformSummaryVersion(), analyses.first().version);
+    EXPECT_TRUE(Waveform::isCompactByteArray(analyses.first().data));
+    expectEqualWaveforms(*pWaveform, Waveform(analyses.first().data));
+
+    // The second load maps the migrated file
+    analyses = analysisDao().getAnalysesForTrack(pTrack->getId());
+    ASSERT_EQ(1, analyses.size());
+    EXPECT_EQ(WaveformFactory::currentWaveformSummaryVersion(), analyses.first().version);
+    EXPECT_TRUE(Waveform::isCompactByteArray(analyses.first().data));
+    expectEqualWaveforms(*pWaveform, Waveform(analyses.first().data));
+}
+
+TEST_F(AnalysisDaoTest, AudioDigestIgnoresMetadata) {
+    const auto audioDigest = digestAudioFile(kTrackLocation);
+    EXPECT_FALSE(audioDigest.isEmpty());
+    EXPECT_EQ(audioDigest, digestAudioFile(kTrackLocation));
+    EXPECT_EQ(audioDigest, digestAudioFile(kSameAudioTrackLocation));
+    EXPECT_NE(audioDigest, digestAudioFile(kOtherAudioTrackLocation));
+}
+
+TEST_F(AnalysisDaoTest, AudioDigestCoversWholeTrack) {
+    constexpr SINT kEditFrameLength = 60 * kSampleRate;
+    const auto digestSine = [](mixxx::IndexRange mutedFrameRange) {
+        SineAudioSource audioSource(kEditFrameLength, mutedFrameRange);
+        EXPECT_EQ(mixxx::AudioSource::OpenResult::Succeeded,
+                audioSource.open(mixxx::AudioSource::OpenMode::Strict));
+        return mixxx::digestAudioSource(&audioSource);
+    };
+    const auto audioDigest = digestSine(mixxx::IndexRange());
+    EXPECT_FALSE(audioDigest.isEmpty());
+    EXPECT_EQ(audioDigest, digestSine(mixxx::IndexRange()));
+    // A single word muted anywhere in a track of the same length
+    for (SINT frameIndex : {SINT{0}, kEditFrameLength / 3, kEditFrameLength - kSampleRate}) {
+        EXPECT_NE(audioDigest,
+                digestSine(mixxx::IndexRange::forward(frameIndex, kSampleRate / 2)))
+                << "muted at frame " << frameIndex;
+    }
+}
+
+TEST_F(AnalysisDaoTest, AudioDigestWhileDecoding) {
+    constexpr SINT kEditFrameLength = 60 * kSampleRate;
+    SineAudioSource audioSource(kEditFrameLength, mixxx::IndexRange());
+    ASSERT_EQ(mixxx::AudioSource::OpenResult::Succeeded,
+            audioSource.open(mixxx::AudioSource::OpenMode::Strict));
+    const auto audioDigest = mixxx::digestAudioSource(&audioSource);
+    ASSERT_FALSE(audioDigest.isEmpty());
+
+    // Decoded in chunks of a different size, e.g. by the analysis
+    constexpr SINT kChunkFrames = 3000;
+    mixxx::AudioDigestCalculator calculator(
+            audioSource.getSignalInfo(), audioSource.frameLength());
+    mixxx::SampleBuffer sampleBuffer(
+            audioSource.getSignalInfo().frames2samples(kChunkFrames));
+    mixxx::IndexRange frameRange = audioSource.frameIndexRange();
+    while (!frameRange.empty()) {
+        const auto readableSampleFrames = audioSource.readSampleFrames(
+                mixxx::WritableSampleFrames(
+                        frameRange.splitAndShrinkFront(
+                                math_min(kChunkFrames, frameRange.length())),
+                        mixxx::SampleBuffer::WritableSlice(sampleBuffer)));
+        calculator.addSamples(
+                readableSampleFrames.readableData(),
+                readableSampleFrames.readableLength());
+    }
+    EXPECT_EQ(audioDigest, calculator.finish());
+}
+
+TEST_F(AnalysisDaoTest, AdoptWaveformOfSameAudio) {
+    const TrackPointer pTrack = getOrAddTrackByLocation(getTestDir().filePath(kTrackLocation));
+    ASSERT_TRUE(pTrack);
+    const TrackPointer pCopy = getOrAddTrackByLocation(
+            getTestDir().filePath(kSameAudioTrackLocation));
+    ASSERT_TRUE(pCopy);
+    const auto audioDigest = digestAudioFile(kTrackLocation);
+    ASSERT_FALSE(audioDigest.isEmpty());
+
+    // Saved before the digest of the track is known
+    const auto pWaveform = makeWaveform(-1);
+    AnalysisDao::AnalysisInfo info;
+    info.trackId = pTrack->getId();
+    info.type = AnalysisDao::TYPE_WAVEFORM;
+    info.version = WaveformFactory::currentWaveformVersion();
+    info.data = pWaveform->toCompactByteArray();
+    ASSERT_TRUE(analysisDao().saveAnalysis(&info));
+    EXPECT_TRUE(analysisDao().getAnalysesForAudioDigest(
+                                    audioDigest, AnalysisDao::TYPE_WAVEFORM, pCopy->getId())
+                        .isEmpty());
+
+    ASSERT_TRUE(analysisDao().saveAudioDigest(pTrack->getId(), audioDigest));
+    ASSERT_TRUE(analysisDao().saveAudioDigest(pCopy->getId(), audioDigest));
+    EXPECT_EQ(audioDigest, analysisDao().getAudioDigest(pCopy->getId()));
+    EXPECT_TRUE(analysisDao().getAnalysesForAudioDigest(
+                                    audioDigest, AnalysisDao::TYPE_WAVESUMMARY, pCopy->getId())
+                        .isEmpty());
+
+    auto analyses = analysisDao().getAnalysesForAudioDigest(
+            audioDigest, AnalysisDao::TYPE_WAVEFORM, pCopy->getId());
+    ASSERT_EQ(1, analyses.size());
+    EXPECT_EQ(pTrack->getId(), analyses.first().trackId);
+    ASSERT_TRUE(analysisDao().adoptAnalysis(&analyses.first(), pCopy->getId()));
+    EXPECT_NE(info.analysisId, analyses.first().analysisId);
+
+    // The copy remains after the analyses of the original have been deleted
+    analysisDao().deleteAnalysesForTrack(pTrack->getId());
+    analyses = analysisDao().getAnalysesForTrack(pCopy->getId());
+    ASSERT_EQ(1, analyses.size());
+    expectEqualWaveforms(*pWaveform, Waveform(analyses.first().data));
+}
+
+TEST_F(AnalysisDaoTest, GetLibraryAnalysisForAudioDigest) {
+    const TrackPointer pTrack = getOrAddTrackByLocation(getTestDir().filePath(kTrackLocation));
+    ASSERT_TRUE(pTrack);
+    const TrackPointer pCopy = getOrAddTrackByLocation(
+            getTestDir().filePath(kSameAudioTrackLocation));
+    ASSERT_TRUE(pCopy);
+    const QByteArray audioDigest = QByteArrayLiteral("audio digest");
+    ASSERT_TRUE(analysisDao().saveAudioDigest(pTrack->getId(), audioDigest));
+    ASSERT_TRUE(analysisDao().saveAudioDigest(pCopy->getId(), audioDigest));
+
+    const mixxx::ReplayGain replayGain(0.5, 0.75f);
+    pTrack->setReplayGain(replayGain);
+    pTrack->setKeys(KeyFactory::makeBasicKeys(
+            mixxx::track::io::key::A_MINOR,
+            mixxx::track::io::key::ANALYZER));
+    ASSERT_TRUE(internalCollection()->saveTrack(pTrack.get()));
+
+    const auto libraryAnalysis =
+            analysisDao().getLibraryAnalysisForAudioDigest(audioDigest, pCopy->getId());
+    ASSERT_TRUE(libraryAnalysis);
+    EXPECT_EQ(replayGain, libraryAnalysis->replayGain);
+    QByteArray keys = libraryAnalysis->keys;
+    EXPECT_EQ(mixxx::track::io::key::A_MINOR,
+            KeyFactory::loadKeysFromByteArray(libraryAnalysis->keysVersion,
+                    libraryAnalysis->keysSubVersion,
+                    &keys)
+                    .getGlobalKey());
+
+    // The results of the track itself are excluded
+    const auto copyAnalysis =
+            analysisDao().getLibraryAnalysisForAudioDigest(audioDigest, pTrack->getId());
+    ASSERT_TRUE(copyAnalysis);
+    EXPECT_FALSE(copyAnalysis->replayGain.hasRatio());
+
+    EXPECT_FALSE(analysisDao().getLibraryAnalysisForAudioDigest(
+            QByteArrayLiteral("other audio digest"), pCopy->getId()));
+}
+
+// Measures the time from opening the stored main waveform of a track until
+// the Waveform is ready to be rendered, i.e. the steps AnalysisDao and
+// WaveformFactory take when a track is loaded into a deck. The checksum
+// verification is the same for all formats and omitted.
+// Argument: 0 = protobuf (before), 1 = compact, 2 = compact + deflate
+static void BM_LoadStoredWaveform(benchmark::State& state) {
+    const auto pWaveform = makeWaveform(-1);
+    QByteArray storedData;
+    switch (state.range(0)) {
+    case 0:
+        storedData = qCompress(pWaveform->toByteArray());
+        break;
+    case 1:
+        storedData = pWaveform->toCompactByteArray(Waveform::StorageCompression::None);
+        break;
+    default:
+        storedData = pWaveform->toCompactByteArray(Waveform::StorageCompression::Deflate);
+        break;
+    }
+    QTemporaryDir storageDir;
+    const QString filePath = storageDir.filePath(QStringLiteral("1"));
+    {
+        QFile file(filePath);
+        if (!file.open(QIODevice::WriteOnly) || file.write(storedData) != storedData.size()) {
+            state.SkipWithError("Failed to write the waveform");
+            return;
+        }
+    }
+
+    for (auto _ : state) {
+        QFile file(filePath);
+        file.open(QIODevice::ReadOnly);
+        const qint64 size = file.size();
+        const QByteArray mappedData = QByteArray::fromRawData(
+                reinterpret_cast<const char*>(file.map(0, size)),
+                static_cast<int>(size));
+        const QByteArray data = Waveform::isCompactByteArray(mappedData)
+                ? mappedData
+                : qUncompress(mappedData);
+        const Waveform waveform(data);
+        benchmark::DoNotOptimize(waveform.getCompletion());
+    }
+    state.counters["bytes"] = storedData.size();
+}
+BENCHMARK(BM_LoadStoredWaveform)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+} // namespace
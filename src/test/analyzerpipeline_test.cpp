@@ -0,0 +1,202 @@
+#include "analyzer/analyzerpipeline.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QDirIterator>
+#include <QSemaphore>
+#include <QTemporaryDir>
+#include <vector>
+
+#include "analyzer/analyzerthread.h"
+#include "analyzer/analyzertrack.h"
+#include "test/mixxxtest.h"
+#include "test/soundsourceproviderregistration.h"
+#include "track/track.h"
+
+namespace {
+
+constexpr SINT kSamplesPerBlock = 64;
+
+// Records all samples for verifying that nothing got lost or reordered
+class RecordingAnalyzer : public Analyzer {
+  public:
+    explicit RecordingAnalyzer(std::vector<CSAMPLE>* pSamples)
+            : m_pSamples(pSamples) {
+    }
+
+    bool initialize(const AnalyzerTrack& track,
+            mixxx::audio::SampleRate sampleRate,
+            SINT frameLength) override {
+        Q_UNUSED(track);
+        Q_UNUSED(sampleRate);
+        Q_UNUSED(frameLength);
+        return true;
+    }
+
+    bool processSamples(const CSAMPLE* pIn, SINT count) override {
+        m_pSamples->insert(m_pSamples->end(), pIn, pIn + count);
+        return true;
+    }
+
+    void storeResults(TrackPointer pTrack) override {
+        Q_UNUSED(pTrack);
+    }
+
+    void cleanup() override {
+    }
+
+  private:
+    std::vector<CSAMPLE>* const m_pSamples;
+};
+
+class AnalyzerPipelineTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        m_samples.resize(3);
+        for (auto& samples : m_samples) {
+            m_analyzers.emplace_back(std::make_unique<RecordingAnalyzer>(&samples));
+        }
+        const auto pTrack = Track::newTemporary();
+        for (auto& analyzer : m_analyzers) {
+            analyzer.initialize(AnalyzerTrack(pTrack), mixxx::audio::SampleRate(44100), 0);
+        }
+    }
+
+    void TearDown() override {
+        for (auto& analyzer : m_analyzers) {
+            analyzer.cancel();
+        }
+    }
+
+    // Publishes numBlocks blocks of increasing sample values, with an
+    // offset within the block to imitate AudioSourceStereoProxy.
+    std::vector<CSAMPLE> publishBlocks(AnalyzerPipeline* pPipeline, int numBlocks) {
+        std::vector<CSAMPLE> expected;
+        for (int i = 0; i < numBlocks; ++i) {
+            const auto block = pPipeline->nextWritableBlock();
+            EXPECT_EQ(kSamplesPerBlock, block.length());
+            const SINT offset = i % 4;
+            for (SINT j = offset; j < block.length(); ++j) {
+                block[j] = static_cast<CSAMPLE>(i * kSamplesPerBlock + j);
+                expected.push_back(block[j]);
+            }
+            pPipeline->publishBlock(block.data(offset), block.length() - offset);
+        }
+        return expected;
+    }
+
+    std::vector<std::vector<CSAMPLE>> m_samples;
+    std::vector<AnalyzerWithState> m_analyzers;
+};
+
+TEST_F(AnalyzerPipelineTest, AllStagesReceiveAllBlocksInOrder) {
+    // Fewer blocks than published to force the decoder to wait
+    AnalyzerPipeline pipeline(&m_analyzers, 4, kSamplesPerBlock);
+    ASSERT_EQ(3, pipeline.numStages());
+
+    const auto expected = publishBlocks(&pipeline, 1000);
+    pipeline.drain();
+
+    for (const auto& samples : m_samples) {
+        EXPECT_EQ(expected, samples);
+    }
+}
+
+TEST_F(AnalyzerPipelineTest, DrainDiscardsUnpublishedBlock) {
+    AnalyzerPipeline pipeline(&m_analyzers, 2, kSamplesPerBlock);
+
+    const auto expected = publishBlocks(&pipeline, 5);
+    // Acquired, but never published, e.g. after cancelling
+    pipeline.nextWritableBlock();
+    pipeline.drain();
+    for (const auto& samples : m_samples) {
+        EXPECT_EQ(expected, samples);
+    }
+
+    // The pipeline is still usable after draining
+    for (auto& samples : m_samples) {
+        samples.clear();
+    }
+    const auto expected2 = publishBlocks(&pipeline, 5);
+    pipeline.drain();
+    for (const auto& samples : m_samples) {
+        EXPECT_EQ(expected2, samples);
+    }
+}
+
+class ProviderRegistration : public SoundSourceProviderRegistration {
+};
+
+// The corpus can be replaced by setting MIXXX_ANALYZER_BENCHMARK_CORPUS to a
+// directory with audio files. Otherwise the files of the test suite are used.
+QStringList benchmarkCorpus() {
+    QString corpusPath = qEnvironmentVariable("MIXXX_ANALYZER_BENCHMARK_CORPUS");
+    if (corpusPath.isEmpty()) {
+        corpusPath = MixxxTest::getOrInitTestDir().filePath(QStringLiteral("id3-test-data"));
+    }
+    QStringList filePaths;
+    QDirIterator it(corpusPath, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        const QString filePath = it.next();
+        if (SoundSourceProxy::isFileNameSupported(filePath)) {
+            filePaths.append(filePath);
+        }
+    }
+    filePaths.sort();
+    return filePaths;
+}
+
+// Analyzes the corpus with a single AnalyzerThread and reports the
+// throughput in tracks per minute. Argument: pipelined mode (0/1)
+static void BM_AnalyzeCorpus(benchmark::State& state) {
+    const ProviderRegistration providerRegistration;
+    const QStringList filePaths = benchmarkCorpus();
+    if (filePaths.isEmpty()) {
+        state.SkipWithError("No audio files found");
+        return;
+    }
+    QTemporaryDir configDir;
+    UserSettingsPointer pConfig(new UserSettings(configDir.filePath("test.cfg")));
+
+    int modeFlags = AnalyzerModeFlags::WithBeats;
+    if (state.range(0)) {
+        modeFlags |= AnalyzerModeFlags::Pipelined;
+    }
+    auto pThread = AnalyzerThread::createInstance(0,
+            mixxx::DbConnectionPoolPtr(),
+            pConfig,
+            static_cast<AnalyzerModeFlags>(modeFlags));
+    QSemaphore done;
+    // Invoked directly on the analyzer thread
+    QObject::connect(
+            pThread.get(),
+            &AnalyzerThread::progress,
+            [&done](int, AnalyzerThreadState threadState, TrackId, AnalyzerProgress) {
+                if (threadState == AnalyzerThreadState::Done) {
+                    done.release();
+                }
+            });
+    pThread->start();
+
+    std::int64_t numTracks = 0;
+    for (auto _ : state) {
+        for (const auto& filePath : filePaths) {
+            // A new track object is not analyzed yet
+            pThread->submitNextTrack(AnalyzerTrack(Track::newTemporary(filePath)));
+            done.acquire();
+            ++numTracks;
+        }
+    }
+    state.counters["tracks/min"] = benchmark::Counter(
+            static_cast<double>(numTracks * 60), benchmark::Counter::kIsRate);
+
+    pThread->stop();
+    pThread->wait();
+    pThread.reset();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+BENCHMARK(BM_AnalyzeCorpus)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+#include <dsp/transforms/FFT.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "analyzer/constants.h"
+#include "analyzer/plugins/analyzerqueenmarybeats.h"
+#include "analyzer/plugins/analyzerqueenmarykey.h"
+#include "util/math.h"
+#include "util/samplebuffer.h"
+
+namespace {
+
+constexpr mixxx::audio::SampleRate kSampleRate(44100);
+constexpr SINT kDurationFrames = 30 * 44100;
+constexpr double kBeatToleranceFrames = 1.0;
+
+/// A kick drum at 120 BPM on top of a sustained A minor chord
+mixxx::SampleBuffer generateSignal() {
+    mixxx::SampleBuffer signal(kDurationFrames * mixxx::kAnalysisChannels);
+    const double chord[] = {220.0, 261.63, 329.63};
+    const SINT beatLengthFrames = kSampleRate.value() / 2;
+    for (SINT frame = 0; frame < kDurationFrames; ++frame) {
+        const double t = static_cast<double>(frame) / kSampleRate.value();
+        double value = 0;
+        for (const double frequency : chord) {
+            value += 0.1 * std::sin(2 * M_PI * frequency * t);
+        }
+        const double beatTime =
+                static_cast<double>(frame % beatLengthFrames) / kSampleRate.value();
+        value += 0.6 * std::exp(-beatTime * 30) * std::sin(2 * M_PI * 60 * beatTime);
+        signal[frame * 2] = static_cast<CSAMPLE>(value);
+        signal[frame * 2 + 1] = static_cast<CSAMPLE>(value);
+    }
+    return signal;
+}
+
+/// Feeds the signal in chunks like the AnalyzerThread
+template<class Analyzer>
+std::unique_ptr<Analyzer> analyze(const mixxx::SampleBuffer& signal, FFTBackend backend) {
+    setFFTBackend(backend);
+    auto pAnalyzer = std::make_unique<Analyzer>();
+    pAnalyzer->initialize(kSampleRate);
+    for (SINT i = 0; i < signal.size(); i += mixxx::kAnalysisSamplesPerChunk) {
+        pAnalyzer->processSamples(&signal[i],
+                math_min(mixxx::kAnalysisSamplesPerChunk, signal.size() - i));
+    }
+    pAnalyzer->finalize();
+    setFFTBackend(FFTBackendAuto);
+    return pAnalyzer;
+}
+
+class AnalyzerQueenMaryTest : public testing::Test {
+  protected:
+    AnalyzerQueenMaryTest()
+            : m_signal(generateSignal()) {
+    }
+
+    const mixxx::SampleBuffer m_signal;
+};
+
+TEST_F(AnalyzerQueenMaryTest, FFTBackendsProduceSameResults) {
+    for (const int size : {512, 1024, 2048, 4096}) {
+        setFFTBackend(FFTBackendKissFFT);
+        FFTReal kissFFT(size);
+        setFFTBackend(FFTBackendRadix4);
+        FFTReal radix4FFT(size);
+        setFFTBackend(FFTBackendAuto);
+        ASSERT_EQ(FFTBackendKissFFT, kissFFT.getBackend());
+        ASSERT_EQ(FFTBackendRadix4, radix4FFT.getBackend());
+
+        std::vector<double> input(&m_signal[0], &m_signal[0] + size);
+        std::vector<double> expected(size);
+        std::vector<double> actual(size);
+        kissFFT.forwardMagnitude(input.data(), expected.data());
+        radix4FFT.forwardMagnitude(input.data(), actual.data());
+        for (int i = 0; i < size; ++i) {
+            ASSERT_NEAR(expected[i], actual[i], 1e-9 * (1 + expected[i]));
+        }
+    }
+}
+
+TEST_F(AnalyzerQueenMaryTest, BeatsMatchKissFFT) {
+    const auto pExpected = analyze<mixxx::AnalyzerQueenMaryBeats>(m_signal, FFTBackendKissFFT);
+    const auto pActual = analyze<mixxx::AnalyzerQueenMaryBeats>(m_signal, FFTBackendRadix4);
+
+    const auto expectedBeats = pExpected->getBeats();
+    const auto actualBeats = pActual->getBeats();
+    ASSERT_GT(expectedBeats.size(), 0);
+    ASSERT_EQ(expectedBeats.size(), actualBeats.size());
+    for (int i = 0; i < expectedBeats.size(); ++i) {
+        EXPECT_NEAR(expectedBeats[i].value(), actualBeats[i].value(), kBeatToleranceFrames);
+    }
+}
+
+TEST_F(AnalyzerQueenMaryTest, KeysMatchKissFFT) {
+    const auto pExpected = analyze<mixxx::AnalyzerQueenMaryKey>(m_signal, FFTBackendKissFFT);
+    const auto pActual = analyze<mixxx::AnalyzerQueenMaryKey>(m_signal, FFTBackendRadix4);
+
+    const auto expectedKeys = pExpected->getKeyChanges();
+    const auto actualKeys = pActual->getKeyChanges();
+    ASSERT_GT(expectedKeys.size(), 0);
+    ASSERT_EQ(expectedKeys.size(), actualKeys.size());
+    for (int i = 0; i < expectedKeys.size(); ++i) {
+        EXPECT_EQ(expectedKeys[i].first, actualKeys[i].first);
+        EXPECT_DOUBLE_EQ(expectedKeys[i].second, actualKeys[i].second);
+    }
+}
+
+template<class Analyzer>
+void benchmarkAnalyzer(benchmark::State& state) {
+    const auto backend = static_cast<FFTBackend>(state.range(0));
+    const mixxx::SampleBuffer signal = generateSignal();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(analyze<Analyzer>(signal, backend));
+    }
+    state.SetItemsProcessed(state.iterations() * kDurationFrames);
+}
+
+static void BM_AnalyzerQueenMaryBeats(benchmark::State& state) {
+    benchmarkAnalyzer<mixxx::AnalyzerQueenMaryBeats>(state);
+}
+BENCHMARK(BM_AnalyzerQueenMaryBeats)
+        ->Arg(FFTBackendKissFFT)
+        ->Arg(FFTBackendRadix4)
+        ->Unit(benchmark::kMillisecond);
+
+static void BM_AnalyzerQueenMaryKey(benchmark::State& state) {
+    benchmarkAnalyzer<mixxx::AnalyzerQueenMaryKey>(state);
+}
+BENCHMARK(BM_AnalyzerQueenMaryKey)
+        ->Arg(FFTBackendKissFFT)
+        ->Arg(FFTBackendRadix4)
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace
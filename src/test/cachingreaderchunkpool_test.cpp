@@ -0,0 +1,81 @@
+#include "engine/cachingreader/cachingreaderchunkpool.h"
+
+#include <gtest/gtest.h>
+
+#include <QThread>
+#include <atomic>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace {
+
+TEST(CachingReaderChunkPoolTest, AllocateAndRelease) {
+    CachingReaderChunkPool pool(4);
+    EXPECT_EQ(4, pool.numFreeChunks());
+
+    std::set<CachingReaderChunkForOwner*> chunks;
+    for (int i = 0; i < 4; ++i) {
+        auto* pChunk = pool.allocate();
+        ASSERT_NE(nullptr, pChunk);
+        EXPECT_EQ(CachingReaderChunkForOwner::FREE, pChunk->getState());
+        chunks.insert(pChunk);
+    }
+    // All chunks are distinct
+    EXPECT_EQ(4u, chunks.size());
+    EXPECT_EQ(0, pool.numFreeChunks());
+    EXPECT_EQ(nullptr, pool.allocate());
+
+    for (auto* pChunk : chunks) {
+        pool.release(pChunk);
+    }
+    EXPECT_EQ(4, pool.numFreeChunks());
+}
+
+TEST(CachingReaderChunkPoolTest, FairShare) {
+    CachingReaderChunkPool pool(12);
+    EXPECT_EQ(12, pool.fairShare());
+    pool.registerReader();
+    pool.registerReader();
+    pool.registerReader();
+    EXPECT_EQ(4, pool.fairShare());
+    pool.unregisterReader();
+    pool.unregisterReader();
+    pool.unregisterReader();
+}
+
+TEST(CachingReaderChunkPoolTest, ConcurrentAllocateAndRelease) {
+    constexpr SINT kNumChunks = 16;
+    constexpr int kNumThreads = 4;
+    constexpr int kNumIterations = 10000;
+    CachingReaderChunkPool pool(kNumChunks);
+
+    // Counts how often each chunk is in use at the same time
+    std::vector<std::atomic<int>> inUse(kNumChunks);
+    std::atomic<bool> failed(false);
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back(QThread::create([&pool, &inUse, &failed] {
+            for (int i = 0; i < kNumIterations; ++i) {
+                auto* pChunk = pool.allocate();
+                if (!pChunk) {
+                    continue;
+                }
+                if (inUse[pChunk->getPoolIndex()].fetch_add(1) != 0) {
+                    failed = true;
+                }
+                inUse[pChunk->getPoolIndex()].fetch_sub(1);
+                pool.release(pChunk);
+            }
+        }));
+        threads.back()->start();
+    }
+    for (const auto& pThread : threads) {
+        EXPECT_TRUE(pThread->wait(10000));
+    }
+    EXPECT_FALSE(failed.load());
+    EXPECT_EQ(kNumChunks, pool.numFreeChunks());
+}
+
+} // namespace
@@ -0,0 +1,303 @@
+#include "engine/cachingreader/cachingreaderworker.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "test/mixxxtest.h"
+
+namespace {
+
+constexpr int kFifoSize = 16;
+
+const QString kDeckGroup = QStringLiteral("[Channel1]");
+
+// Generates a deterministic signal and fails to read any frames
+// beyond readableFrameLength, like a corrupt or truncated file.
+class TestAudioSource : public mixxx::AudioSource {
+  public:
+    TestAudioSource(SINT frameLength, SINT readableFrameLength)
+            : AudioSource(QUrl::fromLocalFile(QStringLiteral("test.wav"))),
+              m_frameLength(frameLength),
+              m_readableFrameLength(readableFrameLength),
+              m_readCount(0),
+              m_closeCount(0) {
+    }
+
+    static CSAMPLE sampleValue(SINT frameIndex, int channel) {
+        return static_cast<CSAMPLE>((frameIndex % 1000) * 2 + channel) / 2048.0f;
+    }
+
+    int readCount() const {
+        return m_readCount;
+    }
+
+    int closeCount() const {
+        return m_closeCount;
+    }
+
+    void close() override {
+        ++m_closeCount;
+    }
+
+  protected:
+    OpenResult tryOpen(
+            OpenMode mode,
+            const OpenParams& params) override {
+        Q_UNUSED(mode);
+        Q_UNUSED(params);
+        if (!initChannelCountOnce(mixxx::kEngineChannelCount) ||
+                !initSampleRateOnce(mixxx::audio::SampleRate(44100)) ||
+                !initFrameIndexRangeOnce(mixxx::IndexRange::forward(0, m_frameLength))) {
+            return OpenResult::Failed;
+        }
+        return OpenResult::Succeeded;
+    }
+
+    mixxx::ReadableSampleFrames readSampleFramesClamped(
+            const mixxx::WritableSampleFrames& sampleFrames) override {
+        ++m_readCount;
+        const auto frameIndexRange = sampleFrames.frameIndexRange();
+        const auto readableFrameIndexRange = intersect(frameIndexRange,
+                mixxx::IndexRange::forward(0, m_readableFrameLength));
+        if (readableFrameIndexRange.empty() ||
+                readableFrameIndexRange.start() != frameIndexRange.start()) {
+            return mixxx::ReadableSampleFrames(
+                    mixxx::IndexRange::forward(frameIndexRange.start(), 0));
+        }
+        CSAMPLE* pSample = sampleFrames.writableData();
+        for (SINT frameIndex = readableFrameIndexRange.start();
+                frameIndex < readableFrameIndexRange.end();
+                ++frameIndex) {
+            for (int channel = 0; channel < getSignalInfo().getChannelCount(); ++channel) {
+                *pSample++ = sampleValue(frameIndex, channel);
+            }
+        }
+        return mixxx::ReadableSampleFrames(readableFrameIndexRange,
+                mixxx::SampleBuffer::ReadableSlice(sampleFrames.writableData(),
+                        getSignalInfo().frames2samples(
+                                readableFrameIndexRange.length())));
+    }
+
+  private:
+    const SINT m_frameLength;
+    const SINT m_readableFrameLength;
+    int m_readCount;
+    int m_closeCount;
+};
+
+} // namespace
+
+class CachingReaderWorkerTest : public MixxxTest {
+  protected:
+    CachingReaderWorkerTest()
+            : m_chunkReadRequestFIFO(kFifoSize),
+              m_readerStatusFIFO(kFifoSize),
+              m_chunkBuffer(CachingReaderChunk::kSamples),
+              m_chunk(mixxx::SampleBuffer::WritableSlice(m_chunkBuffer), 0) {
+        config()->set(ConfigKey("[Master]", "decode_whole_tracks"), ConfigValue(1));
+    }
+
+    std::unique_ptr<CachingReaderWorker> createWorker(const QString& group) {
+        return std::make_unique<CachingReaderWorker>(group,
+                config(),
+                &m_chunkReadRequestFIFO,
+                &m_readerStatusFIFO);
+    }
+
+    // Opens the audio source like CachingReaderWorker::loadTrack()
+    // without the need for a track file.
+    std::shared_ptr<TestAudioSource> openAudioSource(
+            CachingReaderWorker* pWorker,
+            SINT frameLength,
+            SINT readableFrameLength) {
+        auto pAudioSource = std::make_shared<TestAudioSource>(
+                frameLength, readableFrameLength);
+        EXPECT_EQ(mixxx::AudioSource::OpenResult::Succeeded,
+                pAudioSource->open(mixxx::AudioSource::OpenMode::Strict));
+        pWorker->m_pAudioSource = pAudioSource;
+        mixxx::SampleBuffer(CachingReaderChunk::kSamples).swap(pWorker->m_tempReadBuffer);
+        pWorker->allocateTrackBuffer();
+        return pAudioSource;
+    }
+
+    CachingReaderTrackBuffer* trackBuffer(CachingReaderWorker* pWorker) {
+        return pWorker->m_pTrackBuffer.get();
+    }
+
+    void decodeTrackBuffer(CachingReaderWorker* pWorker, int blockCount) {
+        for (int i = 0; i < blockCount; ++i) {
+            ASSERT_FALSE(pWorker->m_pTrackBuffer->isDecodingFinished());
+            pWorker->decodeTrackBuffer();
+        }
+    }
+
+    void decodeWholeTrackBuffer(CachingReaderWorker* pWorker) {
+        while (!pWorker->m_pTrackBuffer->isDecodingFinished()) {
+            pWorker->decodeTrackBuffer();
+        }
+    }
+
+    ReaderStatusUpdate readChunk(CachingReaderWorker* pWorker, SINT chunkIndex) {
+        m_chunk.init(chunkIndex);
+        CachingReaderChunkReadRequest request;
+        request.chunk = &m_chunk;
+        request.hintTimeNanos = 0;
+        return pWorker->processReadRequest(request);
+    }
+
+    void unloadTrack(CachingReaderWorker* pWorker) {
+        pWorker->unloadTrack();
+    }
+
+    // Verifies the samples of the last chunk that has been read
+    void expectChunkSamples(mixxx::IndexRange frameIndexRange) {
+        std::vector<CSAMPLE> samples(
+                CachingReaderChunk::frames2samples(frameIndexRange.length()));
+        ASSERT_EQ(frameIndexRange,
+                m_chunk.readBufferedSampleFrames(samples.data(), frameIndexRange));
+        auto pSample = samples.cbegin();
+        for (SINT frameIndex = frameIndexRange.start();
+                frameIndex < frameIndexRange.end();
+                ++frameIndex) {
+            for (int channel = 0; channel < CachingReaderChunk::kChannels; ++channel) {
+                ASSERT_EQ(TestAudioSource::sampleValue(frameIndex, channel), *pSample++)
+                        << "frame " << frameIndex << ", channel " << channel;
+            }
+        }
+    }
+
+    static mixxx::IndexRange chunkFrameIndexRange(SINT chunkIndex) {
+        return mixxx::IndexRange::forward(
+                chunkIndex * CachingReaderChunk::kFrames,
+                CachingReaderChunk::kFrames);
+    }
+
+    FIFO<CachingReaderChunkReadRequest> m_chunkReadRequestFIFO;
+    FIFO<ReaderStatusUpdate> m_readerStatusFIFO;
+    mixxx::SampleBuffer m_chunkBuffer;
+    CachingReaderChunkForOwner m_chunk;
+};
+
+TEST_F(CachingReaderWorkerTest, DecodedChunksAreServedWhileDecoding) {
+    constexpr SINT kTrailingFrames = 100;
+    constexpr SINT kFrameLength = 4 * CachingReaderChunk::kFrames + kTrailingFrames;
+    auto pWorker = createWorker(kDeckGroup);
+    auto pAudioSource = openAudioSource(pWorker.get(), kFrameLength, kFrameLength);
+    ASSERT_NE(nullptr, trackBuffer(pWorker.get()));
+    EXPECT_TRUE(trackBuffer(pWorker.get())->isInRam());
+
+    decodeTrackBuffer(pWorker.get(), 2);
+    EXPECT_EQ(mixxx::IndexRange::forward(0, 2 * CachingReaderChunk::kFrames),
+            trackBuffer(pWorker.get())->decodedFrameIndexRange());
+    const int decodedReadCount = pAudioSource->readCount();
+
+    // Inside of the decoded range the decoder is not invoked
+    EXPECT_EQ(CHUNK_READ_SUCCESS, readChunk(pWorker.get(), 1).status);
+    EXPECT_EQ(decodedReadCount, pAudioSource->readCount());
+    expectChunkSamples(chunkFrameIndexRange(1));
+
+    // Outside of the decoded range the chunk is read from the audio source
+    EXPECT_EQ(CHUNK_READ_SUCCESS, readChunk(pWorker.get(), 3).status);
+    EXPECT_LT(decodedReadCount, pAudioSource->readCount());
+    expectChunkSamples(chunkFrameIndexRange(3));
+
+    // Decoding continues after the read request
+    decodeWholeTrackBuffer(pWorker.get());
+    EXPECT_EQ(mixxx::IndexRange::forward(0, kFrameLength),
+            trackBuffer(pWorker.get())->decodedFrameIndexRange());
+    const int finishedReadCount = pAudioSource->readCount();
+    EXPECT_EQ(CHUNK_READ_SUCCESS, readChunk(pWorker.get(), 4).status);
+    EXPECT_EQ(finishedReadCount, pAudioSource->readCount());
+    expectChunkSamples(mixxx::IndexRange::forward(
+            4 * CachingReaderChunk::kFrames, kTrailingFrames));
+}
+
+TEST_F(CachingReaderWorkerTest, TrackBufferFallsBackToFile) {
+    constexpr SINT kFrameLength = 3 * CachingReaderChunk::kFrames;
+    // The track doesn't fit into a RAM budget of 0 MiB
+    config()->set(ConfigKey("[Master]", "decode_whole_tracks_ram_budget_mb"), ConfigValue(0));
+    auto pWorker = createWorker(kDeckGroup);
+    auto pAudioSource = openAudioSource(pWorker.get(), kFrameLength, kFrameLength);
+    ASSERT_NE(nullptr, trackBuffer(pWorker.get()));
+    EXPECT_FALSE(trackBuffer(pWorker.get())->isInRam());
+
+    decodeWholeTrackBuffer(pWorker.get());
+    EXPECT_EQ(mixxx::IndexRange::forward(0, kFrameLength),
+            trackBuffer(pWorker.get())->decodedFrameIndexRange());
+    const int decodedReadCount = pAudioSource->readCount();
+    for (SINT chunkIndex = 0; chunkIndex < 3; ++chunkIndex) {
+        EXPECT_EQ(CHUNK_READ_SUCCESS, readChunk(pWorker.get(), chunkIndex).status);
+        expectChunkSamples(chunkFrameIndexRange(chunkIndex));
+    }
+    EXPECT_EQ(decodedReadCount, pAudioSource->readCount());
+}
+
+TEST_F(CachingReaderWorkerTest, ReadErrorStopsDecoding) {
+    constexpr SINT kFrameLength = 4 * CachingReaderChunk::kFrames;
+    // The file is corrupt in the middle of the third chunk
+    constexpr SINT kReadableFrameLength = 2 * CachingReaderChunk::kFrames + 1000;
+    auto pWorker = createWorker(kDeckGroup);
+    auto pAudioSource = openAudioSource(pWorker.get(), kFrameLength, kReadableFrameLength);
+    ASSERT_NE(nullptr, trackBuffer(pWorker.get()));
+
+    decodeWholeTrackBuffer(pWorker.get());
+    // Only the complete blocks before the read error are decoded
+    EXPECT_EQ(mixxx::IndexRange::forward(0, 2 * CachingReaderChunk::kFrames),
+            trackBuffer(pWorker.get())->decodedFrameIndexRange());
+    EXPECT_EQ(mixxx::IndexRange::forward(0, kReadableFrameLength),
+            pAudioSource->frameIndexRange());
+
+    // The decoded chunks are still served from the track buffer
+    const int decodedReadCount = pAudioSource->readCount();
+    EXPECT_EQ(CHUNK_READ_SUCCESS, readChunk(pWorker.get(), 1).status);
+    EXPECT_EQ(decodedReadCount, pAudioSource->readCount());
+    expectChunkSamples(chunkFrameIndexRange(1));
+
+    // The readable part of the corrupt chunk is read from the audio source
+    const auto update = readChunk(pWorker.get(), 2);
+    EXPECT_EQ(CHUNK_READ_SUCCESS, update.status);
+    EXPECT_EQ(mixxx::IndexRange::forward(0, kReadableFrameLength),
+            update.readableFrameIndexRange());
+    expectChunkSamples(mixxx::IndexRange::forward(
+            2 * CachingReaderChunk::kFrames, 1000));
+
+    // Chunks behind the read error are invalid
+    EXPECT_EQ(CHUNK_READ_INVALID, readChunk(pWorker.get(), 3).status);
+}
+
+TEST_F(CachingReaderWorkerTest, UnloadWhileDecoding) {
+    constexpr SINT kFrameLength = 4 * CachingReaderChunk::kFrames;
+    const SINT trackBufferBytes =
+            CachingReaderChunk::frames2samples(kFrameLength) * sizeof(CSAMPLE);
+    auto pWorker = createWorker(kDeckGroup);
+    auto pAudioSource = openAudioSource(pWorker.get(), kFrameLength, kFrameLength);
+    ASSERT_NE(nullptr, trackBuffer(pWorker.get()));
+    decodeTrackBuffer(pWorker.get(), 1);
+    const int closeCount = pAudioSource->closeCount();
+
+    unloadTrack(pWorker.get());
+    EXPECT_EQ(nullptr, trackBuffer(pWorker.get()));
+    EXPECT_LT(closeCount, pAudioSource->closeCount());
+    ReaderStatusUpdate update;
+    ASSERT_EQ(1, m_readerStatusFIFO.read(&update, 1));
+    EXPECT_EQ(TRACK_UNLOADED, update.status);
+
+    // The RAM of the unloaded track is available again for the next track
+    auto pTrackBuffer = CachingReaderTrackBuffer::allocate(
+            mixxx::IndexRange::forward(0, kFrameLength), trackBufferBytes);
+    ASSERT_NE(nullptr, pTrackBuffer);
+    EXPECT_TRUE(pTrackBuffer->isInRam());
+}
+
+TEST_F(CachingReaderWorkerTest, DecodeWholeTracksOnlyForDecks) {
+    constexpr SINT kFrameLength = CachingReaderChunk::kFrames;
+    for (const auto& group : {QStringLiteral("[Sampler1]"), QStringLiteral("[PreviewDeck1]")}) {
+        auto pWorker = createWorker(group);
+        openAudioSource(pWorker.get(), kFrameLength, kFrameLength);
+        EXPECT_EQ(nullptr, trackBuffer(pWorker.get())) << group.toStdString();
+        EXPECT_EQ(CHUNK_READ_SUCCESS, readChunk(pWorker.get(), 0).status);
+        expectChunkSamples(chunkFrameIndexRange(0));
+    }
+}
@@ -0,0 +1,285 @@
+#include "library/columnartrackindex.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QRandomGenerator>
+#include <algorithm>
+
+#include "library/searchquery.h"
+#include "library/searchqueryparser.h"
+#include "test/librarytest.h"
+
+namespace {
+
+using ValueType = ColumnarTrackIndex::ValueType;
+using SortType = ColumnarTrackIndex::SortType;
+
+enum Column {
+    kId,
+    kArtist,
+    kTitle,
+    kYear,
+    kTrackNumber,
+    kBpm,
+    kBitrate,
+    kKey,
+    kKeyId,
+    kDateTimeAdded,
+};
+
+std::vector<ColumnarTrackIndex::ColumnSpec> columnSpecs() {
+    std::vector<ColumnarTrackIndex::ColumnSpec> specs(10);
+    specs[kId] = {QStringLiteral("id"), ValueType::Integer, SortType::Value};
+    specs[kArtist] = {QStringLiteral("artist"), ValueType::String, SortType::NoCaseCollated};
+    specs[kTitle] = {QStringLiteral("title"), ValueType::String, SortType::NoCaseCollated};
+    specs[kYear] = {QStringLiteral("year"), ValueType::String, SortType::NoCase};
+    specs[kTrackNumber] = {QStringLiteral("tracknumber"),
+            ValueType::String,
+            SortType::LeadingInteger};
+    specs[kBpm] = {QStringLiteral("bpm"), ValueType::Double, SortType::Value};
+    specs[kBitrate] = {QStringLiteral("bitrate"), ValueType::Integer, SortType::LeadingInteger};
+    specs[kKey] = {QStringLiteral("key"), ValueType::String, SortType::Key, kKeyId};
+    specs[kKeyId] = {QStringLiteral("key_id"), ValueType::Integer, SortType::Value};
+    specs[kDateTimeAdded] = {QStringLiteral("datetime_added"),
+            ValueType::Variant,
+            SortType::Value};
+    return specs;
+}
+
+class ColumnarTrackIndexTest : public LibraryTest {
+  protected:
+    ColumnarTrackIndexTest()
+            : m_index(columnSpecs()) {
+    }
+
+    int addRow(int id,
+            const QVariant& artist,
+            const QVariant& title,
+            const QVariant& bpm,
+            const QVariant& trackNumber = QVariant()) {
+        const int row = m_index.insertRow(TrackId(id));
+        m_index.setValue(row, kId, id);
+        m_index.setValue(row, kArtist, artist);
+        m_index.setValue(row, kTitle, title);
+        m_index.setValue(row, kBpm, bpm);
+        m_index.setValue(row, kTrackNumber, trackNumber);
+        return row;
+    }
+
+    std::vector<int> sortedIds(const std::vector<ColumnarTrackIndex::SortKey>& sortKeys) const {
+        std::vector<int> rows;
+        for (int row = 0; row < m_index.rowCount(); ++row) {
+            rows.push_back(row);
+        }
+        m_index.sortRows(&rows, sortKeys);
+        std::vector<int> ids;
+        for (const int row : rows) {
+            ids.push_back(m_index.trackId(row).value());
+        }
+        return ids;
+    }
+
+    ColumnarTrackIndex m_index;
+};
+
+TEST_F(ColumnarTrackIndexTest, StoresTypedValues) {
+    // Like NULL values from the database
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    const QVariant nullString = QVariant(QMetaType(QMetaType::QString));
+#else
+    const QVariant nullString = QVariant(QVariant::String);
+#endif
+    addRow(1, QStringLiteral("Artist"), nullString, 128.5, QStringLiteral("01"));
+    addRow(2, QStringLiteral("Artist"), QStringLiteral("Title"), QVariant());
+
+    ASSERT_EQ(2, m_index.rowCount());
+    EXPECT_EQ(QVariant(QStringLiteral("Artist")), m_index.value(0, kArtist));
+    EXPECT_EQ(QVariant(128.5), m_index.value(0, kBpm));
+    EXPECT_EQ(QVariant(qlonglong(2)), m_index.value(1, kId));
+    EXPECT_TRUE(m_index.isNull(0, kTitle));
+    EXPECT_TRUE(m_index.value(0, kTitle).isNull());
+    EXPECT_TRUE(m_index.isNull(1, kBpm));
+    EXPECT_FALSE(m_index.value(1, kBpm).isValid());
+    EXPECT_EQ(QStringLiteral("artist"), m_index.latinLowString(1, kArtist));
+
+    // The last row is moved into the gap
+    EXPECT_TRUE(m_index.removeRow(TrackId(1)));
+    EXPECT_FALSE(m_index.removeRow(TrackId(1)));
+    ASSERT_EQ(1, m_index.rowCount());
+    EXPECT_EQ(0, m_index.row(TrackId(2)));
+    EXPECT_EQ(QVariant(QStringLiteral("Title")), m_index.value(0, kTitle));
+}
+
+TEST_F(ColumnarTrackIndexTest, SortLikeDatabase) {
+    addRow(1, QStringLiteral("beta"), QStringLiteral("x"), 120.0, QStringLiteral("10"));
+    addRow(2, QStringLiteral("Alpha"), QStringLiteral("y"), QVariant(), QStringLiteral("9/12"));
+    addRow(3, QVariant(), QStringLiteral("z"), 90.0, QStringLiteral("abc"));
+    addRow(4, QStringLiteral("alpha"), QStringLiteral("w"), 120.0, QVariant());
+
+    // NULL first, case-insensitive and ties by id
+    EXPECT_EQ((std::vector<int>{3, 2, 4, 1}),
+            sortedIds({{kArtist, Qt::AscendingOrder}}));
+    EXPECT_EQ((std::vector<int>{1, 2, 4, 3}),
+            sortedIds({{kArtist, Qt::DescendingOrder}}));
+    EXPECT_EQ((std::vector<int>{2, 3, 1, 4}),
+            sortedIds({{kBpm, Qt::AscendingOrder}}));
+    EXPECT_EQ((std::vector<int>{4, 1, 3, 2}),
+            sortedIds({{kBpm, Qt::DescendingOrder}, {kTitle, Qt::AscendingOrder}}));
+    // cast(tracknumber as integer)
+    EXPECT_EQ((std::vector<int>{4, 3, 2, 1}),
+            sortedIds({{kTrackNumber, Qt::AscendingOrder}}));
+
+    // The cached ranks are invalidated by modifications
+    m_index.setValue(m_index.row(TrackId(2)), kBpm, 200.0);
+    EXPECT_EQ((std::vector<int>{3, 1, 4, 2}),
+            sortedIds({{kBpm, Qt::AscendingOrder}}));
+}
+
+TEST_F(ColumnarTrackIndexTest, SortVariantsByStorageClass) {
+    addRow(1, QVariant(), QVariant(), QVariant());
+    addRow(2, QVariant(), QVariant(), QVariant());
+    addRow(3, QVariant(), QVariant(), QVariant());
+    m_index.setValue(0, kDateTimeAdded, QStringLiteral("2021-01-01 10:00:00"));
+    m_index.setValue(1, kDateTimeAdded, QStringLiteral("2020-01-01 10:00:00"));
+    m_index.setValue(2, kDateTimeAdded, 5);
+    EXPECT_EQ((std::vector<int>{3, 2, 1}),
+            sortedIds({{kDateTimeAdded, Qt::AscendingOrder}}));
+}
+
+TEST_F(ColumnarTrackIndexTest, SortKeysByCircleOfFifths) {
+    using namespace mixxx::track::io::key;
+    const ChromaticKey keys[] = {A_MINOR, C_MAJOR, G_MAJOR};
+    for (int i = 0; i < 3; ++i) {
+        const int row = addRow(i + 1, QVariant(), QVariant(), QVariant());
+        m_index.setValue(row, kKey, KeyUtils::keyToString(keys[i]));
+        m_index.setValue(row, kKeyId, static_cast<int>(keys[i]));
+    }
+    const int row = addRow(4, QVariant(), QVariant(), QVariant());
+    m_index.setValue(row, kKeyId, QVariant());
+
+    for (const auto notation : {KeyUtils::KeyNotation::OpenKey,
+                 KeyUtils::KeyNotation::Lancelot}) {
+        m_index.setKeyNotation(notation);
+        std::vector<int> expected = {1, 2, 3};
+        std::sort(expected.begin(), expected.end(), [&](int lhs, int rhs) {
+            const int lhsOrder = KeyUtils::keyToCircleOfFifthsOrder(keys[lhs - 1], notation);
+            const int rhsOrder = KeyUtils::keyToCircleOfFifthsOrder(keys[rhs - 1], notation);
+            return lhsOrder < rhsOrder || (lhsOrder == rhsOrder && lhs < rhs);
+        });
+        // NULL first
+        expected.insert(expected.begin(), 4);
+        EXPECT_EQ(expected, sortedIds({{kKey, Qt::AscendingOrder}}));
+    }
+}
+
+TEST_F(ColumnarTrackIndexTest, MatchQuery) {
+    addRow(1, QStringLiteral("Daft Punk"), QStringLiteral("Around the World"), 121.0);
+    addRow(2, QStringLiteral("Björk"), QStringLiteral("Army of Me"), 95.0);
+    addRow(3, QVariant(), QStringLiteral("Untitled"), QVariant());
+    m_index.setValue(0, kYear, QStringLiteral("1997-03-17"));
+    m_index.setValue(1, kYear, QStringLiteral("1995"));
+
+    SearchQueryParser parser(internalCollection(), {"artist", "title"});
+    const auto matchingIds = [&](const QString& query, const QString& extraFilter = QString()) {
+        const auto pQuery = parser.parseQuery(query, extraFilter);
+        EXPECT_TRUE(pQuery->canMatchIndex());
+        std::vector<int> ids;
+        for (int row = 0; row < m_index.rowCount(); ++row) {
+            if (pQuery->match(m_index, row)) {
+                ids.push_back(m_index.trackId(row).value());
+            }
+        }
+        return ids;
+    };
+
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), matchingIds(QString()));
+    EXPECT_EQ((std::vector<int>{2}), matchingIds(QStringLiteral("bjork")));
+    EXPECT_EQ((std::vector<int>{1, 2}), matchingIds(QStringLiteral("ar")));
+    EXPECT_EQ((std::vector<int>{3}), matchingIds(QStringLiteral("-ar")));
+    EXPECT_EQ((std::vector<int>{1}), matchingIds(QStringLiteral("bpm:>100")));
+    EXPECT_EQ((std::vector<int>{2}), matchingIds(QStringLiteral("bpm:90-100 ar")));
+    EXPECT_EQ((std::vector<int>{3}), matchingIds(QStringLiteral("bpm:\"\"")));
+    EXPECT_EQ((std::vector<int>{3}), matchingIds(QStringLiteral("artist:\"\"")));
+    EXPECT_EQ((std::vector<int>{1}), matchingIds(QStringLiteral("year:>1996")));
+
+    // SQL expressions must be evaluated by the database
+    EXPECT_FALSE(parser.parseQuery(QString(), QStringLiteral("bpm > 100"))->canMatchIndex());
+}
+
+TEST_F(ColumnarTrackIndexTest, FindStrings) {
+    addRow(1, QStringLiteral("Daft Punk"), QStringLiteral("Da Funk"), QVariant());
+    addRow(2, QStringLiteral("Punkadelic"), QStringLiteral("Knupdaft"), QVariant());
+    addRow(3, QStringLiteral("Motörhead"), QStringLiteral("Aba Bab"), QVariant());
+
+    const auto foundIds = [&](const QString& pattern) {
+        const std::vector<bool> found = m_index.findStrings(pattern);
+        std::vector<int> ids;
+        for (int row = 0; row < m_index.rowCount(); ++row) {
+            for (const int column : {kArtist, kTitle}) {
+                const quint32 stringId = m_index.stringId(row, column);
+                // Same result as searching each row
+                EXPECT_EQ(m_index.latinLowString(row, column).contains(pattern),
+                        found[stringId])
+                        << pattern.toStdString();
+                if (found[stringId]) {
+                    ids.push_back(m_index.trackId(row).value());
+                    break;
+                }
+            }
+        }
+        return ids;
+    };
+
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), foundIds(QString()));
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), foundIds(QStringLiteral("d")));
+    EXPECT_EQ((std::vector<int>{1, 2}), foundIds(QStringLiteral("punk")));
+    EXPECT_EQ((std::vector<int>{1}), foundIds(QStringLiteral("da f")));
+    // All trigrams are contained, but in a different order
+    EXPECT_EQ((std::vector<int>{}), foundIds(QStringLiteral("abab")));
+    EXPECT_EQ((std::vector<int>{3}), foundIds(QStringLiteral("motorhead")));
+    EXPECT_EQ((std::vector<int>{}), foundIds(QStringLiteral("xyz")));
+}
+
+// Sorts and filters a library with 80000 tracks. Argument: number of
+// search terms.
+static void BM_ColumnarTrackIndexFilterAndSort(benchmark::State& state) {
+    ColumnarTrackIndex index(columnSpecs());
+    QRandomGenerator random(42);
+    constexpr int kNumTracks = 80000;
+    for (int id = 1; id <= kNumTracks; ++id) {
+        const int row = index.insertRow(TrackId(id));
+        index.setValue(row, kId, id);
+        index.setValue(row, kArtist,
+                QStringLiteral("Artist %1").arg(random.bounded(5000)));
+        index.setValue(row, kTitle,
+                QStringLiteral("Title %1").arg(random.bounded(kNumTracks)));
+        index.setValue(row, kBpm, 60.0 + random.bounded(120.0));
+        index.setValue(row, kKeyId, static_cast<int>(random.bounded(25)));
+    }
+
+    // Like SearchQueryParser::parseQuery(), but without a database
+    const auto pQuery = std::make_unique<AndNode>();
+    for (int i = 0; i < state.range(0); ++i) {
+        pQuery->addNode(std::make_unique<TextFilterNode>(QSqlDatabase(),
+                QStringList{"artist", "title"},
+                QString::number(i + 1)));
+    }
+    const std::vector<ColumnarTrackIndex::SortKey> sortKeys = {
+            {kKey, Qt::AscendingOrder}, {kBpm, Qt::DescendingOrder}};
+
+    std::vector<int> rows;
+    for (auto _ : state) {
+        rows.clear();
+        for (int row = 0; row < index.rowCount(); ++row) {
+            if (pQuery->match(index, row)) {
+                rows.push_back(row);
+            }
+        }
+        index.sortRows(&rows, sortKeys);
+        benchmark::DoNotOptimize(rows.data());
+    }
+}
+BENCHMARK(BM_ColumnarTrackIndexFilterAndSort)->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -1,5 +1,10 @@
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
+
 #include <QtDebug>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include "control/controlobject.h"
 #include "util/memory.h"
@@ -85,4 +90,69 @@ TEST_F(ControlObjectTest, Persistence_ValidValue) {
     EXPECT_DOUBLE_EQ(5.0, co.get());
 }
 
+TEST_F(ControlObjectTest, RecreateAfterDelete) {
+    co1.reset();
+    EXPECT_EQ(ControlObject::getControl(ck1, ControlFlag::NoAssertIfMissing),
+            (ControlObject*)nullptr);
+    co1 = std::make_unique<ControlObject>(ck1);
+    EXPECT_EQ(ControlObject::getControl(ck1), co1.get());
+    EXPECT_EQ(ControlObject::getControl(ck2), co2.get());
+}
+
+TEST_F(ControlObjectTest, ConcurrentLookups) {
+    // Look up existing controls while other controls are created and
+    // deleted concurrently
+    std::atomic<bool> stop(false);
+    std::atomic<int> missing(0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            while (!stop.load()) {
+                if (ControlObject::getControl(ck1) != co1.get() ||
+                        ControlObject::getControl(ck2) != co2.get()) {
+                    ++missing;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 1000; ++i) {
+        ControlObject co(ConfigKey(QStringLiteral("[Test]"), QString::number(i)));
+    }
+    stop.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0, missing.load());
+}
+
+// Resolves controls from multiple threads at once, like the GUI, the
+// controllers and skin loading do
+static void BM_ResolveControlsConcurrently(benchmark::State& state) {
+    constexpr int kControlCount = 1000;
+    // Shared by all threads of the benchmark and never deleted, because
+    // the controls must outlive all threads
+    static const std::vector<ControlObject*>* const pControls = [] {
+        auto* pControls = new std::vector<ControlObject*>;
+        for (int i = 0; i < kControlCount; ++i) {
+            pControls->push_back(new ControlObject(ConfigKey(
+                    QStringLiteral("[Channel%1]").arg(i % 8 + 1),
+                    QStringLiteral("benchmark_%1").arg(i))));
+        }
+        return pControls;
+    }();
+    std::vector<ConfigKey> keys;
+    keys.reserve(pControls->size());
+    for (const auto* pControl : *pControls) {
+        keys.push_back(pControl->getKey());
+    }
+
+    for (auto _ : state) {
+        for (const auto& key : keys) {
+            benchmark::DoNotOptimize(ControlDoublePrivate::getControl(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kControlCount);
+}
+BENCHMARK(BM_ResolveControlsConcurrently)->ThreadRange(1, 8)->UseRealTime();
+
 } // namespace
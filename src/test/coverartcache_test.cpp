@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <QFileInfo>
+#include <QTemporaryDir>
 
 #include "library/coverartcache.h"
 #include "library/coverartutils.h"
@@ -92,3 +93,54 @@ TEST_F(CoverArtCacheTest, loadCoverFromFileAbsolute) {
             getTestDir().filePath(kCoverLocationTest),
             getTestDir().filePath(kCoverLocationTest));
 }
+
+TEST_F(CoverArtCacheTest, loadCoverFromThumbnailCache) {
+    QTemporaryDir cacheDir;
+    ASSERT_TRUE(cacheDir.isValid());
+    CoverArtCache::setThumbnailCacheDir(cacheDir.path());
+
+    CoverInfo info;
+    info.type = CoverInfo::FILE;
+    info.source = CoverInfo::GUESSED;
+    info.coverLocation = getTestDir().filePath(kCoverLocationTest);
+    constexpr int kWidth = 50;
+
+    // Resized from the original image and stored in the cache
+    const CoverArtCache::FutureResult res =
+            CoverArtCache::loadCover(nullptr, TrackPointer(), info, kWidth, false);
+    ASSERT_TRUE(res.coverInfoUpdated);
+    ASSERT_EQ(kWidth, res.coverArt.loadedImage.image.width());
+    const QString thumbnailFilePath =
+            CoverArtCache::thumbnailFilePath(res.coverArt.cacheKey(), kWidth);
+    EXPECT_TRUE(QFileInfo::exists(thumbnailFilePath));
+
+    // Loaded from the cache with the refreshed digest
+    const CoverInfo refreshedInfo = res.coverArt;
+    const CoverArtCache::FutureResult cachedRes =
+            CoverArtCache::loadCover(nullptr, TrackPointer(), refreshedInfo, kWidth, false);
+    EXPECT_FALSE(cachedRes.coverInfoUpdated);
+    EXPECT_EQ(CoverInfo::LoadedImage::Result::Ok, cachedRes.coverArt.loadedImage.result);
+    EXPECT_QSTRING_EQ(thumbnailFilePath, cachedRes.coverArt.loadedImage.location);
+    EXPECT_EQ(res.coverArt.loadedImage.image.size(),
+            cachedRes.coverArt.loadedImage.image.size());
+
+    // Full size covers are never cached
+    CoverArtCache::loadCover(nullptr, TrackPointer(), refreshedInfo, 0, false);
+    EXPECT_FALSE(QFileInfo::exists(
+            CoverArtCache::thumbnailFilePath(res.coverArt.cacheKey(), 0)));
+
+    CoverArtCache::setThumbnailCacheDir(QString());
+}
+
+TEST_F(CoverArtCacheTest, cancelledRequestsAreSkipped) {
+    CoverInfo info;
+    info.type = CoverInfo::FILE;
+    info.source = CoverInfo::GUESSED;
+    info.coverLocation = getTestDir().filePath(kCoverLocationTest);
+
+    const auto pCancelled = std::make_shared<std::atomic<bool>>(true);
+    const CoverArtCache::FutureResult res = CoverArtCache::loadCover(
+            nullptr, TrackPointer(), info, 50, true, pCancelled);
+    EXPECT_TRUE(res.cancelled);
+    EXPECT_TRUE(res.coverArt.loadedImage.image.isNull());
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include "effects/backends/builtin/echoeffect.h"
+#include "engine/channelhandle.h"
+#include "engine/engine.h"
+#include "test/mixxxtest.h"
+
+namespace {
+
+class EffectProcessorTest : public MixxxTest {
+  protected:
+    EffectProcessorTest()
+            : m_inputChannel(m_factory.getOrCreateHandle(QStringLiteral("[Channel1]")),
+                      QStringLiteral("[Channel1]")),
+              m_engineParameters(mixxx::audio::SampleRate(48000), 1024) {
+        m_outputChannels.insert(ChannelHandleAndGroup(
+                m_factory.getOrCreateHandle(QStringLiteral("[Master]")),
+                QStringLiteral("[Master]")));
+        m_outputChannels.insert(ChannelHandleAndGroup(
+                m_factory.getOrCreateHandle(QStringLiteral("[Headphone]")),
+                QStringLiteral("[Headphone]")));
+    }
+
+    ChannelHandleFactory m_factory;
+    ChannelHandleAndGroup m_inputChannel;
+    QSet<ChannelHandleAndGroup> m_outputChannels;
+    const mixxx::EngineParameters m_engineParameters;
+};
+
+TEST_F(EffectProcessorTest, ReleaseAndReinitializeInputChannel) {
+    EchoEffect effect;
+    effect.initialize({}, m_outputChannels, m_engineParameters);
+    EXPECT_FALSE(effect.hasStatesForInputChannel(m_inputChannel.handle()));
+    EXPECT_EQ(0, effect.getStatesMemoryUsage().states);
+
+    effect.initializeInputChannel(m_inputChannel.handle(), m_engineParameters);
+    EXPECT_TRUE(effect.hasStatesForInputChannel(m_inputChannel.handle()));
+    const EffectStatesMemoryUsage usage = effect.getStatesMemoryUsage();
+    EXPECT_EQ(2, usage.states);
+    // One delay buffer per output channel
+    const auto delayBufferBytes = static_cast<std::size_t>(
+                                          EchoGroupState::kMaxDelaySeconds *
+                                          m_engineParameters.sampleRate() *
+                                          m_engineParameters.channelCount()) *
+            sizeof(CSAMPLE);
+    EXPECT_LE(2 * delayBufferBytes, usage.bytes);
+
+    effect.releaseInputChannel(m_inputChannel.handle());
+    EXPECT_FALSE(effect.hasStatesForInputChannel(m_inputChannel.handle()));
+    EXPECT_EQ(0, effect.getStatesMemoryUsage().states);
+    EXPECT_EQ(0u, effect.getStatesMemoryUsage().bytes);
+
+    // The states are allocated again when the routing is switched on
+    effect.initializeInputChannel(m_inputChannel.handle(), m_engineParameters);
+    EXPECT_EQ(usage.states, effect.getStatesMemoryUsage().states);
+    EXPECT_EQ(usage.bytes, effect.getStatesMemoryUsage().bytes);
+}
+
+} // namespace
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+
+#include <QElapsedTimer>
+#include <QThread>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "engine/bufferscalers/enginebufferscalerubberband.h"
+#include "engine/engineworker.h"
+#include "engine/engineworkerscheduler.h"
+#include "engine/readaheadmanager.h"
+#include "test/mixxxtest.h"
+#include "util/math.h"
+
+namespace {
+
+constexpr SINT kBufferFrames = 512;
+constexpr SINT kBufferSize = kBufferFrames * mixxx::kEngineChannelCount;
+
+// Reads an endless sine wave
+class ReadAheadManagerFake : public ReadAheadManager {
+  public:
+    SINT getNextSamples(double dRate, CSAMPLE* buffer, SINT requested_samples) override {
+        Q_UNUSED(dRate);
+        for (SINT i = 0; i < requested_samples; i += mixxx::kEngineChannelCount) {
+            const auto value = static_cast<CSAMPLE>(
+                    0.5 * std::sin(2 * M_PI * 440 * m_framesRead / 44100));
+            buffer[i] = value;
+            buffer[i + 1] = value;
+            ++m_framesRead;
+        }
+        return requested_samples;
+    }
+
+    SINT framesRead() const {
+        return m_framesRead;
+    }
+
+  private:
+    SINT m_framesRead = 0;
+};
+
+// Stands in for the reader workers of the other decks, samplers and
+// preview decks. The thread is never started.
+class IdleWorker : public EngineWorker {
+};
+
+class EngineBufferScaleRubberBandTest : public MixxxTest {
+  protected:
+    EngineBufferScaleRubberBandTest()
+            : m_scale(&m_readAheadManager),
+              m_buffer(kBufferSize) {
+        m_scale.setSampleRate(mixxx::audio::SampleRate(44100));
+    }
+
+    void setTempo(double tempo) {
+        double tempoRatio = tempo;
+        double pitchRatio = 1.0;
+        m_scale.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+    }
+
+    // Processes a callback like EngineMixer and waits until the worker
+    // has rendered the output for the next callback
+    double process() {
+        const double framesRead = m_scale.scaleBuffer(m_buffer.data(), kBufferSize);
+        m_scheduler.runWorkers();
+        QElapsedTimer timer;
+        timer.start();
+        while (m_scale.isRenderingAhead() &&
+                m_scale.renderedAheadFrames() < kBufferFrames &&
+                timer.elapsed() < 2000) {
+            QThread::msleep(1);
+        }
+        return framesRead;
+    }
+
+    // The worker hands back the time stretcher after its current block
+    void waitForHandBack() {
+        QElapsedTimer timer;
+        timer.start();
+        while (m_scale.isRenderingAhead() && timer.elapsed() < 2000) {
+            QThread::msleep(1);
+        }
+    }
+
+    CSAMPLE peak() const {
+        CSAMPLE peak = 0;
+        for (const auto sample : m_buffer) {
+            peak = std::max(peak, std::abs(sample));
+        }
+        return peak;
+    }
+
+    ReadAheadManagerFake m_readAheadManager;
+    EngineWorkerScheduler m_scheduler;
+    EngineBufferScaleRubberBand m_scale;
+    std::vector<CSAMPLE> m_buffer;
+};
+
+TEST_F(EngineBufferScaleRubberBandTest, RenderAheadAtSteadyTempo) {
+    m_scale.setScheduler(&m_scheduler);
+    m_scale.startWorker();
+    setTempo(1.1);
+
+    int callbacks = 0;
+    while (!m_scale.isRenderingAhead()) {
+        ASSERT_LT(callbacks++, 20);
+        process();
+    }
+
+    double framesProcessed = 0;
+    for (int i = 0; i < 100; ++i) {
+        const double framesRead = process();
+        ASSERT_TRUE(m_scale.isRenderingAhead());
+        EXPECT_DOUBLE_EQ(1.1 * kBufferFrames, framesRead);
+        EXPECT_GT(peak(), 0.1);
+        framesProcessed += framesRead;
+    }
+
+    // The input is read only a few callbacks ahead of the output
+    const double framesReadAhead = m_readAheadManager.framesRead() -
+            (callbacks * 1.1 * kBufferFrames + framesProcessed);
+    EXPECT_LT(framesReadAhead, 16 * kBufferFrames);
+}
+
+TEST_F(EngineBufferScaleRubberBandTest, TempoChangeStopsRenderingAhead) {
+    m_scale.setScheduler(&m_scheduler);
+    m_scale.startWorker();
+    setTempo(0.9);
+    for (int i = 0; i < 20; ++i) {
+        process();
+    }
+    ASSERT_TRUE(m_scale.isRenderingAhead());
+
+    // The output that has been rendered ahead is played before the
+    // output with the new tempo
+    setTempo(1.2);
+    waitForHandBack();
+    EXPECT_FALSE(m_scale.isRenderingAhead());
+    for (int i = 0; i < 4; ++i) {
+        process();
+        EXPECT_FALSE(m_scale.isRenderingAhead());
+        EXPECT_GT(peak(), 0.1);
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        process();
+    }
+    ASSERT_TRUE(m_scale.isRenderingAhead());
+    m_scale.clear();
+    waitForHandBack();
+    process();
+    EXPECT_FALSE(m_scale.isRenderingAhead());
+    EXPECT_EQ(0, m_scale.renderedAheadFrames());
+}
+
+TEST_F(EngineBufferScaleRubberBandTest, HandBackNeverUnderruns) {
+    m_scale.setScheduler(&m_scheduler);
+    m_scale.startWorker();
+    setTempo(1.0);
+    for (int i = 0; i < 20; ++i) {
+        process();
+    }
+    ASSERT_TRUE(m_scale.isRenderingAhead());
+
+    // Changing the tempo and seeking in the same callback drops the output
+    // that has been rendered ahead. The callback waits for the worker to
+    // finish its current block and renders the output itself instead of
+    // playing silence.
+    setTempo(1.3);
+    m_scale.clear();
+    const double framesRead = m_scale.scaleBuffer(m_buffer.data(), kBufferSize);
+    EXPECT_FALSE(m_scale.isRenderingAhead());
+    EXPECT_GT(framesRead, 0.0);
+    EXPECT_GT(peak(), 0.1);
+
+    // The new tempo is effective after the hand back
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_DOUBLE_EQ(1.3 * kBufferFrames, process());
+        EXPECT_GT(peak(), 0.1);
+    }
+}
+
+TEST_F(EngineBufferScaleRubberBandTest, WorkerOfLateKeylockDeckIsScheduled) {
+    // All players of a session have registered their workers before keylock
+    // is switched to RubberBand for this deck
+    std::vector<std::unique_ptr<IdleWorker>> otherWorkers;
+    for (int i = 0; i < 100; ++i) {
+        otherWorkers.push_back(std::make_unique<IdleWorker>());
+        otherWorkers.back()->setScheduler(&m_scheduler);
+    }
+    m_scale.setScheduler(&m_scheduler);
+    m_scale.startWorker();
+    setTempo(1.1);
+
+    int callbacks = 0;
+    while (!m_scale.isRenderingAhead()) {
+        ASSERT_LT(callbacks++, 20);
+        process();
+    }
+
+    // The worker of a deck that is destroyed is no longer woken up
+    {
+        ReadAheadManagerFake readAheadManager;
+        EngineBufferScaleRubberBand scale(&readAheadManager);
+        scale.setSampleRate(mixxx::audio::SampleRate(44100));
+        scale.setScheduler(&m_scheduler);
+        scale.startWorker();
+        double tempoRatio = 1.1;
+        double pitchRatio = 1.0;
+        scale.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+        scale.scaleBuffer(m_buffer.data(), kBufferSize);
+    }
+    for (int i = 0; i < 4; ++i) {
+        process();
+        EXPECT_TRUE(m_scale.isRenderingAhead());
+        EXPECT_GT(peak(), 0.1);
+    }
+}
+
+TEST_F(EngineBufferScaleRubberBandTest, NoWorkerWithoutStart) {
+    m_scale.setScheduler(&m_scheduler);
+    setTempo(1.1);
+    for (int i = 0; i < 20; ++i) {
+        process();
+        EXPECT_FALSE(m_scale.isRenderingAhead());
+    }
+}
+
+TEST_F(EngineBufferScaleRubberBandTest, NoRenderAheadWithoutWorker) {
+    setTempo(1.1);
+    for (int i = 0; i < 20; ++i) {
+        process();
+        EXPECT_FALSE(m_scale.isRenderingAhead());
+    }
+    EXPECT_GT(peak(), 0.1);
+}
+
+} // namespace
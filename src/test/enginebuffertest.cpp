@@ -97,6 +97,34 @@ TEST_F(EngineBufferTest, PitchRoundtrip) {
     ASSERT_DOUBLE_EQ(0.5, ControlObject::get(ConfigKey(m_sGroup1, "rate")));
 }
 
+TEST_F(EngineBufferTest, CanProcessConcurrently) {
+    EngineBuffer* pEngineBuffer = m_pChannel1->getEngineBuffer();
+    ProcessBuffer();
+    EXPECT_TRUE(pEngineBuffer->canProcessConcurrently());
+
+    // Seeks may align the phase to the sync target
+    pEngineBuffer->queueNewPlaypos(
+            mixxx::audio::FramePos(1000), EngineBuffer::SEEK_STANDARD);
+    EXPECT_FALSE(pEngineBuffer->canProcessConcurrently());
+    ProcessBuffer();
+    EXPECT_TRUE(pEngineBuffer->canProcessConcurrently());
+
+    // Cloning reads the position of the other deck
+    pEngineBuffer->requestClonePosition(m_pChannel2);
+    EXPECT_FALSE(pEngineBuffer->canProcessConcurrently());
+    ProcessBuffer();
+    EXPECT_TRUE(pEngineBuffer->canProcessConcurrently());
+
+    // Synced decks share the state of EngineSync
+    ControlObject::set(ConfigKey(m_sGroup1, "sync_enabled"), 1.0);
+    EXPECT_FALSE(pEngineBuffer->canProcessConcurrently());
+    ProcessBuffer();
+    EXPECT_FALSE(pEngineBuffer->canProcessConcurrently());
+    ControlObject::set(ConfigKey(m_sGroup1, "sync_enabled"), 0.0);
+    ProcessBuffer();
+    EXPECT_TRUE(pEngineBuffer->canProcessConcurrently());
+}
+
 TEST_F(EngineBufferTest, SlowRubberBand) {
     // At very slow speeds, RubberBand needs to reallocate buffers and since
     // this
@@ -0,0 +1,140 @@
+#include "engine/enginechannelworkerpool.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QTemporaryDir>
+#include <QTest>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "test/enginerenderer.h"
+#include "test/mixxxtest.h"
+
+namespace {
+
+struct CountingJobs {
+    std::vector<std::atomic<int>> counts;
+    explicit CountingJobs(int numJobs)
+            : counts(numJobs) {
+    }
+    static void run(void* pContext, int jobIndex) {
+        static_cast<CountingJobs*>(pContext)->counts[jobIndex].fetch_add(1);
+    }
+};
+
+class EngineChannelWorkerPoolTest : public MixxxTest {
+};
+
+TEST_F(EngineChannelWorkerPoolTest, RunsEveryJobExactlyOnce) {
+    EngineChannelWorkerPool pool(3);
+    ASSERT_EQ(3, pool.numWorkers());
+
+    constexpr int kNumJobs = 12;
+    constexpr int kNumBatches = 1000;
+    CountingJobs jobs(kNumJobs);
+    for (int i = 0; i < kNumBatches; ++i) {
+        pool.run(&CountingJobs::run, &jobs, kNumJobs);
+    }
+    for (const auto& count : jobs.counts) {
+        EXPECT_EQ(kNumBatches, count.load());
+    }
+}
+
+TEST_F(EngineChannelWorkerPoolTest, VaryingBatchSizes) {
+    EngineChannelWorkerPool pool(2);
+
+    constexpr int kMaxNumJobs = 9;
+    CountingJobs jobs(kMaxNumJobs);
+    std::vector<int> expected(kMaxNumJobs, 0);
+    for (int i = 0; i < 500; ++i) {
+        const int numJobs = i % (kMaxNumJobs + 1);
+        pool.run(&CountingJobs::run, &jobs, numJobs);
+        for (int j = 0; j < numJobs; ++j) {
+            ++expected[j];
+        }
+    }
+    for (int j = 0; j < kMaxNumJobs; ++j) {
+        EXPECT_EQ(expected[j], jobs.counts[j].load());
+    }
+}
+
+class ProviderRegistration : public SoundSourceProviderRegistration {
+};
+
+// Renders the main output after the decks have been playing for a while,
+// so that the reader caches are filled
+std::vector<CSAMPLE> renderMainOutput(const EngineRenderer::Options& options) {
+    constexpr int kNumWarmUpBuffers = 200;
+    constexpr int kNumBuffers = 100;
+    QTemporaryDir configDir;
+    UserSettingsPointer pConfig(new UserSettings(configDir.filePath("test.cfg")));
+    EngineRenderer renderer(pConfig, EngineRenderer::trackPaths(), options);
+    for (int i = 0; i < kNumWarmUpBuffers; ++i) {
+        renderer.processBuffer();
+        QTest::qSleep(1);
+    }
+    std::vector<CSAMPLE> output;
+    for (int i = 0; i < kNumBuffers; ++i) {
+        renderer.processBuffer();
+        output.insert(output.end(),
+                renderer.mainBuffer(),
+                renderer.mainBuffer() + EngineRenderer::kBufferSize);
+        QTest::qSleep(1);
+    }
+    return output;
+}
+
+TEST_F(EngineChannelWorkerPoolTest, PreFaderEffectsOfParallelDecks) {
+    const ProviderRegistration providerRegistration;
+    EngineRenderer::Options options;
+    options.numDecks = 2;
+    options.sync = false;
+    options.keylock = false;
+    options.loops = false;
+    options.effects = false;
+    // Both decks share the buffers of the equalizer effect chains
+    options.preFaderEffectId = QStringLiteral("org.mixxx.effects.distortion");
+
+    options.parallelChannels = false;
+    const std::vector<CSAMPLE> serialOutput = renderMainOutput(options);
+    options.parallelChannels = true;
+    const std::vector<CSAMPLE> parallelOutput = renderMainOutput(options);
+
+    ASSERT_EQ(serialOutput.size(), parallelOutput.size());
+    EXPECT_GT(*std::max_element(serialOutput.begin(), serialOutput.end()), 0.1f);
+    for (std::size_t i = 0; i < serialOutput.size(); ++i) {
+        ASSERT_FLOAT_EQ(serialOutput[i], parallelOutput[i]) << "at sample " << i;
+    }
+}
+
+// Compares processing the channels serially on the callback thread with
+// processing them on the worker pool of the EngineMixer. The decks are not
+// synced, so that all of them are eligible for concurrent processing.
+// Arguments: number of decks, parallel processing
+static void BM_EngineMixerProcess(benchmark::State& state) {
+    const ProviderRegistration providerRegistration;
+    const QStringList trackPaths = EngineRenderer::trackPaths();
+    if (trackPaths.isEmpty()) {
+        state.SkipWithError("No audio files found");
+        return;
+    }
+    QTemporaryDir configDir;
+    UserSettingsPointer pConfig(new UserSettings(configDir.filePath("test.cfg")));
+
+    EngineRenderer::Options options;
+    options.numDecks = static_cast<int>(state.range(0));
+    options.sync = false;
+    options.parallelChannels = state.range(1) != 0;
+    EngineRenderer renderer(pConfig, trackPaths, options);
+    for (auto _ : state) {
+        renderer.processBuffer();
+    }
+}
+BENCHMARK(BM_EngineMixerProcess)
+        ->ArgsProduct({{4, 8}, {0, 1}})
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+
+} // namespace
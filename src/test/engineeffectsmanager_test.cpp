@@ -0,0 +1,227 @@
+#include "engine/effects/engineeffectsmanager.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "effects/backends/builtin/filtereffect.h"
+#include "effects/backends/effectsbackendmanager.h"
+#include "engine/effects/engineeffect.h"
+#include "engine/effects/engineeffectchain.h"
+#include "test/mixxxtest.h"
+#include "util/sample.h"
+#include "util/samplebuffer.h"
+
+namespace {
+
+constexpr int kNumDecks = 4;
+constexpr int kNumEffectUnits = 4;
+constexpr SINT kNumSamples = 2048;
+constexpr mixxx::audio::SampleRate kSampleRate(44100);
+
+/// Sets up 4 decks and 4 postfader effect units with a filter effect each,
+/// like the default skins, talking to the EngineEffectsManager through its
+/// request pipe like EffectsMessenger.
+class EffectsRig {
+  public:
+    EffectsRig()
+            : m_pBackendManager(new EffectsBackendManager()),
+              m_mainHandleGroup(m_factory.getOrCreateHandle(QStringLiteral("[Master]")),
+                      QStringLiteral("[Master]")) {
+        auto pipes = TwoWayMessagePipe<EffectsRequest*, EffectsResponse>::makeTwoWayMessagePipe(
+                1024, 1024);
+        m_pRequestPipe = std::move(pipes.first);
+        m_pEngineEffectsManager = std::make_unique<EngineEffectsManager>(
+                std::move(pipes.second));
+
+        QSet<ChannelHandleAndGroup> inputChannels;
+        for (int i = 0; i < kNumDecks; ++i) {
+            const QString group = QStringLiteral("[Channel%1]").arg(i + 1);
+            m_decks.emplace_back(m_factory.getOrCreateHandle(group), group);
+            inputChannels.insert(m_decks.back());
+            m_deckBuffers.emplace_back(kNumSamples);
+            SampleUtil::fill(m_deckBuffers.back().data(), 0.1f * (i + 1), kNumSamples);
+        }
+        const QSet<ChannelHandleAndGroup> outputChannels = {m_mainHandleGroup};
+
+        const EffectManifestPointer pManifest = m_pBackendManager->getManifest(
+                FilterEffect::getId(), EffectBackendType::BuiltIn);
+        for (int i = 0; i < kNumEffectUnits; ++i) {
+            m_chains.push_back(std::make_unique<EngineEffectChain>(
+                    QStringLiteral("[EffectRack1_EffectUnit%1]").arg(i + 1),
+                    inputChannels,
+                    outputChannels));
+            m_effects.push_back(std::make_unique<EngineEffect>(pManifest,
+                    m_pBackendManager,
+                    inputChannels,
+                    inputChannels,
+                    outputChannels));
+
+            EffectsRequest* pRequest = newRequest(EffectsRequest::ADD_EFFECT_CHAIN);
+            pRequest->AddEffectChain.pChain = m_chains.back().get();
+            pRequest->AddEffectChain.signalProcessingStage = SignalProcessingStage::Postfader;
+
+            pRequest = newRequest(EffectsRequest::ADD_EFFECT_TO_CHAIN);
+            pRequest->pTargetChain = m_chains.back().get();
+            pRequest->AddEffectToChain.pEffect = m_effects.back().get();
+            pRequest->AddEffectToChain.iIndex = 0;
+
+            pRequest = newRequest(EffectsRequest::SET_EFFECT_PARAMETERS);
+            pRequest->pTargetEffect = m_effects.back().get();
+            pRequest->SetEffectParameters.enabled = true;
+        }
+        processRequests();
+    }
+
+    ~EffectsRig() {
+        // The chains and effects must outlive the EngineEffectsManager
+        m_pEngineEffectsManager.reset();
+    }
+
+    void setChainParameters(int unit, EffectChainMixMode::Type mixMode, double mix) {
+        EffectsRequest* pRequest = newRequest(EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS);
+        pRequest->pTargetChain = m_chains[unit].get();
+        pRequest->SetEffectChainParameters.enabled = true;
+        pRequest->SetEffectChainParameters.mix_mode = mixMode;
+        pRequest->SetEffectChainParameters.mix = mix;
+        processRequests();
+    }
+
+    void enableChainForDeck(int unit, int deck) {
+        EffectsRequest* pRequest = newRequest(
+                EffectsRequest::ENABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL);
+        pRequest->pTargetChain = m_chains[unit].get();
+        pRequest->EnableInputChannelForChain.channelHandle = m_decks[deck].handle();
+        processRequests();
+    }
+
+    /// Mixes all decks into pOutput like ChannelMixer::applyEffectsAndMixChannels
+    void process(CSAMPLE* pOutput, CSAMPLE_GAIN gain) {
+        SampleUtil::clear(pOutput, kNumSamples);
+        for (int i = 0; i < kNumDecks; ++i) {
+            m_pEngineEffectsManager->processPostFaderAndMix(m_decks[i].handle(),
+                    m_mainHandleGroup.handle(),
+                    m_deckBuffers[i].data(),
+                    pOutput,
+                    kNumSamples,
+                    kSampleRate,
+                    m_features,
+                    gain,
+                    gain);
+        }
+    }
+
+    const mixxx::SampleBuffer& deckBuffer(int deck) const {
+        return m_deckBuffers[deck];
+    }
+
+  private:
+    EffectsRequest* newRequest(EffectsRequest::MessageType type) {
+        m_requests.push_back(std::make_unique<EffectsRequest>());
+        EffectsRequest* pRequest = m_requests.back().get();
+        pRequest->type = type;
+        m_pRequestPipe->writeMessage(pRequest);
+        return pRequest;
+    }
+
+    void processRequests() {
+        m_pEngineEffectsManager->onCallbackStart();
+        EffectsResponse response;
+        while (m_pRequestPipe->readMessage(&response)) {
+            EXPECT_TRUE(response.success);
+        }
+        m_requests.clear();
+    }
+
+    ChannelHandleFactory m_factory;
+    EffectsBackendManagerPointer m_pBackendManager;
+    ChannelHandleAndGroup m_mainHandleGroup;
+    std::vector<ChannelHandleAndGroup> m_decks;
+    std::vector<mixxx::SampleBuffer> m_deckBuffers;
+    GroupFeatureState m_features;
+
+    std::unique_ptr<EffectsRequestPipe> m_pRequestPipe;
+    std::vector<std::unique_ptr<EffectsRequest>> m_requests;
+    std::vector<std::unique_ptr<EngineEffectChain>> m_chains;
+    std::vector<std::unique_ptr<EngineEffect>> m_effects;
+    std::unique_ptr<EngineEffectsManager> m_pEngineEffectsManager;
+};
+
+class EngineEffectsManagerTest : public MixxxTest {
+  protected:
+    EngineEffectsManagerTest()
+            : m_output(kNumSamples) {
+    }
+
+    CSAMPLE expectedMix(CSAMPLE_GAIN gain) const {
+        CSAMPLE sum = 0;
+        for (int i = 0; i < kNumDecks; ++i) {
+            sum += m_rig.deckBuffer(i)[0] * gain;
+        }
+        return sum;
+    }
+
+    void assertWholeBufferEquals(CSAMPLE value) const {
+        for (SINT i = 0; i < kNumSamples; ++i) {
+            ASSERT_FLOAT_EQ(value, m_output[i]);
+        }
+    }
+
+    EffectsRig m_rig;
+    mixxx::SampleBuffer m_output;
+};
+
+TEST_F(EngineEffectsManagerTest, MixWithoutEnabledChains) {
+    m_rig.process(m_output.data(), 1.0f);
+    assertWholeBufferEquals(expectedMix(1.0f));
+    m_rig.process(m_output.data(), 0.5f);
+    assertWholeBufferEquals(expectedMix(0.5f));
+    m_rig.process(m_output.data(), 0.0f);
+    assertWholeBufferEquals(0.0f);
+}
+
+TEST_F(EngineEffectsManagerTest, LastChainMixesIntoOutput) {
+    // Fully dry, so the decks are mixed unchanged after passing the effects
+    for (int unit = 0; unit < kNumEffectUnits; ++unit) {
+        m_rig.setChainParameters(unit, EffectChainMixMode::DrySlashWet, 0.0);
+    }
+    m_rig.enableChainForDeck(0, 0);
+    m_rig.enableChainForDeck(1, 0);
+    m_rig.enableChainForDeck(3, 2);
+    for (int i = 0; i < 3; ++i) {
+        m_rig.process(m_output.data(), 1.0f);
+        assertWholeBufferEquals(expectedMix(1.0f));
+        m_rig.process(m_output.data(), 0.5f);
+        assertWholeBufferEquals(expectedMix(0.5f));
+    }
+}
+
+TEST_F(EngineEffectsManagerTest, DryPlusWetMixesDryOnce) {
+    // With the mix knob turned down, the dry signal must be mixed only once
+    m_rig.setChainParameters(0, EffectChainMixMode::DryPlusWet, 0.0);
+    m_rig.enableChainForDeck(0, 1);
+    m_rig.process(m_output.data(), 1.0f);
+    assertWholeBufferEquals(expectedMix(1.0f));
+}
+
+// Mixes 4 decks with the given number of effect units enabled for each deck
+static void BM_ProcessPostFaderAndMix(benchmark::State& state) {
+    EffectsRig rig;
+    for (int unit = 0; unit < kNumEffectUnits; ++unit) {
+        rig.setChainParameters(unit, EffectChainMixMode::DrySlashWet, 0.5);
+        for (int deck = 0; deck < kNumDecks; ++deck) {
+            if (unit < state.range(0)) {
+                rig.enableChainForDeck(unit, deck);
+            }
+        }
+    }
+    mixxx::SampleBuffer output(kNumSamples);
+    for (auto _ : state) {
+        rig.process(output.data(), 0.8f);
+        benchmark::DoNotOptimize(output.data());
+    }
+}
+BENCHMARK(BM_ProcessPostFaderAndMix)->DenseRange(0, kNumEffectUnits);
+
+} // namespace
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "engine/filters/enginefilterbessel4.h"
+#include "util/math.h"
+
+namespace {
+
+constexpr mixxx::audio::SampleRate kSampleRate(44100);
+constexpr int kBufferSize = 1024;
+
+class EngineFilterIIRTest : public testing::Test {
+  protected:
+    // Fills the buffer with a sine on the left and a faster cosine on the
+    // right channel
+    static std::vector<CSAMPLE> stereoSignal(int offset = 0) {
+        std::vector<CSAMPLE> buffer(kBufferSize);
+        for (int i = 0; i < kBufferSize; i += 2) {
+            const int frame = offset + i / 2;
+            buffer[i] = static_cast<CSAMPLE>(0.7 * std::sin(frame * 0.031));
+            buffer[i + 1] = static_cast<CSAMPLE>(0.5 * std::cos(frame * 0.17));
+        }
+        return buffer;
+    }
+
+    static std::vector<CSAMPLE> process(EngineFilterIIRBase* pFilter,
+            const std::vector<CSAMPLE>& input) {
+        std::vector<CSAMPLE> output(input.size());
+        pFilter->process(input.data(), output.data(), static_cast<int>(input.size()));
+        return output;
+    }
+};
+
+TEST_F(EngineFilterIIRTest, StereoChannelsAreIndependent) {
+    EngineFilterBessel4Low filter(kSampleRate, 600);
+    EngineFilterBessel4Low swappedFilter(kSampleRate, 600);
+    filter.assumeSettled();
+    swappedFilter.assumeSettled();
+
+    for (int block = 0; block < 4; ++block) {
+        const auto input = stereoSignal(block * kBufferSize / 2);
+        auto swappedInput = input;
+        for (int i = 0; i < kBufferSize; i += 2) {
+            std::swap(swappedInput[i], swappedInput[i + 1]);
+        }
+        const auto output = process(&filter, input);
+        const auto swappedOutput = process(&swappedFilter, swappedInput);
+        for (int i = 0; i < kBufferSize; i += 2) {
+            ASSERT_EQ(output[i], swappedOutput[i + 1]);
+            ASSERT_EQ(output[i + 1], swappedOutput[i]);
+        }
+    }
+}
+
+TEST_F(EngineFilterIIRTest, CoefficientChangeStartsWithOldFilter) {
+    EngineFilterBessel4Low filter(kSampleRate, 600);
+    EngineFilterBessel4Low oldFilter(kSampleRate, 600);
+    filter.assumeSettled();
+    oldFilter.assumeSettled();
+    process(&filter, stereoSignal());
+    process(&oldFilter, stereoSignal());
+
+    // The first half of the buffer is the output of the old filter, which
+    // is then cross-faded with the new filter
+    filter.setFrequencyCorners(kSampleRate, 2000);
+    const auto input = stereoSignal(kBufferSize / 2);
+    const auto output = process(&filter, input);
+    const auto oldOutput = process(&oldFilter, input);
+    for (int i = 0; i < kBufferSize / 2; ++i) {
+        ASSERT_EQ(oldOutput[i], output[i]);
+    }
+    EXPECT_NE(oldOutput[kBufferSize - 2], output[kBufferSize - 2]);
+
+    // Afterwards only the new filter is processed
+    EngineFilterBessel4Low newFilter(kSampleRate, 2000);
+    newFilter.assumeSettled();
+    process(&newFilter, input);
+    const auto nextInput = stereoSignal(kBufferSize);
+    EXPECT_EQ(process(&newFilter, nextInput), process(&filter, nextInput));
+}
+
+TEST_F(EngineFilterIIRTest, StartFromDry) {
+    EngineFilterBessel4Low filter(kSampleRate, 600);
+    filter.setStartFromDry(true);
+    filter.pauseFilter();
+
+    const auto input = stereoSignal();
+    const auto output = process(&filter, input);
+    for (int i = 0; i < kBufferSize / 2; ++i) {
+        ASSERT_EQ(input[i], output[i]);
+    }
+}
+
+TEST_F(EngineFilterIIRTest, StartFromSilence) {
+    EngineFilterBessel4Low filter(kSampleRate, 600);
+    filter.pauseFilter();
+
+    const auto output = process(&filter, stereoSignal());
+    for (int i = 0; i < kBufferSize / 2; ++i) {
+        ASSERT_EQ(0, output[i]);
+    }
+    EXPECT_NE(0, output[kBufferSize - 2]);
+}
+
+} // namespace
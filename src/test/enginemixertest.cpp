@@ -217,6 +217,52 @@ TEST_F(EngineMixerTest, TwoChannelOutputWorks) {
     assertHeadphoneBufferMatchesGolden(testName);
 }
 
+TEST_F(EngineMixerTest, TwoChannelOutputWorksInParallel) {
+    // The result must be identical to the serial processing.
+    const QString testName = "TwoChannelOutputWorks";
+
+    ControlObject::set(ConfigKey("[App]", "parallel_channel_processing"), 1.0);
+
+    EngineChannelMock* pChannel1 = new EngineChannelMock(
+            "[Test1]", EngineChannel::CENTER, m_pEngineMixer);
+    m_pEngineMixer->addChannel(pChannel1);
+    EngineChannelMock* pChannel2 = new EngineChannelMock(
+            "[Test2]", EngineChannel::CENTER, m_pEngineMixer);
+    m_pEngineMixer->addChannel(pChannel2);
+
+    CSAMPLE* pChannel1Buffer = const_cast<CSAMPLE*>(m_pEngineMixer->getChannelBuffer("[Test1]"));
+    CSAMPLE* pChannel2Buffer = const_cast<CSAMPLE*>(m_pEngineMixer->getChannelBuffer("[Test2]"));
+    SampleUtil::fill(pChannel1Buffer, 0.1f, kMaxEngineSamples);
+    SampleUtil::fill(pChannel2Buffer, 0.2f, kMaxEngineSamples);
+
+    for (EngineChannelMock* pChannel : {pChannel1, pChannel2}) {
+        EXPECT_CALL(*pChannel, updateActiveState())
+                .Times(1)
+                .WillOnce(Return(EngineChannel::ActiveState::Active));
+        EXPECT_CALL(*pChannel, isActive())
+                .Times(1)
+                .WillOnce(Return(true));
+        EXPECT_CALL(*pChannel, isMainMixEnabled())
+                .Times(1)
+                .WillOnce(Return(true));
+        EXPECT_CALL(*pChannel, isPflEnabled())
+                .Times(1)
+                .WillOnce(Return(false));
+        EXPECT_CALL(*pChannel, collectFeatures(_))
+                .Times(1);
+        EXPECT_CALL(*pChannel, postProcess(kMaxEngineSamples))
+                .Times(1);
+        EXPECT_CALL(*pChannel, process(_, kMaxEngineSamples))
+                .Times(1)
+                .WillOnce(Return());
+    }
+
+    m_pEngineMixer->process(kMaxEngineSamples);
+
+    assertMainBufferMatchesGolden(testName);
+    assertHeadphoneBufferMatchesGolden(testName);
+}
+
 TEST_F(EngineMixerTest, TwoChannelPFLOutputWorks) {
     const QString testName = "TwoChannelPFLOutputWorks";
 
@@ -0,0 +1,155 @@
+#include "engine/engineprofiler.h"
+
+#include <gtest/gtest.h>
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+namespace {
+
+// 1024 frames at 48 kHz
+constexpr SINT kFramesPerBuffer = 1024;
+constexpr mixxx::audio::SampleRate kSampleRate(48000);
+constexpr qint64 kBudgetNanos = 21333333;
+
+class EngineProfilerTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        m_pProfiler = EngineProfiler::createInstance();
+        m_nowNanos = 0;
+    }
+
+    void TearDown() override {
+        EngineProfiler::destroy();
+    }
+
+    // Simulates a callback with the given stage durations, one after the
+    // other, using synthetic timestamps
+    void simulateCallback(qint64 channelNanos, qint64 mainEffectsNanos) {
+        EngineProfiler::beginCallback(kFramesPerBuffer, kSampleRate);
+        const qint64 callbackStart = m_nowNanos;
+        EngineProfiler::record(EngineProfiler::Stage::Channel,
+                m_nowNanos,
+                m_nowNanos + channelNanos,
+                1);
+        m_nowNanos += channelNanos;
+        EngineProfiler::record(EngineProfiler::Stage::MainEffects,
+                m_nowNanos,
+                m_nowNanos + mainEffectsNanos);
+        m_nowNanos += mainEffectsNanos;
+        EngineProfiler::record(EngineProfiler::Stage::Callback, callbackStart, m_nowNanos);
+        // Idle until the next callback
+        m_nowNanos += kBudgetNanos;
+    }
+
+    EngineProfiler::StageStats stats(EngineProfiler::Stage stage) const {
+        return m_pProfiler->stageStats()[static_cast<int>(stage)];
+    }
+
+    EngineProfiler* m_pProfiler;
+    qint64 m_nowNanos;
+};
+
+TEST_F(EngineProfilerTest, Percentiles) {
+    for (int i = 1; i <= 100; ++i) {
+        simulateCallback(i * 1000, 1000);
+    }
+    m_pProfiler->processQueuedSamples();
+
+    const auto channelStats = stats(EngineProfiler::Stage::Channel);
+    EXPECT_EQ(100, channelStats.count);
+    EXPECT_EQ(50000, channelStats.p50Nanos);
+    EXPECT_EQ(90000, channelStats.p90Nanos);
+    EXPECT_EQ(99000, channelStats.p99Nanos);
+    EXPECT_EQ(100000, channelStats.maxNanos);
+    EXPECT_EQ(0, channelStats.overruns);
+    EXPECT_EQ(100, stats(EngineProfiler::Stage::Callback).count);
+    EXPECT_EQ(0, stats(EngineProfiler::Stage::Engine).count);
+    EXPECT_TRUE(m_pProfiler->recentOverruns().isEmpty());
+}
+
+TEST_F(EngineProfilerTest, AttributeOverrunToSlowestStage) {
+    for (int i = 0; i < 10; ++i) {
+        simulateCallback(5000000, 1000000);
+    }
+    // The channel is slower than usual, but the main effects exceed their
+    // median duration the most
+    simulateCallback(8000000, 15000000);
+    m_pProfiler->processQueuedSamples();
+
+    const auto overruns = m_pProfiler->recentOverruns();
+    ASSERT_EQ(1, overruns.size());
+    EXPECT_EQ(11u, overruns.first().callback);
+    EXPECT_EQ(23000000, overruns.first().callbackNanos);
+    EXPECT_EQ(kBudgetNanos, overruns.first().budgetNanos);
+    EXPECT_FALSE(overruns.first().xrun);
+    EXPECT_EQ(EngineProfiler::Stage::MainEffects, overruns.first().stage);
+    EXPECT_EQ(-1, overruns.first().channel);
+    EXPECT_EQ(15000000, overruns.first().stageNanos);
+    EXPECT_EQ(1, stats(EngineProfiler::Stage::MainEffects).overruns);
+    EXPECT_EQ(0, stats(EngineProfiler::Stage::Channel).overruns);
+}
+
+TEST_F(EngineProfilerTest, AttributeXrunToPreviousCallback) {
+    for (int i = 0; i < 10; ++i) {
+        simulateCallback(5000000, 1000000);
+    }
+    // Within the budget, but the device reported an xrun anyway
+    simulateCallback(12000000, 1000000);
+    EngineProfiler::reportXrun();
+    simulateCallback(5000000, 1000000);
+    m_pProfiler->processQueuedSamples();
+
+    const auto overruns = m_pProfiler->recentOverruns();
+    ASSERT_EQ(1, overruns.size());
+    EXPECT_EQ(11u, overruns.first().callback);
+    EXPECT_TRUE(overruns.first().xrun);
+    EXPECT_EQ(EngineProfiler::Stage::Channel, overruns.first().stage);
+    EXPECT_EQ(1, overruns.first().channel);
+    EXPECT_EQ(12000000, overruns.first().stageNanos);
+}
+
+TEST_F(EngineProfilerTest, WriteTraceEvents) {
+    QTemporaryDir dir;
+    const QString fileName = dir.filePath(QStringLiteral("trace.json"));
+    EXPECT_FALSE(m_pProfiler->writeTraceEvents(fileName));
+
+    simulateCallback(5000, 1000);
+    EngineProfiler::reportXrun();
+    simulateCallback(5000, 1000);
+    m_pProfiler->processQueuedSamples();
+    ASSERT_TRUE(m_pProfiler->writeTraceEvents(fileName));
+
+    QFile file(fileName);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll());
+    ASSERT_TRUE(document.isObject());
+    const QJsonArray events = document.object().value(QStringLiteral("traceEvents")).toArray();
+    // 3 stages per callback and the xrun
+    ASSERT_EQ(7, events.size());
+
+    const QJsonObject channel = events.at(0).toObject();
+    EXPECT_EQ(QStringLiteral("Channel 1"), channel.value(QStringLiteral("name")).toString());
+    EXPECT_EQ(QStringLiteral("X"), channel.value(QStringLiteral("ph")).toString());
+    EXPECT_EQ(2, channel.value(QStringLiteral("tid")).toInt());
+    EXPECT_DOUBLE_EQ(0.0, channel.value(QStringLiteral("ts")).toDouble());
+    EXPECT_DOUBLE_EQ(5.0, channel.value(QStringLiteral("dur")).toDouble());
+
+    const QJsonObject callback = events.at(2).toObject();
+    EXPECT_EQ(QStringLiteral("Callback"), callback.value(QStringLiteral("name")).toString());
+    EXPECT_EQ(0, callback.value(QStringLiteral("tid")).toInt());
+    EXPECT_DOUBLE_EQ(kBudgetNanos / 1000.0,
+            callback.value(QStringLiteral("args"))
+                    .toObject()
+                    .value(QStringLiteral("budget_us"))
+                    .toDouble());
+
+    const QJsonObject xrun = events.at(3).toObject();
+    EXPECT_EQ(QStringLiteral("xrun"), xrun.value(QStringLiteral("name")).toString());
+    EXPECT_EQ(QStringLiteral("i"), xrun.value(QStringLiteral("ph")).toString());
+}
+
+} // namespace
@@ -0,0 +1,194 @@
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QDataStream>
+#include <QFile>
+#include <QTemporaryDir>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "sources/soundsourceproxy.h"
+#include "test/enginerenderer.h"
+
+// Renders the full signal path of the engine without a sound device. The
+// engine is driven as fast as possible instead of by the clock of a sound
+// card, which makes the results reproducible on any machine.
+//
+// Run the benchmarks with
+//   mixxx-test --benchmark --benchmark_filter=BM_RenderSignalPath
+// The tracks can be replaced by setting MIXXX_RENDER_BENCHMARK_TRACKS to a
+// directory with audio files. If MIXXX_RENDER_BENCHMARK_WAV is set, the main
+// output of the last benchmark run is written to that WAV file.
+
+namespace {
+
+constexpr int kBufferSize = EngineRenderer::kBufferSize;
+constexpr mixxx::audio::ChannelCount kChannelCount = mixxx::audio::ChannelCount::stereo();
+
+class ProviderRegistration : public SoundSourceProviderRegistration {
+};
+
+// Writes interleaved stereo samples as a 32-bit float WAV file
+class WavWriter {
+  public:
+    bool open(const QString& filePath, mixxx::audio::SampleRate sampleRate) {
+        m_file.setFileName(filePath);
+        if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            return false;
+        }
+        m_sampleRate = sampleRate;
+        m_numSamples = 0;
+        m_stream.setDevice(&m_file);
+        m_stream.setByteOrder(QDataStream::LittleEndian);
+        m_stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+        // Rewritten with the final sizes when closing the file
+        writeHeader();
+        return m_stream.status() == QDataStream::Ok;
+    }
+
+    void write(const CSAMPLE* pSamples, int numSamples) {
+        for (int i = 0; i < numSamples; ++i) {
+            m_stream << pSamples[i];
+        }
+        m_numSamples += numSamples;
+    }
+
+    bool close() {
+        if (!m_file.seek(0)) {
+            return false;
+        }
+        writeHeader();
+        const bool ok = m_stream.status() == QDataStream::Ok;
+        m_stream.setDevice(nullptr);
+        m_file.close();
+        return ok;
+    }
+
+  private:
+    void writeHeader() {
+        constexpr quint16 kFormatIeeeFloat = 3;
+        constexpr quint16 kBytesPerSample = sizeof(float);
+        const quint16 blockAlign = kChannelCount * kBytesPerSample;
+        const quint32 dataBytes = static_cast<quint32>(m_numSamples * kBytesPerSample);
+        m_stream.writeRawData("RIFF", 4);
+        m_stream << static_cast<quint32>(36 + dataBytes);
+        m_stream.writeRawData("WAVE", 4);
+        m_stream.writeRawData("fmt ", 4);
+        m_stream << static_cast<quint32>(16);
+        m_stream << kFormatIeeeFloat;
+        m_stream << static_cast<quint16>(kChannelCount);
+        m_stream << static_cast<quint32>(m_sampleRate.value());
+        m_stream << static_cast<quint32>(m_sampleRate.value() * blockAlign);
+        m_stream << blockAlign;
+        m_stream << static_cast<quint16>(8 * kBytesPerSample);
+        m_stream.writeRawData("data", 4);
+        m_stream << dataBytes;
+    }
+
+    QFile m_file;
+    QDataStream m_stream;
+    mixxx::audio::SampleRate m_sampleRate;
+    qint64 m_numSamples = 0;
+};
+
+class EngineRenderTest : public MixxxTest, SoundSourceProviderRegistration {
+};
+
+TEST_F(EngineRenderTest, RenderMainOutputToWav) {
+    constexpr int kNumBuffers = 100;
+    QTemporaryDir outputDir;
+    ASSERT_TRUE(outputDir.isValid());
+    const QString wavPath = outputDir.filePath(QStringLiteral("render.wav"));
+
+    CSAMPLE peak = 0;
+    {
+        EngineRenderer::Options options;
+        options.numDecks = 4;
+        EngineRenderer renderer(config(), EngineRenderer::trackPaths(), options);
+        WavWriter writer;
+        ASSERT_TRUE(writer.open(wavPath, renderer.sampleRate()));
+        for (int i = 0; i < kNumBuffers; ++i) {
+            renderer.processBuffer();
+            const CSAMPLE* pMain = renderer.mainBuffer();
+            for (int j = 0; j < kBufferSize; ++j) {
+                peak = std::max(peak, std::abs(pMain[j]));
+            }
+            writer.write(pMain, kBufferSize);
+        }
+        ASSERT_TRUE(writer.close());
+    }
+    EXPECT_GT(peak, 0);
+
+    SoundSourceProxy proxy(Track::newTemporary(wavPath));
+    const auto pAudioSource = proxy.openAudioSource();
+    ASSERT_NE(nullptr, pAudioSource);
+    EXPECT_EQ(kChannelCount, pAudioSource->getSignalInfo().getChannelCount());
+    EXPECT_EQ(kNumBuffers * kBufferSize / kChannelCount,
+            pAudioSource->frameIndexRange().length());
+}
+
+// Renders the main output with all decks playing, synced and looping with
+// keylock and an effect unit enabled. Reports the percentiles of the
+// processing time per buffer and how many times faster than realtime the
+// engine renders. Argument: number of decks
+static void BM_RenderSignalPath(benchmark::State& state) {
+    const ProviderRegistration providerRegistration;
+    const QStringList trackPaths = EngineRenderer::trackPaths();
+    if (trackPaths.isEmpty()) {
+        state.SkipWithError("No audio files found");
+        return;
+    }
+    QTemporaryDir configDir;
+    UserSettingsPointer pConfig(new UserSettings(configDir.filePath("test.cfg")));
+
+    EngineRenderer::Options options;
+    options.numDecks = static_cast<int>(state.range(0));
+    EngineRenderer renderer(pConfig, trackPaths, options);
+
+    const QString wavPath = qEnvironmentVariable("MIXXX_RENDER_BENCHMARK_WAV");
+    WavWriter writer;
+    if (!wavPath.isEmpty() && !writer.open(wavPath, renderer.sampleRate())) {
+        state.SkipWithError("Failed to open the WAV file");
+        return;
+    }
+
+    std::vector<qint64> bufferNanos;
+    for (auto _ : state) {
+        bufferNanos.push_back(renderer.processBuffer().toIntegerNanos());
+        if (!wavPath.isEmpty()) {
+            writer.write(renderer.mainBuffer(), kBufferSize);
+        }
+    }
+    if (!wavPath.isEmpty()) {
+        writer.close();
+    }
+    if (bufferNanos.empty()) {
+        return;
+    }
+
+    qint64 totalNanos = 0;
+    for (const auto nanos : bufferNanos) {
+        totalNanos += nanos;
+    }
+    std::sort(bufferNanos.begin(), bufferNanos.end());
+    const auto percentileMicros = [&bufferNanos](double percentile) {
+        const auto index = static_cast<std::size_t>(
+                percentile * static_cast<double>(bufferNanos.size() - 1));
+        return static_cast<double>(bufferNanos[index]) / 1000;
+    };
+    state.counters["p50_us"] = percentileMicros(0.5);
+    state.counters["p90_us"] = percentileMicros(0.9);
+    state.counters["p99_us"] = percentileMicros(0.99);
+    state.counters["max_us"] = percentileMicros(1.0);
+    const double audioSeconds =
+            static_cast<double>(bufferNanos.size() * kBufferSize / kChannelCount) /
+            renderer.sampleRate().value();
+    const double renderSeconds = static_cast<double>(totalNanos) / 1e9;
+    if (renderSeconds > 0) {
+        state.counters["realtime_factor"] = audioSeconds / renderSeconds;
+    }
+}
+BENCHMARK(BM_RenderSignalPath)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <QDir>
+#include <QTest>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "effects/backends/effectsbackendmanager.h"
+#include "effects/chains/equalizereffectchain.h"
+#include "effects/defs.h"
+#include "effects/effectchain.h"
+#include "effects/effectslot.h"
+#include "mixer/playermanager.h"
+#include "sources/soundsourceproxy.h"
+#include "test/signalpathtest.h"
+#include "track/beats.h"
+#include "util/performancetimer.h"
+
+// The engine with decks and effect units, but without a PlayerManager and
+// a SoundManager. Mirrors the setup of BaseSignalPathTest for any number of
+// decks.
+class EngineRenderer {
+  public:
+    struct Options {
+        int numDecks = 2;
+        bool sync = true;
+        bool keylock = true;
+        bool loops = true;
+        bool effects = true;
+        // If set, this effect is loaded into the equalizer chain of each
+        // deck, which is processed before the channel fader
+        QString preFaderEffectId;
+        // Processes the channels on the worker pool of the EngineMixer
+        bool parallelChannels = false;
+    };
+
+    static constexpr int kBufferSize = 1024; // samples
+
+    EngineRenderer(UserSettingsPointer pConfig,
+            const QStringList& trackPaths,
+            const Options& options)
+            : m_pConfig(std::move(pConfig)),
+              m_pControlIndicatorTimer(std::make_unique<mixxx::ControlIndicatorTimer>()),
+              m_pChannelHandleFactory(std::make_shared<ChannelHandleFactory>()),
+              m_pNumDecks(std::make_unique<ControlObject>(ConfigKey(
+                      QStringLiteral("[App]"), QStringLiteral("num_decks")))),
+              m_pEffectsManager(std::make_unique<EffectsManager>(
+                      m_pConfig, m_pChannelHandleFactory)),
+              m_pEngineMixer(std::make_unique<TestEngineMixer>(m_pConfig,
+                      QStringLiteral("[Master]"),
+                      m_pEffectsManager.get(),
+                      m_pChannelHandleFactory,
+                      false)) {
+        DEBUG_ASSERT(!trackPaths.isEmpty());
+        for (int i = 0; i < options.numDecks; ++i) {
+            const ChannelHandleAndGroup handleGroup =
+                    m_pEngineMixer->registerChannelGroup(PlayerManager::groupForDeck(i));
+            m_decks.push_back(std::make_unique<Deck>(nullptr,
+                    m_pConfig,
+                    m_pEngineMixer.get(),
+                    m_pEffectsManager.get(),
+                    i % 2 == 1 ? EngineChannel::RIGHT : EngineChannel::LEFT,
+                    handleGroup));
+            m_pEffectsManager->addDeck(handleGroup);
+            ControlObject::set(ConfigKey(handleGroup.name(), "main_mix"), 1.0);
+            m_pNumDecks->set(m_pNumDecks->get() + 1);
+        }
+        m_pEffectsManager->setup();
+        ControlObject::set(ConfigKey(QStringLiteral("[Master]"), "enabled"), 1.0);
+        ControlObject::set(ConfigKey(QStringLiteral("[App]"),
+                                   QStringLiteral("parallel_channel_processing")),
+                options.parallelChannels ? 1.0 : 0.0);
+        PlayerInfo::create();
+
+        for (int i = 0; i < options.numDecks; ++i) {
+            // A different tempo for each deck, so that the synced decks
+            // are actually time stretched
+            loadTrack(m_decks[i].get(),
+                    trackPaths[i % trackPaths.size()],
+                    mixxx::Bpm(120.0 + 4 * i));
+        }
+        for (int i = 0; i < options.numDecks; ++i) {
+            const QString group = m_decks[i]->getGroup();
+            if (options.effects) {
+                enableEffect(group, i % kNumStandardEffectUnits, effectIds()[i % effectIds().size()]);
+            }
+            if (!options.preFaderEffectId.isEmpty()) {
+                enablePreFaderEffect(group, options.preFaderEffectId);
+            }
+            ControlObject::set(ConfigKey(group, "keylock"), options.keylock ? 1.0 : 0.0);
+            ControlObject::set(ConfigKey(group, "sync_enabled"), options.sync ? 1.0 : 0.0);
+            ControlObject::set(ConfigKey(group, "play"), 1.0);
+            if (options.loops) {
+                ControlObject::set(ConfigKey(group, "beatloop_size"), 4.0);
+                ControlObject::set(ConfigKey(group, "beatloop_activate"), 1.0);
+            }
+        }
+    }
+
+    ~EngineRenderer() {
+        m_decks.clear();
+        // Deletes all EngineChannels added to it.
+        m_pEngineMixer.reset();
+        m_pEffectsManager.reset();
+        m_pNumDecks.reset();
+        PlayerInfo::destroy();
+    }
+
+    mixxx::audio::SampleRate sampleRate() const {
+        return mixxx::audio::SampleRate::fromDouble(ControlObject::get(
+                ConfigKey(QStringLiteral("[App]"), QStringLiteral("samplerate"))));
+    }
+
+    // Processes a single buffer and returns the processing time
+    mixxx::Duration processBuffer() {
+        PerformanceTimer timer;
+        timer.start();
+        m_pEngineMixer->process(kBufferSize);
+        return timer.elapsed();
+    }
+
+    const CSAMPLE* mainBuffer() const {
+        return m_pEngineMixer->getMainBuffer();
+    }
+
+    // The tracks that are loaded into the decks. Defaults to a sine wave,
+    // unless MIXXX_RENDER_BENCHMARK_TRACKS is set to a directory.
+    static QStringList trackPaths() {
+        const QString tracksPath = qEnvironmentVariable("MIXXX_RENDER_BENCHMARK_TRACKS");
+        if (tracksPath.isEmpty()) {
+            return {MixxxTest::getOrInitTestDir().filePath(QStringLiteral("sine-30.wav"))};
+        }
+        QStringList filePaths;
+        const QDir tracksDir(tracksPath);
+        const auto fileInfos = tracksDir.entryInfoList(QDir::Files, QDir::Name);
+        for (const auto& fileInfo : fileInfos) {
+            if (SoundSourceProxy::isFileSuffixSupported(fileInfo.suffix())) {
+                filePaths.append(fileInfo.absoluteFilePath());
+            }
+        }
+        return filePaths;
+    }
+
+  private:
+    static const QStringList& effectIds() {
+        static const QStringList kEffectIds = {
+                QStringLiteral("org.mixxx.effects.echo"),
+                QStringLiteral("org.mixxx.effects.filter"),
+                QStringLiteral("org.mixxx.effects.reverb"),
+                QStringLiteral("org.mixxx.effects.flanger"),
+        };
+        return kEffectIds;
+    }
+
+    void loadTrack(Deck* pDeck, const QString& trackPath, mixxx::Bpm bpm) {
+        const TrackPointer pTrack = Track::newTemporary(trackPath);
+        pDeck->slotLoadTrack(pTrack, false);
+        EngineBuffer* pEngineBuffer = pDeck->getEngineDeck()->getEngineBuffer();
+        for (int i = 0; i < 2000 && !pEngineBuffer->isTrackLoaded(); ++i) {
+            m_pEngineMixer->process(kBufferSize);
+            QTest::qSleep(1); // sleep 1 ms for waiting 2 s at max
+        }
+        DEBUG_ASSERT(pEngineBuffer->isTrackLoaded());
+        // The sample rate of the track is only known after it has been loaded
+        pTrack->trySetBeats(mixxx::Beats::fromConstTempo(
+                pTrack->getSampleRate(), mixxx::audio::kStartFramePos, bpm));
+    }
+
+    void enableEffect(const QString& deckGroup, int unitIndex, const QString& effectId) {
+        EffectChainPointer pChain = m_pEffectsManager->getStandardEffectChain(unitIndex);
+        VERIFY_OR_DEBUG_ASSERT(pChain) {
+            return;
+        }
+        const EffectManifestPointer pManifest =
+                m_pEffectsManager->getBackendManager()->getManifest(
+                        effectId, EffectBackendType::BuiltIn);
+        VERIFY_OR_DEBUG_ASSERT(pManifest) {
+            return;
+        }
+        EffectSlotPointer pSlot = pChain->getEffectSlot(0);
+        pSlot->loadEffectWithDefaults(pManifest);
+        ControlObject::set(ConfigKey(pSlot->getGroup(), "enabled"), 1.0);
+        ControlObject::set(ConfigKey(pChain->group(), "mix"), 0.5);
+        ControlObject::set(ConfigKey(pChain->group(), "enabled"), 1.0);
+        ControlObject::set(ConfigKey(pChain->group(),
+                                   QStringLiteral("group_%1_enable").arg(deckGroup)),
+                1.0);
+    }
+
+    void enablePreFaderEffect(const QString& deckGroup, const QString& effectId) {
+        EqualizerEffectChainPointer pChain =
+                m_pEffectsManager->getEqualizerEffectChain(deckGroup);
+        VERIFY_OR_DEBUG_ASSERT(pChain) {
+            return;
+        }
+        const EffectManifestPointer pManifest =
+                m_pEffectsManager->getBackendManager()->getManifest(
+                        effectId, EffectBackendType::BuiltIn);
+        VERIFY_OR_DEBUG_ASSERT(pManifest) {
+            return;
+        }
+        EffectSlotPointer pSlot = pChain->getEffectSlot(0);
+        pSlot->loadEffectWithDefaults(pManifest);
+        ControlObject::set(ConfigKey(pSlot->getGroup(), "enabled"), 1.0);
+        ControlObject::set(ConfigKey(pChain->group(), "mix"), 0.5);
+        ControlObject::set(ConfigKey(pChain->group(), "enabled"), 1.0);
+    }
+
+    const UserSettingsPointer m_pConfig;
+    std::unique_ptr<mixxx::ControlIndicatorTimer> m_pControlIndicatorTimer;
+    ChannelHandleFactoryPointer m_pChannelHandleFactory;
+    std::unique_ptr<ControlObject> m_pNumDecks;
+    std::unique_ptr<EffectsManager> m_pEffectsManager;
+    std::unique_ptr<TestEngineMixer> m_pEngineMixer;
+    std::vector<std::unique_ptr<Deck>> m_decks;
+};
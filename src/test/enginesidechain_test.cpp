@@ -0,0 +1,198 @@
+#include "engine/sidechain/enginesidechain.h"
+
+#include <gtest/gtest.h>
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QSemaphore>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "engine/engine.h"
+#include "util/compatibility/qmutex.h"
+
+namespace {
+
+constexpr int kChunkSamples = EngineSideChain::SIDECHAIN_BUFFER_SIZE;
+constexpr int kChunkFrames = kChunkSamples / mixxx::kEngineChannelCount;
+
+// Everything that a DummySink has received, which outlives the sink
+// when it is deleted by EngineSideChain
+struct DummySinkState {
+    QMutex mutex;
+    std::vector<CSAMPLE> samples;
+    bool shutdown = false;
+    // If set, every call of process() waits for the gate
+    std::unique_ptr<QSemaphore> pGate;
+
+    int numSamples() {
+        const auto locker = lockMutex(&mutex);
+        return static_cast<int>(samples.size());
+    }
+};
+
+// A local sink in place of an encoder that sends to an Icecast server
+// or writes a recording
+class DummySink : public SideChainWorker {
+  public:
+    explicit DummySink(std::shared_ptr<DummySinkState> pState)
+            : m_pState(std::move(pState)) {
+    }
+
+    void process(const CSAMPLE* pBuffer, const int iBufferSize) override {
+        if (m_pState->pGate) {
+            m_pState->pGate->acquire();
+        }
+        const auto locker = lockMutex(&m_pState->mutex);
+        m_pState->samples.insert(m_pState->samples.end(), pBuffer, pBuffer + iBufferSize);
+    }
+
+    void shutdown() override {
+        const auto locker = lockMutex(&m_pState->mutex);
+        m_pState->shutdown = true;
+    }
+
+  private:
+    const std::shared_ptr<DummySinkState> m_pState;
+};
+
+class EngineSideChainTest : public testing::Test {
+  protected:
+    EngineSideChainTest()
+            : m_pSideChain(std::make_unique<EngineSideChain>(
+                      UserSettingsPointer(), m_sidechainMix)),
+              m_numSamplesWritten(0) {
+    }
+
+    std::shared_ptr<DummySinkState> addSink(bool gated = false) {
+        auto pState = std::make_shared<DummySinkState>();
+        if (gated) {
+            pState->pGate = std::make_unique<QSemaphore>();
+        }
+        m_pSideChain->addSideChainWorker(new DummySink(pState));
+        return pState;
+    }
+
+    // Writes a chunk of consecutive sample values, which fills the FIFO
+    // and wakes up the sidechain
+    void writeChunk() {
+        std::vector<CSAMPLE> samples(kChunkSamples);
+        for (auto& sample : samples) {
+            sample = static_cast<CSAMPLE>(m_numSamplesWritten++);
+        }
+        m_pSideChain->writeSamples(samples.data(), kChunkFrames);
+    }
+
+    static bool waitFor(const std::function<bool()>& isDone) {
+        QElapsedTimer timer;
+        timer.start();
+        while (!isDone()) {
+            if (timer.elapsed() > 5000) {
+                return false;
+            }
+            QThread::msleep(1);
+        }
+        return true;
+    }
+
+    static bool waitForSamples(DummySinkState* pState, int numSamples) {
+        return waitFor([pState, numSamples] {
+            return pState->numSamples() >= numSamples;
+        });
+    }
+
+    // The stats of a worker are only updated after its process() has
+    // returned, i.e. after the DummySink has already received the samples.
+    bool waitForWorkerStats(int workerIndex,
+            SINT backlogSamples,
+            quint64 processedSamples,
+            quint64 droppedSamples) const {
+        return waitFor([&] {
+            const auto stats = m_pSideChain->workerStats();
+            if (workerIndex >= stats.size()) {
+                return false;
+            }
+            const auto& workerStats = stats[workerIndex];
+            return workerStats.backlogSamples == backlogSamples &&
+                    workerStats.processedSamples == processedSamples &&
+                    workerStats.droppedSamples == droppedSamples;
+        });
+    }
+
+    static void expectConsecutiveSamples(const std::vector<CSAMPLE>& samples) {
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            ASSERT_EQ(static_cast<CSAMPLE>(i), samples[i]);
+        }
+    }
+
+    CSAMPLE m_sidechainMix[kChunkSamples];
+    std::unique_ptr<EngineSideChain> m_pSideChain;
+    int m_numSamplesWritten;
+};
+
+TEST_F(EngineSideChainTest, FanOutToAllWorkers) {
+    const auto pFirst = addSink();
+    const auto pSecond = addSink();
+
+    for (int i = 0; i < 4; ++i) {
+        writeChunk();
+        ASSERT_TRUE(waitForSamples(pFirst.get(), m_numSamplesWritten));
+        ASSERT_TRUE(waitForSamples(pSecond.get(), m_numSamplesWritten));
+    }
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_TRUE(waitForWorkerStats(i, 0, m_numSamplesWritten, 0));
+    }
+
+    const auto stats = m_pSideChain->workerStats();
+    ASSERT_EQ(2, stats.size());
+    for (const auto& workerStats : stats) {
+        EXPECT_EQ(static_cast<quint64>(m_numSamplesWritten), workerStats.processedSamples);
+        EXPECT_EQ(0u, workerStats.droppedSamples);
+        EXPECT_EQ(0, workerStats.backlogSamples);
+    }
+
+    m_pSideChain.reset();
+    EXPECT_TRUE(pFirst->shutdown);
+    EXPECT_TRUE(pSecond->shutdown);
+    expectConsecutiveSamples(pFirst->samples);
+    expectConsecutiveSamples(pSecond->samples);
+}
+
+TEST_F(EngineSideChainTest, SlowWorkerDoesNotDelayOthers) {
+    const auto pSlow = addSink(true);
+    const auto pFast = addSink();
+
+    // More than the slow worker is allowed to queue
+    const int numChunks =
+            EngineSideChain::kMaxWorkerBacklogSamples / kChunkSamples + 2;
+    for (int i = 0; i < numChunks; ++i) {
+        writeChunk();
+        ASSERT_TRUE(waitForSamples(pFast.get(), m_numSamplesWritten));
+    }
+    EXPECT_EQ(0, pSlow->numSamples());
+    EXPECT_TRUE(waitForWorkerStats(0,
+            EngineSideChain::kMaxWorkerBacklogSamples,
+            0,
+            2 * kChunkSamples));
+    EXPECT_TRUE(waitForWorkerStats(1, 0, m_numSamplesWritten, 0));
+
+    const auto stats = m_pSideChain->workerStats();
+    ASSERT_EQ(2, stats.size());
+    const auto& slowStats = stats[0];
+    EXPECT_EQ(0u, slowStats.processedSamples);
+    EXPECT_EQ(static_cast<SINT>(EngineSideChain::kMaxWorkerBacklogSamples),
+            slowStats.backlogSamples);
+    EXPECT_EQ(static_cast<quint64>(2 * kChunkSamples), slowStats.droppedSamples);
+    const auto& fastStats = stats[1];
+    EXPECT_EQ(static_cast<quint64>(m_numSamplesWritten), fastStats.processedSamples);
+    EXPECT_EQ(0u, fastStats.droppedSamples);
+
+    // The queued chunks are still processed on shutdown
+    pSlow->pGate->release(numChunks);
+    m_pSideChain.reset();
+    EXPECT_EQ(EngineSideChain::kMaxWorkerBacklogSamples, pSlow->numSamples());
+    expectConsecutiveSamples(pFast->samples);
+}
+
+} // namespace
@@ -0,0 +1,63 @@
+#include "engine/engineworkerscheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "engine/engineworker.h"
+
+namespace {
+
+// The worker threads are never started, the test only checks which
+// workers have been woken up.
+class IdleWorker : public EngineWorker {
+  public:
+    int wakeUps() const {
+        return m_semaRun.available();
+    }
+};
+
+// More workers than the decks, samplers and preview decks of a session
+// with all players enabled, plus a RubberBand worker for each deck.
+constexpr int kNumWorkers = 100;
+
+TEST(EngineWorkerSchedulerTest, WakesAllReadyWorkers) {
+    EngineWorkerScheduler scheduler;
+    std::vector<std::unique_ptr<IdleWorker>> workers;
+    for (int i = 0; i < kNumWorkers; ++i) {
+        workers.push_back(std::make_unique<IdleWorker>());
+        workers.back()->setScheduler(&scheduler);
+    }
+
+    for (int i = 0; i < kNumWorkers; i += 2) {
+        workers[i]->workReady();
+    }
+    scheduler.runWorkers();
+
+    for (int i = 0; i < kNumWorkers; ++i) {
+        EXPECT_EQ(i % 2 == 0 ? 1 : 0, workers[i]->wakeUps()) << i;
+    }
+}
+
+TEST(EngineWorkerSchedulerTest, RemovedWorkersAreNotWoken) {
+    EngineWorkerScheduler scheduler;
+    std::vector<std::unique_ptr<IdleWorker>> workers;
+    for (int i = 0; i < kNumWorkers; ++i) {
+        workers.push_back(std::make_unique<IdleWorker>());
+        workers.back()->setScheduler(&scheduler);
+    }
+
+    // Destroying a worker unregisters it
+    workers.erase(workers.begin(), workers.begin() + kNumWorkers / 2);
+    for (const auto& pWorker : workers) {
+        pWorker->workReady();
+    }
+    scheduler.runWorkers();
+
+    for (const auto& pWorker : workers) {
+        EXPECT_EQ(1, pWorker->wakeUps());
+    }
+}
+
+} // namespace
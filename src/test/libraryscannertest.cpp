@@ -1,15 +1,76 @@
-#include <gtest/gtest.h>
+#include <benchmark/benchmark.h>
 #include <gmock/gmock.h>
+#include <gtest/gtest.h>
 
-#include "test/librarytest.h"
+#include <QSignalSpy>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include "library/scanner/libraryscanner.h"
+#include "sources/soundsourceproxy.h"
+#include "test/librarytest.h"
+#include "track/track.h"
+
+namespace {
+
+// Contains a title and an embedded cover image
+const QString kTaggedTestFile = QStringLiteral("id3-test-data/cover-test-jpg.mp3");
+
+constexpr int kScanTimeoutMillis = 10000;
+
+} // anonymous namespace
 
 class LibraryScannerTest : public LibraryTest {
   protected:
     LibraryScannerTest()
             : m_libraryScanner(dbConnectionPooler(), config()) {
     }
+
+    // Copies a test file into the directory and adds it to the library.
+    // The scanner only has to verify the track, so no track objects are
+    // created on the scanner thread.
+    QString addTrackFile(const QString& dirPath, const QString& fileName) {
+        EXPECT_TRUE(QDir().mkpath(dirPath));
+        const QString filePath = QDir(dirPath).filePath(fileName);
+        EXPECT_TRUE(QFile::copy(getTestDir().filePath(kTaggedTestFile), filePath));
+        EXPECT_TRUE(getOrAddTrackByLocation(filePath));
+        return mixxx::FileInfo(filePath).location();
+    }
+
+    // Runs a full scan if no directories are given and returns the
+    // directories that have been scanned
+    QStringList scan(const QStringList& directories = {}) {
+        if (!m_libraryScanner.isRunning()) {
+            m_libraryScanner.start();
+        }
+        QSignalSpy finishedSpy(&m_libraryScanner, &LibraryScanner::scanFinished);
+        QSignalSpy scannedSpy(&m_libraryScanner, &LibraryScanner::directoriesScanned);
+        if (directories.isEmpty()) {
+            m_libraryScanner.scan();
+        } else {
+            EXPECT_TRUE(m_libraryScanner.scanDirectories(directories));
+        }
+        if (finishedSpy.isEmpty()) {
+            EXPECT_TRUE(finishedSpy.wait(kScanTimeoutMillis));
+        }
+        if (scannedSpy.isEmpty()) {
+            return {};
+        }
+        return scannedSpy.first().first().toStringList();
+    }
+
+    bool isTrackDeleted(const QString& location) {
+        QSqlQuery query(dbConnection());
+        query.prepare("SELECT fs_deleted FROM track_locations WHERE location=:location");
+        query.bindValue(":location", location);
+        EXPECT_TRUE(query.exec());
+        EXPECT_TRUE(query.next());
+        return query.value(0).toBool();
+    }
+
     LibraryScanner m_libraryScanner;
 };
 
@@ -52,3 +113,173 @@ TEST_F(LibraryScannerTest, ScannerRoundtrip) {
     m_libraryScanner.changeScannerState(LibraryScanner::IDLE);
     EXPECT_EQ(m_libraryScanner.m_state, LibraryScanner::IDLE);
 }
+
+TEST_F(LibraryScannerTest, PreImportTrackMetadata) {
+    QTemporaryDir tempDir;
+    ASSERT_TRUE(tempDir.isValid());
+    const QString filePath = tempDir.filePath(QStringLiteral("track.mp3"));
+    ASSERT_TRUE(QFile::copy(getTestDir().filePath(kTaggedTestFile), filePath));
+    const auto fileAccess = mixxx::FileAccess(mixxx::FileInfo(filePath));
+
+    const auto preImportedMetadata =
+            SoundSourceProxy::preImportTrackMetadataAndCoverImageFromFile(
+                    fileAccess, false);
+    ASSERT_TRUE(preImportedMetadata);
+    EXPECT_EQ(QStringLiteral("mp3"), preImportedMetadata->fileType);
+    EXPECT_EQ(mixxx::MetadataSource::ImportResult::Succeeded,
+            preImportedMetadata->importResult);
+    EXPECT_EQ(QStringLiteral("test22kMono"),
+            preImportedMetadata->trackMetadata.getTrackInfo().getTitle());
+    EXPECT_FALSE(preImportedMetadata->coverImage.isNull());
+
+    // The new track is initialized from the pre-imported metadata
+    auto pTrack = Track::newTemporary(fileAccess);
+    EXPECT_EQ(SoundSourceProxy::UpdateTrackFromSourceResult::MetadataImportedAndUpdated,
+            SoundSourceProxy(pTrack).updateTrackFromSource(
+                    SoundSourceProxy::UpdateTrackFromSourceMode::Once,
+                    SyncTrackMetadataParams{},
+                    &*preImportedMetadata));
+    EXPECT_EQ(QStringLiteral("test22kMono"), pTrack->getTitle());
+    EXPECT_EQ(CoverInfo::METADATA, pTrack->getCoverInfo().type);
+
+    // Files of cached tracks are not read without locking the cache
+    const auto pCachedTrack = getOrAddTrackByLocation(filePath);
+    ASSERT_TRUE(pCachedTrack);
+    EXPECT_FALSE(SoundSourceProxy::preImportTrackMetadataAndCoverImageFromFile(
+            fileAccess, false));
+}
+
+TEST_F(LibraryScannerTest, ScanDirectoriesMarksTracksInDeletedDirectoryAsDeleted) {
+    QTemporaryDir tempDir;
+    ASSERT_TRUE(tempDir.isValid());
+    const QString rootDir = mixxx::FileInfo(tempDir.path()).location();
+    const QString keptDir = rootDir + QStringLiteral("/kept");
+    const QString deletedDir = rootDir + QStringLiteral("/deleted");
+    const QString keptTrack = addTrackFile(keptDir, QStringLiteral("kept.mp3"));
+    const QString deletedTrack = addTrackFile(deletedDir, QStringLiteral("deleted.mp3"));
+    ASSERT_TRUE(internalCollection()->addDirectory(mixxx::FileInfo(rootDir)));
+    scan();
+    ASSERT_FALSE(isTrackDeleted(deletedTrack));
+
+    // Reported for both the parent and the deleted directory
+    ASSERT_TRUE(QDir(deletedDir).removeRecursively());
+    scan({rootDir, deletedDir});
+
+    EXPECT_TRUE(isTrackDeleted(deletedTrack));
+    EXPECT_FALSE(isTrackDeleted(keptTrack));
+}
+
+TEST_F(LibraryScannerTest, ScanDirectoriesDescendsIntoNewDirectories) {
+    QTemporaryDir tempDir;
+    ASSERT_TRUE(tempDir.isValid());
+    const QString rootDir = mixxx::FileInfo(tempDir.path()).location();
+    const QString knownDir = rootDir + QStringLiteral("/known");
+    addTrackFile(knownDir, QStringLiteral("known.mp3"));
+    ASSERT_TRUE(internalCollection()->addDirectory(mixxx::FileInfo(rootDir)));
+    scan();
+
+    // Only the parent is reported for a new directory
+    const QString newDir = rootDir + QStringLiteral("/new");
+    const QString newSubDir = newDir + QStringLiteral("/sub");
+    const QString newTrack = addTrackFile(newSubDir, QStringLiteral("new.mp3"));
+    const QStringList scannedDirs = scan({rootDir});
+
+    EXPECT_THAT(scannedDirs, ::testing::Contains(newDir));
+    EXPECT_THAT(scannedDirs, ::testing::Contains(newSubDir));
+    EXPECT_FALSE(isTrackDeleted(newTrack));
+}
+
+TEST_F(LibraryScannerTest, ScanDirectoriesSkipsKnownDirectories) {
+    QTemporaryDir tempDir;
+    ASSERT_TRUE(tempDir.isValid());
+    const QString rootDir = mixxx::FileInfo(tempDir.path()).location();
+    const QString knownDir = rootDir + QStringLiteral("/known");
+    const QString knownTrack = addTrackFile(knownDir, QStringLiteral("known.mp3"));
+    ASSERT_TRUE(internalCollection()->addDirectory(mixxx::FileInfo(rootDir)));
+    scan();
+
+    // The known directory has changed, but it is not reported. It is
+    // neither scanned nor are its tracks verified.
+    ASSERT_TRUE(QFile::remove(knownTrack));
+    ASSERT_TRUE(QDir().mkpath(rootDir + QStringLiteral("/new")));
+    const QStringList scannedDirs = scan({rootDir});
+
+    EXPECT_THAT(scannedDirs, ::testing::Contains(rootDir));
+    EXPECT_THAT(scannedDirs, ::testing::Not(::testing::Contains(knownDir)));
+    EXPECT_FALSE(isTrackDeleted(knownTrack));
+}
+
+namespace {
+
+class PreImportBenchmarkCache : public virtual GlobalTrackCacheSaver,
+                                SoundSourceProviderRegistration {
+  public:
+    PreImportBenchmarkCache() {
+        GlobalTrackCache::createInstance(this, [](Track* pTrack) {
+            delete pTrack;
+        });
+    }
+    ~PreImportBenchmarkCache() {
+        GlobalTrackCache::destroyInstance();
+    }
+
+    void saveEvictedTrack(Track* pTrack) noexcept override {
+        Q_UNUSED(pTrack);
+    }
+};
+
+// Parses a synthetic library of tagged files in 20 directories like the
+// worker threads of the scanner, using the given number of threads.
+void BM_PreImportTrackMetadata(benchmark::State& state) {
+    constexpr int kNumDirectories = 20;
+    constexpr int kNumFilesPerDirectory = 25;
+    PreImportBenchmarkCache cache;
+    QTemporaryDir tempDir;
+    const QString sourcePath =
+            MixxxTest::getOrInitTestDir().filePath(kTaggedTestFile);
+    std::vector<mixxx::FileAccess> files;
+    for (int dir = 0; dir < kNumDirectories; ++dir) {
+        const QString dirPath = tempDir.filePath(QString::number(dir));
+        QDir().mkpath(dirPath);
+        for (int file = 0; file < kNumFilesPerDirectory; ++file) {
+            const QString filePath = QDir(dirPath).filePath(
+                    QStringLiteral("%1.mp3").arg(file));
+            if (!QFile::copy(sourcePath, filePath)) {
+                state.SkipWithError("Failed to create the library");
+                return;
+            }
+            files.emplace_back(mixxx::FileInfo(filePath));
+        }
+    }
+
+    const int numThreads = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::atomic<std::size_t> nextFile = 0;
+        std::atomic<int> numImported = 0;
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i) {
+            threads.emplace_back([&] {
+                for (std::size_t index = nextFile++; index < files.size();
+                        index = nextFile++) {
+                    if (SoundSourceProxy::preImportTrackMetadataAndCoverImageFromFile(
+                                files[index], false)) {
+                        ++numImported;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        benchmark::DoNotOptimize(numImported.load());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(files.size()));
+}
+BENCHMARK(BM_PreImportTrackMetadata)
+        ->Arg(1)
+        ->Arg(2)
+        ->Arg(4)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+} // anonymous namespace
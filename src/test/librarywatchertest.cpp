@@ -0,0 +1,103 @@
+#include "library/scanner/librarywatcher.h"
+
+#include <gtest/gtest.h>
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "library/library_prefs.h"
+#include "library/scanner/libraryscanner.h"
+#include "test/librarytest.h"
+
+class LibraryWatcherTest : public LibraryTest {
+  protected:
+    LibraryWatcherTest()
+            : m_libraryScanner(dbConnectionPooler(), config()),
+              m_watcher(&m_libraryScanner, config()) {
+        config()->setValue(mixxx::library::prefs::kWatchDirectoriesConfigKey, true);
+        m_libraryScanner.start();
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(m_tempDir.isValid());
+        m_rootDir = mixxx::FileInfo(m_tempDir.path()).location();
+        for (const auto& subDir : {QStringLiteral("a"), QStringLiteral("b")}) {
+            ASSERT_TRUE(QDir(m_rootDir).mkdir(subDir));
+            m_directories.append(m_rootDir + QChar('/') + subDir);
+        }
+        m_directories.prepend(m_rootDir);
+        m_watcher.setRootDirectories({m_rootDir});
+    }
+
+    QTemporaryDir m_tempDir;
+    QString m_rootDir;
+    QStringList m_directories;
+    LibraryScanner m_libraryScanner;
+    LibraryWatcher m_watcher;
+};
+
+TEST_F(LibraryWatcherTest, WatchScannedDirectories) {
+    m_watcher.slotDirectoriesScanned(m_directories, true);
+    EXPECT_TRUE(m_watcher.isWatching());
+    EXPECT_FALSE(m_watcher.isPeriodicRescanActive());
+
+    // Directories outside of the roots are not watched
+    QTemporaryDir otherDir;
+    m_watcher.slotDirectoriesScanned(
+            {mixxx::FileInfo(otherDir.path()).location()}, false);
+    EXPECT_EQ(m_directories.size(), m_watcher.m_watcher.directories().size());
+
+    // Removing the root stops watching its directories
+    m_watcher.setRootDirectories({});
+    EXPECT_FALSE(m_watcher.isWatching());
+}
+
+TEST_F(LibraryWatcherTest, PeriodicRescanAboveWatchLimit) {
+    m_watcher.m_maxWatchedDirectories = m_directories.size() - 1;
+    m_watcher.slotDirectoriesScanned(m_directories, true);
+    EXPECT_FALSE(m_watcher.isWatching());
+    EXPECT_TRUE(m_watcher.isPeriodicRescanActive());
+
+    // Watching again once the directories fit into the limit
+    m_watcher.m_maxWatchedDirectories = m_directories.size();
+    m_watcher.slotDirectoriesScanned(m_directories, true);
+    EXPECT_TRUE(m_watcher.isWatching());
+    EXPECT_FALSE(m_watcher.isPeriodicRescanActive());
+}
+
+TEST_F(LibraryWatcherTest, DebounceIsCapped) {
+    constexpr int kDebounceMillis = 100;
+    constexpr int kMaxDebounceMillis = 300;
+    constexpr int kChangeIntervalMillis = 20;
+    m_watcher.m_debounceTimer.setInterval(kDebounceMillis);
+    m_watcher.m_maxDebounceMillis = kMaxDebounceMillis;
+    m_watcher.slotDirectoriesScanned(m_directories, true);
+
+    QSignalSpy scanSpy(&m_libraryScanner, &LibraryScanner::startScanDirectories);
+    QElapsedTimer timer;
+    timer.start();
+    // A change every 20 ms would postpone the scan forever without the cap
+    while (scanSpy.isEmpty() && timer.elapsed() < 10 * kMaxDebounceMillis) {
+        m_watcher.slotDirectoryChanged(m_directories[1]);
+        QTest::qWait(kChangeIntervalMillis);
+    }
+    ASSERT_EQ(1, scanSpy.size());
+    EXPECT_GE(timer.elapsed(), kMaxDebounceMillis);
+    EXPECT_LT(timer.elapsed(), 5 * kMaxDebounceMillis);
+    EXPECT_EQ(QStringList{m_directories[1]}, scanSpy.first().first().toStringList());
+}
+
+TEST_F(LibraryWatcherTest, ChangesOutsideOfRootsAreIgnored) {
+    m_watcher.slotDirectoriesScanned(m_directories, true);
+    m_watcher.m_debounceTimer.setInterval(1);
+
+    // The root has been removed after the change has been reported
+    QSignalSpy scanSpy(&m_libraryScanner, &LibraryScanner::startScanDirectories);
+    m_watcher.slotDirectoryChanged(m_directories[1]);
+    m_watcher.setRootDirectories({});
+    QTest::qWait(50);
+    EXPECT_TRUE(scanSpy.isEmpty());
+}
@@ -0,0 +1,50 @@
+#include "util/lightweightsemaphore.h"
+
+#include <gtest/gtest.h>
+
+#include <QThread>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace {
+
+TEST(LightweightSemaphoreTest, TryAcquire) {
+    mixxx::LightweightSemaphore semaphore(1);
+    EXPECT_TRUE(semaphore.tryAcquire());
+    EXPECT_FALSE(semaphore.tryAcquire());
+    semaphore.release(2);
+    EXPECT_EQ(2, semaphore.available());
+    EXPECT_TRUE(semaphore.tryAcquire());
+    EXPECT_TRUE(semaphore.tryAcquire());
+    EXPECT_FALSE(semaphore.tryAcquire());
+}
+
+TEST(LightweightSemaphoreTest, WakesSleepingThreads) {
+    constexpr int kNumThreads = 4;
+    constexpr int kNumIterations = 1000;
+    mixxx::LightweightSemaphore semaphore;
+    std::atomic<int> numAcquired(0);
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int i = 0; i < kNumThreads; ++i) {
+        threads.emplace_back(QThread::create([&semaphore, &numAcquired] {
+            for (int j = 0; j < kNumIterations; ++j) {
+                // Don't spin, so we actually test the sleeping path.
+                semaphore.acquire(0);
+                numAcquired.fetch_add(1);
+            }
+        }));
+        threads.back()->start();
+    }
+    for (int j = 0; j < kNumThreads * kNumIterations; ++j) {
+        semaphore.release();
+    }
+    for (const auto& pThread : threads) {
+        EXPECT_TRUE(pThread->wait(10000));
+    }
+    EXPECT_EQ(kNumThreads * kNumIterations, numAcquired.load());
+    EXPECT_EQ(0, semaphore.available());
+}
+
+} // namespace
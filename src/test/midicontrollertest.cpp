@@ -1,3 +1,4 @@
+#include <benchmark/benchmark.h>
 #include <gmock/gmock.h>
 
 #include <QScopedPointer>
@@ -18,6 +19,8 @@ class MockMidiController : public MidiController {
     }
     ~MockMidiController() override { }
 
+    using MidiController::receivedShortMessage;
+
     MOCK_METHOD0(open, int());
     MOCK_METHOD0(close, int());
     MOCK_METHOD3(sendShortMsg, void(unsigned char status,
@@ -596,3 +599,103 @@ TEST_F(MidiControllerTest, ReceiveMessage_PotMeterCO_14BitPitchBend) {
     receivedShortMessage(MidiOpCode::PitchBendChange, channel, 0x01, 0x40);
     EXPECT_LT(kMiddleValue, potmeter.get());
 }
+
+TEST_F(MidiControllerTest, ReceiveMessage_ControlRecreatedAfterMapping) {
+    ConfigKey key("[Channel1]", "playposition");
+
+    unsigned char channel = 0x01;
+    unsigned char control = 0x10;
+
+    addMapping(MidiInputMapping(
+            MidiKey(MidiUtils::statusFromOpCodeAndChannel(
+                            MidiOpCode::ControlChange, channel),
+                    control),
+            MidiOptions(),
+            key));
+    // The control does not exist yet when the mapping is compiled
+    m_pController->setMapping(m_pMapping->clone());
+
+    {
+        ControlPotmeter potmeter(key, 0.0, 1.0);
+        receivedShortMessage(MidiOpCode::ControlChange, channel, control, 0x7F);
+        EXPECT_DOUBLE_EQ(1.0, potmeter.get());
+    }
+
+    // The control is resolved again after it has been deleted and created
+    ControlPotmeter potmeter(key, -1.0, 1.0);
+    receivedShortMessage(MidiOpCode::ControlChange, channel, control, 0x00);
+    EXPECT_DOUBLE_EQ(-1.0, potmeter.get());
+}
+
+TEST_F(MidiControllerTest, ReceiveMessage_DuplicateMappingsInOrder) {
+    ConfigKey key1("[Channel1]", "hotcue_1_activate");
+    ConfigKey key2("[Channel2]", "hotcue_1_activate");
+    ControlPushButton cpb1(key1);
+    ControlPushButton cpb2(key2);
+
+    unsigned char channel = 0x01;
+    unsigned char control = 0x10;
+    const MidiKey midiKey(MidiUtils::statusFromOpCodeAndChannel(
+                                  MidiOpCode::NoteOn, channel),
+            control);
+
+    // Both mappings of the same message are processed
+    addMapping(MidiInputMapping(midiKey, MidiOptions(), key1));
+    addMapping(MidiInputMapping(midiKey, MidiOptions(), key2));
+    m_pController->setMapping(m_pMapping->clone());
+
+    receivedShortMessage(MidiOpCode::NoteOn, channel, control, 0x7F);
+    EXPECT_LT(0.0, cpb1.get());
+    EXPECT_LT(0.0, cpb2.get());
+    receivedShortMessage(MidiOpCode::NoteOn, channel, control, 0x00);
+    EXPECT_DOUBLE_EQ(0.0, cpb1.get());
+    EXPECT_DOUBLE_EQ(0.0, cpb2.get());
+
+    // Other channels are not mapped
+    receivedShortMessage(MidiOpCode::NoteOn, channel + 1, control, 0x7F);
+    EXPECT_DOUBLE_EQ(0.0, cpb1.get());
+    EXPECT_DOUBLE_EQ(0.0, cpb2.get());
+}
+
+// Measures the time from receiving a MIDI message until the control has been
+// updated, for bursts of 100 messages like a jog wheel sends them at 10k
+// messages per second. Argument: number of other mappings in the mapping,
+// e.g. the buttons of the controller
+static void BM_ReceiveJogWheelBurst(benchmark::State& state) {
+    constexpr int kBurstSize = 100;
+
+    auto pMapping = std::make_shared<LegacyMidiControllerMapping>();
+    std::vector<std::unique_ptr<ControlPushButton>> buttons;
+    for (int i = 0; i < state.range(0); ++i) {
+        const ConfigKey key(QStringLiteral("[Benchmark]"), QStringLiteral("button_%1").arg(i));
+        buttons.push_back(std::make_unique<ControlPushButton>(key));
+        const MidiKey midiKey(MidiUtils::statusFromOpCodeAndChannel(
+                                      MidiOpCode::NoteOn, (i / 128) % 16),
+                i % 128);
+        pMapping->addInputMapping(midiKey.key, MidiInputMapping(midiKey, MidiOptions(), key));
+    }
+
+    const ConfigKey jogKey(QStringLiteral("[Channel1]"), QStringLiteral("jog"));
+    ControlObject jog(jogKey);
+    const unsigned char jogStatus = MidiUtils::statusFromOpCodeAndChannel(
+            MidiOpCode::ControlChange, 0);
+    const unsigned char jogControl = 0x21;
+    const MidiKey jogMidiKey(jogStatus, jogControl);
+    pMapping->addInputMapping(jogMidiKey.key,
+            MidiInputMapping(jogMidiKey, MidiOption::SelectKnob, jogKey));
+
+    MockMidiController controller;
+    controller.setMapping(pMapping);
+    for (auto _ : state) {
+        for (int i = 0; i < kBurstSize; ++i) {
+            // Alternate between one tick forward and backward
+            controller.receivedShortMessage(jogStatus,
+                    jogControl,
+                    (i % 2) ? 0x01 : 0x7F,
+                    mixxx::Duration::empty());
+        }
+    }
+    benchmark::DoNotOptimize(jog.get());
+    state.SetItemsProcessed(state.iterations() * kBurstSize);
+}
+BENCHMARK(BM_ReceiveJogWheelBurst)->Arg(0)->Arg(500)->Unit(benchmark::kMicrosecond);
@@ -1,71 +1,83 @@
-#if 0
-// TODO: make this work again
 #include <benchmark/benchmark.h>
-#include <gtest/gtest.h>
 
 #include "control/controlpotmeter.h"
-#include "effects/builtin/autopaneffect.h"
-#include "effects/builtin/bessel4lvmixeqeffect.h"
-#include "effects/builtin/bessel8lvmixeqeffect.h"
-#include "effects/builtin/bitcrushereffect.h"
-#include "effects/builtin/echoeffect.h"
-#include "effects/builtin/filtereffect.h"
-#include "effects/builtin/flangereffect.h"
-#include "effects/builtin/graphiceqeffect.h"
-#include "effects/builtin/linkwitzriley8eqeffect.h"
-#include "effects/builtin/moogladder4filtereffect.h"
-#include "effects/builtin/phasereffect.h"
-#include "effects/builtin/reverbeffect.h"
+#include "effects/backends/builtin/autopaneffect.h"
+#include "effects/backends/builtin/bessel4lvmixeqeffect.h"
+#include "effects/backends/builtin/bessel8lvmixeqeffect.h"
+#include "effects/backends/builtin/biquadfullkilleqeffect.h"
+#include "effects/backends/builtin/bitcrushereffect.h"
+#include "effects/backends/builtin/echoeffect.h"
+#include "effects/backends/builtin/filtereffect.h"
+#include "effects/backends/builtin/flangereffect.h"
+#include "effects/backends/builtin/graphiceqeffect.h"
+#include "effects/backends/builtin/linkwitzriley8eqeffect.h"
+#include "effects/backends/builtin/moogladder4filtereffect.h"
+#include "effects/backends/builtin/phasereffect.h"
+#include "effects/backends/builtin/reverbeffect.h"
+#include "effects/backends/builtin/threebandbiquadeqeffect.h"
+#include "effects/backends/effectsbackendmanager.h"
 #include "engine/channelhandle.h"
+#include "engine/effects/engineeffect.h"
 #include "engine/effects/groupfeaturestate.h"
-#include "test/baseeffecttest.h"
+#include "engine/effects/message.h"
+#include "engine/engine.h"
+#include "util/math.h"
 #include "util/samplebuffer.h"
 
 namespace {
 
-class EffectsBenchmarkTest : public BaseEffectTest {
-  protected:
-    void SetUp() override {
-        registerTestBackend();
-    }
-};
-
-template <class EffectType>
-void benchmarkBuiltInEffectDefaultParameters(const mixxx::EngineParameters& engineParameters,
-                                            benchmark::State* pState, EffectsManager* pEffectsManager) {
-    EffectManifestPointer pManifest = EffectType::getManifest();
+/// Processes a single built-in effect with its default parameters on one
+/// channel, like an EngineEffectChain does in the engine callback.
+template<class EffectType>
+void benchmarkBuiltInEffectDefaultParameters(
+        const mixxx::EngineParameters& engineParameters,
+        benchmark::State* pState) {
+    auto pBackendManager = EffectsBackendManagerPointer(new EffectsBackendManager());
+    const EffectManifestPointer pManifest = pBackendManager->getManifest(
+            EffectType::getId(), EffectBackendType::BuiltIn);
 
     ChannelHandleFactory factory;
-    QSet<ChannelHandleAndGroup> activeInputChannels;
+    const QString group = QStringLiteral("[Channel1]");
+    const ChannelHandleAndGroup channel(factory.getOrCreateHandle(group), group);
+    const QSet<ChannelHandleAndGroup> channels = {channel};
+    EngineEffect effect(pManifest, pBackendManager, channels, channels, channels);
 
-    QString channel1_group = QString("[Channel1]");
-    ChannelHandle channel1 = factory.getOrCreateHandle(channel1_group);
-    ChannelHandleAndGroup handle_and_group(channel1, channel1_group);
-    pEffectsManager->registerInputChannel(handle_and_group);
-    pEffectsManager->registerOutputChannel(handle_and_group);
-    activeInputChannels.insert(handle_and_group);
-    EffectInstantiatorPointer pInstantiator = EffectInstantiatorPointer(
-        new EffectProcessorInstantiator<EffectType>());
-    EngineEffect effect(pManifest, activeInputChannels, pEffectsManager, pInstantiator);
+    // Enable the effect like EffectSlot does through the EngineEffectsManager
+    auto pipes = TwoWayMessagePipe<EffectsRequest*, EffectsResponse>::makeTwoWayMessagePipe(
+            1, 1);
+    EffectsRequest request;
+    request.type = EffectsRequest::SET_EFFECT_PARAMETERS;
+    request.pTargetEffect = &effect;
+    request.SetEffectParameters.enabled = true;
+    effect.processEffectsRequest(request, pipes.second.get());
 
-    GroupFeatureState featureState;
-    EffectEnableState enableState = EffectEnableState::Enabled;
-
-    mixxx::SampleBuffer input(engineParameters.samplesPerBuffer());
-    mixxx::SampleBuffer output(engineParameters.samplesPerBuffer());
+    const SINT numSamples = engineParameters.samplesPerBuffer();
+    mixxx::SampleBuffer input(numSamples);
+    mixxx::SampleBuffer output(numSamples);
+    for (SINT i = 0; i < numSamples; i += mixxx::kEngineChannelCount) {
+        input[i] = static_cast<CSAMPLE>(0.5 * std::sin(i * 0.01));
+        input[i + 1] = static_cast<CSAMPLE>(0.5 * std::cos(i * 0.03));
+    }
 
+    const GroupFeatureState featureState;
     while (pState->KeepRunning()) {
-        effect.process(channel1, channel1, input.data(), output.data(),
-                       engineParameters.samplesPerBuffer(),
-                       engineParameters.sampleRate(),
-                       enableState, featureState);
+        effect.process(channel.handle(),
+                channel.handle(),
+                input.data(),
+                output.data(),
+                numSamples,
+                engineParameters.sampleRate(),
+                EffectEnableState::Enabled,
+                featureState);
     }
+    pState->SetItemsProcessed(pState->iterations() * engineParameters.framesPerBuffer());
 }
 
 #define FOR_COMMON_BUFFER_SIZES(bm) bm->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Arg(2048)->Arg(4096);
 
 #define DECLARE_EFFECT_BENCHMARK(EffectName)                                         \
-    TEST_F(EffectsBenchmarkTest, BM_BuiltInEffects_DefaultParameters_##EffectName) { \
+    static void BM_BuiltInEffects_DefaultParameters_##EffectName(                   \
+            benchmark::State& state) {                                               \
         ControlPotmeter loEqFrequency(                                               \
                 ConfigKey("[Mixer Profile]", "LoEQFrequency"), 0., 22040);           \
         loEqFrequency.setDefaultValue(250.0);                                        \
@@ -74,14 +86,16 @@ void benchmarkBuiltInEffectDefaultParameters(const mixxx::EngineParameters& engi
         hiEqFrequency.setDefaultValue(2500.0);                                       \
         mixxx::EngineParameters engineParameters(                                    \
                 mixxx::audio::SampleRate(44100),                                     \
-                state.range_x());                                                    \
+                state.range(0));                                                     \
         benchmarkBuiltInEffectDefaultParameters<EffectName>(                         \
-                engineParameters, &state, m_pEffectsManager);                        \
+                engineParameters, &state);                                           \
     }                                                                                \
     FOR_COMMON_BUFFER_SIZES(BENCHMARK(BM_BuiltInEffects_DefaultParameters_##EffectName));
 
+DECLARE_EFFECT_BENCHMARK(AutoPanEffect)
 DECLARE_EFFECT_BENCHMARK(Bessel4LVMixEQEffect)
 DECLARE_EFFECT_BENCHMARK(Bessel8LVMixEQEffect)
+DECLARE_EFFECT_BENCHMARK(BiquadFullKillEQEffect)
 DECLARE_EFFECT_BENCHMARK(BitCrusherEffect)
 DECLARE_EFFECT_BENCHMARK(EchoEffect)
 DECLARE_EFFECT_BENCHMARK(FilterEffect)
@@ -91,6 +105,6 @@ DECLARE_EFFECT_BENCHMARK(LinkwitzRiley8EQEffect)
 DECLARE_EFFECT_BENCHMARK(MoogLadder4FilterEffect)
 DECLARE_EFFECT_BENCHMARK(PhaserEffect)
 DECLARE_EFFECT_BENCHMARK(ReverbEffect)
+DECLARE_EFFECT_BENCHMARK(ThreeBandBiquadEQEffect)
 
 }  // namespace
-#endif
@@ -4,6 +4,9 @@
 #include <QList>
 #include <QPair>
 #include <QtDebug>
+#include <algorithm>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "util/sample.h"
@@ -147,6 +150,61 @@ TEST_F(SampleUtilTest, add2WithGain) {
     }
 }
 
+TEST_F(SampleUtilTest, add2WithRampingGain) {
+    for (int i : std::as_const(evenBuffers)) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        FillBuffer(buffer, 1.0f, size);
+        CSAMPLE* buffer2 = SampleUtil::alloc(size);
+        FillBuffer(buffer2, 1.0f, size);
+        CSAMPLE* buffer3 = SampleUtil::alloc(size);
+        FillBuffer(buffer3, 1.0f, size);
+        SampleUtil::add2WithRampingGain(buffer,
+                buffer2,
+                2.0,
+                2.0,
+                buffer3,
+                3.0,
+                3.0,
+                size);
+        AssertWholeBufferEquals(buffer, 6.0f, size);
+
+        // Crossfade like the dry/wet knob of an effect chain
+        FillBuffer(buffer, 0.0f, size);
+        SampleUtil::add2WithRampingGain(buffer,
+                buffer2,
+                1.0,
+                0.0,
+                buffer3,
+                0.0,
+                1.0,
+                size);
+        AssertWholeBufferEquals(buffer, 1.0f, size);
+
+        // Same result as copying both ramps and adding them
+        CSAMPLE* expected = SampleUtil::alloc(size);
+        FillBuffer(buffer2, 0.5f, size);
+        FillBuffer(buffer, 0.25f, size);
+        FillBuffer(expected, 0.25f, size);
+        SampleUtil::addWithRampingGain(expected, buffer2, 0.0, 1.0, size);
+        SampleUtil::addWithRampingGain(expected, buffer3, 1.0, 0.5, size);
+        SampleUtil::add2WithRampingGain(buffer,
+                buffer2,
+                0.0,
+                1.0,
+                buffer3,
+                1.0,
+                0.5,
+                size);
+        for (int j = 0; j < size; ++j) {
+            EXPECT_FLOAT_EQ(expected[j], buffer[j]);
+        }
+        SampleUtil::free(expected);
+        SampleUtil::free(buffer2);
+        SampleUtil::free(buffer3);
+    }
+}
+
 TEST_F(SampleUtilTest, add3WithGain) {
     for (int i = 0; i < buffers.size(); ++i) {
         CSAMPLE* buffer = buffers[i];
@@ -397,6 +455,274 @@ TEST_F(SampleUtilTest, copyReverse) {
     }
 }
 
+// All kernels that are supported by this CPU must produce the same results as
+// the baseline kernels. FMA may change the rounding of the last bit.
+TEST_F(SampleUtilTest, sampleKernelsMatchBaseline) {
+    const auto* pBaseline = mixxx::SampleKernels::forLevel(
+            mixxx::SampleKernels::Level::Baseline);
+    ASSERT_NE(nullptr, pBaseline);
+    constexpr int kNumSources = 8;
+    constexpr int kNumSamples = 1026;
+    std::vector<std::vector<CSAMPLE>> sources(kNumSources,
+            std::vector<CSAMPLE>(kNumSamples));
+    const CSAMPLE* pSrc[kNumSources];
+    CSAMPLE_GAIN gainIn[kNumSources];
+    CSAMPLE_GAIN gainOut[kNumSources];
+    for (int j = 0; j < kNumSources; ++j) {
+        for (int i = 0; i < kNumSamples; ++i) {
+            sources[j][i] = static_cast<CSAMPLE>((i * (j + 3)) % 37 - 18) / 9.0f;
+        }
+        pSrc[j] = sources[j].data();
+        gainIn[j] = 0.1f * (j + 1);
+        gainOut[j] = 0.9f - 0.1f * j;
+    }
+    std::vector<CSAMPLE> expected(kNumSamples);
+    std::vector<CSAMPLE> actual(kNumSamples);
+    const auto expectBuffersNear = [&]() {
+        for (int i = 0; i < kNumSamples; ++i) {
+            EXPECT_NEAR(expected[i], actual[i], 1e-5f) << "at " << i;
+        }
+    };
+
+    for (int level = 1; level < mixxx::SampleKernels::kNumLevels; ++level) {
+        const auto* pKernels = mixxx::SampleKernels::forLevel(
+                static_cast<mixxx::SampleKernels::Level>(level));
+        if (!pKernels) {
+            qDebug() << "Level" << level << "not supported";
+            continue;
+        }
+        SCOPED_TRACE(pKernels->name);
+
+        for (int n = 0; n <= kNumSources; ++n) {
+            pBaseline->copyNWithGain[n](expected.data(), pSrc, gainIn, kNumSamples);
+            pKernels->copyNWithGain[n](actual.data(), pSrc, gainIn, kNumSamples);
+            expectBuffersNear();
+            pBaseline->copyNWithRampingGain[n](
+                    expected.data(), pSrc, gainIn, gainOut, kNumSamples);
+            pKernels->copyNWithRampingGain[n](
+                    actual.data(), pSrc, gainIn, gainOut, kNumSamples);
+            expectBuffersNear();
+        }
+
+        pBaseline->copyWithRampingGain(
+                expected.data(), pSrc[0], 0.2f, 0.7f, kNumSamples);
+        pKernels->copyWithRampingGain(
+                actual.data(), pSrc[0], 0.2f, 0.7f, kNumSamples);
+        expectBuffersNear();
+
+        pBaseline->addWithRampingGain(
+                expected.data(), pSrc[1], 0.7f, 0.2f, kNumSamples);
+        pKernels->addWithRampingGain(
+                actual.data(), pSrc[1], 0.7f, 0.2f, kNumSamples);
+        expectBuffersNear();
+
+        pBaseline->copyClampBuffer(expected.data(), pSrc[2], kNumSamples);
+        pKernels->copyClampBuffer(actual.data(), pSrc[2], kNumSamples);
+        expectBuffersNear();
+
+        pBaseline->interleaveBuffer(
+                expected.data(), pSrc[3], pSrc[4], kNumSamples / 2);
+        pKernels->interleaveBuffer(
+                actual.data(), pSrc[3], pSrc[4], kNumSamples / 2);
+        expectBuffersNear();
+
+        CSAMPLE expectedAbsL;
+        CSAMPLE expectedAbsR;
+        CSAMPLE actualAbsL;
+        CSAMPLE actualAbsR;
+        EXPECT_EQ(pBaseline->sumAbsPerChannel(
+                          &expectedAbsL, &expectedAbsR, pSrc[5], kNumSamples),
+                pKernels->sumAbsPerChannel(
+                        &actualAbsL, &actualAbsR, pSrc[5], kNumSamples));
+        EXPECT_NEAR(expectedAbsL, actualAbsL, 1e-2f);
+        EXPECT_NEAR(expectedAbsR, actualAbsR, 1e-2f);
+    }
+}
+
+// Compares the kernels of each level with plain scalar loops. The buffers
+// start at unaligned addresses and have odd lengths to cover the prologue
+// and epilogue of the vectorized loops. Samples outside of the processed
+// range must not be touched.
+class SampleKernelsTest : public testing::TestWithParam<mixxx::SampleKernels::Level> {
+  protected:
+    static constexpr CSAMPLE kCanary = 42.0f;
+    // The number of samples, mostly around the width of SIMD registers
+    static constexpr SINT kLengths[] = {0, 1, 2, 3, 5, 7, 9, 15, 17, 31, 33, 63, 65, 1027};
+    // In samples from the start of a buffer of SampleUtil::alloc(). Up to
+    // 64 bytes to miss the alignment of AVX-512 registers.
+    static constexpr SINT kOffsets[] = {0, 1, 2, 3, 4, 7, 8, 15};
+    static constexpr SINT kMaxLength = 1027;
+    static constexpr SINT kMaxOffset = 15;
+
+    void SetUp() override {
+        m_pKernels = mixxx::SampleKernels::forLevel(GetParam());
+        if (!m_pKernels) {
+            GTEST_SKIP() << "Not supported by this build or CPU";
+        }
+        // Twice the max. length for interleaved buffers
+        m_pSrc = SampleUtil::alloc(2 * kMaxLength + kMaxOffset);
+        for (SINT i = 0; i < 2 * kMaxLength + kMaxOffset; ++i) {
+            // Includes values beyond the clamping range
+            m_pSrc[i] = static_cast<CSAMPLE>((i * 7) % 61 - 30) / 20.0f;
+        }
+        m_pExpected = SampleUtil::alloc(2 * kMaxLength + kMaxOffset);
+        m_pActual = SampleUtil::alloc(2 * kMaxLength + kMaxOffset);
+    }
+
+    void TearDown() override {
+        SampleUtil::free(m_pSrc);
+        SampleUtil::free(m_pExpected);
+        SampleUtil::free(m_pActual);
+    }
+
+    // Fills both destination buffers with canaries and the given samples
+    void resetDest(const CSAMPLE* pSamples = nullptr, SINT offset = 0, SINT length = 0) {
+        for (SINT i = 0; i < 2 * kMaxLength + kMaxOffset; ++i) {
+            m_pExpected[i] = kCanary;
+            m_pActual[i] = kCanary;
+        }
+        for (SINT i = 0; i < length; ++i) {
+            m_pExpected[offset + i] = pSamples[i];
+            m_pActual[offset + i] = pSamples[i];
+        }
+    }
+
+    void expectDestNear(CSAMPLE maxError) const {
+        for (SINT i = 0; i < 2 * kMaxLength + kMaxOffset; ++i) {
+            ASSERT_NEAR(m_pExpected[i], m_pActual[i], maxError) << "at " << i;
+        }
+    }
+
+    const mixxx::SampleKernels* m_pKernels = nullptr;
+    CSAMPLE* m_pSrc = nullptr;
+    CSAMPLE* m_pExpected = nullptr;
+    CSAMPLE* m_pActual = nullptr;
+};
+
+TEST_P(SampleKernelsTest, copyWithGain) {
+    for (SINT length : kLengths) {
+        for (SINT offset : kOffsets) {
+            SCOPED_TRACE(testing::Message() << "length " << length << ", offset " << offset);
+            resetDest();
+            for (SINT i = 0; i < length; ++i) {
+                m_pExpected[offset + i] = m_pSrc[kMaxOffset - offset + i] * 0.7f;
+            }
+            m_pKernels->copyWithGain(
+                    m_pActual + offset, m_pSrc + kMaxOffset - offset, 0.7f, length);
+            expectDestNear(0.0f);
+        }
+    }
+}
+
+TEST_P(SampleKernelsTest, addWithRampingGain) {
+    for (SINT length : kLengths) {
+        for (SINT offset : kOffsets) {
+            for (const auto& [oldGain, newGain] : {std::pair{0.3f, 0.8f}, std::pair{0.5f, 0.5f}}) {
+                SCOPED_TRACE(testing::Message() << "length " << length << ", offset "
+                                                << offset << ", gain " << oldGain
+                                                << " -> " << newGain);
+                resetDest(m_pSrc + 1, offset, length);
+                const CSAMPLE* pSrc = m_pSrc + kMaxOffset - offset;
+                CSAMPLE* pExpected = m_pExpected + offset;
+                const CSAMPLE_GAIN gainDelta =
+                        (newGain - oldGain) / CSAMPLE_GAIN(length / 2);
+                if (gainDelta != 0) {
+                    const CSAMPLE_GAIN startGain = oldGain + gainDelta;
+                    // An odd sample at the end doesn't belong to a frame and is ignored
+                    for (SINT i = 0; i < length / 2; ++i) {
+                        const CSAMPLE_GAIN gain = startGain + gainDelta * i;
+                        pExpected[i * 2] += pSrc[i * 2] * gain;
+                        pExpected[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
+                    }
+                } else {
+                    for (SINT i = 0; i < length; ++i) {
+                        pExpected[i] += pSrc[i] * oldGain;
+                    }
+                }
+                m_pKernels->addWithRampingGain(
+                        m_pActual + offset, pSrc, oldGain, newGain, length);
+                // FMA may change the rounding of the last bit
+                expectDestNear(1e-5f);
+            }
+        }
+    }
+}
+
+TEST_P(SampleKernelsTest, convertS16ToFloat32) {
+    std::vector<SAMPLE> src(kMaxLength + kMaxOffset);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        // Covers the whole range including SAMPLE_MINIMUM and SAMPLE_MAXIMUM
+        src[i] = static_cast<SAMPLE>(
+                SAMPLE_MINIMUM + static_cast<int>((i * 4099) % 65536));
+    }
+    src[0] = SAMPLE_MAXIMUM;
+    for (SINT length : kLengths) {
+        for (SINT offset : kOffsets) {
+            SCOPED_TRACE(testing::Message() << "length " << length << ", offset " << offset);
+            resetDest();
+            const SAMPLE* pSrc = src.data() + kMaxOffset - offset;
+            for (SINT i = 0; i < length; ++i) {
+                m_pExpected[offset + i] = CSAMPLE(pSrc[i]) / (SAMPLE_MINIMUM * -1.0f);
+            }
+            m_pKernels->convertS16ToFloat32(m_pActual + offset, pSrc, length);
+            expectDestNear(0.0f);
+        }
+    }
+}
+
+TEST_P(SampleKernelsTest, deinterleaveBuffer) {
+    for (SINT numFrames : kLengths) {
+        for (SINT offset : kOffsets) {
+            SCOPED_TRACE(testing::Message() << "frames " << numFrames << ", offset " << offset);
+            resetDest();
+            // The second channel is written behind the first one in the
+            // same buffer, at an odd distance if numFrames is odd
+            const CSAMPLE* pSrc = m_pSrc + kMaxOffset - offset;
+            for (SINT i = 0; i < numFrames; ++i) {
+                m_pExpected[offset + i] = pSrc[i * 2];
+                m_pExpected[offset + numFrames + i] = pSrc[i * 2 + 1];
+            }
+            m_pKernels->deinterleaveBuffer(m_pActual + offset,
+                    m_pActual + offset + numFrames,
+                    pSrc,
+                    numFrames);
+            expectDestNear(0.0f);
+        }
+    }
+}
+
+TEST_P(SampleKernelsTest, copyClampBuffer) {
+    for (SINT length : kLengths) {
+        for (SINT offset : kOffsets) {
+            SCOPED_TRACE(testing::Message() << "length " << length << ", offset " << offset);
+            resetDest();
+            const CSAMPLE* pSrc = m_pSrc + kMaxOffset - offset;
+            for (SINT i = 0; i < length; ++i) {
+                m_pExpected[offset + i] = std::clamp(pSrc[i], -CSAMPLE_PEAK, CSAMPLE_PEAK);
+            }
+            m_pKernels->copyClampBuffer(m_pActual + offset, pSrc, length);
+            expectDestNear(0.0f);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllLevels,
+        SampleKernelsTest,
+        testing::Values(mixxx::SampleKernels::Level::Baseline,
+                mixxx::SampleKernels::Level::Avx2,
+                mixxx::SampleKernels::Level::Avx512),
+        [](const testing::TestParamInfo<mixxx::SampleKernels::Level>& info) {
+            switch (info.param) {
+            case mixxx::SampleKernels::Level::Baseline:
+                return std::string("Baseline");
+            case mixxx::SampleKernels::Level::Avx2:
+                return std::string("Avx2");
+            case mixxx::SampleKernels::Level::Avx512:
+                return std::string("Avx512");
+            }
+            return std::to_string(static_cast<int>(info.param));
+        });
+
 static void BM_MemCpy(benchmark::State& state) {
     SINT size = static_cast<SINT>(state.range(0));
     CSAMPLE* buffer = SampleUtil::alloc(size);
@@ -583,4 +909,81 @@ static void BM_Copy2WithRampingGain(benchmark::State& state) {
 }
 BENCHMARK(BM_Copy2WithRampingGain)->Range(64, 4096);
 
+// Arguments: the SampleKernels::Level, the number of sources and the
+// number of samples
+static void BM_SampleKernelsCopyNWithGain(benchmark::State& state) {
+    const auto* pKernels = mixxx::SampleKernels::forLevel(
+            static_cast<mixxx::SampleKernels::Level>(state.range(0)));
+    if (!pKernels) {
+        state.SkipWithError("Not supported by this CPU");
+        return;
+    }
+    const int numSources = static_cast<int>(state.range(1));
+    const int size = static_cast<int>(state.range(2));
+    std::vector<CSAMPLE> dest(size);
+    std::vector<std::vector<CSAMPLE>> sources(numSources,
+            std::vector<CSAMPLE>(size, 0.1f));
+    std::vector<const CSAMPLE*> pSrc;
+    std::vector<CSAMPLE_GAIN> gain(numSources, 1.1f);
+    for (const auto& source : sources) {
+        pSrc.push_back(source.data());
+    }
+
+    while (state.KeepRunning()) {
+        pKernels->copyNWithGain[numSources](dest.data(), pSrc.data(), gain.data(), size);
+        benchmark::DoNotOptimize(dest.data());
+    }
+    state.SetLabel(pKernels->name);
+}
+BENCHMARK(BM_SampleKernelsCopyNWithGain)->ArgsProduct({{0, 1, 2}, {2, 8}, {64, 4096}});
+
+static void BM_SampleKernelsCopyNWithRampingGain(benchmark::State& state) {
+    const auto* pKernels = mixxx::SampleKernels::forLevel(
+            static_cast<mixxx::SampleKernels::Level>(state.range(0)));
+    if (!pKernels) {
+        state.SkipWithError("Not supported by this CPU");
+        return;
+    }
+    const int numSources = static_cast<int>(state.range(1));
+    const int size = static_cast<int>(state.range(2));
+    std::vector<CSAMPLE> dest(size);
+    std::vector<std::vector<CSAMPLE>> sources(numSources,
+            std::vector<CSAMPLE>(size, 0.1f));
+    std::vector<const CSAMPLE*> pSrc;
+    std::vector<CSAMPLE_GAIN> gainIn(numSources, 1.1f);
+    std::vector<CSAMPLE_GAIN> gainOut(numSources, 1.2f);
+    for (const auto& source : sources) {
+        pSrc.push_back(source.data());
+    }
+
+    while (state.KeepRunning()) {
+        pKernels->copyNWithRampingGain[numSources](
+                dest.data(), pSrc.data(), gainIn.data(), gainOut.data(), size);
+        benchmark::DoNotOptimize(dest.data());
+    }
+    state.SetLabel(pKernels->name);
+}
+BENCHMARK(BM_SampleKernelsCopyNWithRampingGain)
+        ->ArgsProduct({{0, 1, 2}, {2, 8}, {64, 4096}});
+
+static void BM_SampleKernelsSumAbsPerChannel(benchmark::State& state) {
+    const auto* pKernels = mixxx::SampleKernels::forLevel(
+            static_cast<mixxx::SampleKernels::Level>(state.range(0)));
+    if (!pKernels) {
+        state.SkipWithError("Not supported by this CPU");
+        return;
+    }
+    const SINT size = static_cast<SINT>(state.range(1));
+    std::vector<CSAMPLE> buffer(size, 0.5f);
+    CSAMPLE absL;
+    CSAMPLE absR;
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(pKernels->sumAbsPerChannel(
+                &absL, &absR, buffer.data(), size));
+    }
+    state.SetLabel(pKernels->name);
+}
+BENCHMARK(BM_SampleKernelsSumAbsPerChannel)->ArgsProduct({{0, 1, 2}, {64, 4096}});
+
 }  // namespace
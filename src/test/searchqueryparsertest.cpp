@@ -1,8 +1,11 @@
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 
 #include <QDir>
+#include <QRandomGenerator>
 #include <QtDebug>
 
+#include "library/columnartrackindex.h"
 #include "library/searchqueryparser.h"
 #include "test/librarytest.h"
 #include "track/track.h"
@@ -1037,3 +1040,101 @@ TEST_F(SearchQueryParserTest, QueryIsLessSpecific) {
             QStringLiteral("-crate:\"a b c\""),
             QStringLiteral("crate:\"a b c\"")));
 }
+
+namespace {
+
+const QStringList kBenchmarkSearchColumns = {
+        "artist", "title", "album", "genre", "comment", "location"};
+
+// Generates a library with random words. Many artists, albums and
+// genres are shared by multiple tracks like in a real library.
+void generateLibrary(ColumnarTrackIndex* pIndex, int numTracks) {
+    const QStringList words = {"love", "night", "beat", "dance", "the", "fire",
+            "heart", "dream", "city", "light", "star", "soul", "rain", "gold",
+            "summer", "shadow", "river", "electric", "midnight", "disco",
+            "funk", "sound", "machine", "paradise", "ocean", "dark", "blue",
+            "wild", "sky", "rhythm", "groove", "fever", "magic", "moon",
+            "sun", "shine", "time", "world", "feel", "music"};
+    const QStringList genres = {"House", "Techno", "Drum & Bass", "Hip-Hop",
+            "Funk", "Soul", "Disco", "Trance", "Dubstep", "Jazz", "Rock", "Pop"};
+    QRandomGenerator random(4711);
+    const auto randomWords = [&](int count) {
+        QStringList result;
+        for (int i = 0; i < count; ++i) {
+            result.append(words[random.bounded(words.size())]);
+        }
+        return result.join(' ');
+    };
+
+    for (int id = 1; id <= numTracks; ++id) {
+        const int row = pIndex->insertRow(TrackId(id));
+        const QString artist = QStringLiteral("%1 %2")
+                                       .arg(randomWords(2))
+                                       .arg(random.bounded(numTracks / 20));
+        const QString album = randomWords(2);
+        const QString title = randomWords(3);
+        pIndex->setValue(row, 0, id);
+        pIndex->setValue(row, 1, artist);
+        pIndex->setValue(row, 2, title);
+        pIndex->setValue(row, 3, album);
+        pIndex->setValue(row, 4, genres[random.bounded(genres.size())]);
+        if (random.bounded(4) == 0) {
+            pIndex->setValue(row, 5, randomWords(5));
+        }
+        pIndex->setValue(row,
+                6,
+                QStringLiteral("/home/user/Music/%1/%2/%3 %4.mp3")
+                        .arg(artist, album, QString::number(id % 20), title));
+    }
+}
+
+// Free text terms like SearchQueryParser::parseQuery(), but
+// without a database
+std::unique_ptr<QueryNode> parseTextQuery(const QString& query) {
+    auto pQuery = std::make_unique<AndNode>();
+    for (const auto& word : SearchQueryParser::splitQueryIntoWords(query)) {
+        pQuery->addNode(std::make_unique<TextFilterNode>(
+                QSqlDatabase(), kBenchmarkSearchColumns, word));
+    }
+    return pQuery;
+}
+
+// Searches a generated library with 100000 tracks like typing into the
+// search box. The arguments select the query.
+static void BM_SearchGeneratedLibrary(benchmark::State& state) {
+    const QStringList queries = {
+            QStringLiteral("l"),
+            QStringLiteral("lo"),
+            QStringLiteral("lov"),
+            QStringLiteral("love"),
+            QStringLiteral("love nig"),
+            QStringLiteral("electric paradise 42"),
+            QStringLiteral("xyzzy"),
+    };
+    const QString query = queries[static_cast<int>(state.range(0))];
+    state.SetLabel(query.toStdString());
+
+    std::vector<ColumnarTrackIndex::ColumnSpec> columns(kBenchmarkSearchColumns.size() + 1);
+    columns[0] = {QStringLiteral("id"), ColumnarTrackIndex::ValueType::Integer};
+    for (int i = 0; i < kBenchmarkSearchColumns.size(); ++i) {
+        columns[i + 1] = {kBenchmarkSearchColumns[i], ColumnarTrackIndex::ValueType::String};
+    }
+    ColumnarTrackIndex index(std::move(columns));
+    generateLibrary(&index, 100000);
+
+    std::size_t numMatches = 0;
+    for (auto _ : state) {
+        const auto pQuery = parseTextQuery(query);
+        numMatches = 0;
+        for (int row = 0; row < index.rowCount(); ++row) {
+            if (pQuery->match(index, row)) {
+                ++numMatches;
+            }
+        }
+        benchmark::DoNotOptimize(numMatches);
+    }
+    state.counters["matches"] = static_cast<double>(numMatches);
+}
+BENCHMARK(BM_SearchGeneratedLibrary)->DenseRange(0, 6)->Unit(benchmark::kMillisecond);
+
+} // namespace
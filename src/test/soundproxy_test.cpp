@@ -1,3 +1,5 @@
+#include <benchmark/benchmark.h>
+
 #include <QTemporaryDir>
 #include <QTemporaryFile>
 #include <QtDebug>
@@ -5,6 +7,9 @@
 #include "analyzer/analyzersilence.h"
 #include "sources/audiosourcestereoproxy.h"
 #include "sources/soundsourceproxy.h"
+#ifdef __MAD__
+#include "sources/soundsourcemp3.h"
+#endif
 #include "test/mixxxtest.h"
 #include "test/soundsourceproviderregistration.h"
 #include "track/track.h"
@@ -34,6 +39,37 @@ const SINT kMaxReadFrameCount = kBufferSizes[sizeof(kBufferSizes) / sizeof(kBuff
 
 const CSAMPLE kMaxDecodingError = 0.01f;
 
+#ifdef __MAD__
+const QString kMp3FilePath = QStringLiteral("id3-test-data/cover-test-vbr.mp3");
+
+mixxx::AudioSourcePointer openMp3AudioSource(const QString& filePath) {
+    auto pSoundSource = std::make_shared<mixxx::SoundSourceMp3>(
+            QUrl::fromLocalFile(filePath));
+    if (pSoundSource->open(mixxx::AudioSource::OpenMode::Strict) !=
+            mixxx::AudioSource::OpenResult::Succeeded) {
+        return nullptr;
+    }
+    return pSoundSource;
+}
+
+// Returns the MP3 frames of a file without the ID3v2 tag, which can be
+// appended to another MP3 file
+QByteArray readMp3Frames(const QString& filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    const QByteArray data = file.readAll();
+    if (data.size() < 10 || !data.startsWith("ID3")) {
+        return data;
+    }
+    // The tag size is stored as a syncsafe integer
+    const int tagSize = ((data[6] & 0x7F) << 21) | ((data[7] & 0x7F) << 14) |
+            ((data[8] & 0x7F) << 7) | (data[9] & 0x7F);
+    return data.mid(10 + tagSize);
+}
+#endif
+
 } // anonymous namespace
 
 class SoundSourceProxyTest : public MixxxTest, SoundSourceProviderRegistration {
@@ -1069,3 +1105,121 @@ TEST_F(SoundSourceProxyTest, fileSuffixWithDifferingType) {
                 SoundSourceProxy::isFileSuffixSupported(fileSuffix));
     }
 }
+
+#ifdef __MAD__
+TEST_F(SoundSourceProxyTest, mp3SeekFrameCache) {
+    QTemporaryDir cacheDir;
+    mixxx::SoundSourceMp3::setSeekFrameCacheDir(cacheDir.path());
+
+    // Work on a copy of the file that is modified below
+    QTemporaryDir fileDir;
+    const QString filePath = fileDir.filePath(QStringLiteral("test.mp3"));
+    ASSERT_TRUE(QFile::copy(getTestDir().filePath(kMp3FilePath), filePath));
+
+    // The first time all frame headers are decoded and cached
+    auto pScannedSource = openMp3AudioSource(filePath);
+    ASSERT_TRUE(pScannedSource);
+    EXPECT_EQ(1, QDir(cacheDir.path()).entryList(QDir::Files).size());
+    auto pCachedSource = openMp3AudioSource(filePath);
+    ASSERT_TRUE(pCachedSource);
+
+    EXPECT_EQ(pScannedSource->getSignalInfo(), pCachedSource->getSignalInfo());
+    EXPECT_EQ(pScannedSource->getBitrate(), pCachedSource->getBitrate());
+    ASSERT_EQ(pScannedSource->frameIndexRange(), pCachedSource->frameIndexRange());
+
+    // Seeking must result in the same samples
+    const SINT frameCount = 10000;
+    mixxx::SampleBuffer scannedData(
+            pScannedSource->getSignalInfo().frames2samples(frameCount));
+    mixxx::SampleBuffer cachedData(
+            pCachedSource->getSignalInfo().frames2samples(frameCount));
+    for (const SINT frameIndex : {pScannedSource->frameLength() / 2,
+                 pScannedSource->frameIndexMin(),
+                 pScannedSource->frameIndexMax() - frameCount}) {
+        const auto frameIndexRange = mixxx::IndexRange::forward(frameIndex, frameCount);
+        const auto scannedFrames = pScannedSource->readSampleFrames(
+                mixxx::WritableSampleFrames(frameIndexRange,
+                        mixxx::SampleBuffer::WritableSlice(scannedData)));
+        const auto cachedFrames = pCachedSource->readSampleFrames(
+                mixxx::WritableSampleFrames(frameIndexRange,
+                        mixxx::SampleBuffer::WritableSlice(cachedData)));
+        ASSERT_EQ(frameIndexRange, scannedFrames.frameIndexRange());
+        ASSERT_EQ(frameIndexRange, cachedFrames.frameIndexRange());
+        expectDecodedSamplesEqual(
+                pScannedSource->getSignalInfo().frames2samples(frameCount),
+                &scannedData[0],
+                &cachedData[0],
+                "Decoding mismatch with cached seek frames");
+    }
+    const SINT frameLength = pScannedSource->frameLength();
+    pScannedSource.reset();
+    pCachedSource.reset();
+
+    // The cache is invalidated when the file is modified
+    const QByteArray mp3Frames = readMp3Frames(filePath);
+    ASSERT_FALSE(mp3Frames.isEmpty());
+    {
+        QFile file(filePath);
+        ASSERT_TRUE(file.open(QIODevice::Append));
+        ASSERT_EQ(mp3Frames.size(), file.write(mp3Frames));
+    }
+    const auto pModifiedSource = openMp3AudioSource(filePath);
+    ASSERT_TRUE(pModifiedSource);
+    EXPECT_GT(pModifiedSource->frameLength(), frameLength);
+
+    mixxx::SoundSourceMp3::setSeekFrameCacheDir(QString());
+}
+
+namespace {
+
+// Measures the latency from opening an MP3 file until the first samples
+// have been decoded, e.g. when loading a track into a deck. The file is
+// the test file repeated many times to simulate a long mix.
+// Arguments: number of repetitions, seek frame cache disabled/enabled
+void BM_OpenMp3ToFirstFrame(benchmark::State& state) {
+    const QByteArray mp3Frames = readMp3Frames(
+            MixxxTest::getOrInitTestDir().filePath(kMp3FilePath));
+    QTemporaryDir tempDir;
+    const QString filePath = tempDir.filePath(QStringLiteral("mix.mp3"));
+    {
+        QFile file(filePath);
+        if (mp3Frames.isEmpty() || !file.open(QIODevice::WriteOnly)) {
+            state.SkipWithError("Failed to create the MP3 file");
+            return;
+        }
+        for (int i = 0; i < state.range(0); ++i) {
+            file.write(mp3Frames);
+        }
+    }
+    const bool cacheEnabled = state.range(1) != 0;
+    mixxx::SoundSourceMp3::setSeekFrameCacheDir(
+            cacheEnabled ? tempDir.filePath(QStringLiteral("cache")) : QString());
+    if (cacheEnabled) {
+        // Populate the cache
+        openMp3AudioSource(filePath);
+    }
+
+    constexpr SINT kFirstFrameCount = 1024;
+    mixxx::SampleBuffer sampleBuffer(kFirstFrameCount * 2);
+    for (auto _ : state) {
+        const auto pAudioSource = openMp3AudioSource(filePath);
+        if (!pAudioSource) {
+            state.SkipWithError("Failed to open the MP3 file");
+            break;
+        }
+        const auto readFrames = pAudioSource->readSampleFrames(
+                mixxx::WritableSampleFrames(
+                        mixxx::IndexRange::forward(0, kFirstFrameCount),
+                        mixxx::SampleBuffer::WritableSlice(sampleBuffer)));
+        benchmark::DoNotOptimize(readFrames.frameLength());
+    }
+    state.counters["MB"] = mp3Frames.size() * state.range(0) / 1e6;
+
+    mixxx::SoundSourceMp3::setSeekFrameCacheDir(QString());
+}
+BENCHMARK(BM_OpenMp3ToFirstFrame)
+        ->ArgsProduct({{10, 100, 1000}, {0, 1}})
+        ->Unit(benchmark::kMillisecond);
+
+} // anonymous namespace
+#endif
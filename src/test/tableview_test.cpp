@@ -1,10 +1,14 @@
 // Tests for tableview-related things
 // Right now it's just testing the serialize-unserialize of the header state code.
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <QTemporaryDir>
 #include <QtDebug>
+#include "library/coverartcache.h"
 #include "proto/headers.pb.h"
+#include "test/mixxxtest.h"
 #include "widget/wtracktableviewheader.h"
 
 class HeaderViewStateTest : public testing::Test {
@@ -69,3 +73,37 @@ TEST_F(HeaderViewStateTest, BadHeaderState) {
     HeaderViewState view_state("BLAHBLAHBLAHBAD");
     ASSERT_FALSE(view_state.healthy());
 }
+
+// The rows of a page of the track table and the width of the cover column
+constexpr int kVisibleRows = 40;
+constexpr int kCoverColumnWidth = 100;
+
+// Loads the covers of the rows that become visible when scrolling through
+// the track table by one page, without (0) and with (1) thumbnail cache
+static void BM_ScrollCoverArtColumn(benchmark::State& state) {
+    QTemporaryDir cacheDir;
+    const bool thumbnailCache = state.range(0) != 0;
+    CoverArtCache::setThumbnailCacheDir(thumbnailCache ? cacheDir.path() : QString());
+
+    CoverInfo info;
+    info.type = CoverInfo::FILE;
+    info.source = CoverInfo::GUESSED;
+    info.coverLocation = MixxxTest::getOrInitTestDir().filePath(
+            QStringLiteral("id3-test-data/cover_test.jpg"));
+    // The digest is calculated when a cover is loaded for the first time
+    info = CoverArtCache::loadCover(
+            nullptr, TrackPointer(), info, kCoverColumnWidth, false)
+                   .coverArt;
+
+    for (auto _ : state) {
+        for (int row = 0; row < kVisibleRows; ++row) {
+            const auto res = CoverArtCache::loadCover(
+                    nullptr, TrackPointer(), info, kCoverColumnWidth, false);
+            benchmark::DoNotOptimize(res.coverArt.loadedImage.image.constBits());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kVisibleRows);
+
+    CoverArtCache::setThumbnailCacheDir(QString());
+}
+BENCHMARK(BM_ScrollCoverArtColumn)->Arg(0)->Arg(1);
@@ -56,3 +56,40 @@ TEST_F(TrackDAOTest, detectMovedTracks) {
     QSet<QString> trackLocations = trackDAO.getAllTrackLocations();
     EXPECT_THAT(trackLocations, UnorderedElementsAre(newFile.location(), otherFile.location()));
 }
+
+TEST_F(TrackDAOTest, invalidateTrackLocationsInDirectories) {
+    TrackDAO& trackDAO = internalCollection()->getTrackDAO();
+
+    const QString filename = QStringLiteral("file.mp3");
+    const QDir changedDir(QDir::tempPath() + QStringLiteral("/changed"));
+    const QDir deletedDir(QDir::tempPath() + QStringLiteral("/deleted"));
+    const QDir deletedSubDir(QDir::tempPath() + QStringLiteral("/deleted/sub"));
+    // Shares the prefix of the deleted directory, but is not inside it
+    const QDir otherDir(QDir::tempPath() + QStringLiteral("/deleted-other"));
+
+    QStringList locations;
+    for (const auto& dir : {changedDir, deletedDir, deletedSubDir, otherDir}) {
+        mixxx::FileInfo fileInfo(dir, filename);
+        internalCollection()->addTrack(
+                Track::newTemporary(mixxx::FileAccess(fileInfo)), false);
+        locations.append(fileInfo.location());
+    }
+    // Left over by an interrupted scan
+    trackDAO.invalidateTrackLocationsInLibrary();
+
+    trackDAO.invalidateTrackLocationsInDirectories(
+            QStringList{changedDir.absolutePath()},
+            QStringList{deletedDir.absolutePath()});
+
+    QSqlQuery query(dbConnection());
+    query.prepare(
+            "SELECT needs_verification FROM track_locations "
+            "WHERE location=:location");
+    const QList<bool> expectedNeedsVerification = {true, true, true, false};
+    for (int i = 0; i < locations.size(); ++i) {
+        query.bindValue(":location", locations[i]);
+        ASSERT_TRUE(query.exec());
+        ASSERT_TRUE(query.next());
+        EXPECT_EQ(expectedNeedsVerification[i], query.value(0).toBool()) << locations[i];
+    }
+}
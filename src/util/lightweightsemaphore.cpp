@@ -0,0 +1,103 @@
+#include "util/lightweightsemaphore.h"
+
+#if defined(__APPLE__)
+#include <dispatch/dispatch.h>
+#elif defined(__WINDOWS__)
+#include <windows.h>
+
+#include <climits>
+#else
+#include <semaphore.h>
+
+#include <cerrno>
+#endif
+
+#include "util/assert.h"
+
+namespace mixxx {
+
+namespace detail {
+
+#if defined(__APPLE__)
+
+// Unnamed POSIX semaphores are not supported on macOS. A dispatch semaphore
+// only enters the kernel if a thread has to sleep or to be woken up.
+
+OsSemaphore::OsSemaphore()
+        : m_pSemaphore(dispatch_semaphore_create(0)) {
+    DEBUG_ASSERT(m_pSemaphore);
+}
+
+OsSemaphore::~OsSemaphore() {
+    dispatch_release(static_cast<dispatch_semaphore_t>(m_pSemaphore));
+}
+
+void OsSemaphore::acquire() {
+    dispatch_semaphore_wait(
+            static_cast<dispatch_semaphore_t>(m_pSemaphore),
+            DISPATCH_TIME_FOREVER);
+}
+
+void OsSemaphore::release(int n) {
+    for (int i = 0; i < n; ++i) {
+        dispatch_semaphore_signal(static_cast<dispatch_semaphore_t>(m_pSemaphore));
+    }
+}
+
+#elif defined(__WINDOWS__)
+
+OsSemaphore::OsSemaphore()
+        : m_pSemaphore(CreateSemaphoreW(nullptr, 0, LONG_MAX, nullptr)) {
+    DEBUG_ASSERT(m_pSemaphore);
+}
+
+OsSemaphore::~OsSemaphore() {
+    CloseHandle(m_pSemaphore);
+}
+
+void OsSemaphore::acquire() {
+    const DWORD result = WaitForSingleObject(m_pSemaphore, INFINITE);
+    DEBUG_ASSERT(result == WAIT_OBJECT_0);
+    Q_UNUSED(result);
+}
+
+void OsSemaphore::release(int n) {
+    const BOOL result = ReleaseSemaphore(m_pSemaphore, n, nullptr);
+    DEBUG_ASSERT(result);
+    Q_UNUSED(result);
+}
+
+#else
+
+// sem_post() is implemented with an atomic and a futex on Linux
+
+OsSemaphore::OsSemaphore()
+        : m_pSemaphore(new sem_t) {
+    const int result = sem_init(static_cast<sem_t*>(m_pSemaphore), 0, 0);
+    DEBUG_ASSERT(result == 0);
+    Q_UNUSED(result);
+}
+
+OsSemaphore::~OsSemaphore() {
+    sem_destroy(static_cast<sem_t*>(m_pSemaphore));
+    delete static_cast<sem_t*>(m_pSemaphore);
+}
+
+void OsSemaphore::acquire() {
+    while (sem_wait(static_cast<sem_t*>(m_pSemaphore)) != 0) {
+        // Interrupted by a signal
+        DEBUG_ASSERT(errno == EINTR);
+    }
+}
+
+void OsSemaphore::release(int n) {
+    for (int i = 0; i < n; ++i) {
+        sem_post(static_cast<sem_t*>(m_pSemaphore));
+    }
+}
+
+#endif
+
+} // namespace detail
+
+} // namespace mixxx
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86)
+#include <xmmintrin.h>
+#endif
+
+#include "util/class.h"
+
+namespace mixxx {
+
+// Hint to the CPU that we are in a spin-wait loop.
+inline void cpuRelax() {
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+namespace detail {
+
+// The semaphore of the operating system, which is used for sleeping and
+// waking up threads. QSemaphore is built on a mutex and a condition variable
+// on macOS and Windows, so the audio callback could block on a mutex that is
+// held by a thread with a lower priority. Posting an OS semaphore never waits
+// for another thread.
+class OsSemaphore {
+  public:
+    OsSemaphore();
+    ~OsSemaphore();
+
+    void acquire();
+    void release(int n);
+
+  private:
+    // sem_t, dispatch_semaphore_t or the HANDLE of the Windows semaphore
+    void* m_pSemaphore;
+
+    DISALLOW_COPY_AND_ASSIGN(OsSemaphore);
+};
+
+} // namespace detail
+
+// A counting semaphore that keeps its count in an atomic and only falls back
+// to the semaphore of the operating system if a thread actually has to sleep
+// or a sleeping thread has to be woken up.
+//
+// release() is wait-free if nobody is waiting, and otherwise only posts the
+// OS semaphore without taking any lock. It can be called from the audio
+// callback to hand over work to a background thread.
+class LightweightSemaphore {
+  public:
+    explicit LightweightSemaphore(int initialCount = 0)
+            : m_count(initialCount) {
+    }
+
+    bool tryAcquire() {
+        int count = m_count.load(std::memory_order_relaxed);
+        while (count > 0) {
+            if (m_count.compare_exchange_weak(count,
+                        count - 1,
+                        std::memory_order_acquire,
+                        std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Spins for a short while before going to sleep. This avoids the
+    // syscalls for both sides if the semaphore is released right away.
+    void acquire(int spinCount = kDefaultSpinCount) {
+        for (int i = 0; i < spinCount; ++i) {
+            if (tryAcquire()) {
+                return;
+            }
+            cpuRelax();
+        }
+        // A negative count is the number of sleeping threads.
+        if (m_count.fetch_sub(1, std::memory_order_acquire) <= 0) {
+            m_semaphore.acquire();
+        }
+    }
+
+    void release(int n = 1) {
+        const int oldCount = m_count.fetch_add(n, std::memory_order_release);
+        const int numWaiters = std::min(-oldCount, n);
+        if (numWaiters > 0) {
+            m_semaphore.release(numWaiters);
+        }
+    }
+
+    int available() const {
+        return std::max(m_count.load(std::memory_order_relaxed), 0);
+    }
+
+  private:
+    static constexpr int kDefaultSpinCount = 1000;
+
+    std::atomic<int> m_count;
+    detail::OsSemaphore m_semaphore;
+
+    DISALLOW_COPY_AND_ASSIGN(LightweightSemaphore);
+};
+
+} // namespace mixxx
@@ -20,6 +20,9 @@ typedef qint32 int32_t;
 // using scons optimize=native.
 // "SINT i" is the preferred loop index type that should allow vectorization in
 // general. Unfortunately there are exceptions where "int i" is required for some reasons.
+//
+// The hottest loops are not compiled here but in util/sample_kernels_impl.h,
+// once per instruction set. The best version is selected at runtime.
 
 namespace {
 
@@ -264,22 +267,8 @@ void SampleUtil::addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain)
-            / CSAMPLE_GAIN(numSamples / 2);
-    if (gain_delta != 0) {
-        const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            pDest[i * 2] += pSrc[i * 2] * gain;
-            pDest[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
-        }
-    } else {
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples; ++i) {
-            pDest[i] += pSrc[i] * old_gain;
-        }
-    }
+    mixxx::sampleKernels().addWithRampingGain(
+            pDest, pSrc, old_gain, new_gain, numSamples);
 }
 
 // static
@@ -301,6 +290,37 @@ void SampleUtil::add2WithGain(CSAMPLE* M_RESTRICT pDest,
     }
 }
 
+// static
+void SampleUtil::add2WithRampingGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc1,
+        CSAMPLE_GAIN old_gain1,
+        CSAMPLE_GAIN new_gain1,
+        const CSAMPLE* M_RESTRICT pSrc2,
+        CSAMPLE_GAIN old_gain2,
+        CSAMPLE_GAIN new_gain2,
+        SINT numSamples) {
+    if (old_gain1 == CSAMPLE_GAIN_ZERO && new_gain1 == CSAMPLE_GAIN_ZERO) {
+        addWithRampingGain(pDest, pSrc2, old_gain2, new_gain2, numSamples);
+        return;
+    } else if (old_gain2 == CSAMPLE_GAIN_ZERO && new_gain2 == CSAMPLE_GAIN_ZERO) {
+        addWithRampingGain(pDest, pSrc1, old_gain1, new_gain1, numSamples);
+        return;
+    }
+
+    // The gains are ramped per frame like in addWithRampingGain()
+    const CSAMPLE_GAIN gain1Delta = (new_gain1 - old_gain1) / CSAMPLE_GAIN(numSamples / 2);
+    const CSAMPLE_GAIN startGain1 = old_gain1 + gain1Delta;
+    const CSAMPLE_GAIN gain2Delta = (new_gain2 - old_gain2) / CSAMPLE_GAIN(numSamples / 2);
+    const CSAMPLE_GAIN startGain2 = old_gain2 + gain2Delta;
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < numSamples / 2; ++i) {
+        const CSAMPLE_GAIN gain1 = startGain1 + gain1Delta * i;
+        const CSAMPLE_GAIN gain2 = startGain2 + gain2Delta * i;
+        pDest[i * 2] += pSrc1[i * 2] * gain1 + pSrc2[i * 2] * gain2;
+        pDest[i * 2 + 1] += pSrc1[i * 2 + 1] * gain1 + pSrc2[i * 2 + 1] * gain2;
+    }
+}
+
 // static
 void SampleUtil::add3WithGain(CSAMPLE* pDest,
         const CSAMPLE* M_RESTRICT pSrc1, CSAMPLE_GAIN gain1,
@@ -337,14 +357,7 @@ void SampleUtil::copyWithGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] = pSrc[i] * gain;
-    }
-
-    // OR! need to test which fares better
-    // copy(pDest, pSrc, iNumSamples);
-    // applyGain(pDest, gain);
+    mixxx::sampleKernels().copyWithGain(pDest, pSrc, gain, numSamples);
 }
 
 // static
@@ -362,26 +375,8 @@ void SampleUtil::copyWithRampingGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain)
-            / CSAMPLE_GAIN(numSamples / 2);
-    if (gain_delta != 0) {
-        const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED only with "int i" (not SINT i)
-        for (int i = 0; i < numSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            pDest[i * 2] = pSrc[i * 2] * gain;
-            pDest[i * 2 + 1] = pSrc[i * 2 + 1] * gain;
-        }
-    } else {
-        // note: LOOP VECTORIZED.
-        for (SINT i = 0; i < numSamples; ++i) {
-            pDest[i] = pSrc[i] * old_gain;
-        }
-    }
-
-    // OR! need to test which fares better
-    // copy(pDest, pSrc, iNumSamples);
-    // applyRampingGain(pDest, gain);
+    mixxx::sampleKernels().copyWithRampingGain(
+            pDest, pSrc, old_gain, new_gain, numSamples);
 }
 
 // static
@@ -391,11 +386,7 @@ void SampleUtil::convertS16ToFloat32(CSAMPLE* M_RESTRICT pDest,
     // is the highest valid sample. Note that this means that although some
     // sample values convert to -1.0, none will convert to +1.0.
     DEBUG_ASSERT(-SAMPLE_MINIMUM >= SAMPLE_MAXIMUM);
-    const CSAMPLE kConversionFactor = SAMPLE_MINIMUM * -1.0f;
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] = CSAMPLE(pSrc[i]) / kConversionFactor;
-    }
+    mixxx::sampleKernels().convertS16ToFloat32(pDest, pSrc, numSamples);
 }
 
 //static
@@ -416,29 +407,13 @@ void SampleUtil::convertFloat32ToS16(SAMPLE* pDest, const CSAMPLE* pSrc,
 // static
 SampleUtil::CLIP_STATUS SampleUtil::sumAbsPerChannel(CSAMPLE* pfAbsL,
         CSAMPLE* pfAbsR, const CSAMPLE* pBuffer, SINT numSamples) {
-    CSAMPLE fAbsL = CSAMPLE_ZERO;
-    CSAMPLE fAbsR = CSAMPLE_ZERO;
-    CSAMPLE clippedL = 0;
-    CSAMPLE clippedR = 0;
-
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples / 2; ++i) {
-        CSAMPLE absl = fabs(pBuffer[i * 2]);
-        fAbsL += absl;
-        clippedL += absl > CSAMPLE_PEAK ? 1 : 0;
-        CSAMPLE absr = fabs(pBuffer[i * 2 + 1]);
-        fAbsR += absr;
-        // Replacing the code with a bool clipped will prevent vetorizing
-        clippedR += absr > CSAMPLE_PEAK ? 1 : 0;
-    }
-
-    *pfAbsL = fAbsL;
-    *pfAbsR = fAbsR;
+    const int clippingBits = mixxx::sampleKernels().sumAbsPerChannel(
+            pfAbsL, pfAbsR, pBuffer, numSamples);
     SampleUtil::CLIP_STATUS clipping = SampleUtil::NO_CLIPPING;
-    if (clippedL > 0) {
+    if (clippingBits & mixxx::SampleKernels::kClippingLeft) {
         clipping |= SampleUtil::CLIPPING_LEFT;
     }
-    if (clippedR > 0) {
+    if (clippingBits & mixxx::SampleKernels::kClippingRight) {
         clipping |= SampleUtil::CLIPPING_RIGHT;
     }
     return clipping;
@@ -474,10 +449,7 @@ CSAMPLE SampleUtil::maxAbsAmplitude(const CSAMPLE* pBuffer, SINT numSamples) {
 // static
 void SampleUtil::copyClampBuffer(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc, SINT iNumSamples) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < iNumSamples; ++i) {
-        pDest[i] = clampSample(pSrc[i]);
-    }
+    mixxx::sampleKernels().copyClampBuffer(pDest, pSrc, iNumSamples);
 }
 
 // static
@@ -485,11 +457,7 @@ void SampleUtil::interleaveBuffer(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc1,
         const CSAMPLE* M_RESTRICT pSrc2,
         SINT numFrames) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numFrames; ++i) {
-        pDest[2 * i] = pSrc1[i];
-        pDest[2 * i + 1] = pSrc2[i];
-    }
+    mixxx::sampleKernels().interleaveBuffer(pDest, pSrc1, pSrc2, numFrames);
 }
 
 // static
@@ -497,11 +465,7 @@ void SampleUtil::deinterleaveBuffer(CSAMPLE* M_RESTRICT pDest1,
         CSAMPLE* M_RESTRICT pDest2,
         const CSAMPLE* M_RESTRICT pSrc,
         SINT numFrames) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numFrames; ++i) {
-        pDest1[i] = pSrc[i * 2];
-        pDest2[i] = pSrc[i * 2 + 1];
-    }
+    mixxx::sampleKernels().deinterleaveBuffer(pDest1, pDest2, pSrc, numFrames);
 }
 
 // static
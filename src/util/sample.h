@@ -6,6 +6,7 @@
 
 #include "audio/types.h"
 #include "util/platform.h"
+#include "util/sample_kernels.h"
 #include "util/types.h"
 
 // A group of utilities for working with samples.
@@ -199,6 +200,18 @@ class SampleUtil {
             CSAMPLE_GAIN gain1, const CSAMPLE* pSrc2, CSAMPLE_GAIN gain2,
             SINT numSamples);
 
+    // Add to each sample of pDest, pSrc1 multiplied by a gain ramping from
+    // old_gain1 to new_gain1 plus pSrc2 multiplied by a gain ramping from
+    // old_gain2 to new_gain2
+    static void add2WithRampingGain(CSAMPLE* pDest,
+            const CSAMPLE* pSrc1,
+            CSAMPLE_GAIN old_gain1,
+            CSAMPLE_GAIN new_gain1,
+            const CSAMPLE* pSrc2,
+            CSAMPLE_GAIN old_gain2,
+            CSAMPLE_GAIN new_gain2,
+            SINT numSamples);
+
     // Add to each sample of pDest, pSrc1 multiplied by gain1 plus pSrc2
     // multiplied by gain2 plus pSrc3 multiplied by gain3
     static void add3WithGain(CSAMPLE* pDest, const CSAMPLE* pSrc1,
@@ -10,10 +10,9 @@ static inline void copy1WithGain(CSAMPLE* M_RESTRICT pDest,
         clear(pDest, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0};
+    const CSAMPLE_GAIN gain[] = {gain0};
+    mixxx::sampleKernels().copyNWithGain[1](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy1WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                         const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -22,14 +21,10 @@ static inline void copy1WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         clear(pDest, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0};
+    const CSAMPLE_GAIN gainIn[] = {gain0in};
+    const CSAMPLE_GAIN gainOut[] = {gain0out};
+    mixxx::sampleKernels().copyNWithRampingGain[1](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy2WithGain(CSAMPLE* M_RESTRICT pDest,
                                  const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -43,11 +38,9 @@ static inline void copy2WithGain(CSAMPLE* M_RESTRICT pDest,
         copy1WithGain(pDest, pSrc0, gain0, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1};
+    const CSAMPLE_GAIN gain[] = {gain0, gain1};
+    mixxx::sampleKernels().copyNWithGain[2](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy2WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                         const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -61,19 +54,10 @@ static inline void copy2WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy1WithRampingGain(pDest, pSrc0, gain0in, gain0out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1};
+    const CSAMPLE_GAIN gainIn[] = {gain0in, gain1in};
+    const CSAMPLE_GAIN gainOut[] = {gain0out, gain1out};
+    mixxx::sampleKernels().copyNWithRampingGain[2](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy3WithGain(CSAMPLE* M_RESTRICT pDest,
                                  const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -92,12 +76,9 @@ static inline void copy3WithGain(CSAMPLE* M_RESTRICT pDest,
         copy2WithGain(pDest, pSrc0, gain0, pSrc1, gain1, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2};
+    const CSAMPLE_GAIN gain[] = {gain0, gain1, gain2};
+    mixxx::sampleKernels().copyNWithGain[3](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy3WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                         const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -116,24 +97,10 @@ static inline void copy3WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy2WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2};
+    const CSAMPLE_GAIN gainIn[] = {gain0in, gain1in, gain2in};
+    const CSAMPLE_GAIN gainOut[] = {gain0out, gain1out, gain2out};
+    mixxx::sampleKernels().copyNWithRampingGain[3](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy4WithGain(CSAMPLE* M_RESTRICT pDest,
                                  const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -157,13 +124,9 @@ static inline void copy4WithGain(CSAMPLE* M_RESTRICT pDest,
         copy3WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3};
+    const CSAMPLE_GAIN gain[] = {gain0, gain1, gain2, gain3};
+    mixxx::sampleKernels().copyNWithGain[4](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy4WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                         const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -187,29 +150,10 @@ static inline void copy4WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy3WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3};
+    const CSAMPLE_GAIN gainIn[] = {gain0in, gain1in, gain2in, gain3in};
+    const CSAMPLE_GAIN gainOut[] = {gain0out, gain1out, gain2out, gain3out};
+    mixxx::sampleKernels().copyNWithRampingGain[4](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy5WithGain(CSAMPLE* M_RESTRICT pDest,
                                  const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -238,14 +182,9 @@ static inline void copy5WithGain(CSAMPLE* M_RESTRICT pDest,
         copy4WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3, pSrc4};
+    const CSAMPLE_GAIN gain[] = {gain0, gain1, gain2, gain3, gain4};
+    mixxx::sampleKernels().copyNWithGain[5](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy5WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                         const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -274,34 +213,10 @@ static inline void copy5WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy4WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3, pSrc4};
+    const CSAMPLE_GAIN gainIn[] = {gain0in, gain1in, gain2in, gain3in, gain4in};
+    const CSAMPLE_GAIN gainOut[] = {gain0out, gain1out, gain2out, gain3out, gain4out};
+    mixxx::sampleKernels().copyNWithRampingGain[5](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy6WithGain(CSAMPLE* M_RESTRICT pDest,
                                  const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -335,15 +250,9 @@ static inline void copy6WithGain(CSAMPLE* M_RESTRICT pDest,
         copy5WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5};
+    const CSAMPLE_GAIN gain[] = {gain0, gain1, gain2, gain3, gain4, gain5};
+    mixxx::sampleKernels().copyNWithGain[6](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy6WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                         const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -377,39 +286,10 @@ static inline void copy6WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy5WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5};
+    const CSAMPLE_GAIN gainIn[] = {gain0in, gain1in, gain2in, gain3in, gain4in, gain5in};
+    const CSAMPLE_GAIN gainOut[] = {gain0out, gain1out, gain2out, gain3out, gain4out, gain5out};
+    mixxx::sampleKernels().copyNWithRampingGain[6](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy7WithGain(CSAMPLE* M_RESTRICT pDest,
                                  const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -448,16 +328,9 @@ static inline void copy7WithGain(CSAMPLE* M_RESTRICT pDest,
         copy6WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6};
+    const CSAMPLE_GAIN gain[] = {gain0, gain1, gain2, gain3, gain4, gain5, gain6};
+    mixxx::sampleKernels().copyNWithGain[7](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy7WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                         const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -496,44 +369,10 @@ static inline void copy7WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy6WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6};
+    const CSAMPLE_GAIN gainIn[] = {gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in};
+    const CSAMPLE_GAIN gainOut[] = {gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out};
+    mixxx::sampleKernels().copyNWithRampingGain[7](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy8WithGain(CSAMPLE* M_RESTRICT pDest,
                                  const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -577,17 +416,9 @@ static inline void copy8WithGain(CSAMPLE* M_RESTRICT pDest,
         copy7WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7};
+    const CSAMPLE_GAIN gain[] = {gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7};
+    mixxx::sampleKernels().copyNWithGain[8](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy8WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                         const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -631,49 +462,10 @@ static inline void copy8WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy7WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7;
-    }
+    const CSAMPLE* const pSrc[] = {pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7};
+    const CSAMPLE_GAIN gainIn[] = {gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in};
+    const CSAMPLE_GAIN gainOut[] = {gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out};
+    mixxx::sampleKernels().copyNWithRampingGain[8](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy9WithGain(CSAMPLE* M_RESTRICT pDest,
                                  const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -722,18 +514,15 @@ static inline void copy9WithGain(CSAMPLE* M_RESTRICT pDest,
         copy8WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8,
+    };
+    mixxx::sampleKernels().copyNWithGain[9](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy9WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                         const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -782,54 +571,19 @@ static inline void copy9WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy8WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[9](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy10WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -883,19 +637,15 @@ static inline void copy10WithGain(CSAMPLE* M_RESTRICT pDest,
         copy9WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9,
+    };
+    mixxx::sampleKernels().copyNWithGain[10](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy10WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -949,59 +699,19 @@ static inline void copy10WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy9WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[10](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy11WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -1060,20 +770,15 @@ static inline void copy11WithGain(CSAMPLE* M_RESTRICT pDest,
         copy10WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10,
+    };
+    mixxx::sampleKernels().copyNWithGain[11](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy11WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -1132,64 +837,19 @@ static inline void copy11WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy10WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[11](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy12WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -1253,21 +913,15 @@ static inline void copy12WithGain(CSAMPLE* M_RESTRICT pDest,
         copy11WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11,
+    };
+    mixxx::sampleKernels().copyNWithGain[12](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy12WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -1331,69 +985,19 @@ static inline void copy12WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy11WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[12](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy13WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -1462,22 +1066,15 @@ static inline void copy13WithGain(CSAMPLE* M_RESTRICT pDest,
         copy12WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12,
+    };
+    mixxx::sampleKernels().copyNWithGain[13](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy13WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -1546,74 +1143,19 @@ static inline void copy13WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy12WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[13](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy14WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -1687,23 +1229,15 @@ static inline void copy14WithGain(CSAMPLE* M_RESTRICT pDest,
         copy13WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13,
+    };
+    mixxx::sampleKernels().copyNWithGain[14](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy14WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -1777,79 +1311,19 @@ static inline void copy14WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy13WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[14](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy15WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -1928,24 +1402,15 @@ static inline void copy15WithGain(CSAMPLE* M_RESTRICT pDest,
         copy14WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14,
+    };
+    mixxx::sampleKernels().copyNWithGain[15](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy15WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -2024,84 +1489,19 @@ static inline void copy15WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy14WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[15](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy16WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -2185,25 +1585,15 @@ static inline void copy16WithGain(CSAMPLE* M_RESTRICT pDest,
         copy15WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+    };
+    mixxx::sampleKernels().copyNWithGain[16](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy16WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -2287,89 +1677,19 @@ static inline void copy16WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy15WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[16](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy17WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -2458,26 +1778,17 @@ static inline void copy17WithGain(CSAMPLE* M_RESTRICT pDest,
         copy16WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16,
+    };
+    mixxx::sampleKernels().copyNWithGain[17](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy17WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -2566,94 +1877,22 @@ static inline void copy17WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy16WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[17](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy18WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -2747,27 +1986,17 @@ static inline void copy18WithGain(CSAMPLE* M_RESTRICT pDest,
         copy17WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17,
+    };
+    mixxx::sampleKernels().copyNWithGain[18](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy18WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -2861,99 +2090,22 @@ static inline void copy18WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy17WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[18](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy19WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -3052,28 +2204,17 @@ static inline void copy19WithGain(CSAMPLE* M_RESTRICT pDest,
         copy18WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18,
+    };
+    mixxx::sampleKernels().copyNWithGain[19](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy19WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -3172,104 +2313,22 @@ static inline void copy19WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy18WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[19](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy20WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -3373,29 +2432,17 @@ static inline void copy20WithGain(CSAMPLE* M_RESTRICT pDest,
         copy19WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19,
+    };
+    mixxx::sampleKernels().copyNWithGain[20](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy20WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -3499,109 +2546,22 @@ static inline void copy20WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy19WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[20](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy21WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -3710,30 +2670,17 @@ static inline void copy21WithGain(CSAMPLE* M_RESTRICT pDest,
         copy20WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20,
+    };
+    mixxx::sampleKernels().copyNWithGain[21](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy21WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -3842,114 +2789,22 @@ static inline void copy21WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy20WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[21](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy22WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -4063,31 +2918,17 @@ static inline void copy22WithGain(CSAMPLE* M_RESTRICT pDest,
         copy21WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21,
+    };
+    mixxx::sampleKernels().copyNWithGain[22](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy22WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -4201,119 +3042,22 @@ static inline void copy22WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy21WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[22](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy23WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -4432,32 +3176,17 @@ static inline void copy23WithGain(CSAMPLE* M_RESTRICT pDest,
         copy22WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22,
+    };
+    mixxx::sampleKernels().copyNWithGain[23](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy23WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -4576,124 +3305,22 @@ static inline void copy23WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy22WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[23](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy24WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -4817,33 +3444,17 @@ static inline void copy24WithGain(CSAMPLE* M_RESTRICT pDest,
         copy23WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, pSrc22, gain22, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22 +
-                   pSrc23[i] * gain23;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22, gain23,
+    };
+    mixxx::sampleKernels().copyNWithGain[24](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy24WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -4967,129 +3578,22 @@ static inline void copy24WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy23WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, pSrc22, gain22in, gain22out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    const CSAMPLE_GAIN gain_delta23 = (gain23out - gain23in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain23 = gain23in + gain_delta23;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        const CSAMPLE_GAIN gain23 = start_gain23 + gain_delta23 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22 +
-                       pSrc23[i * 2] * gain23;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22 +
-                           pSrc23[i * 2 + 1] * gain23;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in, gain23in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out, gain23out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[24](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy25WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -5218,34 +3722,19 @@ static inline void copy25WithGain(CSAMPLE* M_RESTRICT pDest,
         copy24WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, pSrc22, gain22, pSrc23, gain23, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22 +
-                   pSrc23[i] * gain23 +
-                   pSrc24[i] * gain24;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22, gain23,
+            gain24,
+    };
+    mixxx::sampleKernels().copyNWithGain[25](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy25WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -5374,134 +3863,25 @@ static inline void copy25WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy24WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, pSrc22, gain22in, gain22out, pSrc23, gain23in, gain23out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    const CSAMPLE_GAIN gain_delta23 = (gain23out - gain23in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain23 = gain23in + gain_delta23;
-    const CSAMPLE_GAIN gain_delta24 = (gain24out - gain24in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain24 = gain24in + gain_delta24;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        const CSAMPLE_GAIN gain23 = start_gain23 + gain_delta23 * i;
-        const CSAMPLE_GAIN gain24 = start_gain24 + gain_delta24 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22 +
-                       pSrc23[i * 2] * gain23 +
-                       pSrc24[i * 2] * gain24;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22 +
-                           pSrc23[i * 2 + 1] * gain23 +
-                           pSrc24[i * 2 + 1] * gain24;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in, gain23in,
+            gain24in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out, gain23out,
+            gain24out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[25](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy26WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -5635,35 +4015,19 @@ static inline void copy26WithGain(CSAMPLE* M_RESTRICT pDest,
         copy25WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, pSrc22, gain22, pSrc23, gain23, pSrc24, gain24, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22 +
-                   pSrc23[i] * gain23 +
-                   pSrc24[i] * gain24 +
-                   pSrc25[i] * gain25;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22, gain23,
+            gain24, gain25,
+    };
+    mixxx::sampleKernels().copyNWithGain[26](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy26WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -5797,139 +4161,25 @@ static inline void copy26WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy25WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, pSrc22, gain22in, gain22out, pSrc23, gain23in, gain23out, pSrc24, gain24in, gain24out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    const CSAMPLE_GAIN gain_delta23 = (gain23out - gain23in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain23 = gain23in + gain_delta23;
-    const CSAMPLE_GAIN gain_delta24 = (gain24out - gain24in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain24 = gain24in + gain_delta24;
-    const CSAMPLE_GAIN gain_delta25 = (gain25out - gain25in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain25 = gain25in + gain_delta25;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        const CSAMPLE_GAIN gain23 = start_gain23 + gain_delta23 * i;
-        const CSAMPLE_GAIN gain24 = start_gain24 + gain_delta24 * i;
-        const CSAMPLE_GAIN gain25 = start_gain25 + gain_delta25 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22 +
-                       pSrc23[i * 2] * gain23 +
-                       pSrc24[i * 2] * gain24 +
-                       pSrc25[i * 2] * gain25;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22 +
-                           pSrc23[i * 2 + 1] * gain23 +
-                           pSrc24[i * 2 + 1] * gain24 +
-                           pSrc25[i * 2 + 1] * gain25;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in, gain23in,
+            gain24in, gain25in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out, gain23out,
+            gain24out, gain25out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[26](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy27WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -6068,36 +4318,19 @@ static inline void copy27WithGain(CSAMPLE* M_RESTRICT pDest,
         copy26WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, pSrc22, gain22, pSrc23, gain23, pSrc24, gain24, pSrc25, gain25, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22 +
-                   pSrc23[i] * gain23 +
-                   pSrc24[i] * gain24 +
-                   pSrc25[i] * gain25 +
-                   pSrc26[i] * gain26;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22, gain23,
+            gain24, gain25, gain26,
+    };
+    mixxx::sampleKernels().copyNWithGain[27](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy27WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -6236,144 +4469,25 @@ static inline void copy27WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy26WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, pSrc22, gain22in, gain22out, pSrc23, gain23in, gain23out, pSrc24, gain24in, gain24out, pSrc25, gain25in, gain25out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    const CSAMPLE_GAIN gain_delta23 = (gain23out - gain23in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain23 = gain23in + gain_delta23;
-    const CSAMPLE_GAIN gain_delta24 = (gain24out - gain24in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain24 = gain24in + gain_delta24;
-    const CSAMPLE_GAIN gain_delta25 = (gain25out - gain25in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain25 = gain25in + gain_delta25;
-    const CSAMPLE_GAIN gain_delta26 = (gain26out - gain26in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain26 = gain26in + gain_delta26;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        const CSAMPLE_GAIN gain23 = start_gain23 + gain_delta23 * i;
-        const CSAMPLE_GAIN gain24 = start_gain24 + gain_delta24 * i;
-        const CSAMPLE_GAIN gain25 = start_gain25 + gain_delta25 * i;
-        const CSAMPLE_GAIN gain26 = start_gain26 + gain_delta26 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22 +
-                       pSrc23[i * 2] * gain23 +
-                       pSrc24[i * 2] * gain24 +
-                       pSrc25[i * 2] * gain25 +
-                       pSrc26[i * 2] * gain26;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22 +
-                           pSrc23[i * 2 + 1] * gain23 +
-                           pSrc24[i * 2 + 1] * gain24 +
-                           pSrc25[i * 2 + 1] * gain25 +
-                           pSrc26[i * 2 + 1] * gain26;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in, gain23in,
+            gain24in, gain25in, gain26in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out, gain23out,
+            gain24out, gain25out, gain26out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[27](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy28WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -6517,37 +4631,19 @@ static inline void copy28WithGain(CSAMPLE* M_RESTRICT pDest,
         copy27WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, pSrc22, gain22, pSrc23, gain23, pSrc24, gain24, pSrc25, gain25, pSrc26, gain26, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22 +
-                   pSrc23[i] * gain23 +
-                   pSrc24[i] * gain24 +
-                   pSrc25[i] * gain25 +
-                   pSrc26[i] * gain26 +
-                   pSrc27[i] * gain27;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22, gain23,
+            gain24, gain25, gain26, gain27,
+    };
+    mixxx::sampleKernels().copyNWithGain[28](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy28WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -6691,149 +4787,25 @@ static inline void copy28WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy27WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, pSrc22, gain22in, gain22out, pSrc23, gain23in, gain23out, pSrc24, gain24in, gain24out, pSrc25, gain25in, gain25out, pSrc26, gain26in, gain26out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    const CSAMPLE_GAIN gain_delta23 = (gain23out - gain23in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain23 = gain23in + gain_delta23;
-    const CSAMPLE_GAIN gain_delta24 = (gain24out - gain24in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain24 = gain24in + gain_delta24;
-    const CSAMPLE_GAIN gain_delta25 = (gain25out - gain25in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain25 = gain25in + gain_delta25;
-    const CSAMPLE_GAIN gain_delta26 = (gain26out - gain26in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain26 = gain26in + gain_delta26;
-    const CSAMPLE_GAIN gain_delta27 = (gain27out - gain27in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain27 = gain27in + gain_delta27;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        const CSAMPLE_GAIN gain23 = start_gain23 + gain_delta23 * i;
-        const CSAMPLE_GAIN gain24 = start_gain24 + gain_delta24 * i;
-        const CSAMPLE_GAIN gain25 = start_gain25 + gain_delta25 * i;
-        const CSAMPLE_GAIN gain26 = start_gain26 + gain_delta26 * i;
-        const CSAMPLE_GAIN gain27 = start_gain27 + gain_delta27 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22 +
-                       pSrc23[i * 2] * gain23 +
-                       pSrc24[i * 2] * gain24 +
-                       pSrc25[i * 2] * gain25 +
-                       pSrc26[i * 2] * gain26 +
-                       pSrc27[i * 2] * gain27;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22 +
-                           pSrc23[i * 2 + 1] * gain23 +
-                           pSrc24[i * 2 + 1] * gain24 +
-                           pSrc25[i * 2 + 1] * gain25 +
-                           pSrc26[i * 2 + 1] * gain26 +
-                           pSrc27[i * 2 + 1] * gain27;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in, gain23in,
+            gain24in, gain25in, gain26in, gain27in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out, gain23out,
+            gain24out, gain25out, gain26out, gain27out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[28](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy29WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -6982,38 +4954,19 @@ static inline void copy29WithGain(CSAMPLE* M_RESTRICT pDest,
         copy28WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, pSrc22, gain22, pSrc23, gain23, pSrc24, gain24, pSrc25, gain25, pSrc26, gain26, pSrc27, gain27, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22 +
-                   pSrc23[i] * gain23 +
-                   pSrc24[i] * gain24 +
-                   pSrc25[i] * gain25 +
-                   pSrc26[i] * gain26 +
-                   pSrc27[i] * gain27 +
-                   pSrc28[i] * gain28;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27, pSrc28,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22, gain23,
+            gain24, gain25, gain26, gain27, gain28,
+    };
+    mixxx::sampleKernels().copyNWithGain[29](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy29WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -7162,154 +5115,25 @@ static inline void copy29WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy28WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, pSrc22, gain22in, gain22out, pSrc23, gain23in, gain23out, pSrc24, gain24in, gain24out, pSrc25, gain25in, gain25out, pSrc26, gain26in, gain26out, pSrc27, gain27in, gain27out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    const CSAMPLE_GAIN gain_delta23 = (gain23out - gain23in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain23 = gain23in + gain_delta23;
-    const CSAMPLE_GAIN gain_delta24 = (gain24out - gain24in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain24 = gain24in + gain_delta24;
-    const CSAMPLE_GAIN gain_delta25 = (gain25out - gain25in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain25 = gain25in + gain_delta25;
-    const CSAMPLE_GAIN gain_delta26 = (gain26out - gain26in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain26 = gain26in + gain_delta26;
-    const CSAMPLE_GAIN gain_delta27 = (gain27out - gain27in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain27 = gain27in + gain_delta27;
-    const CSAMPLE_GAIN gain_delta28 = (gain28out - gain28in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain28 = gain28in + gain_delta28;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        const CSAMPLE_GAIN gain23 = start_gain23 + gain_delta23 * i;
-        const CSAMPLE_GAIN gain24 = start_gain24 + gain_delta24 * i;
-        const CSAMPLE_GAIN gain25 = start_gain25 + gain_delta25 * i;
-        const CSAMPLE_GAIN gain26 = start_gain26 + gain_delta26 * i;
-        const CSAMPLE_GAIN gain27 = start_gain27 + gain_delta27 * i;
-        const CSAMPLE_GAIN gain28 = start_gain28 + gain_delta28 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22 +
-                       pSrc23[i * 2] * gain23 +
-                       pSrc24[i * 2] * gain24 +
-                       pSrc25[i * 2] * gain25 +
-                       pSrc26[i * 2] * gain26 +
-                       pSrc27[i * 2] * gain27 +
-                       pSrc28[i * 2] * gain28;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22 +
-                           pSrc23[i * 2 + 1] * gain23 +
-                           pSrc24[i * 2 + 1] * gain24 +
-                           pSrc25[i * 2 + 1] * gain25 +
-                           pSrc26[i * 2 + 1] * gain26 +
-                           pSrc27[i * 2 + 1] * gain27 +
-                           pSrc28[i * 2 + 1] * gain28;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27, pSrc28,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in, gain23in,
+            gain24in, gain25in, gain26in, gain27in, gain28in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out, gain23out,
+            gain24out, gain25out, gain26out, gain27out, gain28out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[29](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy30WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -7463,39 +5287,19 @@ static inline void copy30WithGain(CSAMPLE* M_RESTRICT pDest,
         copy29WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, pSrc22, gain22, pSrc23, gain23, pSrc24, gain24, pSrc25, gain25, pSrc26, gain26, pSrc27, gain27, pSrc28, gain28, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22 +
-                   pSrc23[i] * gain23 +
-                   pSrc24[i] * gain24 +
-                   pSrc25[i] * gain25 +
-                   pSrc26[i] * gain26 +
-                   pSrc27[i] * gain27 +
-                   pSrc28[i] * gain28 +
-                   pSrc29[i] * gain29;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27, pSrc28, pSrc29,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22, gain23,
+            gain24, gain25, gain26, gain27, gain28, gain29,
+    };
+    mixxx::sampleKernels().copyNWithGain[30](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy30WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -7649,159 +5453,25 @@ static inline void copy30WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy29WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, pSrc22, gain22in, gain22out, pSrc23, gain23in, gain23out, pSrc24, gain24in, gain24out, pSrc25, gain25in, gain25out, pSrc26, gain26in, gain26out, pSrc27, gain27in, gain27out, pSrc28, gain28in, gain28out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    const CSAMPLE_GAIN gain_delta23 = (gain23out - gain23in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain23 = gain23in + gain_delta23;
-    const CSAMPLE_GAIN gain_delta24 = (gain24out - gain24in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain24 = gain24in + gain_delta24;
-    const CSAMPLE_GAIN gain_delta25 = (gain25out - gain25in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain25 = gain25in + gain_delta25;
-    const CSAMPLE_GAIN gain_delta26 = (gain26out - gain26in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain26 = gain26in + gain_delta26;
-    const CSAMPLE_GAIN gain_delta27 = (gain27out - gain27in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain27 = gain27in + gain_delta27;
-    const CSAMPLE_GAIN gain_delta28 = (gain28out - gain28in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain28 = gain28in + gain_delta28;
-    const CSAMPLE_GAIN gain_delta29 = (gain29out - gain29in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain29 = gain29in + gain_delta29;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        const CSAMPLE_GAIN gain23 = start_gain23 + gain_delta23 * i;
-        const CSAMPLE_GAIN gain24 = start_gain24 + gain_delta24 * i;
-        const CSAMPLE_GAIN gain25 = start_gain25 + gain_delta25 * i;
-        const CSAMPLE_GAIN gain26 = start_gain26 + gain_delta26 * i;
-        const CSAMPLE_GAIN gain27 = start_gain27 + gain_delta27 * i;
-        const CSAMPLE_GAIN gain28 = start_gain28 + gain_delta28 * i;
-        const CSAMPLE_GAIN gain29 = start_gain29 + gain_delta29 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22 +
-                       pSrc23[i * 2] * gain23 +
-                       pSrc24[i * 2] * gain24 +
-                       pSrc25[i * 2] * gain25 +
-                       pSrc26[i * 2] * gain26 +
-                       pSrc27[i * 2] * gain27 +
-                       pSrc28[i * 2] * gain28 +
-                       pSrc29[i * 2] * gain29;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22 +
-                           pSrc23[i * 2 + 1] * gain23 +
-                           pSrc24[i * 2 + 1] * gain24 +
-                           pSrc25[i * 2 + 1] * gain25 +
-                           pSrc26[i * 2 + 1] * gain26 +
-                           pSrc27[i * 2 + 1] * gain27 +
-                           pSrc28[i * 2 + 1] * gain28 +
-                           pSrc29[i * 2 + 1] * gain29;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27, pSrc28, pSrc29,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in, gain23in,
+            gain24in, gain25in, gain26in, gain27in, gain28in, gain29in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out, gain23out,
+            gain24out, gain25out, gain26out, gain27out, gain28out, gain29out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[30](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy31WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -7960,40 +5630,19 @@ static inline void copy31WithGain(CSAMPLE* M_RESTRICT pDest,
         copy30WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, pSrc22, gain22, pSrc23, gain23, pSrc24, gain24, pSrc25, gain25, pSrc26, gain26, pSrc27, gain27, pSrc28, gain28, pSrc29, gain29, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22 +
-                   pSrc23[i] * gain23 +
-                   pSrc24[i] * gain24 +
-                   pSrc25[i] * gain25 +
-                   pSrc26[i] * gain26 +
-                   pSrc27[i] * gain27 +
-                   pSrc28[i] * gain28 +
-                   pSrc29[i] * gain29 +
-                   pSrc30[i] * gain30;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27, pSrc28, pSrc29, pSrc30,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22, gain23,
+            gain24, gain25, gain26, gain27, gain28, gain29, gain30,
+    };
+    mixxx::sampleKernels().copyNWithGain[31](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy31WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -8152,164 +5801,25 @@ static inline void copy31WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy30WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, pSrc22, gain22in, gain22out, pSrc23, gain23in, gain23out, pSrc24, gain24in, gain24out, pSrc25, gain25in, gain25out, pSrc26, gain26in, gain26out, pSrc27, gain27in, gain27out, pSrc28, gain28in, gain28out, pSrc29, gain29in, gain29out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    const CSAMPLE_GAIN gain_delta23 = (gain23out - gain23in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain23 = gain23in + gain_delta23;
-    const CSAMPLE_GAIN gain_delta24 = (gain24out - gain24in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain24 = gain24in + gain_delta24;
-    const CSAMPLE_GAIN gain_delta25 = (gain25out - gain25in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain25 = gain25in + gain_delta25;
-    const CSAMPLE_GAIN gain_delta26 = (gain26out - gain26in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain26 = gain26in + gain_delta26;
-    const CSAMPLE_GAIN gain_delta27 = (gain27out - gain27in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain27 = gain27in + gain_delta27;
-    const CSAMPLE_GAIN gain_delta28 = (gain28out - gain28in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain28 = gain28in + gain_delta28;
-    const CSAMPLE_GAIN gain_delta29 = (gain29out - gain29in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain29 = gain29in + gain_delta29;
-    const CSAMPLE_GAIN gain_delta30 = (gain30out - gain30in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain30 = gain30in + gain_delta30;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        const CSAMPLE_GAIN gain23 = start_gain23 + gain_delta23 * i;
-        const CSAMPLE_GAIN gain24 = start_gain24 + gain_delta24 * i;
-        const CSAMPLE_GAIN gain25 = start_gain25 + gain_delta25 * i;
-        const CSAMPLE_GAIN gain26 = start_gain26 + gain_delta26 * i;
-        const CSAMPLE_GAIN gain27 = start_gain27 + gain_delta27 * i;
-        const CSAMPLE_GAIN gain28 = start_gain28 + gain_delta28 * i;
-        const CSAMPLE_GAIN gain29 = start_gain29 + gain_delta29 * i;
-        const CSAMPLE_GAIN gain30 = start_gain30 + gain_delta30 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22 +
-                       pSrc23[i * 2] * gain23 +
-                       pSrc24[i * 2] * gain24 +
-                       pSrc25[i * 2] * gain25 +
-                       pSrc26[i * 2] * gain26 +
-                       pSrc27[i * 2] * gain27 +
-                       pSrc28[i * 2] * gain28 +
-                       pSrc29[i * 2] * gain29 +
-                       pSrc30[i * 2] * gain30;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22 +
-                           pSrc23[i * 2 + 1] * gain23 +
-                           pSrc24[i * 2 + 1] * gain24 +
-                           pSrc25[i * 2 + 1] * gain25 +
-                           pSrc26[i * 2 + 1] * gain26 +
-                           pSrc27[i * 2 + 1] * gain27 +
-                           pSrc28[i * 2 + 1] * gain28 +
-                           pSrc29[i * 2 + 1] * gain29 +
-                           pSrc30[i * 2 + 1] * gain30;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27, pSrc28, pSrc29, pSrc30,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in, gain23in,
+            gain24in, gain25in, gain26in, gain27in, gain28in, gain29in, gain30in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out, gain23out,
+            gain24out, gain25out, gain26out, gain27out, gain28out, gain29out, gain30out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[31](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
 static inline void copy32WithGain(CSAMPLE* M_RESTRICT pDest,
                                   const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0,
@@ -8473,41 +5983,19 @@ static inline void copy32WithGain(CSAMPLE* M_RESTRICT pDest,
         copy31WithGain(pDest, pSrc0, gain0, pSrc1, gain1, pSrc2, gain2, pSrc3, gain3, pSrc4, gain4, pSrc5, gain5, pSrc6, gain6, pSrc7, gain7, pSrc8, gain8, pSrc9, gain9, pSrc10, gain10, pSrc11, gain11, pSrc12, gain12, pSrc13, gain13, pSrc14, gain14, pSrc15, gain15, pSrc16, gain16, pSrc17, gain17, pSrc18, gain18, pSrc19, gain19, pSrc20, gain20, pSrc21, gain21, pSrc22, gain22, pSrc23, gain23, pSrc24, gain24, pSrc25, gain25, pSrc26, gain26, pSrc27, gain27, pSrc28, gain28, pSrc29, gain29, pSrc30, gain30, iNumSamples);
         return;
     }
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc0[i] * gain0 +
-                   pSrc1[i] * gain1 +
-                   pSrc2[i] * gain2 +
-                   pSrc3[i] * gain3 +
-                   pSrc4[i] * gain4 +
-                   pSrc5[i] * gain5 +
-                   pSrc6[i] * gain6 +
-                   pSrc7[i] * gain7 +
-                   pSrc8[i] * gain8 +
-                   pSrc9[i] * gain9 +
-                   pSrc10[i] * gain10 +
-                   pSrc11[i] * gain11 +
-                   pSrc12[i] * gain12 +
-                   pSrc13[i] * gain13 +
-                   pSrc14[i] * gain14 +
-                   pSrc15[i] * gain15 +
-                   pSrc16[i] * gain16 +
-                   pSrc17[i] * gain17 +
-                   pSrc18[i] * gain18 +
-                   pSrc19[i] * gain19 +
-                   pSrc20[i] * gain20 +
-                   pSrc21[i] * gain21 +
-                   pSrc22[i] * gain22 +
-                   pSrc23[i] * gain23 +
-                   pSrc24[i] * gain24 +
-                   pSrc25[i] * gain25 +
-                   pSrc26[i] * gain26 +
-                   pSrc27[i] * gain27 +
-                   pSrc28[i] * gain28 +
-                   pSrc29[i] * gain29 +
-                   pSrc30[i] * gain30 +
-                   pSrc31[i] * gain31;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27, pSrc28, pSrc29, pSrc30, pSrc31,
+    };
+    const CSAMPLE_GAIN gain[] = {
+            gain0, gain1, gain2, gain3, gain4, gain5, gain6, gain7,
+            gain8, gain9, gain10, gain11, gain12, gain13, gain14, gain15,
+            gain16, gain17, gain18, gain19, gain20, gain21, gain22, gain23,
+            gain24, gain25, gain26, gain27, gain28, gain29, gain30, gain31,
+    };
+    mixxx::sampleKernels().copyNWithGain[32](pDest, pSrc, gain, iNumSamples);
 }
 static inline void copy32WithRampingGain(CSAMPLE* M_RESTRICT pDest,
                                          const CSAMPLE* M_RESTRICT pSrc0, CSAMPLE_GAIN gain0in, CSAMPLE_GAIN gain0out,
@@ -8671,167 +6159,23 @@ static inline void copy32WithRampingGain(CSAMPLE* M_RESTRICT pDest,
         copy31WithRampingGain(pDest, pSrc0, gain0in, gain0out, pSrc1, gain1in, gain1out, pSrc2, gain2in, gain2out, pSrc3, gain3in, gain3out, pSrc4, gain4in, gain4out, pSrc5, gain5in, gain5out, pSrc6, gain6in, gain6out, pSrc7, gain7in, gain7out, pSrc8, gain8in, gain8out, pSrc9, gain9in, gain9out, pSrc10, gain10in, gain10out, pSrc11, gain11in, gain11out, pSrc12, gain12in, gain12out, pSrc13, gain13in, gain13out, pSrc14, gain14in, gain14out, pSrc15, gain15in, gain15out, pSrc16, gain16in, gain16out, pSrc17, gain17in, gain17out, pSrc18, gain18in, gain18out, pSrc19, gain19in, gain19out, pSrc20, gain20in, gain20out, pSrc21, gain21in, gain21out, pSrc22, gain22in, gain22out, pSrc23, gain23in, gain23out, pSrc24, gain24in, gain24out, pSrc25, gain25in, gain25out, pSrc26, gain26in, gain26out, pSrc27, gain27in, gain27out, pSrc28, gain28in, gain28out, pSrc29, gain29in, gain29out, pSrc30, gain30in, gain30out, iNumSamples);
         return;
     }
-    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
-    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
-    const CSAMPLE_GAIN gain_delta2 = (gain2out - gain2in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain2 = gain2in + gain_delta2;
-    const CSAMPLE_GAIN gain_delta3 = (gain3out - gain3in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain3 = gain3in + gain_delta3;
-    const CSAMPLE_GAIN gain_delta4 = (gain4out - gain4in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain4 = gain4in + gain_delta4;
-    const CSAMPLE_GAIN gain_delta5 = (gain5out - gain5in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain5 = gain5in + gain_delta5;
-    const CSAMPLE_GAIN gain_delta6 = (gain6out - gain6in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain6 = gain6in + gain_delta6;
-    const CSAMPLE_GAIN gain_delta7 = (gain7out - gain7in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain7 = gain7in + gain_delta7;
-    const CSAMPLE_GAIN gain_delta8 = (gain8out - gain8in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain8 = gain8in + gain_delta8;
-    const CSAMPLE_GAIN gain_delta9 = (gain9out - gain9in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain9 = gain9in + gain_delta9;
-    const CSAMPLE_GAIN gain_delta10 = (gain10out - gain10in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain10 = gain10in + gain_delta10;
-    const CSAMPLE_GAIN gain_delta11 = (gain11out - gain11in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain11 = gain11in + gain_delta11;
-    const CSAMPLE_GAIN gain_delta12 = (gain12out - gain12in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain12 = gain12in + gain_delta12;
-    const CSAMPLE_GAIN gain_delta13 = (gain13out - gain13in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain13 = gain13in + gain_delta13;
-    const CSAMPLE_GAIN gain_delta14 = (gain14out - gain14in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain14 = gain14in + gain_delta14;
-    const CSAMPLE_GAIN gain_delta15 = (gain15out - gain15in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain15 = gain15in + gain_delta15;
-    const CSAMPLE_GAIN gain_delta16 = (gain16out - gain16in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain16 = gain16in + gain_delta16;
-    const CSAMPLE_GAIN gain_delta17 = (gain17out - gain17in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain17 = gain17in + gain_delta17;
-    const CSAMPLE_GAIN gain_delta18 = (gain18out - gain18in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain18 = gain18in + gain_delta18;
-    const CSAMPLE_GAIN gain_delta19 = (gain19out - gain19in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain19 = gain19in + gain_delta19;
-    const CSAMPLE_GAIN gain_delta20 = (gain20out - gain20in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain20 = gain20in + gain_delta20;
-    const CSAMPLE_GAIN gain_delta21 = (gain21out - gain21in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain21 = gain21in + gain_delta21;
-    const CSAMPLE_GAIN gain_delta22 = (gain22out - gain22in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain22 = gain22in + gain_delta22;
-    const CSAMPLE_GAIN gain_delta23 = (gain23out - gain23in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain23 = gain23in + gain_delta23;
-    const CSAMPLE_GAIN gain_delta24 = (gain24out - gain24in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain24 = gain24in + gain_delta24;
-    const CSAMPLE_GAIN gain_delta25 = (gain25out - gain25in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain25 = gain25in + gain_delta25;
-    const CSAMPLE_GAIN gain_delta26 = (gain26out - gain26in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain26 = gain26in + gain_delta26;
-    const CSAMPLE_GAIN gain_delta27 = (gain27out - gain27in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain27 = gain27in + gain_delta27;
-    const CSAMPLE_GAIN gain_delta28 = (gain28out - gain28in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain28 = gain28in + gain_delta28;
-    const CSAMPLE_GAIN gain_delta29 = (gain29out - gain29in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain29 = gain29in + gain_delta29;
-    const CSAMPLE_GAIN gain_delta30 = (gain30out - gain30in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain30 = gain30in + gain_delta30;
-    const CSAMPLE_GAIN gain_delta31 = (gain31out - gain31in) / (iNumSamples / 2);
-    const CSAMPLE_GAIN start_gain31 = gain31in + gain_delta31;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
-        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
-        const CSAMPLE_GAIN gain2 = start_gain2 + gain_delta2 * i;
-        const CSAMPLE_GAIN gain3 = start_gain3 + gain_delta3 * i;
-        const CSAMPLE_GAIN gain4 = start_gain4 + gain_delta4 * i;
-        const CSAMPLE_GAIN gain5 = start_gain5 + gain_delta5 * i;
-        const CSAMPLE_GAIN gain6 = start_gain6 + gain_delta6 * i;
-        const CSAMPLE_GAIN gain7 = start_gain7 + gain_delta7 * i;
-        const CSAMPLE_GAIN gain8 = start_gain8 + gain_delta8 * i;
-        const CSAMPLE_GAIN gain9 = start_gain9 + gain_delta9 * i;
-        const CSAMPLE_GAIN gain10 = start_gain10 + gain_delta10 * i;
-        const CSAMPLE_GAIN gain11 = start_gain11 + gain_delta11 * i;
-        const CSAMPLE_GAIN gain12 = start_gain12 + gain_delta12 * i;
-        const CSAMPLE_GAIN gain13 = start_gain13 + gain_delta13 * i;
-        const CSAMPLE_GAIN gain14 = start_gain14 + gain_delta14 * i;
-        const CSAMPLE_GAIN gain15 = start_gain15 + gain_delta15 * i;
-        const CSAMPLE_GAIN gain16 = start_gain16 + gain_delta16 * i;
-        const CSAMPLE_GAIN gain17 = start_gain17 + gain_delta17 * i;
-        const CSAMPLE_GAIN gain18 = start_gain18 + gain_delta18 * i;
-        const CSAMPLE_GAIN gain19 = start_gain19 + gain_delta19 * i;
-        const CSAMPLE_GAIN gain20 = start_gain20 + gain_delta20 * i;
-        const CSAMPLE_GAIN gain21 = start_gain21 + gain_delta21 * i;
-        const CSAMPLE_GAIN gain22 = start_gain22 + gain_delta22 * i;
-        const CSAMPLE_GAIN gain23 = start_gain23 + gain_delta23 * i;
-        const CSAMPLE_GAIN gain24 = start_gain24 + gain_delta24 * i;
-        const CSAMPLE_GAIN gain25 = start_gain25 + gain_delta25 * i;
-        const CSAMPLE_GAIN gain26 = start_gain26 + gain_delta26 * i;
-        const CSAMPLE_GAIN gain27 = start_gain27 + gain_delta27 * i;
-        const CSAMPLE_GAIN gain28 = start_gain28 + gain_delta28 * i;
-        const CSAMPLE_GAIN gain29 = start_gain29 + gain_delta29 * i;
-        const CSAMPLE_GAIN gain30 = start_gain30 + gain_delta30 * i;
-        const CSAMPLE_GAIN gain31 = start_gain31 + gain_delta31 * i;
-        pDest[i * 2] = pSrc0[i * 2] * gain0 +
-                       pSrc1[i * 2] * gain1 +
-                       pSrc2[i * 2] * gain2 +
-                       pSrc3[i * 2] * gain3 +
-                       pSrc4[i * 2] * gain4 +
-                       pSrc5[i * 2] * gain5 +
-                       pSrc6[i * 2] * gain6 +
-                       pSrc7[i * 2] * gain7 +
-                       pSrc8[i * 2] * gain8 +
-                       pSrc9[i * 2] * gain9 +
-                       pSrc10[i * 2] * gain10 +
-                       pSrc11[i * 2] * gain11 +
-                       pSrc12[i * 2] * gain12 +
-                       pSrc13[i * 2] * gain13 +
-                       pSrc14[i * 2] * gain14 +
-                       pSrc15[i * 2] * gain15 +
-                       pSrc16[i * 2] * gain16 +
-                       pSrc17[i * 2] * gain17 +
-                       pSrc18[i * 2] * gain18 +
-                       pSrc19[i * 2] * gain19 +
-                       pSrc20[i * 2] * gain20 +
-                       pSrc21[i * 2] * gain21 +
-                       pSrc22[i * 2] * gain22 +
-                       pSrc23[i * 2] * gain23 +
-                       pSrc24[i * 2] * gain24 +
-                       pSrc25[i * 2] * gain25 +
-                       pSrc26[i * 2] * gain26 +
-                       pSrc27[i * 2] * gain27 +
-                       pSrc28[i * 2] * gain28 +
-                       pSrc29[i * 2] * gain29 +
-                       pSrc30[i * 2] * gain30 +
-                       pSrc31[i * 2] * gain31;
-        pDest[i * 2 + 1] = pSrc0[i * 2 + 1] * gain0 +
-                           pSrc1[i * 2 + 1] * gain1 +
-                           pSrc2[i * 2 + 1] * gain2 +
-                           pSrc3[i * 2 + 1] * gain3 +
-                           pSrc4[i * 2 + 1] * gain4 +
-                           pSrc5[i * 2 + 1] * gain5 +
-                           pSrc6[i * 2 + 1] * gain6 +
-                           pSrc7[i * 2 + 1] * gain7 +
-                           pSrc8[i * 2 + 1] * gain8 +
-                           pSrc9[i * 2 + 1] * gain9 +
-                           pSrc10[i * 2 + 1] * gain10 +
-                           pSrc11[i * 2 + 1] * gain11 +
-                           pSrc12[i * 2 + 1] * gain12 +
-                           pSrc13[i * 2 + 1] * gain13 +
-                           pSrc14[i * 2 + 1] * gain14 +
-                           pSrc15[i * 2 + 1] * gain15 +
-                           pSrc16[i * 2 + 1] * gain16 +
-                           pSrc17[i * 2 + 1] * gain17 +
-                           pSrc18[i * 2 + 1] * gain18 +
-                           pSrc19[i * 2 + 1] * gain19 +
-                           pSrc20[i * 2 + 1] * gain20 +
-                           pSrc21[i * 2 + 1] * gain21 +
-                           pSrc22[i * 2 + 1] * gain22 +
-                           pSrc23[i * 2 + 1] * gain23 +
-                           pSrc24[i * 2 + 1] * gain24 +
-                           pSrc25[i * 2 + 1] * gain25 +
-                           pSrc26[i * 2 + 1] * gain26 +
-                           pSrc27[i * 2 + 1] * gain27 +
-                           pSrc28[i * 2 + 1] * gain28 +
-                           pSrc29[i * 2 + 1] * gain29 +
-                           pSrc30[i * 2 + 1] * gain30 +
-                           pSrc31[i * 2 + 1] * gain31;
-    }
+    const CSAMPLE* const pSrc[] = {
+            pSrc0, pSrc1, pSrc2, pSrc3, pSrc4, pSrc5, pSrc6, pSrc7,
+            pSrc8, pSrc9, pSrc10, pSrc11, pSrc12, pSrc13, pSrc14, pSrc15,
+            pSrc16, pSrc17, pSrc18, pSrc19, pSrc20, pSrc21, pSrc22, pSrc23,
+            pSrc24, pSrc25, pSrc26, pSrc27, pSrc28, pSrc29, pSrc30, pSrc31,
+    };
+    const CSAMPLE_GAIN gainIn[] = {
+            gain0in, gain1in, gain2in, gain3in, gain4in, gain5in, gain6in, gain7in,
+            gain8in, gain9in, gain10in, gain11in, gain12in, gain13in, gain14in, gain15in,
+            gain16in, gain17in, gain18in, gain19in, gain20in, gain21in, gain22in, gain23in,
+            gain24in, gain25in, gain26in, gain27in, gain28in, gain29in, gain30in, gain31in,
+    };
+    const CSAMPLE_GAIN gainOut[] = {
+            gain0out, gain1out, gain2out, gain3out, gain4out, gain5out, gain6out, gain7out,
+            gain8out, gain9out, gain10out, gain11out, gain12out, gain13out, gain14out, gain15out,
+            gain16out, gain17out, gain18out, gain19out, gain20out, gain21out, gain22out, gain23out,
+            gain24out, gain25out, gain26out, gain27out, gain28out, gain29out, gain30out, gain31out,
+    };
+    mixxx::sampleKernels().copyNWithRampingGain[32](pDest, pSrc, gainIn, gainOut, iNumSamples);
 }
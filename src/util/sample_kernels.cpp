@@ -0,0 +1,106 @@
+// Compiled for the baseline instruction set and selects the kernels at runtime
+#include "util/sample_kernels.h"
+
+#if defined(MIXXX_SAMPLE_KERNELS_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "util/logger.h"
+#include "util/sample_kernels_impl.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("SampleKernels");
+
+constexpr SampleKernels kBaseline = makeSampleKernels(SampleKernels::Level::Baseline, "Baseline");
+
+#if defined(MIXXX_SAMPLE_KERNELS_X86)
+#if defined(_MSC_VER)
+// Check the CPU features and if the OS saves the corresponding registers
+bool cpuSupportsAvx2() {
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool fma = info[2] & (1 << 12);
+    const bool osxsave = info[2] & (1 << 27);
+    const bool avx = info[2] & (1 << 28);
+    if (!fma || !osxsave || !avx) {
+        return false;
+    }
+    // XMM and YMM state
+    if ((_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return info[1] & (1 << 5);
+}
+
+bool cpuSupportsAvx512() {
+    if (!cpuSupportsAvx2()) {
+        return false;
+    }
+    // Opmask, ZMM_Hi256 and Hi16_ZMM state
+    if ((_xgetbv(0) & 0xE6) != 0xE6) {
+        return false;
+    }
+    int info[4];
+    __cpuidex(info, 7, 0);
+    return info[1] & (1 << 16);
+}
+#else
+bool cpuSupportsAvx2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+bool cpuSupportsAvx512() {
+    __builtin_cpu_init();
+    return cpuSupportsAvx2() && __builtin_cpu_supports("avx512f");
+}
+#endif
+#endif // MIXXX_SAMPLE_KERNELS_X86
+
+} // anonymous namespace
+
+// static
+const SampleKernels* SampleKernels::forLevel(Level level) {
+    switch (level) {
+    case Level::Baseline:
+        return &kBaseline;
+    case Level::Avx2:
+#if defined(MIXXX_SAMPLE_KERNELS_X86)
+        if (cpuSupportsAvx2()) {
+            return &sample_kernels::kAvx2;
+        }
+#endif
+        return nullptr;
+    case Level::Avx512:
+#if defined(MIXXX_SAMPLE_KERNELS_X86)
+        if (cpuSupportsAvx512()) {
+            return &sample_kernels::kAvx512;
+        }
+#endif
+        return nullptr;
+    }
+    return nullptr;
+}
+
+// static
+const SampleKernels& SampleKernels::best() {
+    const SampleKernels* pKernels = forLevel(Level::Avx512);
+    if (!pKernels) {
+        pKernels = forLevel(Level::Avx2);
+    }
+    if (!pKernels) {
+        pKernels = forLevel(Level::Baseline);
+    }
+    kLogger.info() << "Using" << pKernels->name << "kernels";
+    return *pKernels;
+}
+
+} // namespace mixxx
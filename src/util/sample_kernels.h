@@ -0,0 +1,98 @@
+#pragma once
+
+#include "util/platform.h"
+#include "util/types.h"
+
+namespace mixxx {
+
+// The hot loops of SampleUtil are compiled multiple times for different
+// instruction sets and the best version that is supported by the CPU is
+// selected at runtime. This allows to use AVX2 and AVX-512 with a single
+// binary that still runs on any x86-64 CPU.
+//
+// The kernels only contain the loops. Special cases like a gain of zero or
+// one are handled by SampleUtil before.
+struct SampleKernels {
+    enum class Level {
+        // Whatever the compiler targets by default, e.g. SSE2 on x86-64
+        Baseline,
+        Avx2,
+        Avx512,
+    };
+    static constexpr int kNumLevels = 3;
+
+    // The max. number of sources of copyNWithGain and copyNWithRampingGain,
+    // must match --max_channels of tools/generate_sample_functions.py
+    static constexpr int kMaxCopyChannels = 32;
+
+    // Bits of the result of sumAbsPerChannel
+    static constexpr int kClippingLeft = 1;
+    static constexpr int kClippingRight = 2;
+
+    typedef void (*CopyWithGainFn)(CSAMPLE* M_RESTRICT pDest,
+            const CSAMPLE* M_RESTRICT pSrc,
+            CSAMPLE_GAIN gain,
+            SINT numSamples);
+    typedef void (*RampingGainFn)(CSAMPLE* M_RESTRICT pDest,
+            const CSAMPLE* M_RESTRICT pSrc,
+            CSAMPLE_GAIN oldGain,
+            CSAMPLE_GAIN newGain,
+            SINT numSamples);
+    typedef void (*CopyNWithGainFn)(CSAMPLE* M_RESTRICT pDest,
+            const CSAMPLE* const* pSrc,
+            const CSAMPLE_GAIN* pGain,
+            int numSamples);
+    typedef void (*CopyNWithRampingGainFn)(CSAMPLE* M_RESTRICT pDest,
+            const CSAMPLE* const* pSrc,
+            const CSAMPLE_GAIN* pGainIn,
+            const CSAMPLE_GAIN* pGainOut,
+            int numSamples);
+    typedef int (*SumAbsPerChannelFn)(CSAMPLE* pAbsL,
+            CSAMPLE* pAbsR,
+            const CSAMPLE* pBuffer,
+            SINT numSamples);
+    typedef void (*ConvertS16ToFloat32Fn)(CSAMPLE* M_RESTRICT pDest,
+            const SAMPLE* M_RESTRICT pSrc,
+            SINT numSamples);
+    typedef void (*InterleaveFn)(CSAMPLE* M_RESTRICT pDest,
+            const CSAMPLE* M_RESTRICT pSrc1,
+            const CSAMPLE* M_RESTRICT pSrc2,
+            SINT numFrames);
+    typedef void (*DeinterleaveFn)(CSAMPLE* M_RESTRICT pDest1,
+            CSAMPLE* M_RESTRICT pDest2,
+            const CSAMPLE* M_RESTRICT pSrc,
+            SINT numFrames);
+    typedef void (*CopyClampFn)(CSAMPLE* M_RESTRICT pDest,
+            const CSAMPLE* M_RESTRICT pSrc,
+            SINT numSamples);
+
+    Level level;
+    const char* name;
+
+    CopyWithGainFn copyWithGain;
+    RampingGainFn copyWithRampingGain;
+    RampingGainFn addWithRampingGain;
+    // Indexed by the number of sources
+    CopyNWithGainFn copyNWithGain[kMaxCopyChannels + 1];
+    CopyNWithRampingGainFn copyNWithRampingGain[kMaxCopyChannels + 1];
+    SumAbsPerChannelFn sumAbsPerChannel;
+    ConvertS16ToFloat32Fn convertS16ToFloat32;
+    InterleaveFn interleaveBuffer;
+    DeinterleaveFn deinterleaveBuffer;
+    CopyClampFn copyClampBuffer;
+
+    // Returns the kernels for the given level or nullptr if they are not
+    // available in this build or not supported by the CPU.
+    static const SampleKernels* forLevel(Level level);
+
+    // Returns the kernels for the best level that is supported by the CPU.
+    static const SampleKernels& best();
+};
+
+// The kernels used by SampleUtil
+inline const SampleKernels& sampleKernels() {
+    static const SampleKernels& kernels = SampleKernels::best();
+    return kernels;
+}
+
+} // namespace mixxx
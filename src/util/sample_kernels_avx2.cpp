@@ -0,0 +1,12 @@
+// Compiled with AVX2 and FMA enabled, see CMakeLists.txt
+#include "util/sample_kernels_impl.h"
+
+namespace mixxx {
+
+namespace sample_kernels {
+
+const SampleKernels kAvx2 = makeSampleKernels(SampleKernels::Level::Avx2, "AVX2");
+
+} // namespace sample_kernels
+
+} // namespace mixxx
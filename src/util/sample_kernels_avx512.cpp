@@ -0,0 +1,12 @@
+// Compiled with AVX-512 enabled, see CMakeLists.txt
+#include "util/sample_kernels_impl.h"
+
+namespace mixxx {
+
+namespace sample_kernels {
+
+const SampleKernels kAvx512 = makeSampleKernels(SampleKernels::Level::Avx512, "AVX-512");
+
+} // namespace sample_kernels
+
+} // namespace mixxx
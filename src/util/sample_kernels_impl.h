@@ -0,0 +1,256 @@
+#pragma once
+
+// The implementation of the SampleUtil kernels. This header is included by
+// one translation unit per instruction set that is compiled with the
+// corresponding compiler flags, see CMakeLists.txt.
+//
+// Everything is defined in an anonymous namespace to get a separate copy
+// for each translation unit. The kernels must not call any inline function
+// that is defined elsewhere! The linker could otherwise pick a version that
+// has been compiled for a newer instruction set and use it everywhere.
+
+#include <cstddef>
+#include <utility>
+
+#include "util/sample_kernels.h"
+
+// LOOP VECTORIZED below marks the loops that are processed with SIMD
+// registers, see the notes in util/sample.cpp.
+
+namespace mixxx {
+
+namespace sample_kernels {
+
+// Defined in the translation units of the corresponding instruction set
+// if available in this build.
+extern const SampleKernels kAvx2;
+extern const SampleKernels kAvx512;
+
+} // namespace sample_kernels
+
+namespace {
+
+void copyWithGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+void copyWithRampingGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN oldGain,
+        CSAMPLE_GAIN newGain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gainDelta = (newGain - oldGain) / CSAMPLE_GAIN(numSamples / 2);
+    if (gainDelta != 0) {
+        const CSAMPLE_GAIN startGain = oldGain + gainDelta;
+        // note: LOOP VECTORIZED only with "int i" (not SINT i)
+        for (int i = 0; i < numSamples / 2; ++i) {
+            const CSAMPLE_GAIN gain = startGain + gainDelta * i;
+            pDest[i * 2] = pSrc[i * 2] * gain;
+            pDest[i * 2 + 1] = pSrc[i * 2 + 1] * gain;
+        }
+    } else {
+        // note: LOOP VECTORIZED.
+        for (SINT i = 0; i < numSamples; ++i) {
+            pDest[i] = pSrc[i] * oldGain;
+        }
+    }
+}
+
+void addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN oldGain,
+        CSAMPLE_GAIN newGain,
+        SINT numSamples) {
+    const CSAMPLE_GAIN gainDelta = (newGain - oldGain) / CSAMPLE_GAIN(numSamples / 2);
+    if (gainDelta != 0) {
+        const CSAMPLE_GAIN startGain = oldGain + gainDelta;
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples / 2; ++i) {
+            const CSAMPLE_GAIN gain = startGain + gainDelta * i;
+            pDest[i * 2] += pSrc[i * 2] * gain;
+            pDest[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
+        }
+    } else {
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples; ++i) {
+            pDest[i] += pSrc[i] * oldGain;
+        }
+    }
+}
+
+// The number of sources is a template parameter, so the compiler unrolls
+// the inner loops and keeps all sources and gains in registers like in the
+// generated functions of SampleUtil.
+template<int N>
+void copyNWithGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pGain,
+        int numSamples) {
+    if constexpr (N == 0) {
+        for (int i = 0; i < numSamples; ++i) {
+            pDest[i] = CSAMPLE_ZERO;
+        }
+    } else {
+        const CSAMPLE* M_RESTRICT src[N];
+        CSAMPLE_GAIN gain[N];
+        for (int j = 0; j < N; ++j) {
+            src[j] = pSrc[j];
+            gain[j] = pGain[j];
+        }
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples; ++i) {
+            CSAMPLE sum = src[0][i] * gain[0];
+            for (int j = 1; j < N; ++j) {
+                sum += src[j][i] * gain[j];
+            }
+            pDest[i] = sum;
+        }
+    }
+}
+
+template<int N>
+void copyNWithRampingGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pGainIn,
+        const CSAMPLE_GAIN* pGainOut,
+        int numSamples) {
+    if constexpr (N == 0) {
+        for (int i = 0; i < numSamples; ++i) {
+            pDest[i] = CSAMPLE_ZERO;
+        }
+    } else {
+        const CSAMPLE* M_RESTRICT src[N];
+        CSAMPLE_GAIN startGain[N];
+        CSAMPLE_GAIN gainDelta[N];
+        for (int j = 0; j < N; ++j) {
+            src[j] = pSrc[j];
+            gainDelta[j] = (pGainOut[j] - pGainIn[j]) / (numSamples / 2);
+            startGain[j] = pGainIn[j] + gainDelta[j];
+        }
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples / 2; ++i) {
+            CSAMPLE_GAIN gain = startGain[0] + gainDelta[0] * i;
+            CSAMPLE left = src[0][i * 2] * gain;
+            CSAMPLE right = src[0][i * 2 + 1] * gain;
+            for (int j = 1; j < N; ++j) {
+                gain = startGain[j] + gainDelta[j] * i;
+                left += src[j][i * 2] * gain;
+                right += src[j][i * 2 + 1] * gain;
+            }
+            pDest[i * 2] = left;
+            pDest[i * 2 + 1] = right;
+        }
+    }
+}
+
+int sumAbsPerChannel(CSAMPLE* pAbsL,
+        CSAMPLE* pAbsR,
+        const CSAMPLE* pBuffer,
+        SINT numSamples) {
+    CSAMPLE absSumL = CSAMPLE_ZERO;
+    CSAMPLE absSumR = CSAMPLE_ZERO;
+    CSAMPLE clippedL = 0;
+    CSAMPLE clippedR = 0;
+
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples / 2; ++i) {
+        // Don't use fabs(), see the note on inline functions above
+        const CSAMPLE absL = pBuffer[i * 2] < 0 ? -pBuffer[i * 2] : pBuffer[i * 2];
+        absSumL += absL;
+        clippedL += absL > CSAMPLE_PEAK ? 1 : 0;
+        const CSAMPLE absR = pBuffer[i * 2 + 1] < 0 ? -pBuffer[i * 2 + 1] : pBuffer[i * 2 + 1];
+        absSumR += absR;
+        // Replacing the code with a bool clipped will prevent vetorizing
+        clippedR += absR > CSAMPLE_PEAK ? 1 : 0;
+    }
+
+    *pAbsL = absSumL;
+    *pAbsR = absSumR;
+    int clipping = 0;
+    if (clippedL > 0) {
+        clipping |= SampleKernels::kClippingLeft;
+    }
+    if (clippedR > 0) {
+        clipping |= SampleKernels::kClippingRight;
+    }
+    return clipping;
+}
+
+void convertS16ToFloat32(CSAMPLE* M_RESTRICT pDest,
+        const SAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    const CSAMPLE kConversionFactor = SAMPLE_MINIMUM * -1.0f;
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] = CSAMPLE(pSrc[i]) / kConversionFactor;
+    }
+}
+
+void interleaveBuffer(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc1,
+        const CSAMPLE* M_RESTRICT pSrc2,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+void deinterleaveBuffer(CSAMPLE* M_RESTRICT pDest1,
+        CSAMPLE* M_RESTRICT pDest2,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+void copyClampBuffer(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    // Don't use CSAMPLE_clamp(), see the note on inline functions above
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        const CSAMPLE sample = pSrc[i] < -CSAMPLE_PEAK ? -CSAMPLE_PEAK : pSrc[i];
+        pDest[i] = sample > CSAMPLE_PEAK ? CSAMPLE_PEAK : sample;
+    }
+}
+
+template<std::size_t... N>
+constexpr SampleKernels makeSampleKernels(SampleKernels::Level level,
+        const char* name,
+        std::index_sequence<N...>) {
+    return SampleKernels{
+            level,
+            name,
+            &copyWithGain,
+            &copyWithRampingGain,
+            &addWithRampingGain,
+            {&copyNWithGain<static_cast<int>(N)>...},
+            {&copyNWithRampingGain<static_cast<int>(N)>...},
+            &sumAbsPerChannel,
+            &convertS16ToFloat32,
+            &interleaveBuffer,
+            &deinterleaveBuffer,
+            &copyClampBuffer,
+    };
+}
+
+constexpr SampleKernels makeSampleKernels(SampleKernels::Level level, const char* name) {
+    return makeSampleKernels(level,
+            name,
+            std::make_index_sequence<SampleKernels::kMaxCopyChannels + 1>());
+}
+
+} // anonymous namespace
+
+} // namespace mixxx
@@ -1,6 +1,10 @@
 #include "waveform/waveform.h"
 
 #include <QtDebug>
+#include <QtEndian>
+#include <algorithm>
+#include <cstring>
+#include <limits>
 
 #include "analyzer/constants.h"
 #include "engine/engine.h"
@@ -8,6 +12,53 @@
 
 using namespace mixxx::track;
 
+namespace {
+
+// Layout of the compact format, all numbers are little endian:
+//
+//   0  magic
+//   4  quint16 format version
+//   6  quint16 StorageCompression
+//   8  quint32 number of samples
+//  12  quint32 number of samples per block
+//  16  double visual sample rate
+//  24  double audio visual ratio
+//  32  samples as stored in WaveformData, 4 bytes each
+//
+// If the samples are deflated, a table with the quint32 size of each block
+// precedes the blocks, each compressed by qCompress().
+//
+// The first byte of the magic is never the first byte of a qCompress()'ed
+// protobuf blob, which starts with the big endian size of the blob.
+const char kCompactMagic[] = {'\x89', 'M', 'W', 'F'};
+constexpr quint16 kCompactFormatVersion = 1;
+constexpr int kCompactHeaderSize = 32;
+constexpr int kCompactSamplesPerBlock = 16384;
+// Decompression speed matters more than the size
+constexpr int kCompactCompressionLevel = 1;
+
+template<typename T>
+void appendLittleEndian(QByteArray* pData, T value) {
+    char bytes[sizeof(T)];
+    qToLittleEndian(value, bytes);
+    pData->append(bytes, sizeof(T));
+}
+
+void appendLittleEndian(QByteArray* pData, double value) {
+    quint64 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    appendLittleEndian(pData, bits);
+}
+
+double readLittleEndianDouble(const char* pData) {
+    const quint64 bits = qFromLittleEndian<quint64>(pData);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // anonymous namespace
+
 // Return the smallest power of 2 which is greater than the desired size when
 // squared.
 int computeTextureStride(int size) {
@@ -132,11 +183,150 @@ QByteArray Waveform::toByteArray() const {
     return QByteArray(output.data(), static_cast<int>(output.length()));
 }
 
+// static
+bool Waveform::isCompactByteArray(const QByteArray& data) {
+    return data.size() >= kCompactHeaderSize &&
+            std::memcmp(data.constData(), kCompactMagic, sizeof(kCompactMagic)) == 0;
+}
+
+QByteArray Waveform::toCompactByteArray(StorageCompression compression) const {
+    const int dataSize = getDataSize();
+    const char* pSamples = reinterpret_cast<const char*>(m_data.data());
+
+    QByteArray output;
+    output.reserve(kCompactHeaderSize + dataSize * static_cast<int>(sizeof(WaveformData)));
+    output.append(kCompactMagic, sizeof(kCompactMagic));
+    appendLittleEndian(&output, kCompactFormatVersion);
+    appendLittleEndian(&output, static_cast<quint16>(compression));
+    appendLittleEndian(&output, static_cast<quint32>(dataSize));
+    appendLittleEndian(&output, static_cast<quint32>(kCompactSamplesPerBlock));
+    appendLittleEndian(&output, m_visualSampleRate);
+    appendLittleEndian(&output, m_audioVisualRatio);
+    DEBUG_ASSERT(output.size() == kCompactHeaderSize);
+
+    switch (compression) {
+    case StorageCompression::None:
+        output.append(pSamples, dataSize * static_cast<int>(sizeof(WaveformData)));
+        break;
+    case StorageCompression::Deflate: {
+        QList<QByteArray> blocks;
+        for (int i = 0; i < dataSize; i += kCompactSamplesPerBlock) {
+            const int blockSize = std::min(kCompactSamplesPerBlock, dataSize - i);
+            blocks.append(qCompress(
+                    reinterpret_cast<const uchar*>(pSamples + i * sizeof(WaveformData)),
+                    blockSize * static_cast<int>(sizeof(WaveformData)),
+                    kCompactCompressionLevel));
+        }
+        for (const auto& block : std::as_const(blocks)) {
+            appendLittleEndian(&output, static_cast<quint32>(block.size()));
+        }
+        for (const auto& block : std::as_const(blocks)) {
+            output.append(block);
+        }
+        break;
+    }
+    }
+
+    return output;
+}
+
+bool Waveform::readCompactByteArray(const QByteArray& data) {
+    DEBUG_ASSERT(isCompactByteArray(data));
+    const char* pData = data.constData();
+    const quint16 formatVersion = qFromLittleEndian<quint16>(pData + 4);
+    const quint16 compression = qFromLittleEndian<quint16>(pData + 6);
+    const quint32 dataSize = qFromLittleEndian<quint32>(pData + 8);
+    const quint32 samplesPerBlock = qFromLittleEndian<quint32>(pData + 12);
+    if (formatVersion != kCompactFormatVersion) {
+        qDebug() << "ERROR: Unsupported compact waveform format version"
+                 << formatVersion;
+        return false;
+    }
+    if (samplesPerBlock == 0 ||
+            dataSize > static_cast<quint32>(std::numeric_limits<int>::max()) /
+                            sizeof(WaveformData)) {
+        qDebug() << "ERROR: Invalid compact waveform of size" << dataSize;
+        return false;
+    }
+
+    // Validate the payload size before allocating anything
+    const qint64 payloadSize = data.size() - kCompactHeaderSize;
+    const qint64 expectedSize = static_cast<qint64>(dataSize) * sizeof(WaveformData);
+    const qint64 numBlocks = (static_cast<qint64>(dataSize) + samplesPerBlock - 1) /
+            samplesPerBlock;
+    const char* pPayload = pData + kCompactHeaderSize;
+    switch (static_cast<StorageCompression>(compression)) {
+    case StorageCompression::None:
+        if (payloadSize < expectedSize) {
+            qDebug() << "ERROR: Compact waveform is truncated:"
+                     << payloadSize << "<" << expectedSize;
+            return false;
+        }
+        break;
+    case StorageCompression::Deflate: {
+        qint64 compressedSize = numBlocks * sizeof(quint32);
+        if (payloadSize < compressedSize) {
+            qDebug() << "ERROR: Compact waveform block table is truncated";
+            return false;
+        }
+        for (qint64 i = 0; i < numBlocks; ++i) {
+            compressedSize += qFromLittleEndian<quint32>(pPayload + i * sizeof(quint32));
+        }
+        if (payloadSize < compressedSize) {
+            qDebug() << "ERROR: Compact waveform is truncated:"
+                     << payloadSize << "<" << compressedSize;
+            return false;
+        }
+        break;
+    }
+    default:
+        qDebug() << "ERROR: Unsupported compact waveform compression" << compression;
+        return false;
+    }
+
+    resize(static_cast<int>(dataSize));
+    char* pSamples = reinterpret_cast<char*>(m_data.data());
+    if (static_cast<StorageCompression>(compression) == StorageCompression::None) {
+        std::memcpy(pSamples, pPayload, expectedSize);
+    } else {
+        const char* pBlock = pPayload + numBlocks * sizeof(quint32);
+        for (qint64 i = 0; i < numBlocks; ++i) {
+            const int compressedBlockSize = static_cast<int>(
+                    qFromLittleEndian<quint32>(pPayload + i * sizeof(quint32)));
+            const qint64 offset = i * samplesPerBlock * sizeof(WaveformData);
+            const qint64 blockSize = std::min<qint64>(
+                    samplesPerBlock * sizeof(WaveformData), expectedSize - offset);
+            const QByteArray block = qUncompress(
+                    reinterpret_cast<const uchar*>(pBlock), compressedBlockSize);
+            if (block.size() != blockSize) {
+                qDebug() << "ERROR: Could not decompress compact waveform block" << i;
+                resize(0);
+                return false;
+            }
+            std::memcpy(pSamples + offset, block.constData(), blockSize);
+            pBlock += compressedBlockSize;
+        }
+    }
+
+    m_visualSampleRate = readLittleEndianDouble(pData + 16);
+    m_audioVisualRatio = readLittleEndianDouble(pData + 24);
+    m_completion = static_cast<int>(dataSize);
+    m_saveState = SaveState::Saved;
+    return true;
+}
+
 void Waveform::readByteArray(const QByteArray& data) {
     if (data.isNull()) {
         return;
     }
 
+    if (isCompactByteArray(data)) {
+        if (!readCompactByteArray(data)) {
+            m_saveState = SaveState::NotSaved;
+        }
+        return;
+    }
+
     io::Waveform waveform;
 
     if (!waveform.ParseFromArray(data.constData(), data.size())) {
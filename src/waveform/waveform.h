@@ -35,6 +35,13 @@ class Waveform {
         Saved
     };
 
+    enum class StorageCompression {
+        None = 0,
+        // The samples are deflated in independent blocks
+        Deflate = 1,
+    };
+
+    // Accepts both the protobuf and the compact format
     explicit Waveform(const QByteArray& pData = QByteArray());
     Waveform(
             int audioSampleRate,
@@ -74,7 +81,14 @@ class Waveform {
         m_description = description;
     }
 
+    // Serializes the waveform as protobuf message, see proto/waveform.proto
     QByteArray toByteArray() const;
+    // Serializes the waveform into a flat binary format with a fixed header
+    // that can be decoded from a memory-mapped file by copying the samples
+    // straight into the data array.
+    QByteArray toCompactByteArray(
+            StorageCompression compression = StorageCompression::None) const;
+    static bool isCompactByteArray(const QByteArray& data);
 
     SaveState saveState() const {
         return m_saveState;
@@ -132,6 +146,7 @@ class Waveform {
 
   private:
     void readByteArray(const QByteArray& data);
+    bool readCompactByteArray(const QByteArray& data);
     void resize(int size);
     void assign(int size, int value = 0);
 
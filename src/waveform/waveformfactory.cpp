@@ -20,6 +20,11 @@ WaveformFactory::VersionClass WaveformFactory::waveformVersionToVersionClass(con
         return VC_USE;
     }
 
+    if (version == WAVEFORM_5_VERSION) {
+        // use, AnalysisDao migrates it to the current version when loading
+        return VC_USE;
+    }
+
     if (version == WAVEFORM_4_VERSION) {
         // Used in Mixxx 1.12 beta, suffers Bug #7776
         return VC_REMOVE;
@@ -46,6 +51,11 @@ WaveformFactory::VersionClass WaveformFactory::waveformSummaryVersionToVersionCl
         return VC_USE;
     }
 
+    if (version == WAVEFORMSUMMARY_5_VERSION) {
+        // use, AnalysisDao migrates it to the current version when loading
+        return VC_USE;
+    }
+
     if (version == WAVEFORMSUMMARY_4_VERSION) {
         // Used in Mixxx 1.12 beta, suffers Bug #7776
         return VC_REMOVE;
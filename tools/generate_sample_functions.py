@@ -3,7 +3,7 @@ import argparse
 import sys
 
 # To use, run this from the top level of the Git repository tree:
-# scripts/generate_sample_functions.py
+# tools/generate_sample_functions.py
 #     --sample_autogen_h src/util/sample_autogen.h
 
 BASIC_INDENT = 4
@@ -43,20 +43,36 @@ def hanging_indent(base, groups, hanging_suffix, terminator, depth=0):
     )
 
 
+def write_array(output, declaration, elements, depth, per_line=8):
+    if len(elements) <= per_line:
+        output.append(
+            " " * (BASIC_INDENT * depth)
+            + declaration
+            + ", ".join(elements)
+            + "};"
+        )
+        return
+    output.append(" " * (BASIC_INDENT * depth) + declaration)
+    for i in range(0, len(elements), per_line):
+        output.append(
+            " " * (BASIC_INDENT * (depth + 2))
+            + ", ".join(elements[i : i + per_line])
+            + ","
+        )
+    output.append(" " * (BASIC_INDENT * depth) + "};")
+
+
 def write_sample_autogen(output, num_channels):
-    output.append("#ifndef MIXXX_UTIL_SAMPLEAUTOGEN_H")
-    output.append("#define MIXXX_UTIL_SAMPLEAUTOGEN_H")
+    output.append("#pragma once")
     output.append("////////////////////////////////////////////////////////")
     output.append("// THIS FILE IS AUTO-GENERATED. DO NOT EDIT DIRECTLY! //")
-    output.append("// SEE scripts/generate_sample_functions.py           //")
+    output.append("// SEE tools/generate_sample_functions.py             //")
     output.append("////////////////////////////////////////////////////////")
 
     for i in range(1, num_channels + 1):
         copy_with_gain(output, 0, i)
         copy_with_ramping_gain(output, 0, i)
 
-    output.append("#endif /* MIXXX_UTIL_SAMPLEAUTOGEN_H */")
-
 
 def copy_with_gain(output, base_indent_depth, num_channels):
     def write(data, depth=0):
@@ -105,15 +121,25 @@ def copy_with_gain(output, base_indent_depth, num_channels):
         write("return;", depth=2)
         write("}", depth=1)
 
-    write("// note: LOOP VECTORIZED.", depth=1)
-    write("for (int i = 0; i < iNumSamples; ++i) {", depth=1)
-    terms = [
-        "pSrc%(i)d[i] * gain%(i)d" % {"i": i} for i in range(num_channels)
-    ]
-    assign = "pDest[i] = "
-    output.extend(hanging_indent(assign, terms, " +", ";", depth=2))
-
-    write("}", depth=1)
+    # The loop is implemented by the runtime-dispatched SIMD kernels, see
+    # src/util/sample_kernels.h
+    write_array(
+        output,
+        "const CSAMPLE* const pSrc[] = {",
+        ["pSrc%(i)d" % {"i": i} for i in range(num_channels)],
+        base_indent_depth + 1,
+    )
+    write_array(
+        output,
+        "const CSAMPLE_GAIN gain[] = {",
+        ["gain%(i)d" % {"i": i} for i in range(num_channels)],
+        base_indent_depth + 1,
+    )
+    write(
+        "mixxx::sampleKernels().copyNWithGain[%(n)d]("
+        "pDest, pSrc, gain, iNumSamples);" % {"n": num_channels},
+        depth=1,
+    )
     write("}")
 
 
@@ -174,50 +200,31 @@ def copy_with_ramping_gain(output, base_indent_depth, num_channels):
         write("return;", depth=2)
         write("}", depth=1)
 
-    for i in range(num_channels):
-        write(
-            (
-                "const CSAMPLE_GAIN gain_delta%(i)d = "
-                "(gain%(i)dout - gain%(i)din) / (iNumSamples / 2);"
-            )
-            % {"i": i},
-            depth=1,
-        )
-        write(
-            (
-                "const CSAMPLE_GAIN start_gain%(i)d = "
-                "gain%(i)din + gain_delta%(i)d;"
-            )
-            % {"i": i},
-            depth=1,
-        )
-
-    write("// note: LOOP VECTORIZED.", depth=1)
-    write("for (int i = 0; i < iNumSamples / 2; ++i) {", depth=1)
-
-    for i in range(num_channels):
-        write(
-            (
-                "const CSAMPLE_GAIN gain%(i)d = "
-                "start_gain%(i)d + gain_delta%(i)d * i;"
-            )
-            % {"i": i},
-            depth=2,
-        )
-
-    terms1 = []
-    terms2 = []
-    for i in range(num_channels):
-        terms1.append("pSrc%(i)d[i * 2] * gain%(i)d" % {"i": i})
-        terms2.append("pSrc%(i)d[i * 2 + 1] * gain%(i)d" % {"i": i})
-
-    assign1 = "pDest[i * 2] = "
-    assign2 = "pDest[i * 2 + 1] = "
-
-    output.extend(hanging_indent(assign1, terms1, " +", ";", depth=2))
-    output.extend(hanging_indent(assign2, terms2, " +", ";", depth=2))
-
-    write("}", depth=1)
+    # The loop is implemented by the runtime-dispatched SIMD kernels, see
+    # src/util/sample_kernels.h
+    write_array(
+        output,
+        "const CSAMPLE* const pSrc[] = {",
+        ["pSrc%(i)d" % {"i": i} for i in range(num_channels)],
+        base_indent_depth + 1,
+    )
+    write_array(
+        output,
+        "const CSAMPLE_GAIN gainIn[] = {",
+        ["gain%(i)din" % {"i": i} for i in range(num_channels)],
+        base_indent_depth + 1,
+    )
+    write_array(
+        output,
+        "const CSAMPLE_GAIN gainOut[] = {",
+        ["gain%(i)dout" % {"i": i} for i in range(num_channels)],
+        base_indent_depth + 1,
+    )
+    write(
+        "mixxx::sampleKernels().copyNWithRampingGain[%(n)d]("
+        "pDest, pSrc, gainIn, gainOut, iNumSamples);" % {"n": num_channels},
+        depth=1,
+    )
     write("}")
 
 